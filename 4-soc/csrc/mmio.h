@@ -25,6 +25,19 @@
  *   +0x14: VGA_STREAM_DATA - 8 pixels packed in 32-bit word (auto-increment)
  *   +0x20: VGA_CTRL        - Display enable, blank, swap request, frame select
  *   +0x24-0x60: VGA_PALETTE[0-15] - 6-bit VGA colors (RRGGBB)
+ *   +0x68: VGA_SPRITE_KEY  - Transparent sprite and tile color index
+ *   +0x6C: VGA_TILE_CTRL   - [16] enable, [15:8] y, [7:0] x of map cell (0,0)
+ *   +0x70: VGA_SCROLL      - [13:8] y, [5:0] x framebuffer scroll (wraps)
+ *   +0x74: VGA_SCROLL_SPLIT - [5:0] first scrolled frame row (0 = all rows)
+ *   +0x80-0x9C: VGA_SPRITE_POS[0-7] - [16] enable, [15:8] y, [7:0] x
+ *   +0x100-0x1FC: VGA_SPRITE_DATA(n, row) - 8x8 sprite patterns, one packed
+ *                 word per row (write-only)
+ *   +0x200-0x5FC: VGA_TILE_DATA(t, row) - 3x3 tile patterns, one word per
+ *                 row, pixels in [3:0], [7:4], [11:8] (write-only)
+ *   +0x1000-0x1FFC: VGA_TILE_MAP(col, row) - 32x32 map of tile indices
+ *                   (write-only)
+ *   +0x8000-0xDFFF: VGA_FB_WORD(frame, n) - Framebuffer word n of a frame,
+ *                   8 pixels packed like STREAM_DATA (write-only, reads 0)
  *
  * Two access patterns are supported:
  *   1. Pointer-based (direct dereference): *VGA_CTRL = 0x01;
@@ -50,6 +63,21 @@
 #define VGA_CTRL ((volatile uint32_t *) (VGA_BASE + 0x20))        /* R/W */
 #define VGA_PALETTE_BASE (VGA_BASE + 0x24)
 #define VGA_PALETTE(n) ((volatile uint32_t *) (VGA_PALETTE_BASE + ((n) << 2)))
+#define VGA_SPRITE_KEY ((volatile uint32_t *) (VGA_BASE + 0x68)) /* R/W */
+#define VGA_SPRITE_POS(n) \
+    ((volatile uint32_t *) (VGA_BASE + 0x80 + ((n) << 2))) /* R/W */
+#define VGA_SPRITE_DATA(n, row) \
+    ((volatile uint32_t *) (VGA_BASE + 0x100 + ((n) << 5) + ((row) << 2))) /* WO */
+#define VGA_TILE_CTRL ((volatile uint32_t *) (VGA_BASE + 0x6C)) /* R/W */
+#define VGA_SCROLL ((volatile uint32_t *) (VGA_BASE + 0x70))       /* R/W */
+#define VGA_SCROLL_SPLIT ((volatile uint32_t *) (VGA_BASE + 0x74)) /* R/W */
+#define VGA_TILE_DATA(t, row) \
+    ((volatile uint32_t *) (VGA_BASE + 0x200 + ((t) << 4) + ((row) << 2))) /* WO */
+#define VGA_TILE_MAP(col, row) \
+    ((volatile uint32_t *) (VGA_BASE + 0x1000 + (((row) * VGA_TILE_MAP_SIZE + (col)) << 2))) /* WO */
+#define VGA_FB_BASE (VGA_BASE + 0x8000)
+#define VGA_FB_WORD(frame, n) \
+    ((volatile uint32_t *) (VGA_FB_BASE + (((frame) * VGA_WORDS_PER_FRAME + (n)) << 2))) /* WO */
 
 /* VGA framebuffer constants */
 #define VGA_FRAME_WIDTH 64
@@ -59,6 +87,13 @@
 #define VGA_WORDS_PER_FRAME (VGA_FRAME_SIZE / VGA_PIXELS_PER_WORD)
 #define VGA_NUM_FRAMES 12
 #define VGA_EXPECTED_ID 0x56474131u /* 'VGA1' */
+#define VGA_SPRITE_COUNT 8
+#define VGA_SPRITE_SIZE 8
+#define VGA_SPRITE_ENABLE (1u << 16)
+#define VGA_TILE_SIZE 3
+#define VGA_TILE_COUNT 64
+#define VGA_TILE_MAP_SIZE 32
+#define VGA_TILE_ENABLE (1u << 16)
 
 
 
@@ -90,12 +125,116 @@ static inline uint32_t vga_pack8_pixels(const uint8_t *pixels)
            ((uint32_t) (pixels[7] & 0xF) << 28);
 }
 
+/* SPRITE_POS value showing a sprite at (x, y); negative positions clip */
+static inline uint32_t vga_sprite_pos(int x, int y)
+{
+    return VGA_SPRITE_ENABLE | ((uint32_t) (y & 0xFF) << 8) |
+           (uint32_t) (x & 0xFF);
+}
+
+/* SCROLL value: scrolled rows show frame pixel (x + sx, y + sy) mod 64 */
+static inline uint32_t vga_scroll(int x, int y)
+{
+    return ((uint32_t) (y & 0x3F) << 8) | (uint32_t) (x & 0x3F);
+}
+
+/* TILE_CTRL value placing map cell (0, 0) at frame pixel (x, y) */
+static inline uint32_t vga_tile_origin(int x, int y)
+{
+    return VGA_TILE_ENABLE | ((uint32_t) (y & 0xFF) << 8) |
+           (uint32_t) (x & 0xFF);
+}
+
 
 /* Timer peripheral registers (base: 0x80000000) */
 #define TIMER_BASE 0x80000000u
 #define TIMER_LIMIT ((volatile uint32_t *) (TIMER_BASE + 0x04))   /* R/W */
 #define TIMER_ENABLED ((volatile uint32_t *) (TIMER_BASE + 0x08)) /* R/W */
 
+/**
+ * DMA controller registers (base: 0xA0000000)
+ *
+ * A second bus master that copies LEN words from SRC to DST while the CPU
+ * keeps running; the bus arbiter alternates between the two, so a long
+ * copy does not starve the CPU.
+ *
+ * Register Map:
+ *   +0x00: DMA_SRC        - Source address (advances by SRC_STRIDE per word)
+ *   +0x04: DMA_DST        - Destination address (advances by DST_STRIDE)
+ *   +0x08: DMA_LEN        - Words to copy; reads back the words left
+ *   +0x0C: DMA_SRC_STRIDE - Source increment in bytes (default 4)
+ *   +0x10: DMA_DST_STRIDE - Destination increment in bytes (default 4,
+ *                           0 for a single register such as VGA_STREAM_DATA)
+ *   +0x14: DMA_CTRL       - bit 0: start, bit 1: completion interrupt enable
+ *   +0x18: DMA_STATUS     - bit 0: busy, bit 1: done (write 1 to clear)
+ *
+ * Notes:
+ *   - Registers other than CTRL/STATUS are read-only while busy
+ *   - The completion interrupt is the machine external interrupt (mcause 11)
+ *   - Source and destination must not overlap
+ *   - The DMA bypasses the data cache: with --dcache, a store to the mailbox
+ *     page (e.g. DMA_CACHE_SYNC) writes back every dirty line before a copy
+ *     reads data the CPU wrote, and drops stale lines before the CPU reads
+ *     data the DMA wrote
+ */
+#define DMA_BASE 0xA0000000u
+#define DMA_SRC ((volatile uint32_t *) (DMA_BASE + 0x00))        /* R/W */
+#define DMA_DST ((volatile uint32_t *) (DMA_BASE + 0x04))        /* R/W */
+#define DMA_LEN ((volatile uint32_t *) (DMA_BASE + 0x08))        /* R/W */
+#define DMA_SRC_STRIDE ((volatile uint32_t *) (DMA_BASE + 0x0C)) /* R/W */
+#define DMA_DST_STRIDE ((volatile uint32_t *) (DMA_BASE + 0x10)) /* R/W */
+#define DMA_CTRL ((volatile uint32_t *) (DMA_BASE + 0x14))       /* R/W */
+#define DMA_STATUS ((volatile uint32_t *) (DMA_BASE + 0x18))     /* R/W1C */
+
+#define DMA_CTRL_START 0x1u
+#define DMA_CTRL_IE 0x2u
+#define DMA_STATUS_BUSY 0x1u
+#define DMA_STATUS_DONE 0x2u
+
+/* Unused mailbox word: storing to it only synchronizes the data cache */
+#define DMA_CACHE_SYNC ((volatile uint32_t *) (uintptr_t) 0x300)
+
+/* Start a copy of len words; returns without waiting for it to finish */
+static inline void dma_start(uint32_t src,
+                             uint32_t dst,
+                             uint32_t len,
+                             uint32_t src_stride,
+                             uint32_t dst_stride)
+{
+    *DMA_CACHE_SYNC = 0;
+    *DMA_SRC = src;
+    *DMA_DST = dst;
+    *DMA_LEN = len;
+    *DMA_SRC_STRIDE = src_stride;
+    *DMA_DST_STRIDE = dst_stride;
+    *DMA_CTRL = DMA_CTRL_START;
+}
+
+static inline int dma_busy(void)
+{
+    return (*DMA_STATUS & DMA_STATUS_BUSY) != 0;
+}
+
+static inline void dma_wait(void)
+{
+    while (dma_busy())
+        ;
+    *DMA_CACHE_SYNC = 0;
+}
+
+/**
+ * Data TCM (base: 0x60000000, 32 KiB by default)
+ *
+ * Single-cycle scratchpad next to the CPU's memory stage. Variables are
+ * placed there with TCM_DATA (initialized, copied in by init.S) or TCM_BSS
+ * (zeroed); link.lds puts the stack there when linked with TCM_STACK.
+ * Only the CPU sees the TCM; the host-call wrappers below copy TCM buffers
+ * through main memory, but DMA and raw hostcall() blocks must stay out of it.
+ */
+#define TCM_BASE 0x60000000u
+#define TCM_DATA __attribute__((section(".tcm.data")))
+#define TCM_BSS __attribute__((section(".tcm.bss")))
+
 /**
  * UART peripheral registers (base: 0x40000000)
  *
@@ -186,4 +325,177 @@ static inline uint32_t vga_pack8_pixels(const uint8_t *pixels)
 #define TEST_DONE_FLAG ((volatile uint32_t *) (uintptr_t) 0x100)
 #define TEST_RESULT ((volatile uint32_t *) (uintptr_t) 0x104)
 
+/**
+ * Host call (semihosting) channel (simulation only)
+ *
+ * The Verilator harness services a request block when its address is
+ * stored to HOSTCALL_DOORBELL. The whole call completes in that single bus
+ * write, so printing costs one store per call instead of one UART frame per
+ * character. Results are written back into the block before the next load.
+ *
+ * Operations:
+ *   HOSTCALL_OP_WRITE     - arg0 = fd (1/2), arg1 = buf, arg2 = len
+ *   HOSTCALL_OP_EXIT      - arg0 = exit code (0 = TEST PASSED)
+ *   HOSTCALL_OP_CYCLES    - ret/ret_hi = simulated CPU cycles
+ *   HOSTCALL_OP_READ_FILE - arg0 = path, arg1 = buf, arg2 = len,
+ *                           arg3 = offset; path is relative to --hostfs
+ *
+ * Usage:
+ *   host_puts("fib(20) done\n");
+ *   uint64_t t = host_cycles();
+ *   host_exit(errors);
+ */
+#define HOSTCALL_DOORBELL ((volatile uint32_t *) (uintptr_t) 0x200)
+
+#define HOSTCALL_OP_WRITE 1
+#define HOSTCALL_OP_EXIT 2
+#define HOSTCALL_OP_CYCLES 3
+#define HOSTCALL_OP_READ_FILE 4
+
+struct hostcall_block {
+    uint32_t op;
+    uint32_t arg[4];
+    int32_t ret;
+    uint32_t ret_hi;
+};
+
+static inline int32_t hostcall(struct hostcall_block *b)
+{
+    __asm__ volatile("" ::: "memory"); /* Block must be in RAM first */
+    *HOSTCALL_DOORBELL = (uint32_t) (uintptr_t) b;
+    __asm__ volatile("" ::: "memory"); /* Harness rewrote b->ret */
+    return b->ret;
+}
+
+/*
+ * The harness reads the block and its buffers through main memory and
+ * cannot see the data TCM, so the wrappers below keep the block in .bss
+ * rather than on a stack that TCM_STACK may have moved into the TCM, and
+ * copy TCM-resident buffers through `buf`. Not reentrant: do not issue
+ * host calls from interrupt handlers.
+ */
+#define HOSTCALL_BOUNCE 256
+#define HOSTCALL_PATH_MAX 256
+
+struct hostcall_area {
+    struct hostcall_block b;
+    char path[HOSTCALL_PATH_MAX];
+    char buf[HOSTCALL_BOUNCE];
+};
+
+static inline struct hostcall_area *hostcall_area(void)
+{
+    static struct hostcall_area area;
+    return &area;
+}
+
+static inline int hostcall_in_tcm(const void *p)
+{
+    return ((uintptr_t) p & 0xF0000000u) == TCM_BASE;
+}
+
+static inline int32_t hostcall_op(uint32_t op,
+                                  uint32_t a0,
+                                  uint32_t a1,
+                                  uint32_t a2,
+                                  uint32_t a3)
+{
+    struct hostcall_block *b = &hostcall_area()->b;
+    b->op = op;
+    b->arg[0] = a0;
+    b->arg[1] = a1;
+    b->arg[2] = a2;
+    b->arg[3] = a3;
+    b->ret = 0;
+    b->ret_hi = 0;
+    return hostcall(b);
+}
+
+static inline int32_t host_write(int fd, const void *buf, uint32_t len)
+{
+    const char *src = (const char *) buf;
+    if (!hostcall_in_tcm(src))
+        return hostcall_op(HOSTCALL_OP_WRITE, (uint32_t) fd,
+                           (uint32_t) (uintptr_t) src, len, 0);
+
+    char *bounce = hostcall_area()->buf;
+    int32_t done = 0;
+    while (len) {
+        uint32_t n = len < HOSTCALL_BOUNCE ? len : HOSTCALL_BOUNCE;
+        for (uint32_t i = 0; i < n; i++)
+            bounce[i] = src[i];
+        int32_t r = hostcall_op(HOSTCALL_OP_WRITE, (uint32_t) fd,
+                                (uint32_t) (uintptr_t) bounce, n, 0);
+        if (r < 0)
+            return done ? done : r;
+        done += r;
+        if ((uint32_t) r < n)
+            break;
+        src += n;
+        len -= n;
+    }
+    return done;
+}
+
+static inline int32_t host_puts(const char *s)
+{
+    uint32_t len = 0;
+    while (s[len])
+        len++;
+    return host_write(1, s, len);
+}
+
+static inline uint64_t host_cycles(void)
+{
+    hostcall_op(HOSTCALL_OP_CYCLES, 0, 0, 0, 0);
+    struct hostcall_block *b = &hostcall_area()->b;
+    return ((uint64_t) b->ret_hi << 32) | (uint32_t) b->ret;
+}
+
+static inline int32_t host_read_file(const char *path,
+                                     void *buf,
+                                     uint32_t len,
+                                     uint32_t offset)
+{
+    struct hostcall_area *area = hostcall_area();
+    if (hostcall_in_tcm(path)) {
+        uint32_t i = 0;
+        while ((area->path[i] = path[i]))
+            if (++i == HOSTCALL_PATH_MAX)
+                return -1;
+        path = area->path;
+    }
+
+    char *dst = (char *) buf;
+    if (!hostcall_in_tcm(dst))
+        return hostcall_op(HOSTCALL_OP_READ_FILE, (uint32_t) (uintptr_t) path,
+                           (uint32_t) (uintptr_t) dst, len, offset);
+
+    int32_t done = 0;
+    while (len) {
+        uint32_t n = len < HOSTCALL_BOUNCE ? len : HOSTCALL_BOUNCE;
+        int32_t r = hostcall_op(HOSTCALL_OP_READ_FILE,
+                                (uint32_t) (uintptr_t) path,
+                                (uint32_t) (uintptr_t) area->buf, n,
+                                offset + (uint32_t) done);
+        if (r < 0)
+            return done ? done : r;
+        for (int32_t i = 0; i < r; i++)
+            dst[i] = area->buf[i];
+        done += r;
+        if ((uint32_t) r < n)
+            break;
+        dst += r;
+        len -= n;
+    }
+    return done;
+}
+
+static inline void __attribute__((noreturn)) host_exit(int code)
+{
+    hostcall_op(HOSTCALL_OP_EXIT, (uint32_t) code, 0, 0, 0);
+    for (;;)
+        __asm__ volatile("wfi");
+}
+
 #endif /* MMIO_H */
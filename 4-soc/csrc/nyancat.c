@@ -99,15 +99,20 @@ extern const uint8_t nyancat_compressed_data[];
 //                      0x5Y=Skip*64(64-1024)
 void vga_upload_frame_delta(int frame_index)
 {
+#if USE_PREPACKED_FRAMES
+    // The previous frame's DMA copy still streams into UPLOAD_ADDR
+    dma_wait();
+#endif
+
     // Set upload address to start of frame
     vga_write32(VGA_ADDR_UPLOAD_ADDR,
                 ((uint32_t) (frame_index & 0xF) << 16) | 0);
 
 #if USE_PREPACKED_FRAMES
-    // Directly upload prepacked words for this frame (saves 8KB .bss)
-    for (int i = 0; i < WORDS_PER_FRAME; i++) {
-        vga_write32(VGA_ADDR_STREAM_DATA, nyancat_frames[frame_index][i]);
-    }
+    // Let the DMA stream the prepacked words (saves 8KB .bss); the CPU
+    // returns at once and the copy finishes in the background
+    dma_start((uint32_t) (uintptr_t) nyancat_frames[frame_index],
+              VGA_ADDR_STREAM_DATA, WORDS_PER_FRAME, 4, 0);
 #else
     // Runtime delta-RLE decompression (requires frame_buffer and
     // prev_frame_buffer)
@@ -276,6 +281,9 @@ int main(void)
     // Upload all frames (delta decompression) while keeping frame 0 displayed
     for (int frame = 0; frame < FRAME_COUNT; frame++)
         vga_upload_frame_delta(frame);
+#if USE_PREPACKED_FRAMES
+    dma_wait();
+#endif
 
     // Animate: cycle through frames infinitely
     for (uint32_t frame = 0;;) {
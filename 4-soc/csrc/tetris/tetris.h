@@ -7,7 +7,7 @@
 
 #define GRID_WIDTH 10
 #define GRID_HEIGHT 18
-#define BLOCK_SIZE 3
+#define BLOCK_SIZE 3 /* Grid cells are VGA tiles: must equal VGA_TILE_SIZE */
 
 #define GRID_OFFSET_X 2
 #define GRID_OFFSET_Y 5
@@ -22,6 +22,27 @@ static inline void cpu_sync(void)
 
 static uint8_t framebuffer[VGA_FRAME_SIZE];
 
+/* Packed words last written to VGA frame 0, so a swap rewrites only the
+ * words that changed through the framebuffer window */
+static uint32_t uploaded[VGA_WORDS_PER_FRAME];
+
+/* Grid cells are drawn by the VGA tile layer, whose map cell (0, 0) sits at
+ * the top-left grid cell: tile c is a solid block of color c. `cells` is the
+ * frame being drawn and `shown` the map as last written, so a swap writes
+ * one map word per changed cell. */
+#define TILE_EMPTY 0 /* Color 0 is the transparent key */
+#define TILE_GHOST 10
+
+static uint8_t cells[GRID_HEIGHT][GRID_WIDTH];
+static uint8_t shown[GRID_HEIGHT][GRID_WIDTH];
+
+static inline void cell_set(int x, int y, uint8_t tile)
+{
+    if (x >= 0 && x < GRID_WIDTH && y >= 0 && y < GRID_HEIGHT) {
+        cells[y][x] = tile;
+    }
+}
+
 static void fb_clear(void)
 {
     for (int i = 0; i < VGA_FRAME_SIZE; i++) {
@@ -130,10 +151,34 @@ void draw_init(void)
 
     fb_clear();
 
+    /* Tile patterns: empty, one solid block per color, the ghost outline */
+    for (int row = 0; row < BLOCK_SIZE; row++) {
+        *VGA_TILE_DATA(TILE_EMPTY, row) = 0;
+        for (uint32_t c = 1; c <= COLOR_WHITE; c++) {
+            *VGA_TILE_DATA(c, row) = c | (c << 4) | (c << 8);
+        }
+    }
+    *VGA_TILE_DATA(TILE_GHOST, 0) = COLOR_GRAY * 0x111;
+    *VGA_TILE_DATA(TILE_GHOST, 1) = COLOR_GRAY * 0x101;
+    *VGA_TILE_DATA(TILE_GHOST, 2) = COLOR_GRAY * 0x111;
+
+    for (int row = 0; row < VGA_TILE_MAP_SIZE; row++) {
+        for (int col = 0; col < VGA_TILE_MAP_SIZE; col++) {
+            *VGA_TILE_MAP(col, row) = TILE_EMPTY;
+        }
+    }
+    for (int y = 0; y < GRID_HEIGHT; y++) {
+        for (int x = 0; x < GRID_WIDTH; x++) {
+            cells[y][x] = shown[y][x] = TILE_EMPTY;
+        }
+    }
+    *VGA_SPRITE_KEY = COLOR_BLACK;
+    *VGA_TILE_CTRL = vga_tile_origin(GRID_OFFSET_X, GRID_OFFSET_Y);
+
     vga_write32(VGA_ADDR_UPLOAD_ADDR, 0);
-    for (int i = 0; i < 512; i++) {
-        vga_write32(VGA_ADDR_STREAM_DATA,
-                    vga_pack8_pixels(&framebuffer[i * 8]));
+    for (int i = 0; i < VGA_WORDS_PER_FRAME; i++) {
+        uploaded[i] = vga_pack8_pixels(&framebuffer[i * 8]);
+        vga_write32(VGA_ADDR_STREAM_DATA, uploaded[i]);
     }
 
     vga_write32(VGA_ADDR_CTRL, 0x01);
@@ -142,6 +187,11 @@ void draw_init(void)
 void draw_clear(void)
 {
     fb_clear();
+    for (int y = 0; y < GRID_HEIGHT; y++) {
+        for (int x = 0; x < GRID_WIDTH; x++) {
+            cells[y][x] = TILE_EMPTY;
+        }
+    }
 }
 
 void draw_border(void)
@@ -159,11 +209,7 @@ void draw_grid(const grid_t *g)
     for (int y = 0; y < GRID_HEIGHT; y++) {
         for (int x = 0; x < GRID_WIDTH; x++) {
             if (g->rows[y] & (1u << x)) {
-                int sx = GRID_OFFSET_X + x * BLOCK_SIZE;
-
-                int sy = GRID_OFFSET_Y + (GRID_HEIGHT - 1 - y) * BLOCK_SIZE;
-
-                fb_rect(sx, sy, BLOCK_SIZE, BLOCK_SIZE, g->colors[y][x]);
+                cells[y][x] = g->colors[y][x];
             }
         }
     }
@@ -186,26 +232,10 @@ void draw_block(const block_t *b)
     int gx3 = b->x + SHAPES[shape][rot][3][0];
     int gy3 = b->y + SHAPES[shape][rot][3][1];
 
-    if (gx0 >= 0 && gx0 < GRID_WIDTH && gy0 >= 0 && gy0 < GRID_HEIGHT) {
-        int sx = GRID_OFFSET_X + gx0 * BLOCK_SIZE;
-        int sy = GRID_OFFSET_Y + (GRID_HEIGHT - 1 - gy0) * BLOCK_SIZE;
-        fb_rect(sx, sy, BLOCK_SIZE, BLOCK_SIZE, b->color);
-    }
-    if (gx1 >= 0 && gx1 < GRID_WIDTH && gy1 >= 0 && gy1 < GRID_HEIGHT) {
-        int sx = GRID_OFFSET_X + gx1 * BLOCK_SIZE;
-        int sy = GRID_OFFSET_Y + (GRID_HEIGHT - 1 - gy1) * BLOCK_SIZE;
-        fb_rect(sx, sy, BLOCK_SIZE, BLOCK_SIZE, b->color);
-    }
-    if (gx2 >= 0 && gx2 < GRID_WIDTH && gy2 >= 0 && gy2 < GRID_HEIGHT) {
-        int sx = GRID_OFFSET_X + gx2 * BLOCK_SIZE;
-        int sy = GRID_OFFSET_Y + (GRID_HEIGHT - 1 - gy2) * BLOCK_SIZE;
-        fb_rect(sx, sy, BLOCK_SIZE, BLOCK_SIZE, b->color);
-    }
-    if (gx3 >= 0 && gx3 < GRID_WIDTH && gy3 >= 0 && gy3 < GRID_HEIGHT) {
-        int sx = GRID_OFFSET_X + gx3 * BLOCK_SIZE;
-        int sy = GRID_OFFSET_Y + (GRID_HEIGHT - 1 - gy3) * BLOCK_SIZE;
-        fb_rect(sx, sy, BLOCK_SIZE, BLOCK_SIZE, b->color);
-    }
+    cell_set(gx0, gy0, b->color);
+    cell_set(gx1, gy1, b->color);
+    cell_set(gx2, gy2, b->color);
+    cell_set(gx3, gy3, b->color);
 }
 
 void draw_ghost(const grid_t *g, const block_t *b)
@@ -234,26 +264,10 @@ void draw_ghost(const grid_t *g, const block_t *b)
     int gx3 = ghost.x + SHAPES[shape][rot][3][0];
     int gy3 = ghost.y + SHAPES[shape][rot][3][1];
 
-    if (gx0 >= 0 && gx0 < GRID_WIDTH && gy0 >= 0 && gy0 < GRID_HEIGHT) {
-        int sx = GRID_OFFSET_X + gx0 * BLOCK_SIZE;
-        int sy = GRID_OFFSET_Y + (GRID_HEIGHT - 1 - gy0) * BLOCK_SIZE;
-        fb_rect_outline(sx, sy, BLOCK_SIZE, BLOCK_SIZE, COLOR_GRAY);
-    }
-    if (gx1 >= 0 && gx1 < GRID_WIDTH && gy1 >= 0 && gy1 < GRID_HEIGHT) {
-        int sx = GRID_OFFSET_X + gx1 * BLOCK_SIZE;
-        int sy = GRID_OFFSET_Y + (GRID_HEIGHT - 1 - gy1) * BLOCK_SIZE;
-        fb_rect_outline(sx, sy, BLOCK_SIZE, BLOCK_SIZE, COLOR_GRAY);
-    }
-    if (gx2 >= 0 && gx2 < GRID_WIDTH && gy2 >= 0 && gy2 < GRID_HEIGHT) {
-        int sx = GRID_OFFSET_X + gx2 * BLOCK_SIZE;
-        int sy = GRID_OFFSET_Y + (GRID_HEIGHT - 1 - gy2) * BLOCK_SIZE;
-        fb_rect_outline(sx, sy, BLOCK_SIZE, BLOCK_SIZE, COLOR_GRAY);
-    }
-    if (gx3 >= 0 && gx3 < GRID_WIDTH && gy3 >= 0 && gy3 < GRID_HEIGHT) {
-        int sx = GRID_OFFSET_X + gx3 * BLOCK_SIZE;
-        int sy = GRID_OFFSET_Y + (GRID_HEIGHT - 1 - gy3) * BLOCK_SIZE;
-        fb_rect_outline(sx, sy, BLOCK_SIZE, BLOCK_SIZE, COLOR_GRAY);
-    }
+    cell_set(gx0, gy0, TILE_GHOST);
+    cell_set(gx1, gy1, TILE_GHOST);
+    cell_set(gx2, gy2, TILE_GHOST);
+    cell_set(gx3, gy3, TILE_GHOST);
 }
 
 /* Multiply by 3 using shift and add (avoids software multiply on RV32I) */
@@ -314,6 +328,18 @@ void draw_game_over(void)
         fb_pixel(26 + i, 28 + i, COLOR_RED);
         fb_pixel(26 + i, 35 - i, COLOR_RED);
     }
+
+    /* The tile layer covers the framebuffer: empty the cells under the box */
+    for (int y = 0; y < GRID_HEIGHT; y++) {
+        int sy = GRID_OFFSET_Y + (GRID_HEIGHT - 1 - y) * BLOCK_SIZE;
+        for (int x = 0; x < GRID_WIDTH; x++) {
+            int sx = GRID_OFFSET_X + x * BLOCK_SIZE;
+            if (sx + BLOCK_SIZE > 20 && sx < 44 && sy + BLOCK_SIZE > 25 &&
+                sy < 39) {
+                cells[y][x] = TILE_EMPTY;
+            }
+        }
+    }
 }
 
 void draw_swap_buffers(void)
@@ -323,11 +349,21 @@ void draw_swap_buffers(void)
         /* Spin until VBlank begins */
     }
 
-    vga_write32(VGA_ADDR_UPLOAD_ADDR, 0);
+    for (int i = 0; i < VGA_WORDS_PER_FRAME; i++) {
+        uint32_t word = vga_pack8_pixels(&framebuffer[i * 8]);
+        if (word != uploaded[i]) {
+            uploaded[i] = word;
+            *VGA_FB_WORD(0, i) = word;
+        }
+    }
 
-    for (int i = 0; i < 512; i++) {
-        vga_write32(VGA_ADDR_STREAM_DATA,
-                    vga_pack8_pixels(&framebuffer[i * 8]));
+    for (int y = 0; y < GRID_HEIGHT; y++) {
+        for (int x = 0; x < GRID_WIDTH; x++) {
+            if (cells[y][x] != shown[y][x]) {
+                shown[y][x] = cells[y][x];
+                *VGA_TILE_MAP(x, GRID_HEIGHT - 1 - y) = shown[y][x];
+            }
+        }
     }
 
     vga_write32(VGA_ADDR_CTRL, 0x01);
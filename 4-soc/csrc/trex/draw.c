@@ -73,47 +73,47 @@ static const uint8_t cactus_shape_mini[4] = {
     0b01100000  //  ##
 };
 
-void place_cactus(int x, int y, uint8_t color) {
-    for (int row = 0; row < 4; row++) {
-        for (int col = 0; col < 4; col++) {
-            // 注意：這裡只檢查前 4 個 bit (從左邊數過來)
-            if ((cactus_shape_mini[row] >> (7 - col)) & 1) {
-                int px = x + col;
-                int py = y + row;
-                if (px >= 0 && px < 64 && py >= 0 && py < 64) {
-                    vga_framebuffer[py * 64 + px] = color;
-                }
-            }
-        }
-    }
-}
-// 在畫布上畫出一隻恐龍
-void place_dino(int x, int y, uint8_t color,int body_picture ) {
-    for (int row = 0; row < 8; row++) {
+// 硬體 sprite 編號: 恐龍跑步 2 張、蹲下 2 張、仙人掌 1 張
+#define SPRITE_DINO_RUN  0
+#define SPRITE_DINO_DUCK 2
+#define SPRITE_CACTUS    4
+
+// 把 1-bit 圖案 (最高位元在左) 轉成 sprite 的 4-bit 像素列，其餘列透明
+static void sprite_load(int n, const uint8_t *shape, int height, uint8_t color)
+{
+    for (int row = 0; row < VGA_SPRITE_SIZE; row++) {
+        uint8_t pixels[8] = {0};
         for (int col = 0; col < 8; col++) {
-            if ((dino_shape[body_picture][row] >> (7 - col)) & 1) {
-                int px = x + col;
-                int py = y + row;
-                if (px >= 0 && px < 64 && py >= 0 && py < 64) {
-                    vga_framebuffer[py * 64 + px] = color;
-                }
-            }
+            if (row < height && ((shape[row] >> (7 - col)) & 1))
+                pixels[col] = color;
         }
+        *VGA_SPRITE_DATA(n, row) = vga_pack8_pixels(pixels);
     }
 }
 
-void place_dino_setdown(int x, int y, uint8_t color,int body_picture) {
-    for (int row = 0; row < 8; row++) {
-        for (int col = 0; col < 8; col++) {
-            if ((dino_shape_setdown[body_picture][row] >> (7 - col)) & 1) {
-                int px = x + col;
-                int py = y + row;
-                if (px >= 0 && px < 64 && py >= 0 && py < 64) {
-                    vga_framebuffer[py * 64 + px] = color;
-                }
-            }
-        }
+// 地平線以下的列 (HORIZON_Y..63) 由硬體捲動，上方不動
+#define HORIZON_Y 58
+
+// 地面往左捲一格後，只重畫從右邊進入畫面的那一欄: 一次 framebuffer word 寫入
+static void ground_column(int scroll_x, uint32_t *rand_state)
+{
+    int col = (scroll_x + 63) & 63;
+    int pixel = (HORIZON_Y + 1) * 64 + col;
+    my_rand(rand_state);
+    vga_framebuffer[pixel] = (*rand_state & 3) == 0 ? 2 : 0;  // 地上的小石子
+    *VGA_FB_WORD(0, pixel / 8) = vga_pack8_pixels(&vga_framebuffer[pixel & ~7]);
+}
+
+static void sprites_init(void)
+{
+    *VGA_SPRITE_KEY = 0;  // 背景色透明
+    for (int i = 0; i < 2; i++) {
+        sprite_load(SPRITE_DINO_RUN + i, dino_shape[i], 8, 1);
+        sprite_load(SPRITE_DINO_DUCK + i, dino_shape_setdown[i], 8, 1);
     }
+    sprite_load(SPRITE_CACTUS, cactus_shape_mini, 4, 1);
+    for (int i = 0; i < VGA_SPRITE_COUNT; i++)
+        *VGA_SPRITE_POS(i) = 0;
 }
 
 void place_die() {
@@ -136,12 +136,20 @@ static inline void delay(uint32_t cycles)
 }
 
 #define VGA_STAT_SAFE 0x01
+
+// 等到下一個 vblank 開始: 每個畫面更新一次，sprite 移動不會撕裂
+static void wait_vblank(void)
+{
+    while ((*VGA_STATUS) & VGA_STAT_SAFE);
+    while (!((*VGA_STATUS) & VGA_STAT_SAFE));
+}
+
 void run_trex(uint32_t shap) {
     int dino_x = 5;
     int dino_y = 50;      
     int y_velocity = 0;   
     int body_picture = 0;
-    int current_frame = 0;
+    int shown = SPRITE_DINO_RUN;
     const int GROUND_Y = 50; 
     const int JUMP_IMPULSE = -6; 
     const int GRAVITY = 1;      
@@ -149,6 +157,8 @@ void run_trex(uint32_t shap) {
     int cactus_x = 64; 
     const int cactus_y = 54; 
     uint32_t offset=0;
+    int scroll_x = 0;
+    uint32_t pebbles = shap;
     int score=0;
     char *score_msg = "score:";
     
@@ -176,26 +186,26 @@ void run_trex(uint32_t shap) {
             score+=1; 
             print_score(score);
         }
-        
-        draw_cleanup_buffers();
-        place_cactus(cactus_x, cactus_y, 1);
-        
+
+        int pose = (body_picture % 2);
         if(setdown_times>0){
-            place_dino_setdown(dino_x, dino_y, 1, (body_picture % 2));
+            pose += SPRITE_DINO_DUCK;
             setdown_times--;
         }else{
-            place_dino(dino_x, dino_y, 1, (body_picture % 2));
+            pose += SPRITE_DINO_RUN;
         }
-         
-
 
-        // VGA 上傳
-        *VGA_UPLOAD_ADDR = (current_frame << 16)|1792;
-        for (int i = 224; i < 464; i++) {
-            *VGA_STREAM_DATA = vga_pack8_pixels(&vga_framebuffer[i * 8]);
+        // 背景 (地平線) 不變，只移動 sprite: 每個畫面 2-3 次暫存器寫入
+        wait_vblank();
+        if (pose != shown) {
+            *VGA_SPRITE_POS(shown) = 0;
+            shown = pose;
         }
-        while (!((*VGA_STATUS) & VGA_STAT_SAFE));
-        *VGA_CTRL = (current_frame << 4) | 0x01;
+        *VGA_SPRITE_POS(pose) = vga_sprite_pos(dino_x, dino_y);
+        *VGA_SPRITE_POS(SPRITE_CACTUS) = vga_sprite_pos(cactus_x, cactus_y);
+        scroll_x = (scroll_x + 1) & 63;  // 地面和仙人掌一樣每格左移 1 像素
+        *VGA_SCROLL = vga_scroll(scroll_x, 0);
+        ground_column(scroll_x, &pebbles);
        
         body_picture++;
         
@@ -225,6 +235,8 @@ void print_score(int s) {
     *UART_SEND = '\n';
 }
 void draw_die(){
+    for (int i = 0; i < VGA_SPRITE_COUNT; i++)
+        *VGA_SPRITE_POS(i) = 0;
     draw_cleanup_buffers();
     place_die();
     draw_swap_buffers();
@@ -239,6 +251,8 @@ void draw_die(){
         *UART_SEND = msg[i];
     }
     while(!(*UART_STATUS & 0x02));
+    draw_cleanup_buffers();
+    draw_swap_buffers();
 }
 
 
@@ -249,13 +263,15 @@ void draw_init_buffers()
    for (int i = 0; i < 4096; i++) vga_framebuffer[i] = 0;
 
    
-    draw_horizon(2, 58); 
+    draw_horizon(2, HORIZON_Y); 
     for (int i = 0; i < 512; i++) {
         *VGA_STREAM_DATA = vga_pack8_pixels(&vga_framebuffer[i * 8]);
         
     }
-    
-    
+    sprites_init();
+    *VGA_SCROLL = 0;
+    *VGA_SCROLL_SPLIT = HORIZON_Y;
+    *VGA_CTRL = 0x01;
 }
 
 void draw_horizon(uint8_t color, int y_position) {
@@ -21,7 +21,4 @@ void handle_input(int *y, int *velocity, int ground_y, int jump_impulse,int *sit
 void my_rand(uint32_t *rand_state);
 void update_physics(int *y, int *velocity, int ground_y, int gravity);
 void run_trex(uint32_t shap);
-void place_dino(int x, int y, uint8_t color, int frame);
-void place_dino_setdown(int x, int y, uint8_t color, int frame);
-void place_cactus(int x, int y, uint8_t color);
 void print_score(int v);
@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT
+"""
+Batch RISCOF compliance on the Verilator model
+
+Runs every test ELF of an existing RISCOF work directory through one VTop
+binary in parallel (via the regression farm), writes each DUT signature next
+to its ELF, and compares it with the reference signature when RISCOF has
+produced one. The ELFs are loaded as they are; each test must be linked at
+the core's 0x1000 reset address and export begin_signature/end_signature.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+from typing import List, Optional
+
+
+def find_tests(work: Path) -> List[Path]:
+    """Every <test>/dut/*.elf under the work directory, sorted"""
+    return sorted(work.glob("**/dut/*.elf"))
+
+
+def reference_signature(elf: Path) -> Optional[Path]:
+    """The reference model's signature for a DUT ELF, if present"""
+    ref = elf.parent.parent / "ref"
+    sigs = sorted(ref.glob("*.signature")) if ref.is_dir() else []
+    return sigs[0] if sigs else None
+
+
+def read_words(path: Path) -> List[str]:
+    """Signature lines, lower-cased and without blanks"""
+    with open(path, "r") as f:
+        return [w.strip().lower() for w in f if w.strip()]
+
+
+def job_name(elf: Path, work: Path) -> str:
+    """Farm job name of a test: its directory relative to the work dir"""
+    return str(elf.parent.parent.relative_to(work)).replace(os.sep, "/")
+
+
+def quote(value) -> str:
+    """A manifest token that keeps spaces; the farm has no escape for quotes"""
+    text = str(value)
+    if '"' in text or "\n" in text:
+        raise ValueError(f"cannot put {text!r} in a farm manifest")
+    return f'"{text}"'
+
+
+def write_manifest(tests: List[Path], work: Path, args) -> str:
+    """One farm job per test; returns the manifest path"""
+    fd, path = tempfile.mkstemp(prefix="compliance-", suffix=".manifest")
+    try:
+        with os.fdopen(fd, "w") as f:
+            for elf in tests:
+                name = job_name(elf, work)
+                sig = elf.parent / args.sig_name
+                # A signature left by an earlier run must not score this one
+                sig.unlink(missing_ok=True)
+                # The farm splits args again, so the path is quoted inside it
+                sig_arg = quote(sig).replace('"', '\\"')
+                f.write(
+                    f"{quote(name)} {quote(elf)} "
+                    f'args="--headless --watchdog 0 --signature {sig_arg}" '
+                    f"max_cycles={args.max_cycles} "
+                    f"expect=done timeout={args.timeout}\n"
+                )
+    except ValueError:
+        os.unlink(path)
+        raise
+    return path
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("work", type=Path, help="RISCOF work directory")
+    parser.add_argument(
+        "-s",
+        "--sim",
+        default="verilog/verilator/obj_dir/VTop",
+        help="Verilator simulator binary (default: %(default)s)",
+    )
+    parser.add_argument(
+        "--farm",
+        default="verilog/verilator/farm",
+        help="Regression farm binary (default: %(default)s)",
+    )
+    parser.add_argument("-j", "--jobs", type=int, default=os.cpu_count() or 4)
+    parser.add_argument(
+        "--sig-name",
+        default="DUT-mycpu.signature",
+        help="Signature file written in each dut/ directory",
+    )
+    parser.add_argument("--max-cycles", type=int, default=10000000)
+    parser.add_argument("--timeout", type=int, default=120)
+    args = parser.parse_args()
+
+    tests = find_tests(args.work)
+    if not tests:
+        print(f"No dut/*.elf under {args.work}", file=sys.stderr)
+        return 1
+    print(f"Running {len(tests)} compliance tests with {args.jobs} jobs")
+
+    try:
+        manifest = write_manifest(tests, args.work, args)
+    except ValueError as e:
+        print(e, file=sys.stderr)
+        return 1
+    fd, report = tempfile.mkstemp(prefix="compliance-", suffix=".json")
+    os.close(fd)
+    try:
+        subprocess.run(
+            [args.farm, "-s", args.sim, "-m", manifest, "-j", str(args.jobs),
+             "--json", report],
+            check=False,
+        )
+        # Per-job farm status: a timeout or crash fails the test even if it
+        # wrote a (partial) signature
+        try:
+            with open(report, "r") as f:
+                status = {j["name"]: j for j in json.load(f)["jobs"]}
+        except (OSError, ValueError, KeyError):
+            status = {}
+    finally:
+        os.unlink(manifest)
+        os.unlink(report)
+
+    passed, failed, unchecked = 0, [], 0
+    for elf in tests:
+        name = job_name(elf, args.work)
+        sig = elf.parent / args.sig_name
+        ref = reference_signature(elf)
+        job = status.get(name)
+        if job is None:
+            failed.append(f"{name}: no farm result")
+        elif job["status"] != "pass":
+            failed.append(f"{name}: {job['status']} {job['message']}".rstrip())
+        elif not sig.exists():
+            failed.append(f"{name}: no signature")
+        elif ref is None:
+            unchecked += 1
+        elif read_words(sig) != read_words(ref):
+            failed.append(f"{name}: signature differs from {ref.name}")
+        else:
+            passed += 1
+
+    print(
+        f"\nCompliance: {passed} passed, {len(failed)} failed, "
+        f"{unchecked} without a reference signature"
+    )
+    for line in failed:
+        print(f"  FAIL {line}")
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
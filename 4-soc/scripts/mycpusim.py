@@ -0,0 +1,256 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT
+"""
+Python bindings for libmycpusim - drive the MyCPU SoC simulator in-process
+
+Example:
+    from mycpusim import MyCPUSim, EVENT_UART_TX
+
+    with MyCPUSim("csrc/shell.asmbin") as sim:
+        sim.run(2_000_000, EVENT_UART_TX)
+        sim.uart_send(b"help\\r")
+        sim.step(5_000_000)
+        print(sim.uart_recv().decode(errors="replace"))
+        print(hex(sim.pc), hex(sim.reg(10)), sim.csr(0xB00))
+
+`load()` and `reset()` start a fresh run on the same instance (cycle count,
+results, UART queues and output all restart; `load()` also clears memory).
+
+Build the library first with `make libmycpusim`. Set MYCPUSIM_LIB to use a
+library other than verilog/verilator/libmycpusim.so.
+"""
+
+import ctypes
+import os
+import sys
+from pathlib import Path
+from typing import Optional
+
+EVENT_NONE = 0
+EVENT_TEST_DONE = 1 << 0
+EVENT_HOST_EXIT = 1 << 1
+EVENT_INPUT_END = 1 << 2
+EVENT_FINISH = 1 << 3
+EVENT_FRAME = 1 << 5
+EVENT_UART_TX = 1 << 6
+
+RUNNING = 0
+PASSED = 1
+FAILED = 2
+
+FRAME_WIDTH = 640
+FRAME_HEIGHT = 480
+
+_DEFAULT_LIB = (
+    Path(__file__).resolve().parent.parent / "verilog" / "verilator" / "libmycpusim.so"
+)
+
+_lib = None
+
+
+def _load_library():
+    global _lib
+    if _lib is not None:
+        return _lib
+    path = os.environ.get("MYCPUSIM_LIB", str(_DEFAULT_LIB))
+    lib = ctypes.CDLL(path)
+
+    p = ctypes.c_void_p
+    u32, u64, sz = ctypes.c_uint32, ctypes.c_uint64, ctypes.c_size_t
+    cstr, buf = ctypes.c_char_p, ctypes.c_void_p
+    signatures = {
+        "mycpusim_create": (p, []),
+        "mycpusim_destroy": (None, [p]),
+        "mycpusim_last_error": (cstr, [p]),
+        "mycpusim_load": (ctypes.c_int, [p, cstr]),
+        "mycpusim_load_buffer": (ctypes.c_int, [p, buf, sz, u32]),
+        "mycpusim_set_mem_timing": (ctypes.c_int, [p, cstr]),
+        "mycpusim_set_hostfs": (None, [p, cstr]),
+        "mycpusim_set_input_script": (ctypes.c_int, [p, cstr]),
+        "mycpusim_set_uart_loopback": (None, [p, ctypes.c_int]),
+        "mycpusim_reset": (None, [p]),
+        "mycpusim_step": (u32, [p, u64]),
+        "mycpusim_run": (u32, [p, u64, u32]),
+        "mycpusim_cycles": (u64, [p]),
+        "mycpusim_status": (ctypes.c_int, [p, ctypes.POINTER(u32)]),
+        "mycpusim_pc": (u32, [p]),
+        "mycpusim_read_reg": (u32, [p, ctypes.c_uint]),
+        "mycpusim_read_csr": (u32, [p, ctypes.c_uint]),
+        "mycpusim_read_mem": (ctypes.c_int, [p, u32, ctypes.POINTER(u32)]),
+        "mycpusim_write_mem": (ctypes.c_int, [p, u32, u32]),
+        "mycpusim_read_bytes": (ctypes.c_int, [p, u32, buf, sz]),
+        "mycpusim_write_bytes": (ctypes.c_int, [p, u32, buf, sz]),
+        "mycpusim_uart_send": (None, [p, buf, sz]),
+        "mycpusim_uart_recv": (sz, [p, buf, sz]),
+        "mycpusim_frame_count": (u64, [p]),
+        "mycpusim_get_frame": (ctypes.c_int, [p, buf, sz]),
+    }
+    for name, (restype, argtypes) in signatures.items():
+        fn = getattr(lib, name)
+        fn.restype = restype
+        fn.argtypes = argtypes
+    _lib = lib
+    return lib
+
+
+class MyCPUSimError(RuntimeError):
+    pass
+
+
+class MyCPUSim:
+    """One SoC instance (VTop + memory + UART + host calls)"""
+
+    def __init__(self, binary: Optional[str] = None, mem_timing: Optional[str] = None,
+                 hostfs: Optional[str] = None, uart_loopback: bool = False):
+        self._lib = _load_library()
+        self._h = self._lib.mycpusim_create()
+        if not self._h:
+            raise MyCPUSimError("mycpusim_create failed")
+        if mem_timing:
+            self._check(self._lib.mycpusim_set_mem_timing(self._h, mem_timing.encode()))
+        if hostfs:
+            self._lib.mycpusim_set_hostfs(self._h, hostfs.encode())
+        self._lib.mycpusim_set_uart_loopback(self._h, int(uart_loopback))
+        if binary:
+            self.load(binary)
+
+    def _check(self, rc: int):
+        if rc != 0:
+            raise MyCPUSimError(self._lib.mycpusim_last_error(self._h).decode())
+
+    def close(self):
+        if self._h:
+            self._lib.mycpusim_destroy(self._h)
+            self._h = None
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+    def __del__(self):
+        self.close()
+
+    # Program loading
+    def load(self, path: str):
+        self._check(self._lib.mycpusim_load(self._h, str(path).encode()))
+        self.reset()
+
+    def load_bytes(self, data: bytes, base: int = 0x1000):
+        self._check(self._lib.mycpusim_load_buffer(self._h, data, len(data), base))
+        self.reset()
+
+    def set_input_script(self, path: str):
+        self._check(self._lib.mycpusim_set_input_script(self._h, str(path).encode()))
+
+    def reset(self):
+        self._lib.mycpusim_reset(self._h)
+
+    # Execution
+    def step(self, cycles: int) -> int:
+        """Run `cycles` CPU cycles; returns terminal events, if any"""
+        return self._lib.mycpusim_step(self._h, cycles)
+
+    def run(self, max_cycles: int, events: int = EVENT_NONE) -> int:
+        """Run until any event in `events` (or a terminal one) occurs"""
+        return self._lib.mycpusim_run(self._h, max_cycles, events)
+
+    @property
+    def cycles(self) -> int:
+        return self._lib.mycpusim_cycles(self._h)
+
+    @property
+    def status(self):
+        """(RUNNING|PASSED|FAILED, result word or exit code)"""
+        result = ctypes.c_uint32()
+        st = self._lib.mycpusim_status(self._h, ctypes.byref(result))
+        return st, result.value
+
+    # State
+    @property
+    def pc(self) -> int:
+        return self._lib.mycpusim_pc(self._h)
+
+    def reg(self, idx: int) -> int:
+        return self._lib.mycpusim_read_reg(self._h, idx)
+
+    def csr(self, addr: int) -> int:
+        return self._lib.mycpusim_read_csr(self._h, addr)
+
+    def read32(self, addr: int) -> int:
+        value = ctypes.c_uint32()
+        self._check(self._lib.mycpusim_read_mem(self._h, addr, ctypes.byref(value)))
+        return value.value
+
+    def write32(self, addr: int, value: int):
+        self._check(self._lib.mycpusim_write_mem(self._h, addr, value & 0xFFFFFFFF))
+
+    def read(self, addr: int, length: int) -> bytes:
+        buf = ctypes.create_string_buffer(length)
+        self._check(self._lib.mycpusim_read_bytes(self._h, addr, buf, length))
+        return buf.raw
+
+    def write(self, addr: int, data: bytes):
+        self._check(self._lib.mycpusim_write_bytes(self._h, addr, data, len(data)))
+
+    # UART
+    def uart_send(self, data: bytes):
+        self._lib.mycpusim_uart_send(self._h, data, len(data))
+
+    def uart_recv(self) -> bytes:
+        out = bytearray()
+        buf = ctypes.create_string_buffer(4096)
+        while True:
+            n = self._lib.mycpusim_uart_recv(self._h, buf, len(buf))
+            out += buf.raw[:n]
+            if n < len(buf):
+                return bytes(out)
+
+    # VGA
+    @property
+    def frame_count(self) -> int:
+        return self._lib.mycpusim_frame_count(self._h)
+
+    def frame(self) -> bytes:
+        """Last completed frame, FRAME_WIDTH x FRAME_HEIGHT RRGGBB bytes"""
+        size = FRAME_WIDTH * FRAME_HEIGHT
+        buf = ctypes.create_string_buffer(size)
+        self._check(self._lib.mycpusim_get_frame(self._h, buf, size))
+        return buf.raw
+
+
+def _run_once(sim: MyCPUSim, max_cycles: int):
+    ev = sim.run(max_cycles)
+    return ev, sim.cycles, sim.pc, sim.status, sim.uart_recv()
+
+
+def main():
+    """Minimal runner: python3 scripts/mycpusim.py <binary.asmbin> [cycles]
+
+    With --reuse the binary is loaded and run a second time on the same
+    instance, which must give the same result as the first run.
+    """
+    args = [a for a in sys.argv[1:] if a != "--reuse"]
+    reuse = len(args) != len(sys.argv) - 1
+    if not args:
+        print(f"Usage: {sys.argv[0]} [--reuse] <binary.asmbin> [max_cycles]")
+        return 1
+    max_cycles = int(args[1], 0) if len(args) > 1 else 250_000_000
+    with MyCPUSim(args[0], uart_loopback=True) as sim:
+        first = _run_once(sim, max_cycles)
+        ev, cycles, pc, (st, result), uart = first
+        sys.stdout.write(uart.decode(errors="replace"))
+        print(f"\nevents=0x{ev:x} cycles={cycles} pc=0x{pc:08x} "
+              f"status={['running', 'passed', 'failed'][st]} result=0x{result:x}")
+        if reuse:
+            sim.load(args[0])
+            if _run_once(sim, max_cycles) != first:
+                print("reuse: second run on the same instance differs")
+                return 1
+            print("reuse: second run matches")
+        return 0 if st != FAILED else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
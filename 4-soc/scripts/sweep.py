@@ -0,0 +1,270 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT
+"""
+Design-space sweep over elaboration-time SoC parameters
+
+For every combination of the given sizes, elaborates Top with that SoCConfig
+(VerilogGenerator --config), builds a Verilator model in its own directory,
+runs the fixed workload set (scripts/sweep.workloads) on it in parallel, and
+tabulates CPI, mhpmcounter3-15 and the host build/run time per configuration
+and workload:
+
+    python3 scripts/sweep.py --btb 16,32,64 --ras 4,8 --ibtb 8,16
+
+Run from the 4-soc directory. The table is also written as CSV
+(results/sweep.csv by default). Keys not swept keep their SoCConfig
+defaults; --mem also sets the harness memory size (--mem-size), and any
+I-cache or D-cache axis runs the workloads with that cache enabled (--icache,
+--dcache).
+"""
+
+import argparse
+import csv
+import itertools
+import os
+import re
+import shlex
+import subprocess
+import sys
+import time
+from concurrent.futures import ThreadPoolExecutor
+from pathlib import Path
+from typing import Dict, List, Optional
+
+SOC_DIR = Path(__file__).resolve().parent.parent
+HARNESS_DIR = SOC_DIR / "verilog" / "verilator"
+BUILD_ROOT = HARNESS_DIR / "sweep"
+
+# SoCConfig.parse() keys, in table order
+KEYS = [
+    "btb",
+    "ras",
+    "ibtb",
+    "icache",
+    "icache_ways",
+    "icache_line",
+    "dcache",
+    "dcache_ways",
+    "dcache_line",
+    "sb",
+    "tcm",
+    "mem",
+]
+ICACHE_KEYS = {"icache", "icache_ways", "icache_line"}
+DCACHE_KEYS = {"dcache", "dcache_ways", "dcache_line"}
+COUNTERS = ["mcycle", "minstret"] + [f"mhpmcounter{i}" for i in range(3, 16)]
+COUNTER_RE = re.compile(r"^\s+(mcycle|minstret|mhpmcounter\d+)\s+(\d+)")
+
+
+class Workload:
+    def __init__(self, name: str, binary: str, args: List[str], max_cycles: int):
+        self.name = name
+        self.binary = binary
+        self.args = args
+        self.max_cycles = max_cycles
+
+
+def read_workloads(path: Path) -> List[Workload]:
+    """Parse '<name> <binary> [args="..."] [max_cycles=N]' lines"""
+    workloads = []
+    with open(path, "r") as f:
+        for lineno, line in enumerate(f, 1):
+            if not line.strip() or line.lstrip().startswith("#"):
+                continue
+            fields = shlex.split(line)
+            if len(fields) < 2:
+                sys.exit(f"{path}:{lineno}: expected <name> <binary>")
+            args, max_cycles = [], 20000000
+            for kv in fields[2:]:
+                key, _, value = kv.partition("=")
+                if key == "args":
+                    args = value.split()
+                elif key == "max_cycles":
+                    max_cycles = int(value, 0)
+                else:
+                    sys.exit(f"{path}:{lineno}: unknown key '{key}'")
+            workloads.append(Workload(fields[0], fields[1], args, max_cycles))
+    return workloads
+
+
+def config_spec(config: Dict[str, int]) -> str:
+    return ",".join(f"{k}={config[k]}" for k in KEYS if k in config)
+
+
+def config_tag(config: Dict[str, int]) -> str:
+    return "-".join(f"{k}{config[k]}" for k in KEYS if k in config) or "default"
+
+
+def build(config: Dict[str, int]) -> Path:
+    """Elaborate and verilate one configuration; returns the VTop path"""
+    out = BUILD_ROOT / config_tag(config)
+    out.mkdir(parents=True, exist_ok=True)
+    generator = f"runMain board.verilator.VerilogGenerator --target-dir {out}"
+    if config:
+        generator += f" --config {config_spec(config)}"
+    subprocess.run(
+        ["sbt", "project soc", generator],
+        cwd=SOC_DIR.parent,
+        check=True,
+        stdout=subprocess.DEVNULL,
+    )
+    sdl_cflags = subprocess.check_output(["sdl2-config", "--cflags"], text=True).strip()
+    sdl_libs = subprocess.check_output(["sdl2-config", "--libs"], text=True).strip()
+    subprocess.run(
+        [
+            "verilator",
+            "--exe",
+            "--cc",
+            str(HARNESS_DIR / "sim.cpp"),
+            "Top.v",
+            "-CFLAGS",
+            f"{sdl_cflags} -pthread -I{HARNESS_DIR}",
+            "-LDFLAGS",
+            f"{sdl_libs} -pthread",
+        ],
+        cwd=out,
+        check=True,
+        stdout=subprocess.DEVNULL,
+    )
+    subprocess.run(
+        ["make", "-C", "obj_dir", "-f", "VTop.mk", f"-j{os.cpu_count() or 4}"],
+        cwd=out,
+        check=True,
+        stdout=subprocess.DEVNULL,
+    )
+    return out / "obj_dir" / "VTop"
+
+
+def run(
+    vtop: Path,
+    workload: Workload,
+    mem: Optional[int],
+    icache: bool,
+    dcache: bool,
+) -> Dict[str, object]:
+    """One workload on one model; counters parsed from --counters output"""
+    cmd = [
+        str(vtop),
+        "-i",
+        workload.binary,
+        "--headless",
+        "--watchdog",
+        "0",
+        "--counters",
+    ]
+    cmd += ["--max-cycles", str(workload.max_cycles)]
+    if mem is not None:
+        cmd += ["--mem-size", str(mem)]
+    if icache:
+        cmd.append("--icache")
+    if dcache:
+        cmd.append("--dcache")
+    cmd += workload.args
+    start = time.monotonic()
+    proc = subprocess.run(
+        cmd, cwd=SOC_DIR, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True
+    )
+    row: Dict[str, object] = {"run_s": round(time.monotonic() - start, 2)}
+    for line in proc.stdout.splitlines():
+        m = COUNTER_RE.match(line)
+        if m:
+            row[m.group(1)] = int(m.group(2))
+    if "mcycle" not in row:
+        row["error"] = f"exit {proc.returncode}, no counters"
+    elif row["minstret"]:
+        row["cpi"] = round(row["mcycle"] / row["minstret"], 4)
+    return row
+
+
+def int_list(text: str) -> List[int]:
+    return [int(v, 0) for v in text.split(",") if v]
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--btb", type=int_list, help="BTB entries, e.g. 16,32,64")
+    parser.add_argument("--ras", type=int_list, help="RAS depths")
+    parser.add_argument("--ibtb", type=int_list, help="IndirectBTB entries")
+    parser.add_argument("--icache", type=int_list, help="I-cache sizes in bytes")
+    parser.add_argument("--icache-ways", type=int_list, help="I-cache ways (1 or 2)")
+    parser.add_argument("--icache-line", type=int_list, help="I-cache line bytes")
+    parser.add_argument("--dcache", type=int_list, help="D-cache sizes in bytes")
+    parser.add_argument("--dcache-ways", type=int_list, help="D-cache ways (1 or 2)")
+    parser.add_argument("--dcache-line", type=int_list, help="D-cache line bytes")
+    parser.add_argument("--sb", type=int_list, help="Store buffer depths (0 = none)")
+    parser.add_argument("--tcm", type=int_list, help="Data TCM sizes in bytes")
+    parser.add_argument(
+        "--mem", type=int_list, help="Memory sizes in bytes (>= 4 MiB for csrc/)"
+    )
+    parser.add_argument(
+        "-w",
+        "--workloads",
+        type=Path,
+        default=SOC_DIR / "scripts" / "sweep.workloads",
+        help="Workload list (default: %(default)s)",
+    )
+    parser.add_argument("-j", "--jobs", type=int, default=os.cpu_count() or 4)
+    parser.add_argument("--csv", type=Path, default=SOC_DIR / "results" / "sweep.csv")
+    args = parser.parse_args()
+
+    axes = [(k, getattr(args, k)) for k in KEYS if getattr(args, k)]
+    configs = [
+        dict(zip([k for k, _ in axes], values))
+        for values in itertools.product(*[v for _, v in axes])
+    ]
+    workloads = read_workloads(args.workloads)
+    print(f"Sweeping {len(configs)} configurations x {len(workloads)} workloads")
+
+    rows = []
+    for config in configs:
+        tag = config_tag(config)
+        start = time.monotonic()
+        try:
+            vtop = build(config)
+        except subprocess.CalledProcessError as e:
+            print(f"  {tag}: build failed ({e.cmd[0]})", file=sys.stderr)
+            rows.append({"config": tag, "workload": "-", "error": "build failed"})
+            continue
+        build_s = round(time.monotonic() - start, 1)
+        print(f"  {tag}: built in {build_s}s")
+        icache = bool(ICACHE_KEYS & config.keys())
+        dcache = bool(DCACHE_KEYS & config.keys())
+        with ThreadPoolExecutor(max_workers=args.jobs) as pool:
+            results = pool.map(
+                lambda w: (w, run(vtop, w, config.get("mem"), icache, dcache)),
+                workloads,
+            )
+            for workload, row in results:
+                rows.append(
+                    {
+                        "config": tag,
+                        "workload": workload.name,
+                        "build_s": build_s,
+                        **row,
+                    }
+                )
+
+    columns = (
+        ["config", "workload", "cpi"] + COUNTERS[2:] + ["build_s", "run_s", "error"]
+    )
+    widths = {c: max(len(c), *(len(str(r.get(c, ""))) for r in rows)) for c in columns}
+    print()
+    print("  ".join(c.ljust(widths[c]) for c in columns).rstrip())
+    for r in rows:
+        print("  ".join(str(r.get(c, "")).ljust(widths[c]) for c in columns).rstrip())
+
+    args.csv.parent.mkdir(parents=True, exist_ok=True)
+    with open(args.csv, "w", newline="") as f:
+        writer = csv.DictWriter(
+            f,
+            fieldnames=columns[:2] + ["cpi"] + COUNTERS + columns[-3:],
+            extrasaction="ignore",
+        )
+        writer.writeheader()
+        writer.writerows(rows)
+    print(f"\nWritten to {args.csv}")
+    return 1 if any("error" in r for r in rows) else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -10,13 +10,18 @@ import bus.BusArbiter
 import bus.BusSwitch
 import chisel3._
 import chisel3.stage.ChiselStage
+import chisel3.util.Cat
+import peripheral.DMA
 import peripheral.DummySlave
 import peripheral.Uart
 import peripheral.VGA
 import riscv.core.CPU
+import riscv.core.ICacheRefillBundle
+import riscv.core.RetireBundle
 import riscv.Parameters
+import riscv.SoCConfig
 
-class Top extends Module {
+class Top(config: SoCConfig = SoCConfig()) extends Module {
   val io = IO(new Bundle {
     val signal_interrupt = Input(Bool())
 
@@ -25,6 +30,13 @@ class Top extends Module {
     val instruction         = Input(UInt(Parameters.InstructionWidth))
     val instruction_valid   = Input(Bool())
 
+    // Instruction cache (sim.cpp --icache); refills are served by the harness memory
+    val icache_enable = Input(Bool())
+    val icache_refill = new ICacheRefillBundle
+
+    // Data cache (sim.cpp --dcache); line transfers go through mem_slave
+    val dcache_enable = Input(Bool())
+
     val mem_slave = new AXI4LiteSlaveBundle(Parameters.AddrBits, Parameters.DataBits)
 
     // VGA peripheral outputs
@@ -45,6 +57,9 @@ class Top extends Module {
     val cpu_debug_read_data        = Output(UInt(Parameters.DataWidth))
     val cpu_csr_debug_read_address = Input(UInt(Parameters.CSRRegisterAddrWidth))
     val cpu_csr_debug_read_data    = Output(UInt(Parameters.DataWidth))
+
+    // Retirement trace for lockstep co-simulation (sim.cpp --cosim)
+    val retire = new RetireBundle
   })
 
   // AXI4-Lite memory model provided by Verilator C++ harness (sim.cpp)
@@ -57,15 +72,21 @@ class Top extends Module {
   // UART peripheral (115200 baud standard rate)
   val uart = Module(new Uart(frequency = 50000000, baudRate = 115200))
 
-  val cpu         = Module(new CPU)
+  // DMA controller: second bus master
+  val dma = Module(new DMA)
+
+  val cpu         = Module(new CPU(config = config))
   val dummy       = Module(new DummySlave)
   val bus_arbiter = Module(new BusArbiter)
-  val bus_switch  = Module(new BusSwitch)
+  val bus_switch  = Module(new BusSwitch(config.slaveDeviceCount))
 
   // Instruction fetch (external ROM in testbench)
   io.instruction_address   := cpu.io.instruction_address
   cpu.io.instruction       := io.instruction
   cpu.io.instruction_valid := io.instruction_valid
+  cpu.io.icache_enable     := io.icache_enable
+  cpu.io.dcache_enable     := io.dcache_enable
+  io.icache_refill <> cpu.io.icache_refill
 
   // Terminate unused memory_bundle inputs with explicit values
   // These signals are not used because memory access goes through AXI4-Lite channels,
@@ -78,17 +99,21 @@ class Top extends Module {
   cpu.io.memory_bundle.busy                := false.B
   cpu.io.memory_bundle.granted             := false.B
 
-  // Bus arbiter
-  bus_arbiter.io.bus_request(0) := true.B
+  // Bus arbiter: master 0 = CPU, master 1 = DMA
+  bus_arbiter.io.masters(0) <> cpu.io.axi4_channels
+  bus_arbiter.io.masters(1) <> dma.io.master
 
   // Bus switch
-  bus_switch.io.master <> cpu.io.axi4_channels
-  bus_switch.io.address := cpu.io.bus_address
+  bus_switch.io.master <> bus_arbiter.io.slave
   bus_switch.io.slaves(0) <> mem_slave.io.channels
   bus_switch.io.slaves(1) <> vga.io.channels
   bus_switch.io.slaves(2) <> uart.io.channels
-  for (i <- 3 until Parameters.SlaveDeviceCount) {
-    bus_switch.io.slaves(i) <> dummy.io.channels
+  for (i <- 3 until config.slaveDeviceCount) {
+    if (i == DMA.SlaveIndex) {
+      bus_switch.io.slaves(i) <> dma.io.channels
+    } else {
+      bus_switch.io.slaves(i) <> dummy.io.channels
+    }
   }
 
   // VGA connections
@@ -105,19 +130,32 @@ class Top extends Module {
   uart.io.rxd       := io.uart_rxd
   io.uart_interrupt := uart.io.signal_interrupt
 
-  // Interrupt
-  cpu.io.interrupt_flag := io.signal_interrupt
+  // Interrupts: bit 0 = timer (harness), bit 1 = DMA completion (external)
+  cpu.io.interrupt_flag := Cat(dma.io.signal_interrupt, io.signal_interrupt)
 
   // Debug interfaces
   cpu.io.debug_read_address     := io.cpu_debug_read_address
   io.cpu_debug_read_data        := cpu.io.debug_read_data
   cpu.io.csr_debug_read_address := io.cpu_csr_debug_read_address
   io.cpu_csr_debug_read_data    := cpu.io.csr_debug_read_data
+  io.retire                     := cpu.io.retire
 }
 
+/**
+ * Emit Top.v. Options (for the design-space sweep, scripts/sweep.py):
+ *   --config key=value,...  SoCConfig.parse() spec, e.g. "btb=64,ras=8"
+ *   --target-dir <dir>      output directory (default 4-soc/verilog/verilator)
+ */
 object VerilogGenerator extends App {
+  def option(name: String): Option[String] =
+    args.sliding(2).collectFirst { case Array(`name`, value) => value }
+
+  val config    = option("--config").map(SoCConfig.parse).getOrElse(SoCConfig())
+  val targetDir = option("--target-dir").getOrElse("4-soc/verilog/verilator")
+  println(s"Elaborating Top with ${config.tag}")
+
   (new ChiselStage).emitVerilog(
-    new Top(),
-    Array("--target-dir", "4-soc/verilog/verilator")
+    new Top(config),
+    Array("--target-dir", targetDir)
   )
 }
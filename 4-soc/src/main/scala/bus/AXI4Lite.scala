@@ -5,7 +5,6 @@
 package bus
 
 import chisel3._
-import chisel3.experimental.ChiselEnum
 import chisel3.util._
 import riscv.Parameters
 
@@ -21,6 +20,7 @@ import riscv.Parameters
  * - Fixed data width (32-bit in this implementation)
  * - Separate read and write channels (can operate independently)
  * - VALID/READY handshake on all channels
+ * - No transaction IDs: responses on each channel return in request order
  *
  * Channel Summary:
  * - Write Address (AW): Master provides write address
@@ -117,41 +117,36 @@ class AXI4LiteMasterBundle(addrWidth: Int, dataWidth: Int) extends Bundle {
   val read_data           = Output(UInt(dataWidth.W))
   val write_data          = Input(UInt(dataWidth.W))
   val write_strobe        = Input(Vec(Parameters.WordSize, Bool()))
-  val busy                = Output(Bool()) // if busy, master is not ready
-  val read_valid          = Output(Bool()) // read transaction complete
-  val write_valid         = Output(Bool()) // write transaction complete (BRESP received)
+  val granted             = Output(Bool()) // read/write request accepted this cycle
+  val busy                = Output(Bool()) // transactions in flight or a response pending
+  val read_valid          = Output(Bool()) // read transaction complete (in request order)
+  val write_valid         = Output(Bool()) // write transaction complete (BRESP received, in request order)
   val write_data_accepted = Output(Bool()) // write data accepted by slave (WREADY && WVALID)
 }
 
-object AXI4LiteStates extends ChiselEnum {
-  val Idle, ReadAddr, ReadData, WriteAddr, WriteData, WriteResp = Value
-}
-
+/**
+ * AXI4-Lite slave adapter for a device with a single AXI4LiteSlaveBundle port
+ *
+ * The device sees one access at a time: a read holds io.bundle.read until the
+ * device answers with read_valid, a write pulses io.bundle.write for one
+ * cycle. The channels are pipelined around that port:
+ * - A new read address is accepted in the cycle the previous read's data
+ *   is returned, so back-to-back reads reach the device one per cycle
+ * - A write is accepted with its address and data together, and BVALID is
+ *   raised in the cycle the device sees the write
+ * - Reads take the device port first when both channels have a request
+ */
 class AXI4LiteSlave(addrWidth: Int, dataWidth: Int) extends Module {
   val io = IO(new Bundle {
     val channels = Flipped(new AXI4LiteChannels(addrWidth, dataWidth))
     val bundle   = new AXI4LiteSlaveBundle(addrWidth, dataWidth)
   })
 
-  val state = RegInit(AXI4LiteStates.Idle)
-
-  val addr = RegInit(0.U(addrWidth.W)) // Fixed: was dataWidth, should be addrWidth
+  // Device port
+  val addr = RegInit(0.U(addrWidth.W))
   io.bundle.address := addr
-
-  // Read signals
   val read = RegInit(false.B)
   io.bundle.read := read
-  val read_data = RegInit(0.U(dataWidth.W))
-  io.channels.read_data_channel.RDATA := read_data
-
-  val ARREADY = RegInit(false.B)
-  io.channels.read_address_channel.ARREADY := ARREADY
-  val RVALID = RegInit(false.B)
-  io.channels.read_data_channel.RVALID := RVALID
-  val RRESP = RegInit(0.U(AXI4Lite.respWidth.W))
-  io.channels.read_data_channel.RRESP := RRESP
-
-  // Write signals
   val write = RegInit(false.B)
   io.bundle.write := write
   val write_data = RegInit(0.U(dataWidth.W))
@@ -159,209 +154,169 @@ class AXI4LiteSlave(addrWidth: Int, dataWidth: Int) extends Module {
   val write_strobe = RegInit(VecInit(Seq.fill(Parameters.WordSize)(false.B)))
   io.bundle.write_strobe := write_strobe
 
-  val AWREADY = RegInit(false.B)
-  io.channels.write_address_channel.AWREADY := AWREADY
-  val WREADY = RegInit(false.B)
-  io.channels.write_data_channel.WREADY := WREADY
+  // Response registers
+  val RVALID = RegInit(false.B)
+  io.channels.read_data_channel.RVALID := RVALID
+  val read_data = RegInit(0.U(dataWidth.W))
+  io.channels.read_data_channel.RDATA := read_data
+  io.channels.read_data_channel.RRESP := 0.U // OKAY response
   val BVALID = RegInit(false.B)
   io.channels.write_response_channel.BVALID := BVALID
-  val BRESP = WireInit(0.U(AXI4Lite.respWidth.W))
-  io.channels.write_response_channel.BRESP := BRESP
-
-  switch(state) {
-    is(AXI4LiteStates.Idle) {
-      read  := false.B
-      write := false.B
-
-      when(io.channels.read_address_channel.ARVALID) {
-        // Read request
-        state   := AXI4LiteStates.ReadAddr
-        ARREADY := true.B
-      }.elsewhen(io.channels.write_address_channel.AWVALID) {
-        // Write request
-        state   := AXI4LiteStates.WriteAddr
-        AWREADY := true.B
-      }
-    }
-
-    is(AXI4LiteStates.ReadAddr) {
-      when(io.channels.read_address_channel.ARVALID && ARREADY) {
-        // Capture address
-        addr    := io.channels.read_address_channel.ARADDR
-        ARREADY := false.B
-        read    := true.B
-        state   := AXI4LiteStates.ReadData
-      }
-    }
-
-    is(AXI4LiteStates.ReadData) {
-      when(io.bundle.read_valid) {
-        // Data ready from slave device
-        read_data := io.bundle.read_data
-        RVALID    := true.B
-        RRESP     := 0.U // OKAY response
-        read      := false.B
-      }
-
-      when(RVALID && io.channels.read_data_channel.RREADY) {
-        // Master acknowledged data
-        RVALID := false.B
-        state  := AXI4LiteStates.Idle
-      }
-    }
-
-    is(AXI4LiteStates.WriteAddr) {
-      when(io.channels.write_address_channel.AWVALID && AWREADY) {
-        // Capture write address
-        addr    := io.channels.write_address_channel.AWADDR
-        AWREADY := false.B
-        WREADY  := true.B
-        state   := AXI4LiteStates.WriteData
-      }
-    }
+  io.channels.write_response_channel.BRESP  := 0.U // OKAY response
+
+  // The device port is free next cycle unless a read is still waiting for its data
+  val r_free    = !RVALID || io.channels.read_data_channel.RREADY
+  val read_done = read && io.bundle.read_valid && r_free
+  val port_free = !read || read_done
+
+  // Read address: taken whenever the device port frees up
+  io.channels.read_address_channel.ARREADY := port_free
+  val read_start = io.channels.read_address_channel.ARVALID && port_free
+
+  // Write address and data: taken together, in a cycle without a new read
+  val write_ready =
+    port_free && !io.channels.read_address_channel.ARVALID &&
+      (!BVALID || io.channels.write_response_channel.BREADY)
+  io.channels.write_address_channel.AWREADY := write_ready && io.channels.write_data_channel.WVALID
+  io.channels.write_data_channel.WREADY     := write_ready && io.channels.write_address_channel.AWVALID
+  val write_start =
+    write_ready && io.channels.write_address_channel.AWVALID && io.channels.write_data_channel.WVALID
+
+  when(read_start) {
+    addr := io.channels.read_address_channel.ARADDR
+  }.elsewhen(write_start) {
+    addr         := io.channels.write_address_channel.AWADDR
+    write_data   := io.channels.write_data_channel.WDATA
+    write_strobe := VecInit(io.channels.write_data_channel.WSTRB.asBools)
+  }
+  read  := read_start || read && !read_done
+  write := write_start
+
+  when(read_done) {
+    // Data ready from slave device
+    read_data := io.bundle.read_data
+    RVALID    := true.B
+  }.elsewhen(io.channels.read_data_channel.RREADY) {
+    // Master acknowledged data
+    RVALID := false.B
+  }
 
-    is(AXI4LiteStates.WriteData) {
-      when(io.channels.write_data_channel.WVALID && WREADY) {
-        // Capture write data
-        write_data   := io.channels.write_data_channel.WDATA
-        write_strobe := VecInit(io.channels.write_data_channel.WSTRB.asBools)
-        WREADY       := false.B
-        write        := true.B
-        state        := AXI4LiteStates.WriteResp
-      }
-    }
+  when(write_start) {
+    BVALID := true.B
+  }.elsewhen(io.channels.write_response_channel.BREADY) {
+    // Master acknowledged write completion
+    BVALID := false.B
+  }
+}
 
-    is(AXI4LiteStates.WriteResp) {
-      write  := false.B
-      BVALID := true.B
-      BRESP  := 0.U // OKAY response
+object AXI4LiteMaster {
 
-      when(BVALID && io.channels.write_response_channel.BREADY) {
-        // Master acknowledged write completion
-        BVALID := false.B
-        state  := AXI4LiteStates.Idle
-      }
-    }
-  }
+  /** Transactions per channel that may be in flight at once */
+  val MaxOutstanding = 4
 }
 
-class AXI4LiteMaster(addrWidth: Int, dataWidth: Int) extends Module {
+/**
+ * AXI4-Lite master with independent, pipelined read and write channels
+ *
+ * Each channel accepts a new request (bundle.granted) while earlier ones are
+ * still in flight, up to maxOutstanding per channel, so back-to-back
+ * requests sustain one transfer per cycle. Address/data registers are
+ * loaded when a request is granted and ARVALID/AWVALID/WVALID rise in the
+ * next cycle; a request is granted once the previous address (and write
+ * data) handshake completes.
+ *
+ * RREADY and BREADY are always high. read_valid/write_valid pulse one
+ * cycle after each response, in request order per channel; reads and writes
+ * are not ordered against each other, so a requester that needs a read to
+ * see its own earlier write waits for write_valid first.
+ *
+ * @param maxOutstanding Transactions in flight per channel
+ */
+class AXI4LiteMaster(addrWidth: Int, dataWidth: Int, maxOutstanding: Int = AXI4LiteMaster.MaxOutstanding)
+    extends Module {
   val io = IO(new Bundle {
     val channels = new AXI4LiteChannels(addrWidth, dataWidth)
     val bundle   = new AXI4LiteMasterBundle(addrWidth, dataWidth)
   })
 
-  val state = RegInit(AXI4LiteStates.Idle)
-  io.bundle.busy := state =/= AXI4LiteStates.Idle
-
-  val addr = RegInit(0.U(addrWidth.W)) // Fixed: use addrWidth, not dataWidth
-  io.channels.read_address_channel.ARADDR  := addr
-  io.channels.write_address_channel.AWADDR := addr
+  // Read channel
+  val ARVALID = RegInit(false.B)
+  io.channels.read_address_channel.ARVALID := ARVALID
+  val read_addr = RegInit(0.U(addrWidth.W))
+  io.channels.read_address_channel.ARADDR := read_addr
+  io.channels.read_address_channel.ARPROT := 0.U
+  io.channels.read_data_channel.RREADY    := true.B
 
-  // Read signals
   val read_valid = RegInit(false.B)
   io.bundle.read_valid := read_valid
   val read_data = RegInit(0.U(dataWidth.W))
   io.bundle.read_data := read_data
+  val read_count = RegInit(0.U(log2Ceil(maxOutstanding + 1).W)) // granted, RDATA not yet received
 
-  val ARVALID = RegInit(false.B)
-  io.channels.read_address_channel.ARVALID := ARVALID
-  val RREADY = RegInit(false.B)
-  io.channels.read_data_channel.RREADY := RREADY
-
-  io.channels.read_address_channel.ARPROT := 0.U
-
-  // Write signals
-  val write_valid = RegInit(false.B)
-  io.bundle.write_valid := write_valid
-  val write_data = RegInit(0.U(dataWidth.W))
-  io.channels.write_data_channel.WDATA := write_data
-  val write_strobe = RegInit(VecInit(Seq.fill(Parameters.WordSize)(false.B)))
-  io.channels.write_data_channel.WSTRB := write_strobe.asUInt
-
+  // Write channel
   val AWVALID = RegInit(false.B)
   io.channels.write_address_channel.AWVALID := AWVALID
+  val write_addr = RegInit(0.U(addrWidth.W))
+  io.channels.write_address_channel.AWADDR := write_addr
+  io.channels.write_address_channel.AWPROT := 0.U
   val WVALID = RegInit(false.B)
   io.channels.write_data_channel.WVALID := WVALID
-  val BREADY = RegInit(false.B)
-  io.channels.write_response_channel.BREADY := BREADY
+  val write_data = RegInit(0.U(dataWidth.W))
+  io.channels.write_data_channel.WDATA := write_data
+  val write_strobe = RegInit(VecInit(Seq.fill(Parameters.WordSize)(false.B)))
+  io.channels.write_data_channel.WSTRB      := write_strobe.asUInt
+  io.channels.write_response_channel.BREADY := true.B
+
+  val write_valid = RegInit(false.B)
+  io.bundle.write_valid := write_valid
+  val write_count = RegInit(0.U(log2Ceil(maxOutstanding + 1).W)) // granted, BRESP not yet received
 
   // Posted-write optimization: Signal when write data is accepted (before BRESP)
   val write_data_accepted = RegInit(false.B)
   io.bundle.write_data_accepted := write_data_accepted
 
-  io.channels.write_address_channel.AWPROT := 0.U
+  val ar_free = !ARVALID || io.channels.read_address_channel.ARREADY
+  val aw_free = !AWVALID || io.channels.write_address_channel.AWREADY
+  val w_free  = !WVALID || io.channels.write_data_channel.WREADY
+  val r_fire  = io.channels.read_data_channel.RVALID
+  val b_fire  = io.channels.write_response_channel.BVALID
+
+  val read_grant =
+    io.bundle.read && !io.bundle.write && ar_free && (read_count =/= maxOutstanding.U || r_fire)
+  val write_grant =
+    io.bundle.write && aw_free && w_free && (write_count =/= maxOutstanding.U || b_fire)
+  io.bundle.granted := read_grant || write_grant
+  io.bundle.busy    := read_count =/= 0.U || write_count =/= 0.U || read_valid || write_valid
+
+  when(read_grant) {
+    read_addr := io.bundle.address
+    ARVALID   := true.B
+  }.elsewhen(io.channels.read_address_channel.ARREADY) {
+    ARVALID := false.B
+  }
 
-  // Performance optimization: Assert ARVALID/AWVALID in Idle to save 1 cycle
-  // per transaction. Both addr and ARVALID/AWVALID are registered, so they
-  // update synchronously on the same clock edge - no address capture race.
-  // The CPU already latches bus_address_reg, so BusSwitch routing is stable.
-  switch(state) {
-    is(AXI4LiteStates.Idle) {
-      read_valid          := false.B
-      write_valid         := false.B
-      write_data_accepted := false.B
-
-      when(io.bundle.read && !io.bundle.write) {
-        // Start read transaction - assert ARVALID immediately (saves 1 cycle)
-        addr    := io.bundle.address
-        ARVALID := true.B
-        RREADY  := true.B
-        state   := AXI4LiteStates.ReadData
-      }.elsewhen(io.bundle.write) {
-        // Start write transaction - assert AWVALID/WVALID immediately (saves 1 cycle)
-        addr         := io.bundle.address
-        write_data   := io.bundle.write_data
-        write_strobe := io.bundle.write_strobe
-        AWVALID      := true.B
-        WVALID       := true.B
-        state        := AXI4LiteStates.WriteData
-      }
+  when(write_grant) {
+    write_addr   := io.bundle.address
+    write_data   := io.bundle.write_data
+    write_strobe := io.bundle.write_strobe
+    AWVALID      := true.B
+    WVALID       := true.B
+  }.otherwise {
+    when(io.channels.write_address_channel.AWREADY) {
+      AWVALID := false.B
     }
-
-    is(AXI4LiteStates.ReadData) {
-      // Deassert ARVALID after address handshake completes
-      when(ARVALID && io.channels.read_address_channel.ARREADY) {
-        ARVALID := false.B
-      }
-
-      when(io.channels.read_data_channel.RVALID && RREADY) {
-        // Data received from slave
-        read_data  := io.channels.read_data_channel.RDATA
-        RREADY     := false.B
-        read_valid := true.B
-        state      := AXI4LiteStates.Idle
-      }
+    when(io.channels.write_data_channel.WREADY) {
+      WVALID := false.B
     }
+  }
 
-    is(AXI4LiteStates.WriteData) {
-      // Deassert AWVALID after address handshake completes
-      when(AWVALID && io.channels.write_address_channel.AWREADY) {
-        AWVALID := false.B
-      }
-
-      when(WVALID && io.channels.write_data_channel.WREADY) {
-        // Data accepted by slave - signal for posted-write optimization
-        WVALID              := false.B
-        BREADY              := true.B
-        write_data_accepted := true.B // Pipeline can proceed before BRESP
-        state               := AXI4LiteStates.WriteResp
-      }
-    }
+  read_count  := read_count + read_grant.asUInt - r_fire.asUInt
+  write_count := write_count + write_grant.asUInt - b_fire.asUInt
 
-    is(AXI4LiteStates.WriteResp) {
-      // Fix AXI4-Lite protocol: ensure AWVALID is cleared after address handshake
-      // If WREADY arrived before AWREADY in WriteData, AWVALID may still be high
-      when(AWVALID && io.channels.write_address_channel.AWREADY) {
-        AWVALID := false.B
-      }
-
-      when(io.channels.write_response_channel.BVALID && BREADY) {
-        // Write acknowledged
-        BREADY      := false.B
-        write_valid := true.B
-        state       := AXI4LiteStates.Idle
-      }
-    }
+  read_valid          := r_fire
+  write_valid         := b_fire
+  write_data_accepted := WVALID && io.channels.write_data_channel.WREADY
+  when(r_fire) {
+    read_data := io.channels.read_data_channel.RDATA
   }
 }
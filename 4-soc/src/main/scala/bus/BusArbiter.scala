@@ -5,43 +5,113 @@
 package bus
 
 import chisel3._
+import chisel3.util._
 import riscv.Parameters
 
 /**
- * Bus arbiter for multi-master AXI4-Lite bus access.
+ * Bus arbiter: shares one AXI4-Lite port (the BusSwitch) between several
+ * masters (master 0 = CPU, master 1 = DMA).
  *
- * NOTE: This module is currently unused in 4-soc as the system operates with
- * a single bus master (CPU). It exists as infrastructure for future multi-master
- * configurations (e.g., DMA controller, debug interface, or additional cores).
+ * The read (AR/R) and write (AW/W/B) channels are arbitrated independently,
+ * so the CPU can fetch data while the DMA writes and vice versa. Each channel
+ * has an owner, the master of its in-flight transactions, and a count of
+ * them; responses (R, B) are returned to the owner.
  *
- * Implementation: Static priority arbitration where higher-numbered masters have
- * higher priority. Master 0 (CPU) is lowest priority, which would allow DMA or
- * debug access to preempt normal CPU bus transactions when needed.
+ * Arbitration:
+ *   AXI4-Lite has no transaction IDs, so only the owner may add transactions
+ *   while some are in flight. When the channel is idle, the next owner is the
+ *   first requesting master after the previous owner (round-robin).
  *
- * To enable multi-master operation:
- *   1. Set Parameters.MasterDeviceCount > 1
- *   2. Instantiate BusArbiter in Top.scala
- *   3. Connect arbiter between masters and BusSwitch
- *   4. Gate master bus signals through bus_granted
+ *   The owner keeps pipelining requests only while no other master is
+ *   waiting; once one is, the owner's in-flight transactions drain and the
+ *   waiting master goes next. A master therefore waits for at most one
+ *   transaction per other master, so a DMA transfer cannot starve the CPU.
+ *
+ *   A write's W beat follows AW to the same master: while a master's AW is
+ *   being forwarded, W comes from that master, afterwards from the owner.
+ *
+ * @param masterDeviceCount Number of masters
+ * @param maxOutstanding    Transactions in flight per channel
  */
-class BusArbiter extends Module {
+class BusArbiter(
+    masterDeviceCount: Int = Parameters.MasterDeviceCount,
+    maxOutstanding: Int = AXI4LiteMaster.MaxOutstanding
+) extends Module {
+  require(masterDeviceCount >= 1, "BusArbiter needs at least one master")
+  val masterDeviceCountBits = log2Up(masterDeviceCount)
+
   val io = IO(new Bundle {
-    val bus_request     = Input(Vec(Parameters.MasterDeviceCount, Bool()))
-    val bus_granted     = Output(Vec(Parameters.MasterDeviceCount, Bool()))
-    val ctrl_stall_flag = Output(Bool())
+    val masters = Vec(masterDeviceCount, Flipped(new AXI4LiteChannels(Parameters.AddrBits, Parameters.DataBits)))
+    val slave   = new AXI4LiteChannels(Parameters.AddrBits, Parameters.DataBits)
   })
 
-  val granted = Wire(UInt())
-  // Static Priority Arbitration
-  // Higher number = Higher priority
-  granted := 0.U
-  for (i <- 0 until Parameters.MasterDeviceCount) {
-    when(io.bus_request(i.U)) {
-      granted := i.U
-    }
+  // First requesting master after `last`, wrapping around
+  def next_of(valid: UInt, last: UInt): UInt = {
+    val after = valid & VecInit((0 until masterDeviceCount).map(i => i.U > last)).asUInt
+    Mux(after.orR, PriorityEncoder(after), PriorityEncoder(valid))
+  }
+
+  // In-flight transactions per channel: owner and count
+  val read_owner  = RegInit(0.U(masterDeviceCountBits.W))
+  val read_count  = RegInit(0.U(log2Ceil(maxOutstanding + 1).W))
+  val write_owner = RegInit(0.U(masterDeviceCountBits.W))
+  val write_count = RegInit(0.U(log2Ceil(maxOutstanding + 1).W))
+
+  // Read address
+  val ar_valid   = VecInit(io.masters.map(_.read_address_channel.ARVALID)).asUInt
+  val ar_index   = Mux(read_count === 0.U, next_of(ar_valid, read_owner), read_owner)
+  val r_sel      = UIntToOH(read_owner, masterDeviceCount)
+  val ar_waiting = (ar_valid & ~r_sel).orR
+  val ar_open    = read_count === 0.U || !ar_waiting && read_count =/= maxOutstanding.U
+  val ar_sel     = Mux(ar_open, UIntToOH(ar_index, masterDeviceCount), 0.U) & ar_valid
+
+  // Write address and data
+  val aw_valid   = VecInit(io.masters.map(_.write_address_channel.AWVALID)).asUInt
+  val aw_index   = Mux(write_count === 0.U, next_of(aw_valid, write_owner), write_owner)
+  val b_sel      = UIntToOH(write_owner, masterDeviceCount)
+  val aw_waiting = (aw_valid & ~b_sel).orR
+  val aw_open    = write_count === 0.U || !aw_waiting && write_count =/= maxOutstanding.U
+  val aw_sel     = Mux(aw_open, UIntToOH(aw_index, masterDeviceCount), 0.U) & aw_valid
+  val w_sel      = Mux(aw_sel.orR, aw_sel, b_sel)
+
+  // Drive the slave port from the selected master (an all-zero select yields 0)
+  io.slave.write_address_channel.AWVALID := aw_sel.orR
+  io.slave.write_address_channel.AWADDR  := Mux1H(aw_sel, io.masters.map(_.write_address_channel.AWADDR))
+  io.slave.write_address_channel.AWPROT  := Mux1H(aw_sel, io.masters.map(_.write_address_channel.AWPROT))
+  io.slave.write_data_channel.WVALID     := Mux1H(w_sel, io.masters.map(_.write_data_channel.WVALID))
+  io.slave.write_data_channel.WDATA      := Mux1H(w_sel, io.masters.map(_.write_data_channel.WDATA))
+  io.slave.write_data_channel.WSTRB      := Mux1H(w_sel, io.masters.map(_.write_data_channel.WSTRB))
+  io.slave.write_response_channel.BREADY := Mux1H(b_sel, io.masters.map(_.write_response_channel.BREADY))
+
+  io.slave.read_address_channel.ARVALID := ar_sel.orR
+  io.slave.read_address_channel.ARADDR  := Mux1H(ar_sel, io.masters.map(_.read_address_channel.ARADDR))
+  io.slave.read_address_channel.ARPROT  := Mux1H(ar_sel, io.masters.map(_.read_address_channel.ARPROT))
+  io.slave.read_data_channel.RREADY     := Mux1H(r_sel, io.masters.map(_.read_data_channel.RREADY))
+
+  // Only the selected master sees READY handshakes and responses
+  for (i <- 0 until masterDeviceCount) {
+    io.masters(i).write_address_channel.AWREADY := io.slave.write_address_channel.AWREADY && aw_sel(i)
+    io.masters(i).write_data_channel.WREADY     := io.slave.write_data_channel.WREADY && w_sel(i)
+    io.masters(i).write_response_channel.BVALID := io.slave.write_response_channel.BVALID && b_sel(i)
+    io.masters(i).write_response_channel.BRESP  := io.slave.write_response_channel.BRESP
+
+    io.masters(i).read_address_channel.ARREADY := io.slave.read_address_channel.ARREADY && ar_sel(i)
+    io.masters(i).read_data_channel.RVALID     := io.slave.read_data_channel.RVALID && r_sel(i)
+    io.masters(i).read_data_channel.RDATA      := io.slave.read_data_channel.RDATA
+    io.masters(i).read_data_channel.RRESP      := io.slave.read_data_channel.RRESP
+  }
+
+  // Track in-flight transactions
+  val ar_fire = io.slave.read_address_channel.ARVALID && io.slave.read_address_channel.ARREADY
+  val r_fire  = io.slave.read_data_channel.RVALID && io.slave.read_data_channel.RREADY
+  val aw_fire = io.slave.write_address_channel.AWVALID && io.slave.write_address_channel.AWREADY
+  val b_fire  = io.slave.write_response_channel.BVALID && io.slave.write_response_channel.BREADY
+  when(ar_fire) {
+    read_owner := ar_index
   }
-  for (i <- 0 until Parameters.MasterDeviceCount) {
-    io.bus_granted(i.U) := i.U === granted
+  when(aw_fire) {
+    write_owner := aw_index
   }
-  io.ctrl_stall_flag := !io.bus_granted(0.U)
+  read_count  := read_count + ar_fire.asUInt - r_fire.asUInt
+  write_count := write_count + aw_fire.asUInt - b_fire.asUInt
 }
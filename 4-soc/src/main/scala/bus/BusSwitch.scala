@@ -11,7 +11,7 @@ import riscv.Parameters
 /**
  * AXI4-Lite Bus Switch (Address Decoder)
  *
- * Routes AXI4-Lite transactions from a single master to multiple slaves
+ * Routes AXI4-Lite transactions from the BusArbiter to multiple slaves
  * based on address decoding. Uses upper address bits [31:29] for routing,
  * supporting up to 8 slave devices.
  *
@@ -21,94 +21,115 @@ import riscv.Parameters
  *   Slave 2: 0x4000_0000 - 0x5FFF_FFFF (UART Controller)
  *   Slave 3: 0x6000_0000 - 0x7FFF_FFFF (Reserved/DummySlave)
  *   Slave 4: 0x8000_0000 - 0x9FFF_FFFF (Reserved/DummySlave)
- *   Slave 5: 0xA000_0000 - 0xBFFF_FFFF (Reserved/DummySlave)
+ *   Slave 5: 0xA000_0000 - 0xBFFF_FFFF (DMA Controller)
  *   Slave 6: 0xC000_0000 - 0xDFFF_FFFF (Reserved/DummySlave)
  *   Slave 7: 0xE000_0000 - 0xFFFF_FFFF (Reserved/DummySlave)
  *
- * CRITICAL: Address Stability Requirement
- *   The io.address input MUST be stable for the duration of each AXI transaction.
- *   This switch uses combinational decode - if the address changes mid-transaction,
- *   routing will glitch and corrupt the transfer.
+ *   The map above is the default slaveDeviceCount = 8; N slaves decode the top
+ *   log2(N) address bits instead.
  *
- *   The CPU wrapper (CPU.scala) handles this by latching bus_address_reg when a
- *   new transaction starts and holding it while the AXI master is busy.
+ * Routing:
+ *   Read transactions are routed by ARADDR and write transactions by AWADDR,
+ *   so the read and write channels switch independently of each other. Each
+ *   channel remembers the slave of its in-flight transactions and how many
+ *   there are; responses (R, B) are returned from that slave.
+ *
+ *   AXI4-Lite has no transaction IDs, so responses must come back in request
+ *   order. A new address is therefore only forwarded while the channel is
+ *   idle or its in-flight transactions target the same slave. Back-to-back
+ *   requests to one slave pipeline at one per cycle; switching slaves waits
+ *   for the outstanding responses to drain.
+ *
+ *   A write's W beat follows AW to the same slave: while AWVALID is high it
+ *   goes where AW goes, afterwards to the slave of the last accepted AW.
  *
  * Design Features:
- *   - Combinational one-hot decode: Zero-cycle latency for address routing
+ *   - Combinational one-hot decode of ARADDR/AWADDR
  *   - VALID gating: Only selected slave sees VALID assertions
  *   - Mux1H response: Fast one-hot multiplexer for slave responses
  *   - DummySlave support: Unmapped regions respond with DECERR (no deadlock)
+ *
+ * @param slaveDeviceCount Number of slave regions (power of 2)
+ * @param maxOutstanding   Transactions in flight per channel
  */
-class BusSwitch extends Module {
+class BusSwitch(
+    slaveDeviceCount: Int = Parameters.SlaveDeviceCount,
+    maxOutstanding: Int = AXI4LiteMaster.MaxOutstanding
+) extends Module {
+  val slaveDeviceCountBits = log2Up(slaveDeviceCount)
+
   val io = IO(new Bundle {
-    val address = Input(UInt(Parameters.AddrWidth))
-    val slaves  = Vec(Parameters.SlaveDeviceCount, new AXI4LiteChannels(Parameters.AddrBits, Parameters.DataBits))
-    val master  = Flipped(new AXI4LiteChannels(Parameters.AddrBits, Parameters.DataBits))
+    val slaves = Vec(slaveDeviceCount, new AXI4LiteChannels(Parameters.AddrBits, Parameters.DataBits))
+    val master = Flipped(new AXI4LiteChannels(Parameters.AddrBits, Parameters.DataBits))
   })
 
-  val index = io.address(Parameters.AddrBits - 1, Parameters.AddrBits - Parameters.SlaveDeviceCountBits)
-  val sel   = UIntToOH(index, Parameters.SlaveDeviceCount)
-
-  // Latched slave selection for response channels (hardening fix).
-  // This ensures stable response routing even if io.address changes mid-transaction.
-  // Without this, a timing race could cause RDATA/BRESP to be muxed from wrong slave.
-  val read_sel  = RegInit(0.U(Parameters.SlaveDeviceCount.W))
-  val write_sel = RegInit(0.U(Parameters.SlaveDeviceCount.W))
-
-  // Latch read selection when ARVALID is asserted (start of read transaction).
-  // Priority: New transaction latching takes precedence over clearing to handle
-  // back-to-back transactions where completion and new start occur same cycle.
-  when(io.master.read_address_channel.ARVALID) {
-    read_sel := sel
-  }.elsewhen(io.master.read_data_channel.RVALID && io.master.read_data_channel.RREADY) {
-    read_sel := 0.U
-  }
+  def index_of(address: UInt) = address(Parameters.AddrBits - 1, Parameters.AddrBits - slaveDeviceCountBits)
 
-  // Latch write selection when AWVALID or WVALID is asserted (start of write transaction).
-  // Priority: New transaction latching takes precedence over clearing.
-  when(io.master.write_address_channel.AWVALID || io.master.write_data_channel.WVALID) {
-    write_sel := sel
-  }.elsewhen(io.master.write_response_channel.BVALID && io.master.write_response_channel.BREADY) {
-    write_sel := 0.U
-  }
+  // In-flight transactions per channel: target slave and count
+  val read_target  = RegInit(0.U(slaveDeviceCountBits.W))
+  val read_count   = RegInit(0.U(log2Ceil(maxOutstanding + 1).W))
+  val write_target = RegInit(0.U(slaveDeviceCountBits.W))
+  val write_count  = RegInit(0.U(log2Ceil(maxOutstanding + 1).W))
 
-  // Drive slaves: only the selected slave sees VALID/READY handshakes.
-  // Use combinational sel for address/data phases, latched sel for response phases.
-  for (i <- 0 until Parameters.SlaveDeviceCount) {
-    val hit = sel(i)
+  // Read address: forwarded while it cannot reorder responses
+  val ar_index = index_of(io.master.read_address_channel.ARADDR)
+  val ar_open  = read_count === 0.U || read_target === ar_index && read_count =/= maxOutstanding.U
+  val ar_sel   = Mux(ar_open, UIntToOH(ar_index, slaveDeviceCount), 0.U)
+  val r_sel    = UIntToOH(read_target, slaveDeviceCount)
 
-    // Write address channel: combinational sel (transaction start)
-    io.slaves(i).write_address_channel.AWVALID := io.master.write_address_channel.AWVALID && hit
+  // Write address and data
+  val aw_index = index_of(io.master.write_address_channel.AWADDR)
+  val aw_open  = write_count === 0.U || write_target === aw_index && write_count =/= maxOutstanding.U
+  val aw_sel   = Mux(aw_open, UIntToOH(aw_index, slaveDeviceCount), 0.U)
+  val b_sel    = UIntToOH(write_target, slaveDeviceCount)
+  val w_sel    = Mux(io.master.write_address_channel.AWVALID, aw_sel, b_sel)
+
+  // Drive slaves: only the selected slave sees VALID/READY handshakes.
+  for (i <- 0 until slaveDeviceCount) {
+    // Write address channel
+    io.slaves(i).write_address_channel.AWVALID := io.master.write_address_channel.AWVALID && aw_sel(i)
     io.slaves(i).write_address_channel.AWADDR  := io.master.write_address_channel.AWADDR
     io.slaves(i).write_address_channel.AWPROT  := io.master.write_address_channel.AWPROT
 
-    // Write data channel: combinational sel (transaction start)
-    io.slaves(i).write_data_channel.WVALID := io.master.write_data_channel.WVALID && hit
+    // Write data channel
+    io.slaves(i).write_data_channel.WVALID := io.master.write_data_channel.WVALID && w_sel(i)
     io.slaves(i).write_data_channel.WDATA  := io.master.write_data_channel.WDATA
     io.slaves(i).write_data_channel.WSTRB  := io.master.write_data_channel.WSTRB
 
-    // Write response channel: latched sel (response phase)
-    io.slaves(i).write_response_channel.BREADY := io.master.write_response_channel.BREADY && write_sel(i)
+    // Write response channel: in-flight target
+    io.slaves(i).write_response_channel.BREADY := io.master.write_response_channel.BREADY && b_sel(i)
 
-    // Read address channel: combinational sel (transaction start)
-    io.slaves(i).read_address_channel.ARVALID := io.master.read_address_channel.ARVALID && hit
+    // Read address channel
+    io.slaves(i).read_address_channel.ARVALID := io.master.read_address_channel.ARVALID && ar_sel(i)
     io.slaves(i).read_address_channel.ARADDR  := io.master.read_address_channel.ARADDR
     io.slaves(i).read_address_channel.ARPROT  := io.master.read_address_channel.ARPROT
 
-    // Read data channel: latched sel (response phase)
-    io.slaves(i).read_data_channel.RREADY := io.master.read_data_channel.RREADY && read_sel(i)
+    // Read data channel: in-flight target
+    io.slaves(i).read_data_channel.RREADY := io.master.read_data_channel.RREADY && r_sel(i)
   }
 
-  // Multiplex slave responses back to the master
-  // Use combinational sel for address handshake (AWREADY, ARREADY)
-  // Use latched sel for response muxing (BVALID/BRESP, RVALID/RDATA/RRESP)
-  io.master.write_address_channel.AWREADY := Mux1H(sel, io.slaves.map(_.write_address_channel.AWREADY))
-  io.master.write_data_channel.WREADY     := Mux1H(sel, io.slaves.map(_.write_data_channel.WREADY))
-  io.master.write_response_channel.BVALID := Mux1H(write_sel, io.slaves.map(_.write_response_channel.BVALID))
-  io.master.write_response_channel.BRESP  := Mux1H(write_sel, io.slaves.map(_.write_response_channel.BRESP))
-
-  io.master.read_address_channel.ARREADY := Mux1H(sel, io.slaves.map(_.read_address_channel.ARREADY))
-  io.master.read_data_channel.RVALID     := Mux1H(read_sel, io.slaves.map(_.read_data_channel.RVALID))
-  io.master.read_data_channel.RDATA      := Mux1H(read_sel, io.slaves.map(_.read_data_channel.RDATA))
-  io.master.read_data_channel.RRESP      := Mux1H(read_sel, io.slaves.map(_.read_data_channel.RRESP))
+  // Multiplex slave responses back to the master (an all-zero select yields 0)
+  io.master.write_address_channel.AWREADY := Mux1H(aw_sel, io.slaves.map(_.write_address_channel.AWREADY))
+  io.master.write_data_channel.WREADY     := Mux1H(w_sel, io.slaves.map(_.write_data_channel.WREADY))
+  io.master.write_response_channel.BVALID := Mux1H(b_sel, io.slaves.map(_.write_response_channel.BVALID))
+  io.master.write_response_channel.BRESP  := Mux1H(b_sel, io.slaves.map(_.write_response_channel.BRESP))
+
+  io.master.read_address_channel.ARREADY := Mux1H(ar_sel, io.slaves.map(_.read_address_channel.ARREADY))
+  io.master.read_data_channel.RVALID     := Mux1H(r_sel, io.slaves.map(_.read_data_channel.RVALID))
+  io.master.read_data_channel.RDATA      := Mux1H(r_sel, io.slaves.map(_.read_data_channel.RDATA))
+  io.master.read_data_channel.RRESP      := Mux1H(r_sel, io.slaves.map(_.read_data_channel.RRESP))
+
+  // Track in-flight transactions
+  val ar_fire = io.master.read_address_channel.ARVALID && io.master.read_address_channel.ARREADY
+  val r_fire  = io.master.read_data_channel.RVALID && io.master.read_data_channel.RREADY
+  val aw_fire = io.master.write_address_channel.AWVALID && io.master.write_address_channel.AWREADY
+  val b_fire  = io.master.write_response_channel.BVALID && io.master.write_response_channel.BREADY
+  when(ar_fire) {
+    read_target := ar_index
+  }
+  when(aw_fire) {
+    write_target := aw_index
+  }
+  read_count  := read_count + ar_fire.asUInt - r_fire.asUInt
+  write_count := write_count + aw_fire.asUInt - b_fire.asUInt
 }
@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: MIT
+// MyCPU is freely redistributable under the MIT License. See the file
+// "LICENSE" for information on usage and redistribution of this file.
+
+package peripheral
+
+import bus.AXI4LiteChannels
+import bus.AXI4LiteMaster
+import bus.AXI4LiteSlave
+import chisel3._
+import chisel3.util._
+import riscv.Parameters
+
+object DMA {
+
+  /** Bus slave region of the register window (0xA0000000 with 8 regions) */
+  val SlaveIndex = 5
+
+  /** Words read ahead of the destination writes */
+  val BufferDepth = AXI4LiteMaster.MaxOutstanding
+}
+
+/**
+ * DMA controller: copies words between bus addresses as a second bus master
+ * (behind BusArbiter), so the CPU keeps running during a transfer
+ *
+ * Memory map (Base: 0xA0000000):
+ *   0x00: SRC        - Source address; advances by SRC_STRIDE per word read
+ *   0x04: DST        - Destination address; advances by DST_STRIDE per word written
+ *   0x08: LEN        - Words to copy; reads back the words not yet written
+ *   0x0C: SRC_STRIDE - Bytes added to SRC per word (default 4)
+ *   0x10: DST_STRIDE - Bytes added to DST per word (default 4; 0 = one register,
+ *                      e.g. VGA STREAM_DATA)
+ *   0x14: CTRL       - [0] start (write 1), [1] completion interrupt enable
+ *   0x18: STATUS     - [0] busy, [1] done (W1C)
+ *
+ * Operation:
+ *   Addresses and strides are word aligned (bits [1:0] ignored). Reads run up
+ *   to BufferDepth words ahead of the writes; a buffered word is written
+ *   before the next read is requested, so source and destination transfers
+ *   overlap on the independent read and write channels. done is set once the
+ *   last write response has returned; signal_interrupt is high while done and
+ *   the interrupt enable are set.
+ *
+ *   SRC/DST/LEN/strides and start are ignored while busy. The copy goes
+ *   straight to the bus: the source and destination must not overlap, and
+ *   main memory data in the DCache must be written back first (any store to
+ *   the mailbox page below 0x1000 writes back the whole cache).
+ */
+class DMA extends Module {
+  val io = IO(new Bundle {
+    val channels         = Flipped(new AXI4LiteChannels(8, Parameters.DataBits)) // Registers
+    val master           = new AXI4LiteChannels(Parameters.AddrBits, Parameters.DataBits)
+    val signal_interrupt = Output(Bool())
+  })
+
+  // ============ MMIO Register Offsets ============
+  object Reg {
+    val SRC        = 0x00
+    val DST        = 0x04
+    val LEN        = 0x08
+    val SRC_STRIDE = 0x0c
+    val DST_STRIDE = 0x10
+    val CTRL       = 0x14
+    val STATUS     = 0x18
+  }
+
+  val slave = Module(new AXI4LiteSlave(8, Parameters.DataBits))
+  slave.io.channels <> io.channels
+  val axi_master = Module(new AXI4LiteMaster(Parameters.AddrBits, Parameters.DataBits))
+  io.master <> axi_master.io.channels
+
+  def aligned(value: UInt) = Cat(value(Parameters.DataBits - 1, 2), 0.U(2.W))
+
+  // Transfer registers
+  val src        = RegInit(0.U(Parameters.AddrWidth))
+  val dst        = RegInit(0.U(Parameters.AddrWidth))
+  val len        = RegInit(0.U(Parameters.DataWidth)) // Words not yet written
+  val src_stride = RegInit(4.U(Parameters.DataWidth))
+  val dst_stride = RegInit(4.U(Parameters.DataWidth))
+  val ie         = RegInit(false.B)
+  val busy       = RegInit(false.B)
+  val done       = RegInit(false.B)
+  val reads_left = RegInit(0.U(Parameters.DataWidth))            // Words not yet read
+  val reading    = RegInit(0.U(log2Ceil(DMA.BufferDepth + 1).W)) // Reads granted, data not yet returned
+
+  val buffer = Module(new Queue(UInt(Parameters.DataWidth), DMA.BufferDepth))
+
+  // ============ Register Interface ============
+  val addr = slave.io.bundle.address
+  slave.io.bundle.read_valid := slave.io.bundle.read
+  slave.io.bundle.read_data := MuxLookup(addr, 0.U)(
+    IndexedSeq(
+      Reg.SRC.U        -> src,
+      Reg.DST.U        -> dst,
+      Reg.LEN.U        -> len,
+      Reg.SRC_STRIDE.U -> src_stride,
+      Reg.DST_STRIDE.U -> dst_stride,
+      Reg.CTRL.U       -> Cat(ie, 0.U(1.W)),
+      Reg.STATUS.U     -> Cat(done, busy)
+    )
+  )
+
+  val write_data = slave.io.bundle.write_data
+  val start      = WireDefault(false.B)
+  when(slave.io.bundle.write) {
+    when(addr === Reg.CTRL.U) {
+      ie    := write_data(1)
+      start := write_data(0) && !busy
+    }.elsewhen(addr === Reg.STATUS.U) {
+      when(write_data(1)) {
+        done := false.B
+      }
+    }.elsewhen(!busy) {
+      when(addr === Reg.SRC.U) {
+        src := aligned(write_data)
+      }.elsewhen(addr === Reg.DST.U) {
+        dst := aligned(write_data)
+      }.elsewhen(addr === Reg.LEN.U) {
+        len := write_data
+      }.elsewhen(addr === Reg.SRC_STRIDE.U) {
+        src_stride := aligned(write_data)
+      }.elsewhen(addr === Reg.DST_STRIDE.U) {
+        dst_stride := aligned(write_data)
+      }
+    }
+  }
+
+  // ============ Copy Engine ============
+  // Reads are only requested while the buffer has room for their data
+  val write_request = busy && buffer.io.deq.valid
+  val read_request  = busy && reads_left =/= 0.U && buffer.io.count +& reading < DMA.BufferDepth.U
+  axi_master.io.bundle.address      := Mux(write_request, dst, src)
+  axi_master.io.bundle.read         := read_request && !write_request
+  axi_master.io.bundle.write        := write_request
+  axi_master.io.bundle.write_data   := buffer.io.deq.bits
+  axi_master.io.bundle.write_strobe := VecInit(Seq.fill(Parameters.WordSize)(true.B))
+
+  val read_grant  = axi_master.io.bundle.read && axi_master.io.bundle.granted
+  val write_grant = write_request && axi_master.io.bundle.granted
+  buffer.io.enq.valid := axi_master.io.bundle.read_valid
+  buffer.io.enq.bits  := axi_master.io.bundle.read_data
+  buffer.io.deq.ready := write_grant
+  reading             := reading + read_grant.asUInt - axi_master.io.bundle.read_valid.asUInt
+
+  when(read_grant) {
+    src        := src + src_stride
+    reads_left := reads_left - 1.U
+  }
+  when(write_grant) {
+    dst := dst + dst_stride
+    len := len - 1.U
+  }
+
+  when(start) {
+    busy       := true.B
+    done       := false.B
+    reads_left := len
+  }.elsewhen(busy && len === 0.U && !axi_master.io.bundle.busy) {
+    busy := false.B
+    done := true.B
+  }
+
+  io.signal_interrupt := done && ie
+}
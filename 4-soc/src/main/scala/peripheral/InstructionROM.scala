@@ -4,11 +4,13 @@
 
 package peripheral
 
-import java.io.FileWriter
+import java.nio.charset.StandardCharsets
 import java.nio.file.Files
 import java.nio.file.Paths
+import java.nio.file.StandardCopyOption
 import java.nio.ByteBuffer
 import java.nio.ByteOrder
+import java.util.Arrays
 
 import chisel3._
 import chisel3.util.experimental.loadMemoryFromFileInline
@@ -29,35 +31,44 @@ class InstructionROM(instructionFilename: String) extends Module {
   val wordAddress = (io.address - Parameters.EntryAddress) >> 2
   io.data := mem(wordAddress)
 
+  // Whole little-endian words of the image, then three NOPs so the fetch stage never reads past the end.
+  // The image is read in one pass into a preallocated buffer; the init file is rewritten only when its
+  // content changes, so re-elaborating the same program touches nothing on disk.
   def readAsmBinary(filename: String) = {
-    val inputStream = if (Files.exists(Paths.get(filename))) {
-      Files.newInputStream(Paths.get(filename))
+    val path = Paths.get(filename)
+    val bytes = if (Files.exists(path)) {
+      Files.readAllBytes(path)
     } else {
-      getClass.getClassLoader.getResourceAsStream(filename)
+      val inputStream = getClass.getClassLoader.getResourceAsStream(filename)
+      try inputStream.readAllBytes()
+      finally inputStream.close()
     }
-    var instructions = new Array[BigInt](0)
-    val arr          = new Array[Byte](4)
-    while (inputStream.read(arr) == 4) {
-      val instBuf = ByteBuffer.wrap(arr)
-      instBuf.order(ByteOrder.LITTLE_ENDIAN)
-      val inst = BigInt(instBuf.getInt() & 0xffffffffL)
-      instructions = instructions :+ inst
+    val words  = bytes.length / 4
+    val length = words + 3
+    val buf    = ByteBuffer.wrap(bytes).order(ByteOrder.LITTLE_ENDIAN)
+
+    // Use @address\ndata format for loadMemoryFromFileInline compatibility
+    val text = new StringBuilder(length * 16)
+    for (i <- 0 until length) {
+      val inst = if (i < words) buf.getInt(i * 4) & 0xffffffffL else 0x00000013L
+      text.append('@').append(i.toHexString).append('\n')
+      text.append(f"$inst%08x").append('\n')
     }
-    instructions = instructions :+ BigInt(0x00000013L)
-    instructions = instructions :+ BigInt(0x00000013L)
-    instructions = instructions :+ BigInt(0x00000013L)
+    val content = text.toString.getBytes(StandardCharsets.US_ASCII)
+
     val currentDir = System.getProperty("user.dir")
     // Extract just the filename from instructionFilename (handles absolute paths)
-    val baseName   = Paths.get(instructionFilename).getFileName.toString
+    val baseName   = path.getFileName.toString
     val exeTxtPath = Paths.get(currentDir, "verilog", f"${baseName}.txt")
     // Create verilog directory if it doesn't exist
     Files.createDirectories(exeTxtPath.getParent)
-    val writer = new FileWriter(exeTxtPath.toString)
-    for (i <- instructions.indices) {
-      // Use @address\ndata format for loadMemoryFromFileInline compatibility
-      writer.write(f"@$i%x\n${instructions(i)}%08x\n")
+    val unchanged = Files.exists(exeTxtPath) && Arrays.equals(Files.readAllBytes(exeTxtPath), content)
+    if (!unchanged) {
+      // Write then rename, so concurrent elaborations never see a partial file
+      val tmp = Files.createTempFile(exeTxtPath.getParent, baseName, ".tmp")
+      Files.write(tmp, content)
+      Files.move(tmp, exeTxtPath, StandardCopyOption.REPLACE_EXISTING, StandardCopyOption.ATOMIC_MOVE)
     }
-    writer.close()
-    (exeTxtPath, instructions.length)
+    (exeTxtPath, length)
   }
 }
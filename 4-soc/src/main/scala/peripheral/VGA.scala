@@ -10,6 +10,21 @@ import chisel3._
 import chisel3.util._
 import riscv.Parameters
 
+object VGA {
+
+  /** Slave address bits: registers at 0x00-0xFF, framebuffer window at 0x8000 */
+  val AddrBits = 16
+
+  /** Hardware sprites, each SpriteSize x SpriteSize pixels (one pattern word per row) */
+  val SpriteCount = 8
+  val SpriteSize  = 8
+
+  /** Tile layer: TileMapSize x TileMapSize cells of TileSize x TileSize pixel tiles */
+  val TileSize    = 3
+  val TileCount   = 64
+  val TileMapSize = 32
+}
+
 /**
  * VGA peripheral with AXI4-Lite interface and dual-clock CDC
  *
@@ -21,6 +36,39 @@ import riscv.Parameters
  *   0x14: STREAM_DATA - 8 pixels packed in 32-bit word (auto-increment)
  *   0x20: CTRL        - Display enable, blank, swap request, frame select, interrupt enable
  *   0x24-0x60: PALETTE[0-15] - 16 entries, 6-bit VGA colors (RRGGBB)
+ *   0x68: SPRITE_KEY  - [3:0] transparent sprite and tile color index
+ *   0x6C: TILE_CTRL   - [16] enable, [15:8] y, [7:0] x of map cell (0,0) (two's complement)
+ *   0x70: SCROLL      - [13:8] y, [5:0] x framebuffer offset of the scrolled rows
+ *   0x74: SCROLL_SPLIT - [5:0] first scrolled frame row (0 = whole frame)
+ *   0x80-0x9C: SPRITE_POS[0-7] - [16] enable, [15:8] y, [7:0] x (two's complement)
+ *   0x100-0x1FC: SPRITE_DATA - Sprite n row r at 0x100 + n*32 + r*4, 8 pixels
+ *                  packed like STREAM_DATA; write-only, reads return 0
+ *   0x200-0x5FC: TILE_DATA - Tile t row r at 0x200 + t*16 + r*4, pixels in
+ *                  [3:0], [7:4], [11:8]; write-only, reads return 0
+ *   0x1000-0x1FFC: TILE_MAP - Cell (col, row) at 0x1000 + (row*32 + col)*4,
+ *                  [5:0] tile index; write-only, reads return 0
+ *   0x8000-0xDFFF: FRAMEBUFFER - Word frame*512+n holds 8 pixels of frame `frame`
+ *                  (same packing as STREAM_DATA); write-only, reads return 0
+ *
+ * The FRAMEBUFFER window writes one word at any position without touching
+ * UPLOAD_ADDR, so firmware can update only the words that changed.
+ *
+ * Sprites are composited over the displayed frame in frame pixel coordinates:
+ * sprite n covers x..x+7, y..y+7 (negative positions clip at the left/top
+ * edge). Pixels equal to SPRITE_KEY are transparent; where sprites overlap,
+ * the lowest-numbered one is shown. Moving a sprite is one SPRITE_POS write.
+ *
+ * SCROLL shifts the framebuffer read, wrapping around the 64x64 frame: frame
+ * row y at or below SCROLL_SPLIT shows pixel (x + SCROLL.x, y + SCROLL.y)
+ * mod 64, rows above the split are not scrolled (e.g. a score area). Tiles
+ * and sprites are positioned on the screen and do not scroll.
+ *
+ * The tile layer lies between the framebuffer and the sprites: a 32x32 map of
+ * 3x3 tiles whose cell (0,0) is placed at the TILE_CTRL origin, so redrawing
+ * a grid cell or a character is one TILE_MAP write. Tile pixels equal to
+ * SPRITE_KEY show the framebuffer beneath. The map row of each line is read
+ * into a line buffer during the left margin, so a TILE_MAP write shows from
+ * the next line on.
  *
  * VGA timing: 640×480 @ 72Hz
  *   H_TOTAL=832, V_TOTAL=520, pixel clock=31.5 MHz
@@ -33,7 +81,7 @@ import riscv.Parameters
  */
 class VGA extends Module {
   val io = IO(new Bundle {
-    val channels    = Flipped(new AXI4LiteChannels(8, Parameters.DataBits))
+    val channels    = Flipped(new AXI4LiteChannels(VGA.AddrBits, Parameters.DataBits))
     val pixClock    = Input(Clock())     // VGA pixel clock (31.5 MHz)
     val hsync       = Output(Bool())     // Horizontal sync
     val vsync       = Output(Bool())     // Vertical sync
@@ -90,6 +138,15 @@ class VGA extends Module {
     val CTRL         = 0x20 // Control register
     val PALETTE_BASE = 0x24 // Palette entries start here
     val PALETTE_END  = 0x64 // Palette entries end here (16 entries: 0x24-0x60)
+    val SPRITE_KEY   = 0x68   // Transparent sprite and tile color index
+    val TILE_CTRL    = 0x6c   // Tile layer enable and origin
+    val SCROLL       = 0x70   // Framebuffer scroll offset
+    val SCROLL_SPLIT = 0x74   // First scrolled frame row
+    val SPRITE_POS   = 0x80   // Sprite positions start here (one word per sprite)
+    val SPRITE_DATA  = 0x100  // Sprite patterns start here (SpriteSize words per sprite)
+    val TILE_DATA    = 0x200  // Tile patterns start here (one word per row, 4 rows per tile)
+    val TILE_MAP     = 0x1000 // Tile map cells start here (one word per cell)
+    val FB_WINDOW    = 0x8000 // Linear framebuffer window (address bit 15)
   }
 
   // Peripheral identification constant
@@ -98,8 +155,26 @@ class VGA extends Module {
   // ============ Framebuffer RAM ============
   val framebuffer = Module(new TrueDualPortRAM32(TOTAL_WORDS, ADDR_WIDTH))
 
+  // ============ Sprite Pattern RAMs ============
+  // One per sprite, so every sprite's row is read in the same pixel cycle
+  val SPRITE_ROW_BITS = log2Ceil(VGA.SpriteSize)
+  val sprites         = Seq.fill(VGA.SpriteCount)(Module(new TrueDualPortRAM32(VGA.SpriteSize, SPRITE_ROW_BITS)))
+
+  // ============ Tile Pattern and Map RAMs ============
+  val TILE_ROW_BITS   = log2Ceil(VGA.TileSize)
+  val TILE_INDEX_BITS = log2Ceil(VGA.TileCount)
+  val TILE_MAP_BITS   = log2Ceil(VGA.TileMapSize)
+  val TILE_MAP_PIXELS = VGA.TileSize * VGA.TileMapSize
+  val tiles           = Module(new TrueDualPortRAM32(VGA.TileCount << TILE_ROW_BITS, TILE_INDEX_BITS + TILE_ROW_BITS))
+  val tile_map        = Module(new TrueDualPortRAM32(VGA.TileMapSize * VGA.TileMapSize, 2 * TILE_MAP_BITS))
+
+  // Fixed-point multiplier for divide-by-TileSize, exact below 128:
+  // x / 3 = x * ceil(256/3) >> 8 = x * 86 >> 8
+  require(TILE_MAP_PIXELS <= 128, "tile map must span fewer than 128 pixels")
+  val DIV_BY_TILE_MULT = (256 + VGA.TileSize - 1) / VGA.TileSize
+
   // ============ AXI4-Lite Slave Interface ============
-  val slave = Module(new AXI4LiteSlave(8, Parameters.DataBits))
+  val slave = Module(new AXI4LiteSlave(VGA.AddrBits, Parameters.DataBits))
   slave.io.channels <> io.channels
 
   // ============ CPU Clock Domain (sysclk) ============
@@ -110,6 +185,11 @@ class VGA extends Module {
   val intrStatusReg = RegInit(0.U(32.W))
   val uploadAddrReg = RegInit(0.U(32.W))
   val paletteReg    = RegInit(VecInit(Seq.fill(16)(0.U(6.W))))
+  val spriteKeyReg  = RegInit(0.U(4.W))
+  val spritePosReg  = RegInit(VecInit(Seq.fill(VGA.SpriteCount)(0.U(17.W))))
+  val tileCtrlReg   = RegInit(0.U(17.W))
+  val scrollReg     = RegInit(0.U(14.W))
+  val splitReg      = RegInit(0.U(6.W))
 
   // Control register bit fields
   val ctrl_en        = ctrlReg(0)
@@ -163,8 +243,9 @@ class VGA extends Module {
 
     io.intr := (intrStatusReg =/= 0.U) && ctrl_vblank_ie
 
-    // MMIO address decode (mask to get offset within peripheral)
-    val addr             = slave.io.bundle.address & 0xff.U // VGA registers at 0x00-0xFF
+    // MMIO address decode (registers compare the full offset, so the
+    // framebuffer window does not alias them)
+    val addr             = slave.io.bundle.address
     val addr_id          = addr === Reg.ID.U
     val addr_status      = addr === Reg.STATUS.U
     val addr_intr_status = addr === Reg.INTR_STATUS.U
@@ -173,6 +254,23 @@ class VGA extends Module {
     val addr_ctrl        = addr === Reg.CTRL.U
     val addr_palette     = (addr >= Reg.PALETTE_BASE.U) && (addr < Reg.PALETTE_END.U)
     val palette_idx      = (addr - Reg.PALETTE_BASE.U) >> 2
+    val addr_sprite_key  = addr === Reg.SPRITE_KEY.U
+    val addr_sprite_pos  = (addr >= Reg.SPRITE_POS.U) && (addr < (Reg.SPRITE_POS + 4 * VGA.SpriteCount).U)
+    val sprite_pos_idx   = (addr - Reg.SPRITE_POS.U) >> 2
+    val addr_sprite_data =
+      (addr >= Reg.SPRITE_DATA.U) && (addr < (Reg.SPRITE_DATA + 4 * VGA.SpriteCount * VGA.SpriteSize).U)
+    val sprite_data_word = (addr - Reg.SPRITE_DATA.U) >> 2
+    val addr_tile_ctrl   = addr === Reg.TILE_CTRL.U
+    val addr_scroll      = addr === Reg.SCROLL.U
+    val addr_split       = addr === Reg.SCROLL_SPLIT.U
+    val addr_tile_data =
+      (addr >= Reg.TILE_DATA.U) && (addr < (Reg.TILE_DATA + 4 * (VGA.TileCount << TILE_ROW_BITS)).U)
+    val tile_data_word = (addr - Reg.TILE_DATA.U) >> 2
+    val addr_tile_map =
+      (addr >= Reg.TILE_MAP.U) && (addr < (Reg.TILE_MAP + 4 * VGA.TileMapSize * VGA.TileMapSize).U)
+    val tile_map_word = (addr - Reg.TILE_MAP.U) >> 2
+    val addr_fb_window   = addr(log2Ceil(Reg.FB_WINDOW))
+    val fb_window_word   = addr(ADDR_WIDTH + 1, 2)
 
     // AXI4-Lite Read handling
     // read_valid must only be asserted when peripheral has valid data ready
@@ -218,6 +316,16 @@ class VGA extends Module {
       read_data_prepared := uploadAddrReg
     }.elsewhen(addr_palette) {
       read_data_prepared := paletteReg(palette_idx)
+    }.elsewhen(addr_sprite_key) {
+      read_data_prepared := spriteKeyReg
+    }.elsewhen(addr_sprite_pos) {
+      read_data_prepared := spritePosReg(sprite_pos_idx)
+    }.elsewhen(addr_tile_ctrl) {
+      read_data_prepared := tileCtrlReg
+    }.elsewhen(addr_scroll) {
+      read_data_prepared := scrollReg
+    }.elsewhen(addr_split) {
+      read_data_prepared := splitReg
     }
 
     // Only assert read_valid when there's an active read request
@@ -261,12 +369,47 @@ class VGA extends Module {
         uploadAddrReg := Cat(upload_frame, wrapped_addr)
       }.elsewhen(addr_palette) {
         paletteReg(palette_idx) := slave.io.bundle.write_data(5, 0)
+      }.elsewhen(addr_fb_window) {
+        when(fb_window_word < TOTAL_WORDS.U) {
+          fb_write_en   := true.B
+          fb_write_addr := fb_window_word
+          fb_write_data := slave.io.bundle.write_data
+        }
+      }.elsewhen(addr_sprite_key) {
+        spriteKeyReg := slave.io.bundle.write_data(3, 0)
+      }.elsewhen(addr_sprite_pos) {
+        spritePosReg(sprite_pos_idx) := slave.io.bundle.write_data(16, 0)
+      }.elsewhen(addr_tile_ctrl) {
+        tileCtrlReg := slave.io.bundle.write_data(16, 0)
+      }.elsewhen(addr_scroll) {
+        scrollReg := slave.io.bundle.write_data(13, 0)
+      }.elsewhen(addr_split) {
+        splitReg := slave.io.bundle.write_data(5, 0)
       }
     }
 
     framebuffer.io.wea   := fb_write_en
     framebuffer.io.addra := fb_write_addr
     framebuffer.io.dina  := fb_write_data
+
+    // Sprite pattern write ports
+    val sprite_data_sel = sprite_data_word >> SPRITE_ROW_BITS
+    for ((sprite, i) <- sprites.zipWithIndex) {
+      sprite.io.clka  := clock
+      sprite.io.wea   := slave.io.bundle.write && addr_sprite_data && sprite_data_sel === i.U
+      sprite.io.addra := sprite_data_word(SPRITE_ROW_BITS - 1, 0)
+      sprite.io.dina  := slave.io.bundle.write_data
+    }
+
+    // Tile pattern and map write ports
+    tiles.io.clka     := clock
+    tiles.io.wea      := slave.io.bundle.write && addr_tile_data
+    tiles.io.addra    := tile_data_word(TILE_INDEX_BITS + TILE_ROW_BITS - 1, 0)
+    tiles.io.dina     := slave.io.bundle.write_data
+    tile_map.io.clka  := clock
+    tile_map.io.wea   := slave.io.bundle.write && addr_tile_map
+    tile_map.io.addra := tile_map_word(2 * TILE_MAP_BITS - 1, 0)
+    tile_map.io.dina  := slave.io.bundle.write_data
   }
 
   // ============ Pixel Clock Domain (pixclk) ============
@@ -334,6 +477,17 @@ class VGA extends Module {
     val palette_sync1 = RegNext(paletteReg)
     val palette_sync  = RegNext(palette_sync1)
 
+    val sprite_key_sync1 = RegNext(spriteKeyReg)
+    val sprite_key       = RegNext(sprite_key_sync1)
+    val sprite_pos_sync1 = RegNext(spritePosReg)
+    val sprite_pos       = RegNext(sprite_pos_sync1)
+    val tile_ctrl_sync1  = RegNext(tileCtrlReg)
+    val tile_ctrl        = RegNext(tile_ctrl_sync1)
+    val scroll_sync1     = RegNext(scrollReg)
+    val scroll           = RegNext(scroll_sync1)
+    val split_sync1      = RegNext(splitReg)
+    val split            = RegNext(split_sync1)
+
     // Pipeline delays
     val frame_x_d1         = RegNext(frame_x)
     val frame_y_d1         = RegNext(frame_y)
@@ -349,7 +503,11 @@ class VGA extends Module {
     val h_active_d2 = RegNext(h_active_d1)
     val v_active_d2 = RegNext(v_active_d1)
 
-    val pixel_idx     = frame_y * FRAME_WIDTH.U + frame_x
+    // Scrolled rows read the frame at an offset; 6-bit sums wrap around
+    val scrolled      = frame_y >= split
+    val read_x        = Mux(scrolled, frame_x + scroll(5, 0), frame_x)
+    val read_y        = Mux(scrolled, frame_y + scroll(13, 8), frame_y)
+    val pixel_idx     = read_y * FRAME_WIDTH.U + read_x
     val word_offset   = pixel_idx >> 3
     val pixel_in_word = pixel_idx(2, 0)
     val frame_base    = curr_frame * WORDS_PER_FRAME.U
@@ -375,7 +533,64 @@ class VGA extends Module {
       )
     )
 
-    val color_from_palette = palette_sync(pixel_4bit)
+    // Sprites: hit test beside the framebuffer read, pattern row arrives with fb_word
+    val sprite_visible = Wire(Vec(VGA.SpriteCount, Bool()))
+    val sprite_pixel   = Wire(Vec(VGA.SpriteCount, UInt(4.W)))
+    for ((sprite, i) <- sprites.zipWithIndex) {
+      val enable = sprite_pos(i)(16)
+      val dx     = frame_x - sprite_pos(i)(7, 0) // Wraps, so negative positions clip
+      val dy     = frame_y - sprite_pos(i)(15, 8)
+      val hit    = enable && dx < VGA.SpriteSize.U && dy < VGA.SpriteSize.U
+
+      sprite.io.clkb  := io.pixClock
+      sprite.io.addrb := dy(SPRITE_ROW_BITS - 1, 0)
+
+      val hit_d1    = RegNext(hit)
+      val column_d1 = RegNext(dx(SPRITE_ROW_BITS - 1, 0))
+      val pixels    = VecInit((0 until VGA.SpriteSize).map(p => sprite.io.doutb(4 * p + 3, 4 * p)))
+      sprite_pixel(i)   := pixels(column_d1)
+      sprite_visible(i) := hit_d1 && sprite_pixel(i) =/= sprite_key
+    }
+
+    // Tiles: position within the map (wraps, so negative origins clip)
+    val tile_x         = frame_x - tile_ctrl(7, 0)
+    val tile_y         = frame_y - tile_ctrl(15, 8)
+    val tile_hit       = tile_ctrl(16) && tile_x < TILE_MAP_PIXELS.U && tile_y < TILE_MAP_PIXELS.U
+    val tile_col_mult  = tile_x(6, 0) * DIV_BY_TILE_MULT.U
+    val tile_row_mult  = tile_y(6, 0) * DIV_BY_TILE_MULT.U
+    val tile_col       = tile_col_mult(TILE_MAP_BITS + 7, 8)
+    val tile_row       = tile_row_mult(TILE_MAP_BITS + 7, 8)
+    val tile_column    = tile_x - tile_col * VGA.TileSize.U // Pixel within the tile
+    val tile_row_pixel = tile_y - tile_row * VGA.TileSize.U
+
+    // The line's map row is fetched into tile_line while x_px is in the left
+    // margin (one cell per pixel clock), so the pixel path needs only the
+    // pattern read, which arrives with fb_word
+    val tile_line         = Reg(Vec(VGA.TileMapSize, UInt(TILE_INDEX_BITS.W)))
+    val tile_fetch_d1     = RegNext(x_px < VGA.TileMapSize.U)
+    val tile_fetch_col_d1 = RegNext(x_px(TILE_MAP_BITS - 1, 0))
+    tile_map.io.clkb  := io.pixClock
+    tile_map.io.addrb := Cat(tile_row, x_px(TILE_MAP_BITS - 1, 0))
+    when(tile_fetch_d1) {
+      tile_line(tile_fetch_col_d1) := tile_map.io.doutb(TILE_INDEX_BITS - 1, 0)
+    }
+
+    tiles.io.clkb  := io.pixClock
+    tiles.io.addrb := Cat(tile_line(tile_col), tile_row_pixel(TILE_ROW_BITS - 1, 0))
+
+    val tile_hit_d1    = RegNext(tile_hit)
+    val tile_column_d1 = RegNext(tile_column(TILE_ROW_BITS - 1, 0))
+    val tile_pixels    = VecInit((0 until 1 << TILE_ROW_BITS).map(p => tiles.io.doutb(4 * p + 3, 4 * p)))
+    val tile_pixel     = tile_pixels(tile_column_d1)
+    val tile_visible   = tile_hit_d1 && tile_pixel =/= sprite_key
+
+    // Lowest-numbered visible sprite wins, then the tile layer, otherwise the
+    // framebuffer pixel
+    val pixel_index = PriorityMux(
+      sprite_visible :+ tile_visible :+ true.B,
+      sprite_pixel :+ tile_pixel :+ pixel_4bit
+    )
+    val color_from_palette = palette_sync(pixel_index)
 
     val output_color = WireDefault(0.U(6.W))
     when(blanking) {
@@ -24,7 +24,8 @@ object ImplementationType {
  *
  * These parameters define the processor's architectural width, memory layout,
  * and peripheral configuration. Changing these values affects hardware synthesis
- * and software compatibility.
+ * and software compatibility. Sizes that vary per build (predictors, memory size,
+ * slave count) are taken from [[SoCConfig]], whose defaults are the values here.
  */
 object Parameters {
   // RV32I: 32-bit address and data widths
@@ -63,9 +64,9 @@ object Parameters {
   // Program entry point: 0x1000 (after reset vector area)
   val EntryAddress = 0x1000.U(Parameters.AddrWidth)
 
-  // AXI4-Lite bus topology: single master (CPU), 8 slave address regions
+  // AXI4-Lite bus topology: two masters (CPU, DMA), 8 slave address regions
   // Address decoding uses upper 3 bits: 0x00-0x1F=RAM, 0x20-0x3F=VGA, etc.
-  val MasterDeviceCount    = 1
+  val MasterDeviceCount    = 2
   val SlaveDeviceCount     = 8
   val SlaveDeviceCountBits = log2Up(Parameters.SlaveDeviceCount) // 3 bits
 
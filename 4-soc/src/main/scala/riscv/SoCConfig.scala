@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: MIT
+// MyCPU is freely redistributable under the MIT License. See the file
+// "LICENSE" for information on usage and redistribution of this file.
+
+package riscv
+
+import chisel3.util.isPow2
+import chisel3.util.log2Up
+
+/**
+ * Elaboration-time SoC configuration.
+ *
+ * Sizes that are worth exploring without touching the RTL: predictor
+ * capacities, cache geometries, the store buffer depth, the data TCM size
+ * and main memory size. The defaults reproduce the checked-in Top.v. A
+ * configuration is threaded from Top through CPU and PipelinedCPU into
+ * InstructionFetch, ICache, DCache, StoreBuffer, DataTCM and BusSwitch;
+ * everything else keeps using the fixed constants in [[Parameters]].
+ *
+ * Main memory lives in the Verilator harness, so memorySizeInBytes is not
+ * elaborated into hardware. It is checked against the memory slave's
+ * address region here and passed to the harness (--mem-size) by the sweep
+ * driver (scripts/sweep.py).
+ *
+ * @param btbEntries        BranchTargetBuffer entries (power of 2)
+ * @param rasDepth          ReturnAddressStack depth (power of 2, >= 2)
+ * @param ibtbEntries       IndirectBTB entries (power of 2, >= 4)
+ * @param icacheSizeBytes   ICache capacity in bytes (power of 2, >= 2 sets)
+ * @param icacheWays        ICache associativity, 1 or 2
+ * @param icacheLineBytes   ICache line size in bytes (power of 2, >= 8)
+ * @param dcacheSizeBytes   DCache capacity in bytes (power of 2, >= 2 sets)
+ * @param dcacheWays        DCache associativity, 1 or 2
+ * @param dcacheLineBytes   DCache line size in bytes (power of 2, >= 8)
+ * @param storeBufferDepth  StoreBuffer entries (0 = stores wait for the bus)
+ * @param tcmSizeBytes      DataTCM capacity in bytes at 0x60000000 (power of
+ *                          2, 1 KiB to 1 MiB)
+ * @param memorySizeInBytes Main memory size (multiple of 4)
+ * @param slaveDeviceCount  Bus slave regions, decoded from the top address bits.
+ *                          Fixed at 8: Top wires each peripheral to the slave
+ *                          index of its base address in the firmware's memory
+ *                          map (VGA 0x20000000, UART 0x40000000, DMA
+ *                          0xA0000000), which only holds for 8 regions.
+ */
+case class SoCConfig(
+    btbEntries: Int = 32,
+    rasDepth: Int = 4,
+    ibtbEntries: Int = 8,
+    icacheSizeBytes: Int = 4096,
+    icacheWays: Int = 1,
+    icacheLineBytes: Int = 16,
+    dcacheSizeBytes: Int = 4096,
+    dcacheWays: Int = 1,
+    dcacheLineBytes: Int = 16,
+    storeBufferDepth: Int = 4,
+    tcmSizeBytes: Int = 32768,
+    memorySizeInBytes: Int = Parameters.MemorySizeInBytes,
+    slaveDeviceCount: Int = Parameters.SlaveDeviceCount
+) {
+  require(isPow2(btbEntries), "BTB entries must be power of 2")
+  require(rasDepth >= 2 && isPow2(rasDepth), "RAS depth must be power of 2 and >= 2")
+  require(isPow2(ibtbEntries) && ibtbEntries >= 4, "IndirectBTB entries must be power of 2 and >= 4")
+  require(icacheWays == 1 || icacheWays == 2, "ICache ways must be 1 or 2")
+  require(isPow2(icacheLineBytes) && icacheLineBytes >= 8, "ICache line size must be power of 2 and >= 8")
+  require(
+    isPow2(icacheSizeBytes) && icacheSizeBytes >= 2 * icacheLineBytes * icacheWays,
+    "ICache size must be power of 2 and hold at least 2 sets"
+  )
+  require(dcacheWays == 1 || dcacheWays == 2, "DCache ways must be 1 or 2")
+  require(isPow2(dcacheLineBytes) && dcacheLineBytes >= 8, "DCache line size must be power of 2 and >= 8")
+  require(
+    isPow2(dcacheSizeBytes) && dcacheSizeBytes >= 2 * dcacheLineBytes * dcacheWays,
+    "DCache size must be power of 2 and hold at least 2 sets"
+  )
+  require(storeBufferDepth >= 0 && storeBufferDepth <= 16, "Store buffer depth must be between 0 and 16")
+  require(
+    isPow2(tcmSizeBytes) && tcmSizeBytes >= 1024 && tcmSizeBytes <= (1 << 20),
+    "TCM size must be power of 2 between 1 KiB and 1 MiB"
+  )
+  require(
+    slaveDeviceCount == Parameters.SlaveDeviceCount,
+    s"Slave count must be ${Parameters.SlaveDeviceCount} (the peripherals' fixed memory map)"
+  )
+  require(memorySizeInBytes > 0 && memorySizeInBytes % 4 == 0, "Memory size must be a positive multiple of 4")
+  require(
+    memorySizeInBytes.toLong <= (1L << (Parameters.AddrBits - slaveDeviceCountBits)),
+    "Memory does not fit in slave 0's address region"
+  )
+
+  def slaveDeviceCountBits: Int = log2Up(slaveDeviceCount)
+
+  /**
+   * Compact form used in build directory names, e.g.
+   * "btb32-ras4-ibtb8-ic4096w1l16-dc4096w1l16-sb4-tcm32768-mem2097152-slv8"
+   */
+  def tag: String =
+    s"btb$btbEntries-ras$rasDepth-ibtb$ibtbEntries-ic${icacheSizeBytes}w${icacheWays}l$icacheLineBytes" +
+      s"-dc${dcacheSizeBytes}w${dcacheWays}l$dcacheLineBytes-sb$storeBufferDepth-tcm$tcmSizeBytes" +
+      s"-mem$memorySizeInBytes-slv$slaveDeviceCount"
+}
+
+object SoCConfig {
+
+  /**
+   * Parse "key=value,..." with keys btb, ras, ibtb, icache, icache_ways,
+   * icache_line, dcache, dcache_ways, dcache_line, sb, tcm and mem;
+   * omitted keys keep their defaults. Throws IllegalArgumentException on bad input.
+   */
+  def parse(spec: String): SoCConfig =
+    spec.split(",").map(_.trim).filter(_.nonEmpty).foldLeft(SoCConfig()) { (config, field) =>
+      field.split("=", 2) match {
+        case Array(key, value) =>
+          val n =
+            try Integer.decode(value.trim).intValue
+            catch {
+              case _: NumberFormatException =>
+                throw new IllegalArgumentException(s"Bad value in '$field'")
+            }
+          key.trim match {
+            case "btb"         => config.copy(btbEntries = n)
+            case "ras"         => config.copy(rasDepth = n)
+            case "ibtb"        => config.copy(ibtbEntries = n)
+            case "icache"      => config.copy(icacheSizeBytes = n)
+            case "icache_ways" => config.copy(icacheWays = n)
+            case "icache_line" => config.copy(icacheLineBytes = n)
+            case "dcache"      => config.copy(dcacheSizeBytes = n)
+            case "dcache_ways" => config.copy(dcacheWays = n)
+            case "dcache_line" => config.copy(dcacheLineBytes = n)
+            case "sb"          => config.copy(storeBufferDepth = n)
+            case "tcm"         => config.copy(tcmSizeBytes = n)
+            case "mem"         => config.copy(memorySizeInBytes = n)
+            case other         => throw new IllegalArgumentException(s"Unknown configuration key '$other'")
+          }
+        case _ => throw new IllegalArgumentException(s"Expected key=value, got '$field'")
+      }
+    }
+}
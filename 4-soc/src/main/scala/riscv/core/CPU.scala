@@ -8,26 +8,30 @@ import bus.AXI4LiteMaster
 import chisel3._
 import riscv.ImplementationType
 import riscv.Parameters
+import riscv.SoCConfig
 // PipelinedCPU is now in the same package (riscv.core)
 
-class CPU(val implementation: Int = ImplementationType.FiveStageFinal) extends Module {
-  val io = IO(new CPUBundle)
+class CPU(val implementation: Int = ImplementationType.FiveStageFinal, config: SoCConfig = SoCConfig()) extends Module {
+  val io = IO(new CPUBundle(config.slaveDeviceCountBits))
 
   implementation match {
     case ImplementationType.FiveStageFinal =>
-      val cpu = Module(new PipelinedCPU)
+      val cpu = Module(new PipelinedCPU(config))
 
       // Connect instruction fetch interface
       io.instruction_address   := cpu.io.instruction_address
       cpu.io.instruction       := io.instruction
       cpu.io.instruction_valid := io.instruction_valid
+      cpu.io.icache_enable     := io.icache_enable
+      cpu.io.dcache_enable     := io.dcache_enable
+      io.icache_refill <> cpu.io.icache_refill
 
       // Connect memory/bus interface through AXI4-Lite master
       val axi_master = Module(new AXI4LiteMaster(Parameters.AddrBits, Parameters.DataBits))
 
       // Reconstruct full address from PipelinedCPU outputs
       val full_bus_address = cpu.io.device_select ## cpu.io.memory_bundle
-        .address(Parameters.AddrBits - Parameters.SlaveDeviceCountBits - 1, 0)
+        .address(Parameters.AddrBits - config.slaveDeviceCountBits - 1, 0)
 
       // BusBundle to AXI4LiteMasterBundle adapter
       axi_master.io.bundle.address      := full_bus_address
@@ -41,7 +45,7 @@ class CPU(val implementation: Int = ImplementationType.FiveStageFinal) extends M
       cpu.io.memory_bundle.write_valid         := axi_master.io.bundle.write_valid
       cpu.io.memory_bundle.write_data_accepted := axi_master.io.bundle.write_data_accepted
       cpu.io.memory_bundle.busy                := axi_master.io.bundle.busy
-      cpu.io.memory_bundle.granted             := !axi_master.io.bundle.busy // Granted when not busy
+      cpu.io.memory_bundle.granted             := axi_master.io.bundle.granted
 
       // Connect AXI4-Lite channels to top-level
       io.axi4_channels <> axi_master.io.channels
@@ -59,28 +63,10 @@ class CPU(val implementation: Int = ImplementationType.FiveStageFinal) extends M
       // Connect device select and bus address from wrapper
       io.device_select := cpu.io.device_select
 
-      // Latch bus address for the duration of each AXI transaction.
-      // AXI4LiteMaster captures cpu.io.memory_bundle.address in the Idle state and
-      // asserts ARVALID/AWVALID on the next cycle. If the CPU pipeline advances in
-      // between, the combinational cpu.io.memory_bundle.address/device_select would
-      // change and the BusSwitch could route the master's ARVALID/AWVALID to the
-      // wrong slave. By registering bus_address when a new request starts and
-      // holding it while the master is busy, we ensure stable routing.
-      val bus_address_reg  = RegInit(0.U(Parameters.AddrWidth))
-      val next_bus_address = full_bus_address
-
-      // New transaction starts when master is idle (not busy) and CPU issues a
-      // read or write request on the BusBundle.
-      val start_bus_transaction =
-        !axi_master.io.bundle.busy &&
-          cpu.io.memory_bundle.request &&
-          (cpu.io.memory_bundle.read || cpu.io.memory_bundle.write)
-
-      when(start_bus_transaction) {
-        bus_address_reg := next_bus_address
-      }
-
-      io.bus_address := bus_address_reg
+      // Address of the request currently presented to the AXI4-Lite master.
+      // The master registers ARADDR/AWADDR when it grants a request and the
+      // BusSwitch routes on those, so no latch is needed here.
+      io.bus_address := full_bus_address
 
       // Connect wrapper memory_bundle outputs (pass through from CPU)
       io.memory_bundle.address      := cpu.io.memory_bundle.address
@@ -104,6 +90,8 @@ class CPU(val implementation: Int = ImplementationType.FiveStageFinal) extends M
       cpu.io.csr_debug_read_address := io.csr_debug_read_address
       io.csr_debug_read_data        := cpu.io.csr_debug_read_data
 
+      io.retire := cpu.io.retire
+
       // Connect debug bus signals
       io.debug_bus_write_enable := cpu.io.memory_bundle.write
       io.debug_bus_write_data   := cpu.io.memory_bundle.write_data
@@ -9,15 +9,22 @@ import bus.AXI4LiteMasterBundle
 import chisel3._
 import riscv.Parameters
 
-class CPUBundle extends Bundle {
+class CPUBundle(deviceSelectBits: Int = Parameters.SlaveDeviceCountBits) extends Bundle {
   // Instruction fetch interface
   val instruction_address = Output(UInt(Parameters.AddrWidth))
   val instruction         = Input(UInt(Parameters.InstructionWidth))
   val instruction_valid   = Input(Bool())
 
+  // Instruction cache: enable (false = ideal fetch above) and line refill port
+  val icache_enable = Input(Bool())
+  val icache_refill = new ICacheRefillBundle
+
+  // Data cache enable (false = every load/store is a bus transaction)
+  val dcache_enable = Input(Bool())
+
   // Memory/Bus interface
   val memory_bundle = new BusBundle
-  val device_select = Output(UInt(Parameters.SlaveDeviceCountBits.W))
+  val device_select = Output(UInt(deviceSelectBits.W))
 
   // AXI4-Lite interface (for top-level integration)
   val axi4_channels = new AXI4LiteChannels(Parameters.AddrBits, Parameters.DataBits)
@@ -32,6 +39,9 @@ class CPUBundle extends Bundle {
   val csr_debug_read_address = Input(UInt(Parameters.CSRRegisterAddrWidth))
   val csr_debug_read_data    = Output(UInt(Parameters.DataWidth))
 
+  // Retirement trace (co-simulation)
+  val retire = new RetireBundle
+
   // Bus address and write strobes for BusSwitch/arbiter AXI4-Lite routing
   val bus_address            = Output(UInt(Parameters.AddrWidth))
   val debug_bus_write_enable = Output(Bool())
@@ -0,0 +1,324 @@
+// SPDX-License-Identifier: MIT
+// MyCPU is freely redistributable under the MIT License. See the file
+// "LICENSE" for information on usage and redistribution of this file.
+
+package riscv.core
+
+import chisel3._
+import chisel3.util._
+import riscv.Parameters
+
+object DCache {
+
+  /**
+   * Bytes at the bottom of slave 0 that are never cached: the harness
+   * mailbox (test handshake at 0x100/0x104, host-call doorbell at 0x200).
+   * Programs are loaded at 0x1000.
+   */
+  val MailboxBytes = 0x1000
+}
+
+/**
+ * DCache: Write-back data cache between MemoryAccess and the AXI4-Lite master
+ *
+ * Organization:
+ * - Direct-mapped (ways = 1) or 2-way set associative (ways = 2, LRU)
+ * - Write-back, write-allocate; one dirty bit per line
+ * - Data arrays are combinational-read memories, so a hit answers in the
+ *   cycle MemoryAccess issues the request and the pipeline does not stall
+ *
+ * Operation:
+ * - enable low: both BusBundles are connected straight through
+ * - Only slave 0 (main memory) above the mailbox page is cached; MMIO
+ *   (VGA, UART, timer, ...) and mailbox loads pass straight through
+ * - A miss is accepted (granted) like a bus transaction, writes the victim
+ *   back if it is dirty, refills the line, then answers from the cache.
+ *   Line transfers are single-word AXI4-Lite transactions on the memory
+ *   side, so they go through the harness memory timing model.
+ * - Pass-through transactions may be pipelined on the AXI4-Lite master;
+ *   a cached request or flush waits until none is in flight (mem.busy low),
+ *   so its response cannot overtake theirs
+ * - A store to the mailbox page first writes back and invalidates every
+ *   line, so the harness sees memory as the program left it and the
+ *   program sees what a host call wrote back
+ *
+ * Performance counters:
+ * - hit:        cached load/store answered without a refill (mhpmcounter12)
+ * - miss:       refill started (mhpmcounter13)
+ * - write_back: dirty line written back, on a miss or a flush (mhpmcounter14)
+ *
+ * @param sizeBytes            Total capacity in bytes
+ * @param ways                 Associativity, 1 or 2
+ * @param lineBytes            Line size in bytes (>= 8)
+ * @param slaveDeviceCountBits Address bits decoding the bus slave
+ */
+class DCache(
+    sizeBytes: Int = 4096,
+    ways: Int = 1,
+    lineBytes: Int = 16,
+    slaveDeviceCountBits: Int = Parameters.SlaveDeviceCountBits
+) extends Module {
+  require(ways == 1 || ways == 2, "DCache ways must be 1 or 2")
+  require(isPow2(lineBytes) && lineBytes >= 8, "DCache line size must be power of 2 and >= 8")
+  require(isPow2(sizeBytes) && sizeBytes >= 2 * lineBytes * ways, "DCache needs at least 2 sets")
+
+  val lineWords  = lineBytes / 4
+  val sets       = sizeBytes / (lineBytes * ways)
+  val offsetBits = log2Ceil(lineBytes)
+  val indexBits  = log2Ceil(sets)
+  val tagBits    = Parameters.AddrBits - offsetBits - indexBits
+
+  val io = IO(new Bundle {
+    val enable = Input(Bool()) // false: both sides connected straight through
+    val cpu    = Flipped(new BusBundle) // MemoryAccess
+    val mem    = new BusBundle          // AXI4-Lite master (CPU.scala)
+
+    // Performance counter events
+    val hit        = Output(Bool())
+    val miss       = Output(Bool())
+    val write_back = Output(Bool())
+  })
+
+  val data  = Seq.fill(ways)(Mem(sets * lineWords, UInt(Parameters.DataWidth)))
+  val tags  = Reg(Vec(ways, Vec(sets, UInt(tagBits.W))))
+  val valid = RegInit(VecInit(Seq.fill(ways)(VecInit(Seq.fill(sets)(false.B)))))
+  val dirty = RegInit(VecInit(Seq.fill(ways)(VecInit(Seq.fill(sets)(false.B)))))
+  val lru   = RegInit(VecInit(Seq.fill(sets)(false.B))) // 2-way: true = replace way 1 next
+
+  val sIdle :: sWriteBack :: sRefill :: sRespond :: sFlush :: sUncached :: Nil = Enum(6)
+  val state                                                                    = RegInit(sIdle)
+
+  // Request accepted on a miss or a mailbox store, replayed once the line
+  // transfers are done
+  val op_address = RegInit(0.U(Parameters.AddrWidth))
+  val op_write   = RegInit(false.B)
+  val op_data    = RegInit(0.U(Parameters.DataWidth))
+  val op_strobe  = RegInit(0.U(Parameters.WordSize.W))
+
+  // Line transfer: line_address is line-aligned, one word per beat
+  val line_address = RegInit(0.U(Parameters.AddrWidth))
+  val way          = RegInit(0.U(1.W))
+  val beat         = RegInit(0.U(log2Ceil(lineWords).W))
+  val issued       = RegInit(false.B) // beat's AXI transaction started
+  val flushing     = RegInit(false.B)
+  val flush_set    = RegInit(0.U(indexBits.W))
+
+  def index_of(address: UInt) = address(offsetBits + indexBits - 1, offsetBits)
+  def tag_of(address: UInt)   = address(Parameters.AddrBits - 1, offsetBits + indexBits)
+  def word_of(address: UInt)  = address(offsetBits - 1, 2)
+
+  // Store data merged into a cached word under the byte strobes
+  def merge(old: UInt, data: UInt, strobe: UInt): UInt =
+    VecInit((0 until Parameters.WordSize).map { i =>
+      Mux(strobe(i), data(8 * i + 7, 8 * i), old(8 * i + 7, 8 * i))
+    }).asUInt
+
+  def write_word(w: UInt, address: UInt, value: UInt) =
+    for (i <- 0 until ways) {
+      when(w === i.U) {
+        data(i).write(Cat(index_of(address), word_of(address)), value)
+      }
+    }
+
+  // Lookup (combinational)
+  val address  = io.cpu.address
+  val index    = index_of(address)
+  val way_hit  = VecInit((0 until ways).map(w => valid(w)(index) && tags(w)(index) === tag_of(address)))
+  val hit      = way_hit.asUInt.orR
+  val hit_way  = if (ways == 2) way_hit(1).asUInt else 0.U
+  val hit_data = Mux1H(way_hit, data.map(_.read(Cat(index, word_of(address)))))
+
+  val request = io.cpu.request && (io.cpu.read || io.cpu.write)
+  val slave0  = address(Parameters.AddrBits - 1, Parameters.AddrBits - slaveDeviceCountBits) === 0.U
+  val mailbox = address(Parameters.AddrBits - 1, log2Ceil(DCache.MailboxBytes)) === 0.U
+  val cached  = io.enable && slave0 && !mailbox
+  val flush   = io.enable && mailbox && io.cpu.write
+
+  // Default: straight through
+  io.mem.address             := io.cpu.address
+  io.mem.read                := io.cpu.read
+  io.mem.write               := io.cpu.write
+  io.mem.write_data          := io.cpu.write_data
+  io.mem.write_strobe        := io.cpu.write_strobe
+  io.mem.request             := io.cpu.request
+  io.cpu.read_data           := io.mem.read_data
+  io.cpu.read_valid          := io.mem.read_valid
+  io.cpu.write_valid         := io.mem.write_valid
+  io.cpu.write_data_accepted := io.mem.write_data_accepted
+  io.cpu.busy                := io.mem.busy
+  io.cpu.granted             := io.mem.granted
+
+  io.hit        := false.B
+  io.miss       := false.B
+  io.write_back := false.B
+
+  // One single-word transaction on the memory side; true when it completes
+  def transfer(write: Bool, address: UInt, value: UInt): Bool = {
+    io.mem.request      := !issued
+    io.mem.read         := !issued && !write
+    io.mem.write        := !issued && write
+    io.mem.address      := address
+    io.mem.write_data   := value
+    io.mem.write_strobe := VecInit(Seq.fill(Parameters.WordSize)(true.B))
+    when(!issued && io.mem.granted) {
+      issued := true.B
+    }
+    val done = issued && Mux(write, io.mem.write_valid, io.mem.read_valid)
+    when(done) {
+      issued := false.B
+    }
+    done
+  }
+
+  def accept() = {
+    op_address := address
+    op_write   := io.cpu.write
+    op_data    := io.cpu.write_data
+    op_strobe  := io.cpu.write_strobe.asUInt
+    beat       := 0.U
+    issued     := false.B
+  }
+
+  when(state =/= sIdle) {
+    io.mem.request             := false.B
+    io.mem.read                := false.B
+    io.mem.write               := false.B
+    io.cpu.read_valid          := false.B
+    io.cpu.write_valid         := false.B
+    io.cpu.write_data_accepted := false.B
+    io.cpu.busy                := true.B
+    io.cpu.granted             := false.B
+  }
+
+  val beat_address = Cat(line_address(Parameters.AddrBits - 1, offsetBits), beat, 0.U(2.W))
+  val last_beat    = beat === (lineWords - 1).U
+
+  switch(state) {
+    is(sIdle) {
+      val quiet = !io.mem.busy
+      when(request && (cached || flush)) {
+        io.mem.request := false.B
+        io.mem.read    := false.B
+        io.mem.write   := false.B
+        io.cpu.granted := false.B
+      }
+      when(request && cached && hit && quiet) {
+        // Answer in the same cycle; MemoryAccess does not stall
+        io.cpu.granted := true.B
+        io.hit         := true.B
+        when(io.cpu.write) {
+          write_word(hit_way, address, merge(hit_data, io.cpu.write_data, io.cpu.write_strobe.asUInt))
+          dirty(hit_way)(index) := true.B
+          io.cpu.write_valid    := true.B
+        }.otherwise {
+          io.cpu.read_data  := hit_data
+          io.cpu.read_valid := true.B
+        }
+        if (ways == 2) {
+          lru(index) := way_hit(0)
+        }
+      }.elsewhen(request && cached) {
+        when(quiet) {
+          val victim =
+            if (ways == 2) Mux(!valid(0)(index), 0.U, Mux(!valid(1)(index), 1.U, lru(index).asUInt)) else 0.U
+          accept()
+          io.cpu.granted := true.B
+          io.miss        := true.B
+          way            := victim
+          when(valid(victim)(index) && dirty(victim)(index)) {
+            line_address := Cat(tags(victim)(index), index, 0.U(offsetBits.W))
+            state        := sWriteBack
+          }.otherwise {
+            line_address := Cat(address(Parameters.AddrBits - 1, offsetBits), 0.U(offsetBits.W))
+            state        := sRefill
+          }
+        }
+      }.elsewhen(request && flush) {
+        when(quiet) {
+          accept()
+          io.cpu.granted := true.B
+          way            := 0.U
+          flush_set      := 0.U
+          flushing       := true.B
+          state          := sFlush
+        }
+      }
+    }
+
+    is(sWriteBack) {
+      val wb_index = index_of(line_address)
+      val wb_data  = VecInit(data.map(_.read(Cat(wb_index, beat))))(way)
+      when(transfer(true.B, beat_address, wb_data)) {
+        beat := beat + 1.U
+        when(last_beat) {
+          io.write_back        := true.B
+          valid(way)(wb_index) := false.B
+          dirty(way)(wb_index) := false.B
+          line_address         := Cat(op_address(Parameters.AddrBits - 1, offsetBits), 0.U(offsetBits.W))
+          state                := Mux(flushing, sFlush, sRefill)
+        }
+      }
+    }
+
+    is(sRefill) {
+      when(transfer(false.B, beat_address, 0.U)) {
+        write_word(way, beat_address, io.mem.read_data)
+        beat := beat + 1.U
+        when(last_beat) {
+          tags(way)(index_of(line_address))  := tag_of(line_address)
+          valid(way)(index_of(line_address)) := true.B
+          state                              := sRespond
+        }
+      }
+    }
+
+    is(sRespond) {
+      // Replay the accepted request against the refilled line
+      val op_index = index_of(op_address)
+      val op_word  = VecInit(data.map(_.read(Cat(op_index, word_of(op_address)))))(way)
+      when(op_write) {
+        write_word(way, op_address, merge(op_word, op_data, op_strobe))
+        dirty(way)(op_index) := true.B
+        io.cpu.write_valid   := true.B
+      }.otherwise {
+        io.cpu.read_data  := op_word
+        io.cpu.read_valid := true.B
+      }
+      if (ways == 2) {
+        lru(op_index) := way === 0.U
+      }
+      state := sIdle
+    }
+
+    is(sFlush) {
+      // Visit every (set, way); dirty lines go through sWriteBack first
+      when(valid(way)(flush_set) && dirty(way)(flush_set)) {
+        line_address := Cat(tags(way)(flush_set), flush_set, 0.U(offsetBits.W))
+        beat         := 0.U
+        state        := sWriteBack
+      }.otherwise {
+        valid(way)(flush_set) := false.B
+        when(way === (ways - 1).U) {
+          way       := 0.U
+          flush_set := flush_set + 1.U
+          when(flush_set === (sets - 1).U) {
+            flushing := false.B
+            state    := sUncached
+          }
+        }.otherwise {
+          way := way + 1.U
+        }
+      }
+    }
+
+    is(sUncached) {
+      // The mailbox store itself, after the flush
+      val done = transfer(true.B, op_address, op_data)
+      io.mem.write_strobe := VecInit(op_strobe.asBools)
+      when(done) {
+        io.cpu.write_valid := true.B
+        state              := sIdle
+      }
+    }
+  }
+}
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: MIT
+// MyCPU is freely redistributable under the MIT License. See the file
+// "LICENSE" for information on usage and redistribution of this file.
+
+package riscv.core
+
+import chisel3._
+import chisel3.util._
+import riscv.Parameters
+
+object DataTCM {
+
+  /**
+   * Base of the TCM window: the start of bus slave 3, which has no
+   * peripheral behind it (DummySlave) in the default memory map.
+   */
+  val Base = 0x60000000L
+}
+
+/** MemoryAccess side of the data TCM port */
+class TCMBundle extends Bundle {
+  val address      = Output(UInt(Parameters.AddrWidth))
+  val select       = Input(Bool()) // address falls in the TCM window
+  val read_data    = Input(UInt(Parameters.DataWidth))
+  val write        = Output(Bool())
+  val write_data   = Output(UInt(Parameters.DataWidth))
+  val write_strobe = Output(Vec(Parameters.WordSize, Bool()))
+}
+
+/**
+ * DataTCM: Single-cycle data scratchpad (tightly-coupled memory)
+ *
+ * A word-wide RAM at [DataTCM.Base, DataTCM.Base + sizeBytes) that
+ * MemoryAccess reads and writes directly, without a bus transaction:
+ * - Reads are combinational, so a load completes in its MEM cycle
+ * - Writes take effect at the clock edge under the byte strobes
+ *
+ * The TCM is not visible to the AXI4-Lite bus or the Verilator harness
+ * memory, so nothing but the CPU can read what is stored there.
+ *
+ * @param sizeBytes Capacity in bytes (power of 2)
+ */
+class DataTCM(sizeBytes: Int = 32768) extends Module {
+  require(isPow2(sizeBytes) && sizeBytes >= 1024, "DataTCM size must be power of 2 and >= 1 KiB")
+
+  val io = IO(Flipped(new TCMBundle))
+
+  val offsetBits = log2Ceil(sizeBytes)
+  val ram        = Mem(sizeBytes / Parameters.WordSize, Vec(Parameters.WordSize, UInt(Parameters.ByteWidth)))
+  val index      = io.address(offsetBits - 1, log2Up(Parameters.WordSize))
+
+  io.select    := io.address(Parameters.AddrBits - 1, offsetBits) === (DataTCM.Base >> offsetBits).U
+  io.read_data := ram.read(index).asUInt
+
+  when(io.select && io.write) {
+    ram.write(
+      index,
+      VecInit((0 until Parameters.WordSize).map(i => io.write_data(8 * i + 7, 8 * i))),
+      io.write_strobe
+    )
+  }
+}
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: MIT
+// MyCPU is freely redistributable under the MIT License. See the file
+// "LICENSE" for information on usage and redistribution of this file.
+
+package riscv.core
+
+import chisel3._
+import chisel3.util._
+import riscv.Parameters
+
+/**
+ * Line refill port of the instruction cache.
+ *
+ * request is held with a stable line-aligned address for the whole refill.
+ * The memory answers with the line's words in address order, one per cycle
+ * with data_valid high (after any latency). request drops on the cycle after
+ * the last word.
+ */
+class ICacheRefillBundle extends Bundle {
+  val request    = Output(Bool())
+  val address    = Output(UInt(Parameters.AddrWidth))
+  val data       = Input(UInt(Parameters.DataWidth))
+  val data_valid = Input(Bool())
+}
+
+/**
+ * ICache: Instruction cache between InstructionFetch and a refill port
+ *
+ * Organization:
+ * - Direct-mapped (ways = 1) or 2-way set associative (ways = 2, LRU)
+ * - sizeBytes total capacity, lineBytes per line (both powers of 2)
+ * - Data arrays are combinational-read memories, so a hit returns the
+ *   instruction in the same cycle, exactly like the ideal external ROM
+ *
+ * Operation:
+ * - enable low: the ideal external fetch path (rom_instruction and
+ *   rom_instruction_valid) passes straight through; the cache is idle
+ * - enable high: a lookup that misses starts a refill of the whole line and
+ *   holds instruction_valid low until the line is filled. IF keeps its PC
+ *   meanwhile (jumps still redirect it), as with an invalid ROM word.
+ * - rom_instruction_valid low (harness drain) suppresses lookups and refills
+ *
+ * Performance counters:
+ * - hit:  fetch accepted by IF and served from the cache (mhpmcounter10),
+ *         including the replayed fetch after each refill
+ * - miss: refill started (mhpmcounter11)
+ *
+ * The cache is not coherent with stores: code written at run time needs a
+ * reset (there is no fence.i).
+ *
+ * @param sizeBytes Total capacity in bytes
+ * @param ways      Associativity, 1 or 2
+ * @param lineBytes Line size in bytes (>= 8)
+ */
+class ICache(sizeBytes: Int = 4096, ways: Int = 1, lineBytes: Int = 16) extends Module {
+  require(ways == 1 || ways == 2, "ICache ways must be 1 or 2")
+  require(isPow2(lineBytes) && lineBytes >= 8, "ICache line size must be power of 2 and >= 8")
+  require(isPow2(sizeBytes) && sizeBytes >= 2 * lineBytes * ways, "ICache needs at least 2 sets")
+
+  val lineWords  = lineBytes / 4
+  val sets       = sizeBytes / (lineBytes * ways)
+  val offsetBits = log2Ceil(lineBytes)
+  val indexBits  = log2Ceil(sets)
+  val tagBits    = Parameters.AddrBits - offsetBits - indexBits
+
+  val io = IO(new Bundle {
+    val enable  = Input(Bool())                      // false: ideal fetch passes through
+    val address = Input(UInt(Parameters.AddrWidth))  // IF program counter
+    val fetch   = Input(Bool())                      // IF not stalled (hit counting)
+
+    // Ideal external fetch (testbench ROM)
+    val rom_instruction       = Input(UInt(Parameters.InstructionWidth))
+    val rom_instruction_valid = Input(Bool())
+
+    // To InstructionFetch
+    val instruction       = Output(UInt(Parameters.InstructionWidth))
+    val instruction_valid = Output(Bool())
+
+    val refill = new ICacheRefillBundle
+
+    // Performance counter events
+    val hit  = Output(Bool())
+    val miss = Output(Bool())
+  })
+
+  val data  = Seq.fill(ways)(Mem(sets * lineWords, UInt(Parameters.DataWidth)))
+  val tags  = Reg(Vec(ways, Vec(sets, UInt(tagBits.W))))
+  val valid = RegInit(VecInit(Seq.fill(ways)(VecInit(Seq.fill(sets)(false.B)))))
+  val lru   = RegInit(VecInit(Seq.fill(sets)(false.B))) // 2-way: true = replace way 1 next
+
+  val sIdle :: sRefill :: Nil = Enum(2)
+  val state                   = RegInit(sIdle)
+  val refill_address          = RegInit(0.U(Parameters.AddrWidth))
+  val refill_way              = RegInit(0.U(1.W))
+  val beat                    = RegInit(0.U(log2Ceil(lineWords).W))
+
+  // Lookup (combinational)
+  val index    = io.address(offsetBits + indexBits - 1, offsetBits)
+  val tag      = io.address(Parameters.AddrBits - 1, offsetBits + indexBits)
+  val word     = io.address(offsetBits - 1, 2)
+  val way_hit  = VecInit((0 until ways).map(w => valid(w)(index) && tags(w)(index) === tag))
+  val hit      = way_hit.asUInt.orR
+  val hit_data = Mux1H(way_hit, data.map(_.read(Cat(index, word))))
+
+  val lookup       = io.enable && io.rom_instruction_valid && state === sIdle
+  val start_refill = lookup && !hit
+
+  when(lookup && hit && io.fetch && (ways == 2).B) {
+    lru(index) := way_hit(0)
+  }
+
+  // Refill: invalidate the victim, fill it word by word, then validate it
+  val victim = if (ways == 2) Mux(!valid(0)(index), 0.U, Mux(!valid(1)(index), 1.U, lru(index).asUInt)) else 0.U
+  when(start_refill) {
+    state                := sRefill
+    refill_address       := Cat(io.address(Parameters.AddrBits - 1, offsetBits), 0.U(offsetBits.W))
+    refill_way           := victim
+    beat                 := 0.U
+    valid(victim)(index) := false.B
+  }
+
+  val refill_index = refill_address(offsetBits + indexBits - 1, offsetBits)
+  val refill_tag   = refill_address(Parameters.AddrBits - 1, offsetBits + indexBits)
+  when(state === sRefill && io.refill.data_valid) {
+    for (w <- 0 until ways) {
+      when(refill_way === w.U) {
+        data(w).write(Cat(refill_index, beat), io.refill.data)
+      }
+    }
+    beat := beat + 1.U
+    when(beat === (lineWords - 1).U) {
+      tags(refill_way)(refill_index)  := refill_tag
+      valid(refill_way)(refill_index) := true.B
+      lru(refill_index)               := refill_way === 0.U
+      state                           := sIdle
+    }
+  }
+
+  io.refill.request    := state === sRefill
+  io.refill.address    := refill_address
+  io.instruction       := Mux(io.enable, hit_data, io.rom_instruction)
+  io.instruction_valid := Mux(io.enable, lookup && hit, io.rom_instruction_valid)
+
+  io.hit  := lookup && hit && io.fetch
+  io.miss := start_refill
+}
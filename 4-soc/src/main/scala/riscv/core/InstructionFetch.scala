@@ -7,6 +7,7 @@ package riscv.core
 import chisel3._
 import chisel3.util.MuxCase
 import riscv.Parameters
+import riscv.SoCConfig
 
 object ProgramCounter {
   val EntryAddress = Parameters.EntryAddress
@@ -19,13 +20,13 @@ object ProgramCounter {
  * branch prediction using two complementary predictors:
  *
  * Branch Target Buffer (BTB):
- * - 32-entry direct-mapped cache indexed by PC[6:2]
+ * - Direct-mapped cache indexed by PC (32 entries by default, PC[6:2])
  * - Stores branch/jump targets with 2-bit saturating counters
  * - Predicts taken when: BTB hit AND counter >= 2 (weakly/strongly taken)
  * - Updated in ID stage when branches resolve
  *
  * Return Address Stack (RAS):
- * - 4-entry circular stack for JALR return prediction
+ * - Circular stack for JALR return prediction (4 entries by default)
  * - Push on call: JAL/JALR with rd=x1 (ra) or rd=x5 (t0)
  * - Pop on return: JALR with rs1=x1/x5, rd=x0
  * - Speculative pop in IF stage when return pattern detected
@@ -62,8 +63,10 @@ object ProgramCounter {
  * - mhpmcounter7: BTB miss penalty (cold misses + wrong target predictions)
  * - mhpmcounter8: Total branches resolved (accuracy denominator)
  * - mhpmcounter9: BTB predictions made (coverage numerator)
+ *
+ * @param config Predictor sizes (btbEntries, rasDepth, ibtbEntries)
  */
-class InstructionFetch extends Module {
+class InstructionFetch(config: SoCConfig = SoCConfig()) extends Module {
   val io = IO(new Bundle {
     val stall_flag_ctrl   = Input(Bool())
     val jump_flag_id      = Input(Bool())
@@ -115,8 +118,8 @@ class InstructionFetch extends Module {
   })
   val pc = RegInit(ProgramCounter.EntryAddress)
 
-  // Branch Target Buffer for branch prediction (32 entries for better coverage)
-  val btb = Module(new BranchTargetBuffer(entries = 32))
+  // Branch Target Buffer for branch prediction (32 entries by default)
+  val btb = Module(new BranchTargetBuffer(entries = config.btbEntries))
   btb.io.pc := pc
 
   // BTB prediction: use predicted target if BTB predicts taken
@@ -125,11 +128,11 @@ class InstructionFetch extends Module {
   io.btb_predicted_target := btb.io.predicted_pc
 
   // Return Address Stack for JALR return prediction
-  val ras = Module(new ReturnAddressStack(depth = 4))
+  val ras = Module(new ReturnAddressStack(depth = config.rasDepth))
 
   // Indirect Branch Target Buffer for non-return JALR prediction
   // Handles function pointers, vtables, computed jumps that RAS doesn't cover
-  val ibtb = Module(new IndirectBTB(entries = 8))
+  val ibtb = Module(new IndirectBTB(entries = config.ibtbEntries))
   ibtb.io.pc := pc
 
   // Detect JALR with rs1=ra (x1) or rs1=t0 (x5) in fetched instruction for speculative pop
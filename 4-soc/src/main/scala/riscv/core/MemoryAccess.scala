@@ -18,6 +18,7 @@ object MemoryAccessStates extends ChiselEnum {
  *
  * Handles load/store operations with AXI4-Lite bus interface. Implements a
  * simple state machine for bus transactions with proper stall generation.
+ * Accesses to the data TCM window bypass the bus and complete in one cycle.
  *
  * Key Features:
  * - Load operations: LB, LBU, LH, LHU, LW with byte/halfword extraction
@@ -27,9 +28,12 @@ object MemoryAccessStates extends ChiselEnum {
  * - Latched control signals to handle stall release timing
  *
  * State Machine:
- * - Idle: Monitor memory_read_enable/memory_write_enable, start transactions
+ * - Idle: Monitor memory_read_enable/memory_write_enable, start transactions.
+ *   A response in the request cycle (store buffered, load forwarded from the
+ *   StoreBuffer, DCache hit) or a TCM access completes without stalling.
  * - Read: Wait for bus.read_valid, extract data, release stall
- * - Write: Wait for bus.write_valid (BRESP), release stall
+ * - Write: Wait for bus.write_valid (BRESP), release stall; only reached
+ *   without a store buffer (SoCConfig sb=0)
  *
  * Critical Timing:
  * - PipelineRegister is purely sequential (io.out := reg), NOT combinational
@@ -63,6 +67,7 @@ class MemoryAccess extends Module {
     val wb_regs_write_enable  = Output(Bool())
 
     val bus = new BusBundle
+    val tcm = new TCMBundle // DataTCM, accessed without a bus transaction
   })
   val mem_address_index = io.alu_result(log2Up(Parameters.WordSize) - 1, 0).asUInt
   val mem_access_state  = RegInit(MemoryAccessStates.Idle)
@@ -116,6 +121,10 @@ class MemoryAccess extends Module {
   io.bus.write           := false.B
   io.wb_memory_read_data := latched_memory_read_data // Use latched value
   io.ctrl_stall_flag     := false.B
+  io.tcm.address         := io.bus.address
+  io.tcm.write           := false.B
+  io.tcm.write_data      := io.bus.write_data
+  io.tcm.write_strobe    := io.bus.write_strobe
 
   // Misaligned access handling:
   // RISC-V spec allows implementation-defined behavior for misaligned accesses.
@@ -128,6 +137,56 @@ class MemoryAccess extends Module {
   // Cross-word-boundary accesses would require two bus transactions and are not implemented.
   // For strict compliance with exception-based handling, add misalignment trap logic.
 
+  // Loaded data (byte/halfword extraction with sign extension), valid with
+  // bus.read_valid or a TCM access. Use io.funct3 and mem_address_index directly - PipelineRegister
+  // is purely sequential (io.out := reg), NOT combinational bypass, so these
+  // signals remain stable during the entire bus transaction while mem_stall is asserted.
+  val data = Mux(io.tcm.select, io.tcm.read_data, io.bus.read_data)
+
+  val processed_data = MuxLookup(
+    io.funct3,
+    0.U,
+    IndexedSeq(
+      InstructionsTypeL.lb -> MuxLookup(
+        mem_address_index,
+        Cat(Fill(24, data(31)), data(31, 24)),
+        IndexedSeq(
+          0.U -> Cat(Fill(24, data(7)), data(7, 0)),
+          1.U -> Cat(Fill(24, data(15)), data(15, 8)),
+          2.U -> Cat(Fill(24, data(23)), data(23, 16))
+        )
+      ),
+      InstructionsTypeL.lbu -> MuxLookup(
+        mem_address_index,
+        Cat(Fill(24, 0.U), data(31, 24)),
+        IndexedSeq(
+          0.U -> Cat(Fill(24, 0.U), data(7, 0)),
+          1.U -> Cat(Fill(24, 0.U), data(15, 8)),
+          2.U -> Cat(Fill(24, 0.U), data(23, 16))
+        )
+      ),
+      InstructionsTypeL.lh -> MuxLookup(
+        mem_address_index,
+        Cat(Fill(16, data(31)), data(31, 16)), // offset 3: best-effort (crosses word boundary)
+        IndexedSeq(
+          0.U -> Cat(Fill(16, data(15)), data(15, 0)), // bytes 0-1
+          1.U -> Cat(Fill(16, data(23)), data(23, 8)), // bytes 1-2
+          2.U -> Cat(Fill(16, data(31)), data(31, 16)) // bytes 2-3
+        )
+      ),
+      InstructionsTypeL.lhu -> MuxLookup(
+        mem_address_index,
+        Cat(Fill(16, 0.U), data(31, 16)), // offset 3: best-effort (crosses word boundary)
+        IndexedSeq(
+          0.U -> Cat(Fill(16, 0.U), data(15, 0)), // bytes 0-1
+          1.U -> Cat(Fill(16, 0.U), data(23, 8)), // bytes 1-2
+          2.U -> Cat(Fill(16, 0.U), data(31, 16)) // bytes 2-3
+        )
+      ),
+      InstructionsTypeL.lw -> data
+    )
+  )
+
   // State machine: handle Read/Write completion FIRST (independent of enable signals)
   // This fixes a critical bug where the state machine would get stuck if the pipeline
   // moved on (enable went low) before the bus transaction completed.
@@ -136,54 +195,6 @@ class MemoryAccess extends Module {
     io.bus.request     := true.B
     io.ctrl_stall_flag := true.B
     when(io.bus.read_valid) {
-      val data = io.bus.read_data
-      // Compute the processed data (byte/halfword extraction with sign extension)
-      // Use io.funct3 and mem_address_index directly - PipelineRegister is purely
-      // sequential (io.out := reg), NOT combinational bypass, so these signals
-      // remain stable during the entire bus transaction while mem_stall is asserted.
-      val processed_data = MuxLookup(
-        io.funct3,
-        0.U,
-        IndexedSeq(
-          InstructionsTypeL.lb -> MuxLookup(
-            mem_address_index,
-            Cat(Fill(24, data(31)), data(31, 24)),
-            IndexedSeq(
-              0.U -> Cat(Fill(24, data(7)), data(7, 0)),
-              1.U -> Cat(Fill(24, data(15)), data(15, 8)),
-              2.U -> Cat(Fill(24, data(23)), data(23, 16))
-            )
-          ),
-          InstructionsTypeL.lbu -> MuxLookup(
-            mem_address_index,
-            Cat(Fill(24, 0.U), data(31, 24)),
-            IndexedSeq(
-              0.U -> Cat(Fill(24, 0.U), data(7, 0)),
-              1.U -> Cat(Fill(24, 0.U), data(15, 8)),
-              2.U -> Cat(Fill(24, 0.U), data(23, 16))
-            )
-          ),
-          InstructionsTypeL.lh -> MuxLookup(
-            mem_address_index,
-            Cat(Fill(16, data(31)), data(31, 16)), // offset 3: best-effort (crosses word boundary)
-            IndexedSeq(
-              0.U -> Cat(Fill(16, data(15)), data(15, 0)), // bytes 0-1
-              1.U -> Cat(Fill(16, data(23)), data(23, 8)), // bytes 1-2
-              2.U -> Cat(Fill(16, data(31)), data(31, 16)) // bytes 2-3
-            )
-          ),
-          InstructionsTypeL.lhu -> MuxLookup(
-            mem_address_index,
-            Cat(Fill(16, 0.U), data(31, 16)), // offset 3: best-effort (crosses word boundary)
-            IndexedSeq(
-              0.U -> Cat(Fill(16, 0.U), data(15, 0)), // bytes 0-1
-              1.U -> Cat(Fill(16, 0.U), data(23, 8)), // bytes 1-2
-              2.U -> Cat(Fill(16, 0.U), data(31, 16)) // bytes 2-3
-            )
-          ),
-          InstructionsTypeL.lw -> data
-        )
-      )
       // Store in register for persistence after read_valid goes low
       latched_memory_read_data := processed_data
       // Also output immediately for forwarding on this cycle
@@ -212,23 +223,30 @@ class MemoryAccess extends Module {
     // Idle state: check enable signals to start new transactions
     when(io.memory_read_enable) {
       // Start the read transaction when the bus is available
-      io.ctrl_stall_flag := true.B
-      io.bus.read        := true.B
-      io.bus.request     := true.B
+      io.ctrl_stall_flag := !(io.tcm.select || io.bus.read_valid)
+      io.bus.read        := !io.tcm.select
+      io.bus.request     := !io.tcm.select
       // Capture control signals for MEM2WB when read starts
       // These are latched so that when read_valid arrives and stall releases,
       // MEM2WB can still capture the correct writeback info for the load instruction
       latched_regs_write_source  := io.regs_write_source
       latched_regs_write_address := io.regs_write_address
       latched_regs_write_enable  := io.regs_write_enable
-      when(io.bus.granted) {
+      when(io.tcm.select || io.bus.read_valid) {
+        // Answered in the request cycle (TCM or DCache hit): complete without stalling
+        latched_memory_read_data := processed_data
+        io.wb_memory_read_data   := processed_data
+        read_just_completed      := true.B
+      }.elsewhen(io.bus.granted) {
         mem_access_state := MemoryAccessStates.Read
       }
     }.elsewhen(io.memory_write_enable) {
-      // Start the write transaction when the bus is available
-      io.ctrl_stall_flag  := true.B
+      // Start the write transaction when the bus is available; a TCM store or
+      // a DCache hit completes it in the request cycle
+      io.ctrl_stall_flag  := !(io.tcm.select || io.bus.write_valid)
       io.bus.write_data   := io.reg2_data
-      io.bus.write        := true.B
+      io.bus.write        := !io.tcm.select
+      io.tcm.write        := io.tcm.select
       io.bus.write_strobe := VecInit(Seq.fill(Parameters.WordSize)(false.B))
       when(io.funct3 === InstructionsTypeS.sb) {
         io.bus.write_strobe(mem_address_index) := true.B
@@ -263,8 +281,8 @@ class MemoryAccess extends Module {
           io.bus.write_strobe(i) := true.B
         }
       }
-      io.bus.request := true.B
-      when(io.bus.granted) {
+      io.bus.request := !io.tcm.select
+      when(!io.tcm.select && !io.bus.write_valid && io.bus.granted) {
         mem_access_state := MemoryAccessStates.Write
       }
     }
@@ -10,6 +10,7 @@ import riscv.core.CPUBundle
 import riscv.core.CSR
 import riscv.core.RegisterFile
 import riscv.Parameters
+import riscv.SoCConfig
 
 /**
  * CPU: Five-stage pipelined RISC-V RV32I processor with advanced optimizations
@@ -111,13 +112,15 @@ import riscv.Parameters
  * - interrupt_flag: External interrupt input
  * - debug_read_address/data: Register file inspection
  * - csr_debug_read_address/data: CSR inspection
+ *
+ * @param config Elaboration-time sizes (predictors, bus slave count)
  */
-class PipelinedCPU extends Module {
-  val io = IO(new CPUBundle)
+class PipelinedCPU(config: SoCConfig = SoCConfig()) extends Module {
+  val io = IO(new CPUBundle(config.slaveDeviceCountBits))
 
   val ctrl       = Module(new Control)
   val regs       = Module(new RegisterFile)
-  val inst_fetch = Module(new InstructionFetch)
+  val inst_fetch = Module(new InstructionFetch(config))
   val if2id      = Module(new IF2ID)
   val id         = Module(new InstructionDecode)
   val id2ex      = Module(new ID2EX)
@@ -129,6 +132,11 @@ class PipelinedCPU extends Module {
   val forwarding = Module(new Forwarding)
   val clint      = Module(new CLINT)
   val csr_regs   = Module(new CSR)
+  val icache     = Module(new ICache(config.icacheSizeBytes, config.icacheWays, config.icacheLineBytes))
+  val tcm        = Module(new DataTCM(config.tcmSizeBytes))
+  val dcache     = Module(
+    new DCache(config.dcacheSizeBytes, config.dcacheWays, config.dcacheLineBytes, config.slaveDeviceCountBits)
+  )
 
   ctrl.io.jump_flag               := id.io.if_jump_flag
   ctrl.io.jump_instruction_id     := id.io.ctrl_jump_instruction
@@ -164,8 +172,16 @@ class PipelinedCPU extends Module {
   inst_fetch.io.stall_flag_ctrl   := ctrl.io.pc_stall || mem_stall
   inst_fetch.io.jump_flag_id      := id.io.if_jump_flag
   inst_fetch.io.jump_address_id   := id.io.if_jump_address
-  inst_fetch.io.rom_instruction   := io.instruction
-  inst_fetch.io.instruction_valid := io.instruction_valid
+  inst_fetch.io.rom_instruction   := icache.io.instruction
+  inst_fetch.io.instruction_valid := icache.io.instruction_valid
+
+  // Instruction cache in front of the external fetch port (bypassed when disabled)
+  icache.io.enable                := io.icache_enable
+  icache.io.address               := inst_fetch.io.instruction_address
+  icache.io.fetch                 := !(ctrl.io.pc_stall || mem_stall)
+  icache.io.rom_instruction       := io.instruction
+  icache.io.rom_instruction_valid := io.instruction_valid
+  io.icache_refill <> icache.io.refill
 
   // Prediction signals from IF2ID pipeline register (all predictors)
   val btb_predicted    = if2id.io.output_btb_predicted_taken
@@ -447,11 +463,26 @@ class PipelinedCPU extends Module {
   mem.io.regs_write_enable   := ex2mem.io.output_regs_write_enable
   mem.io.csr_read_data       := ex2mem.io.output_csr_read_data
   mem.io.instruction_address := ex2mem.io.output_instruction_address // For JAL/JALR forwarding
-  io.device_select := mem.io.bus
-    .address(Parameters.AddrBits - 1, Parameters.AddrBits - Parameters.SlaveDeviceCountBits)
-  io.memory_bundle <> mem.io.bus
-  io.memory_bundle.address := 0.U(Parameters.SlaveDeviceCountBits.W) ## mem.io.bus
-    .address(Parameters.AddrBits - 1 - Parameters.SlaveDeviceCountBits, 0)
+  // Loads and stores in the TCM window go to the data TCM; the rest go through
+  // the store buffer and then the D-cache, which passes MMIO (and everything
+  // while disabled) straight through to the AXI4-Lite master
+  tcm.io <> mem.io.tcm
+  dcache.io.enable := io.dcache_enable
+  val store_buffer_full = Wire(Bool())
+  if (config.storeBufferDepth > 0) {
+    val store_buffer = Module(new StoreBuffer(config.storeBufferDepth, config.slaveDeviceCountBits))
+    store_buffer.io.cpu <> mem.io.bus
+    dcache.io.cpu <> store_buffer.io.mem
+    store_buffer_full := store_buffer.io.full_stall
+  } else {
+    dcache.io.cpu <> mem.io.bus
+    store_buffer_full := false.B
+  }
+  io.device_select := dcache.io.mem
+    .address(Parameters.AddrBits - 1, Parameters.AddrBits - config.slaveDeviceCountBits)
+  io.memory_bundle <> dcache.io.mem
+  io.memory_bundle.address := 0.U(config.slaveDeviceCountBits.W) ## dcache.io.mem
+    .address(Parameters.AddrBits - 1 - config.slaveDeviceCountBits, 0)
 
   mem2wb.io.stall               := mem_stall
   mem2wb.io.instruction_address := ex2mem.io.output_instruction_address
@@ -517,12 +548,22 @@ class PipelinedCPU extends Module {
   //
   // For now, we use a simpler but slightly imprecise metric:
   // - Count register-writing instructions in WB
-  // - Count stores when they complete (write_data_accepted)
+  // - Count stores when they complete (write_valid: accepted by the store buffer, a D-cache hit or the TCM)
   // This may undercount branches that don't write registers, but matches typical CPI analysis.
   val wb_instruction_valid = mem2wb.io.output_regs_write_enable
-  val store_completed      = mem.io.bus.write && mem.io.bus.write_valid // Store completes
+  val store_completed      = mem.io.bus.write_valid || mem.io.tcm.write // Store completes
   csr_regs.io.instruction_retired := (wb_instruction_valid || store_completed) && !mem_stall
 
+  // Retirement trace: write-backs as they leave WB, stores as they start on the bus or write the TCM
+  io.retire.reg_valid     := wb_instruction_valid && !mem_stall
+  io.retire.reg_pc        := mem2wb.io.output_instruction_address
+  io.retire.reg_rd        := mem2wb.io.output_regs_write_address(Parameters.PhysicalRegisterAddrBits - 1, 0)
+  io.retire.reg_data      := wb.io.regs_write_data
+  io.retire.store_valid   := mem.io.bus.write && mem.io.bus.granted || mem.io.tcm.write
+  io.retire.store_address := mem.io.bus.address
+  io.retire.store_data    := mem.io.bus.write_data
+  io.retire.store_strobe  := mem.io.bus.write_strobe.asUInt
+
   // Branch misprediction: BTB, RAS, or IndirectBTB predicted wrong
   // Gate with !mem_stall to ensure single-cycle pulse.
   // - mem_stall: Pipeline frozen (would count same misprediction multiple times)
@@ -592,6 +633,21 @@ class PipelinedCPU extends Module {
   // Pulse semantics: Single-cycle event per prediction (branch_hazard and mem_stall gating).
   csr_regs.io.btb_predicted := btb_predicted && is_branch_or_jump && !id.io.branch_hazard && !mem_stall
 
+  // I-cache hits/misses (mhpmcounter10/11): hits count fetches accepted by IF (not stalled),
+  // misses count line refills. Both stay 0 while the cache is disabled (ideal fetch).
+  csr_regs.io.icache_hit  := icache.io.hit
+  csr_regs.io.icache_miss := icache.io.miss
+
+  // D-cache hits/misses/write-backs (mhpmcounter12-14): a hit is a cached load or store
+  // answered without a refill, a miss starts a refill, a write-back is one dirty line.
+  // All stay 0 while the cache is disabled.
+  csr_regs.io.dcache_hit        := dcache.io.hit
+  csr_regs.io.dcache_miss       := dcache.io.miss
+  csr_regs.io.dcache_write_back := dcache.io.write_back
+
+  // Store buffer full stalls (mhpmcounter15): cycles a store waits for a free entry
+  csr_regs.io.store_buffer_full := store_buffer_full
+
   // Initialize unused CPUBundle signals (used by wrapper, not by pipeline core)
   io.bus_address                                 := 0.U
   io.axi4_channels.read_address_channel.ARADDR   := 0.U
@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: MIT
+// MyCPU is freely redistributable under the MIT License. See the file
+// "LICENSE" for information on usage and redistribution of this file.
+
+package riscv.core
+
+import chisel3._
+import riscv.Parameters
+
+/**
+ * Retirement trace for co-simulation against a reference model.
+ *
+ * - reg_*: one pulse per register write-back, in program order, on the last
+ *   cycle the instruction sits in WB (MEM2WB holds it while mem_stall is high)
+ * - store_*: one pulse per store, when MemoryAccess starts the bus write;
+ *   address is word-aligned, data/strobe are as driven on the bus
+ *
+ * Branches and other instructions without either effect produce no pulse.
+ */
+class RetireBundle extends Bundle {
+  val reg_valid     = Output(Bool())
+  val reg_pc        = Output(UInt(Parameters.AddrWidth))
+  val reg_rd        = Output(UInt(Parameters.PhysicalRegisterAddrWidth))
+  val reg_data      = Output(UInt(Parameters.DataWidth))
+  val store_valid   = Output(Bool())
+  val store_address = Output(UInt(Parameters.AddrWidth))
+  val store_data    = Output(UInt(Parameters.DataWidth))
+  val store_strobe  = Output(UInt(Parameters.WordSize.W))
+}
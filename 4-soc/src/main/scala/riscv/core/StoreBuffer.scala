@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: MIT
+// MyCPU is freely redistributable under the MIT License. See the file
+// "LICENSE" for information on usage and redistribution of this file.
+
+package riscv.core
+
+import chisel3._
+import chisel3.util._
+import riscv.Parameters
+
+class StoreBufferEntry extends Bundle {
+  val address = UInt(Parameters.AddrWidth) // Word aligned
+  val data    = UInt(Parameters.DataWidth)
+  val strobe  = UInt(Parameters.WordSize.W)
+}
+
+/**
+ * StoreBuffer: Non-blocking store FIFO between MemoryAccess and the DCache
+ *
+ * A store is accepted (granted, write_valid) in the cycle MemoryAccess issues
+ * it as long as an entry is free, so MEM does not wait for the AXI4-Lite
+ * write response. Entries drain in program order; the next entry is issued
+ * as soon as the bus grants it, without waiting for the previous write
+ * response, so a run of stores drains one per cycle on a pipelined bus.
+ *
+ * Loads:
+ * - Main memory above the mailbox page: answered from the youngest buffered
+ *   store to the same word when that store wrote all four bytes; otherwise
+ *   sent ahead of the buffered stores when none of them touches the word
+ * - MMIO, the mailbox page, and any load while a mailbox store (test
+ *   handshake, host-call doorbell) is buffered: wait until the buffer is
+ *   empty, so device and host-call side effects stay in program order
+ * - A partially overlapping load also waits for the buffer to drain
+ *
+ * Entries are kept oldest-first and shift down as the head's write
+ * response returns; the oldest `inflight` entries have been issued.
+ *
+ * Performance counters:
+ * - full_stall: a store is waiting for a free entry (mhpmcounter15)
+ *
+ * @param depth                Number of entries (>= 1)
+ * @param slaveDeviceCountBits Address bits decoding the bus slave
+ */
+class StoreBuffer(depth: Int = 4, slaveDeviceCountBits: Int = Parameters.SlaveDeviceCountBits) extends Module {
+  require(depth >= 1, "StoreBuffer needs at least one entry")
+
+  val io = IO(new Bundle {
+    val cpu = Flipped(new BusBundle) // MemoryAccess
+    val mem = new BusBundle          // DCache
+
+    val full_stall = Output(Bool())
+  })
+
+  val entries  = Reg(Vec(depth, new StoreBufferEntry))
+  val count    = RegInit(0.U(log2Ceil(depth + 1).W))
+  val inflight = RegInit(0.U(log2Ceil(depth + 1).W)) // Oldest entries issued, write response pending
+  val loading  = RegInit(false.B)                      // Load sent to the bus, waiting for read_valid
+
+  val empty = count === 0.U
+  val full  = count === depth.U
+  val live  = VecInit((0 until depth).map(i => i.U < count))
+
+  def word_of(address: UInt) = address(Parameters.AddrBits - 1, 2)
+  def main_memory(address: UInt) =
+    address(Parameters.AddrBits - 1, Parameters.AddrBits - slaveDeviceCountBits) === 0.U &&
+      address(Parameters.AddrBits - 1, log2Ceil(DCache.MailboxBytes)) =/= 0.U
+
+  val address = io.cpu.address
+  val load    = io.cpu.request && io.cpu.read && !loading
+  val store   = io.cpu.request && io.cpu.write
+
+  // Load lookup (combinational)
+  val matches  = VecInit((0 until depth).map(i => live(i) && word_of(entries(i).address) === word_of(address)))
+  val barrier  = (0 until depth).map(i => live(i) && !main_memory(entries(i).address)).reduce(_ || _)
+  val youngest = PriorityMux(matches.reverse, entries.reverse)
+  val ordered  = !main_memory(address) || barrier
+  val forward  = load && !ordered && matches.asUInt.orR && youngest.strobe.andR
+  val bypass   = load && (empty || !ordered && !matches.asUInt.orR)
+
+  // Default: drain the oldest entry not yet issued; the CPU side sees no response
+  val next  = MuxLookup(inflight, entries(0))((0 until depth).map(i => i.U -> entries(i)))
+  val drain = inflight =/= count && !loading
+  io.mem.address             := next.address
+  io.mem.read                := false.B
+  io.mem.write               := drain
+  io.mem.write_data          := next.data
+  io.mem.write_strobe        := VecInit(next.strobe.asBools)
+  io.mem.request             := drain
+  io.cpu.read_data           := io.mem.read_data
+  io.cpu.read_valid          := false.B
+  io.cpu.write_valid         := false.B
+  io.cpu.write_data_accepted := false.B
+  io.cpu.busy                := io.mem.busy
+  io.cpu.granted             := false.B
+  io.full_stall              := store && full
+
+  when(bypass || loading) {
+    // The load owns the bus until its data returns
+    io.mem.address      := address
+    io.mem.read         := io.cpu.read
+    io.mem.write        := false.B
+    io.mem.write_strobe := VecInit(Seq.fill(Parameters.WordSize)(false.B))
+    io.mem.request      := io.cpu.request
+    io.cpu.read_valid   := io.mem.read_valid
+    io.cpu.granted      := io.mem.granted
+    when(bypass && io.mem.granted && !io.mem.read_valid) {
+      loading := true.B
+    }
+    when(loading && io.mem.read_valid) {
+      loading := false.B
+    }
+  }.elsewhen(forward) {
+    io.cpu.read_data  := youngest.data
+    io.cpu.read_valid := true.B
+    io.cpu.granted    := true.B
+  }
+
+  // Write responses return in order: each one retires the head entry
+  val issue   = io.mem.request && io.mem.write && io.mem.granted
+  val dequeue = io.mem.write_valid && (inflight =/= 0.U || issue)
+  inflight := inflight + issue.asUInt - dequeue.asUInt
+
+  val enqueue = store && !full
+  when(enqueue) {
+    io.cpu.granted     := true.B
+    io.cpu.write_valid := true.B
+  }
+
+  val shifted = Wire(Vec(depth, new StoreBufferEntry))
+  for (i <- 0 until depth) {
+    shifted(i) := (if (i + 1 < depth) entries(i + 1) else entries(i))
+  }
+  val next_entries = Mux(dequeue, shifted, entries)
+  val tail         = Mux(dequeue, count - 1.U, count)
+  entries := next_entries
+  when(enqueue) {
+    entries(tail).address := Cat(address(Parameters.AddrBits - 1, 2), 0.U(2.W))
+    entries(tail).data    := io.cpu.write_data
+    entries(tail).strobe  := io.cpu.write_strobe.asUInt
+  }
+  count := count + enqueue.asUInt - dequeue.asUInt
+}
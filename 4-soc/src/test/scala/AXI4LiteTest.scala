@@ -4,6 +4,8 @@
 
 import bus.AXI4LiteMaster
 import bus.AXI4LiteSlave
+import bus.BusArbiter
+import bus.BusSwitch
 import chisel3._
 import chiseltest._
 import org.scalatest.flatspec.AnyFlatSpec
@@ -85,4 +87,184 @@ class AXI4LiteTest extends AnyFlatSpec with ChiselScalatestTester {
       assert(dut.io.done.peek().litToBoolean, s"Write transaction did not complete in $cycles cycles")
     }
   }
+
+  it should "sustain one read per cycle with back-to-back requests" in {
+    test(new Module {
+      val io = IO(new Bundle {
+        val read_valid = Output(Bool())
+        val read_data  = Output(UInt(Parameters.DataWidth))
+      })
+
+      val master = Module(new AXI4LiteMaster(Parameters.AddrBits, Parameters.DataBits))
+      val slave  = Module(new AXI4LiteSlave(Parameters.AddrBits, Parameters.DataBits))
+
+      master.io.channels <> slave.io.channels
+
+      // Request the next word as soon as the previous request is granted
+      val address = RegInit(0x1000.U(Parameters.AddrWidth))
+      when(master.io.bundle.granted) {
+        address := address + 4.U
+      }
+      master.io.bundle.address      := address
+      master.io.bundle.read         := true.B
+      master.io.bundle.write        := false.B
+      master.io.bundle.write_data   := 0.U
+      master.io.bundle.write_strobe := VecInit(Seq.fill(Parameters.WordSize)(false.B))
+
+      // Slave answers in the cycle it sees the read, returning the address
+      slave.io.bundle.read_data  := slave.io.bundle.address
+      slave.io.bundle.read_valid := slave.io.bundle.read
+
+      io.read_valid := master.io.bundle.read_valid
+      io.read_data  := master.io.bundle.read_data
+    }) { dut =>
+      var cycles = 0
+      while (!dut.io.read_valid.peekBoolean() && cycles < 20) {
+        dut.clock.step()
+        cycles += 1
+      }
+      for (i <- 0 until 8) {
+        dut.io.read_valid.expect(true.B)
+        dut.io.read_data.expect((0x1000 + 4 * i).U)
+        dut.clock.step()
+      }
+    }
+  }
+
+  it should "sustain one write per cycle with back-to-back requests" in {
+    test(new Module {
+      val io = IO(new Bundle {
+        val write   = Output(Bool())
+        val address = Output(UInt(Parameters.AddrWidth))
+        val data    = Output(UInt(Parameters.DataWidth))
+      })
+
+      val master = Module(new AXI4LiteMaster(Parameters.AddrBits, Parameters.DataBits))
+      val slave  = Module(new AXI4LiteSlave(Parameters.AddrBits, Parameters.DataBits))
+
+      master.io.channels <> slave.io.channels
+
+      val address = RegInit(0x2000.U(Parameters.AddrWidth))
+      when(master.io.bundle.granted) {
+        address := address + 4.U
+      }
+      master.io.bundle.address      := address
+      master.io.bundle.read         := false.B
+      master.io.bundle.write        := true.B
+      master.io.bundle.write_data   := ~address
+      master.io.bundle.write_strobe := VecInit(Seq.fill(Parameters.WordSize)(true.B))
+
+      slave.io.bundle.read_data  := 0.U
+      slave.io.bundle.read_valid := false.B
+
+      io.write   := slave.io.bundle.write
+      io.address := slave.io.bundle.address
+      io.data    := slave.io.bundle.write_data
+    }) { dut =>
+      var cycles = 0
+      while (!dut.io.write.peekBoolean() && cycles < 20) {
+        dut.clock.step()
+        cycles += 1
+      }
+      for (i <- 0 until 8) {
+        dut.io.write.expect(true.B)
+        dut.io.address.expect((0x2000 + 4 * i).U)
+        dut.io.data.expect((~(0x2000L + 4 * i) & 0xffffffffL).U)
+        dut.clock.step()
+      }
+    }
+  }
+
+  it should "keep read responses in order across BusSwitch slaves" in {
+    val addresses = Seq(0x00000100L, 0x00000104L, 0x40000000L, 0x40000004L, 0x00000108L, 0x40000008L)
+    test(new Module {
+      val io = IO(new Bundle {
+        val read_valid = Output(Bool())
+        val read_data  = Output(UInt(Parameters.DataWidth))
+      })
+
+      val master     = Module(new AXI4LiteMaster(Parameters.AddrBits, Parameters.DataBits))
+      val bus_switch = Module(new BusSwitch(4))
+      val slaves     = Seq.fill(4)(Module(new AXI4LiteSlave(Parameters.AddrBits, Parameters.DataBits)))
+
+      bus_switch.io.master <> master.io.channels
+      for (i <- 0 until 4) {
+        bus_switch.io.slaves(i) <> slaves(i).io.channels
+        // Slave 0 answers a cycle later than slave 2, so a reordering switch would be caught
+        val delayed = RegNext(slaves(i).io.bundle.read, false.B) && slaves(i).io.bundle.read
+        slaves(i).io.bundle.read_data  := slaves(i).io.bundle.address
+        slaves(i).io.bundle.read_valid := (if (i == 0) delayed else slaves(i).io.bundle.read)
+      }
+
+      val rom   = VecInit(addresses.map(_.U(Parameters.AddrWidth)))
+      val index = RegInit(0.U(4.W))
+      when(master.io.bundle.granted) {
+        index := index + 1.U
+      }
+      master.io.bundle.address      := rom(index)
+      master.io.bundle.read         := index < addresses.length.U
+      master.io.bundle.write        := false.B
+      master.io.bundle.write_data   := 0.U
+      master.io.bundle.write_strobe := VecInit(Seq.fill(Parameters.WordSize)(false.B))
+
+      io.read_valid := master.io.bundle.read_valid
+      io.read_data  := master.io.bundle.read_data
+    }) { dut =>
+      val seen   = scala.collection.mutable.ArrayBuffer[BigInt]()
+      var cycles = 0
+      while (seen.length < addresses.length && cycles < 100) {
+        if (dut.io.read_valid.peekBoolean()) seen += dut.io.read_data.peekInt()
+        dut.clock.step()
+        cycles += 1
+      }
+      assert(seen == addresses.map(BigInt(_)))
+    }
+  }
+
+  it should "share one slave between two masters in round-robin order" in {
+    test(new Module {
+      val io = IO(new Bundle {
+        val read_valid = Output(Vec(2, Bool()))
+        val read_data  = Output(Vec(2, UInt(Parameters.DataWidth)))
+      })
+
+      val masters     = Seq.fill(2)(Module(new AXI4LiteMaster(Parameters.AddrBits, Parameters.DataBits)))
+      val bus_arbiter = Module(new BusArbiter(2))
+      val slave       = Module(new AXI4LiteSlave(Parameters.AddrBits, Parameters.DataBits))
+
+      slave.io.channels <> bus_arbiter.io.slave
+      slave.io.bundle.read_data  := slave.io.bundle.address
+      slave.io.bundle.read_valid := slave.io.bundle.read
+
+      // Both masters stream reads as fast as they are granted: master i reads 0x1000 * (i + 1) upwards
+      for (i <- 0 until 2) {
+        bus_arbiter.io.masters(i) <> masters(i).io.channels
+        val address = RegInit((0x1000 * (i + 1)).U(Parameters.AddrWidth))
+        when(masters(i).io.bundle.granted) {
+          address := address + 4.U
+        }
+        masters(i).io.bundle.address      := address
+        masters(i).io.bundle.read         := true.B
+        masters(i).io.bundle.write        := false.B
+        masters(i).io.bundle.write_data   := 0.U
+        masters(i).io.bundle.write_strobe := VecInit(Seq.fill(Parameters.WordSize)(false.B))
+        io.read_valid(i)                  := masters(i).io.bundle.read_valid
+        io.read_data(i)                   := masters(i).io.bundle.read_data
+      }
+    }) { dut =>
+      val seen = Seq.fill(2)(scala.collection.mutable.ArrayBuffer[BigInt]())
+      for (_ <- 0 until 60) {
+        for (i <- 0 until 2) {
+          if (dut.io.read_valid(i).peekBoolean()) seen(i) += dut.io.read_data(i).peekInt()
+        }
+        dut.clock.step()
+      }
+      // Each master gets its own data in order, and neither is starved
+      for (i <- 0 until 2) {
+        assert(seen(i).length >= 6, s"master $i completed ${seen(i).length} reads")
+        assert(seen(i) == seen(i).indices.map(n => BigInt(0x1000 * (i + 1) + 4 * n)))
+      }
+      assert((seen(0).length - seen(1).length).abs <= 1)
+    }
+  }
 }
@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: MIT
+// MyCPU is freely redistributable under the MIT License. See the file
+// "LICENSE" for information on usage and redistribution of this file.
+
+package riscv
+
+import scala.collection.mutable
+
+import chisel3._
+import chiseltest._
+import org.scalatest.flatspec.AnyFlatSpec
+import riscv.core.DCache
+
+class DCacheTest extends AnyFlatSpec with ChiselScalatestTester {
+  behavior.of("DCache")
+
+  // Memory side: an AXI4-Lite master in front of word-addressed memory,
+  // answering each transaction `latency` cycles after it starts
+  class MemoryModel(dut: DCache, latency: Int = 2) {
+    val words      = mutable.Map[Long, BigInt]().withDefault(a => BigInt(a) + 0x1000)
+    val writes     = mutable.ArrayBuffer[Long]()
+    var busy       = false
+    var remaining  = 0
+    var op_write   = false
+    var op_address = 0L
+    var reads      = 0
+
+    // One clock cycle; returns (granted, read_valid, read_data, write_valid) seen by the CPU side
+    def cycle(): (Boolean, Boolean, BigInt, Boolean) = {
+      val respond = busy && remaining == 0
+      dut.io.mem.read_valid.poke((respond && !op_write).B)
+      dut.io.mem.write_valid.poke((respond && op_write).B)
+      dut.io.mem.read_data.poke(if (respond && !op_write) words(op_address).U else 0.U)
+      if (respond) busy = false
+      dut.io.mem.granted.poke((!busy).B)
+      dut.io.mem.busy.poke(busy.B)
+      dut.io.mem.write_data_accepted.poke(false.B)
+
+      val request = dut.io.mem.request.peekBoolean()
+      if (!busy && request && (dut.io.mem.read.peekBoolean() || dut.io.mem.write.peekBoolean())) {
+        op_write   = dut.io.mem.write.peekBoolean()
+        op_address = dut.io.mem.address.peekInt().toLong
+        if (op_write) {
+          words(op_address) = dut.io.mem.write_data.peekInt()
+          writes += op_address
+        } else {
+          reads += 1
+        }
+        busy      = true
+        remaining = latency
+      }
+      val seen = (
+        dut.io.cpu.granted.peekBoolean(),
+        dut.io.cpu.read_valid.peekBoolean(),
+        dut.io.cpu.read_data.peekInt(),
+        dut.io.cpu.write_valid.peekBoolean()
+      )
+      dut.clock.step()
+      if (busy && remaining > 0) remaining -= 1
+      seen
+    }
+  }
+
+  def request(dut: DCache, address: Long, write: Boolean = false, data: BigInt = 0): Unit = {
+    dut.io.cpu.request.poke(true.B)
+    dut.io.cpu.read.poke((!write).B)
+    dut.io.cpu.write.poke(write.B)
+    dut.io.cpu.address.poke(address.U)
+    dut.io.cpu.write_data.poke(data.U)
+    for (i <- 0 until Parameters.WordSize) dut.io.cpu.write_strobe(i).poke(write.B)
+  }
+
+  // Issue one access like MemoryAccess (request/read/write only until granted)
+  // and run until it completes; returns (cycles, read data)
+  def access(dut: DCache, model: MemoryModel, address: Long, write: Boolean = false, data: BigInt = 0)
+      : (Int, BigInt) = {
+    request(dut, address, write, data)
+    var cycles = 0
+    while (cycles < 2000) {
+      val (granted, rv, rdata, wv) = model.cycle()
+      cycles += 1
+      if (rv || wv) {
+        dut.io.cpu.request.poke(false.B)
+        dut.io.cpu.read.poke(false.B)
+        dut.io.cpu.write.poke(false.B)
+        return (cycles, rdata)
+      }
+      if (granted) {
+        dut.io.cpu.read.poke(false.B)
+        dut.io.cpu.write.poke(false.B)
+      }
+    }
+    fail(f"access to 0x$address%x did not complete")
+  }
+
+  def setup(dut: DCache, enable: Boolean): MemoryModel = {
+    dut.io.enable.poke(enable.B)
+    dut.io.cpu.request.poke(false.B)
+    dut.io.cpu.read.poke(false.B)
+    dut.io.cpu.write.poke(false.B)
+    new MemoryModel(dut)
+  }
+
+  it should "pass every access through when disabled" in {
+    test(new DCache).withAnnotations(TestAnnotations.annos) { dut =>
+      val model = setup(dut, enable = false)
+      assert(access(dut, model, 0x2004)._2 == 0x3004)
+      assert(access(dut, model, 0x2004)._2 == 0x3004)
+      assert(model.reads == 2)
+    }
+  }
+
+  it should "refill a line on a miss and then hit without stalling" in {
+    test(new DCache).withAnnotations(TestAnnotations.annos) { dut =>
+      val model = setup(dut, enable = true)
+      val (miss_cycles, data) = access(dut, model, 0x2004)
+      assert(data == 0x3004)
+      assert(model.reads == 4 && miss_cycles > 4)
+
+      request(dut, 0x200c)
+      dut.io.cpu.read_valid.expect(true.B)
+      dut.io.cpu.read_data.expect(0x300c.U)
+      dut.io.hit.expect(true.B)
+      assert(access(dut, model, 0x200c)._1 == 1)
+      assert(model.reads == 4)
+    }
+  }
+
+  it should "write a dirty line back before reusing its set" in {
+    test(new DCache).withAnnotations(TestAnnotations.annos) { dut =>
+      val model = setup(dut, enable = true)
+      access(dut, model, 0x2000, write = true, data = 0xabcd)
+      assert(model.writes.isEmpty)
+      assert(access(dut, model, 0x2000)._2 == 0xabcd)
+
+      // 4 KiB apart: same set of the direct-mapped cache
+      assert(access(dut, model, 0x3000)._2 == 0x4000)
+      assert(model.writes == Seq(0x2000L, 0x2004L, 0x2008L, 0x200cL))
+      assert(model.words(0x2000) == 0xabcd)
+    }
+  }
+
+  it should "flush dirty lines before a mailbox store" in {
+    test(new DCache).withAnnotations(TestAnnotations.annos) { dut =>
+      val model = setup(dut, enable = true)
+      access(dut, model, 0x2008, write = true, data = 0x55)
+      access(dut, model, 0x100, write = true, data = 0xcafef00dL)
+      assert(model.writes == Seq(0x2000L, 0x2004L, 0x2008L, 0x200cL, 0x100L))
+      assert(model.words(0x2008) == 0x55)
+    }
+  }
+
+  it should "not cache MMIO" in {
+    test(new DCache).withAnnotations(TestAnnotations.annos) { dut =>
+      val model = setup(dut, enable = true)
+      access(dut, model, 0x40000000L)
+      access(dut, model, 0x40000000L)
+      assert(model.reads == 2)
+    }
+  }
+}
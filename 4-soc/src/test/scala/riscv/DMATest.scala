@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: MIT
+// MyCPU is freely redistributable under the MIT License. See the file
+// "LICENSE" for information on usage and redistribution of this file.
+
+package riscv
+
+import scala.collection.mutable
+
+import bus.AXI4LiteMaster
+import bus.AXI4LiteMasterBundle
+import bus.AXI4LiteSlave
+import bus.AXI4LiteSlaveBundle
+import chisel3._
+import chiseltest._
+import org.scalatest.flatspec.AnyFlatSpec
+import peripheral.DMA
+
+// DMA with an AXI4-Lite master for register access (cpu) and an AXI4-Lite
+// slave adapter on its bus port (mem)
+class DMAHarness extends Module {
+  val io = IO(new Bundle {
+    val cpu              = new AXI4LiteMasterBundle(Parameters.AddrBits, Parameters.DataBits)
+    val mem              = new AXI4LiteSlaveBundle(Parameters.AddrBits, Parameters.DataBits)
+    val signal_interrupt = Output(Bool())
+  })
+
+  val dma    = Module(new DMA)
+  val master = Module(new AXI4LiteMaster(Parameters.AddrBits, Parameters.DataBits))
+  val slave  = Module(new AXI4LiteSlave(Parameters.AddrBits, Parameters.DataBits))
+
+  master.io.bundle <> io.cpu
+  dma.io.channels <> master.io.channels
+  slave.io.channels <> dma.io.master
+  io.mem <> slave.io.bundle
+  io.signal_interrupt := dma.io.signal_interrupt
+}
+
+class DMATest extends AnyFlatSpec with ChiselScalatestTester {
+  behavior.of("DMA")
+
+  // Word-addressed memory answering reads in the cycle they reach the
+  // device port; `log` records every write in bus order
+  class MemoryModel(dut: DMAHarness) {
+    val words = mutable.Map[Long, BigInt]().withDefault(a => BigInt(a) ^ 0x5a5a0000L)
+    val log   = mutable.ArrayBuffer[(Long, BigInt)]()
+
+    def cycle(): Unit = {
+      val address = dut.io.mem.address.peekInt().toLong
+      val read    = dut.io.mem.read.peekBoolean()
+      dut.io.mem.read_valid.poke(read.B)
+      dut.io.mem.read_data.poke(if (read) words(address).U else 0.U)
+      if (dut.io.mem.write.peekBoolean()) {
+        val data = dut.io.mem.write_data.peekInt()
+        words(address) = data
+        log += ((address, data))
+      }
+      dut.clock.step()
+    }
+  }
+
+  // Register access through the CPU-side master: request until granted,
+  // then wait for the response
+  def access(dut: DMAHarness, model: MemoryModel, offset: Int, write: Boolean = false, data: BigInt = 0): BigInt = {
+    dut.io.cpu.address.poke(offset.U)
+    dut.io.cpu.read.poke((!write).B)
+    dut.io.cpu.write.poke(write.B)
+    dut.io.cpu.write_data.poke(data.U)
+    for (i <- 0 until Parameters.WordSize) dut.io.cpu.write_strobe(i).poke(write.B)
+    var cycles = 0
+    while (cycles < 100) {
+      if (dut.io.cpu.granted.peekBoolean()) {
+        model.cycle()
+        dut.io.cpu.read.poke(false.B)
+        dut.io.cpu.write.poke(false.B)
+        while (!dut.io.cpu.read_valid.peekBoolean() && !dut.io.cpu.write_valid.peekBoolean()) model.cycle()
+        val result = dut.io.cpu.read_data.peekInt()
+        model.cycle()
+        return result
+      }
+      model.cycle()
+      cycles += 1
+    }
+    fail(f"register access to 0x$offset%x was not granted")
+  }
+
+  def setup(dut: DMAHarness): MemoryModel = {
+    dut.io.cpu.read.poke(false.B)
+    dut.io.cpu.write.poke(false.B)
+    new MemoryModel(dut)
+  }
+
+  def waitFor(dut: DMAHarness, model: MemoryModel)(condition: => Boolean): Unit = {
+    var cycles = 0
+    while (!condition && cycles < 1000) {
+      model.cycle()
+      cycles += 1
+    }
+    assert(condition, "DMA transfer did not complete")
+  }
+
+  it should "copy a block and signal completion" in {
+    test(new DMAHarness).withAnnotations(TestAnnotations.annos) { dut =>
+      val model = setup(dut)
+      access(dut, model, 0x00, write = true, data = 0x1000)
+      access(dut, model, 0x04, write = true, data = 0x2000)
+      access(dut, model, 0x08, write = true, data = 16)
+      access(dut, model, 0x14, write = true, data = 3) // start, interrupt enable
+      assert((access(dut, model, 0x18) & 1) == 1)
+      waitFor(dut, model)(dut.io.signal_interrupt.peekBoolean())
+
+      assert(model.log.map(_._1) == (0 until 16).map(i => 0x2000L + 4 * i))
+      for (i <- 0 until 16) assert(model.words(0x2000L + 4 * i) == model.words(0x1000L + 4 * i))
+      assert(access(dut, model, 0x18) == 2)
+      assert(access(dut, model, 0x08) == 0)
+
+      access(dut, model, 0x18, write = true, data = 2)
+      dut.io.signal_interrupt.expect(false.B)
+    }
+  }
+
+  it should "write every word to one register with a zero destination stride" in {
+    test(new DMAHarness).withAnnotations(TestAnnotations.annos) { dut =>
+      val model = setup(dut)
+      access(dut, model, 0x00, write = true, data = 0x3000)
+      access(dut, model, 0x04, write = true, data = 0x20000014L)
+      access(dut, model, 0x08, write = true, data = 8)
+      access(dut, model, 0x10, write = true, data = 0)
+      access(dut, model, 0x14, write = true, data = 1)
+      waitFor(dut, model)(access(dut, model, 0x18) == 2)
+
+      assert(model.log.map(_._1) == Seq.fill(8)(0x20000014L))
+      assert(model.log.map(_._2) == (0 until 8).map(i => model.words(0x3000L + 4 * i)))
+      dut.io.signal_interrupt.expect(false.B)
+    }
+  }
+
+  it should "ignore register writes while busy" in {
+    test(new DMAHarness).withAnnotations(TestAnnotations.annos) { dut =>
+      val model = setup(dut)
+      access(dut, model, 0x00, write = true, data = 0x1000)
+      access(dut, model, 0x04, write = true, data = 0x2000)
+      access(dut, model, 0x08, write = true, data = 64)
+      access(dut, model, 0x14, write = true, data = 1)
+      access(dut, model, 0x04, write = true, data = 0x4000)
+      waitFor(dut, model)(access(dut, model, 0x18) == 2)
+
+      assert(model.log.length == 64)
+      assert(model.log.forall(w => w._1 >= 0x2000L && w._1 < 0x2100L))
+    }
+  }
+}
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: MIT
+// MyCPU is freely redistributable under the MIT License. See the file
+// "LICENSE" for information on usage and redistribution of this file.
+
+package riscv
+
+import chisel3._
+import chiseltest._
+import org.scalatest.flatspec.AnyFlatSpec
+import riscv.core.DataTCM
+
+class DataTCMTest extends AnyFlatSpec with ChiselScalatestTester {
+  behavior.of("DataTCM")
+
+  def write(dut: DataTCM, address: Long, data: BigInt, strobe: Seq[Boolean] = Seq.fill(4)(true)): Unit = {
+    dut.io.address.poke(address.U)
+    dut.io.write.poke(true.B)
+    dut.io.write_data.poke(data.U)
+    for (i <- 0 until Parameters.WordSize) dut.io.write_strobe(i).poke(strobe(i).B)
+    dut.clock.step()
+    dut.io.write.poke(false.B)
+  }
+
+  it should "select only its own window" in {
+    test(new DataTCM(4096)).withAnnotations(TestAnnotations.annos) { dut =>
+      dut.io.address.poke(0x60000000L.U)
+      dut.io.select.expect(true.B)
+      dut.io.address.poke(0x60000ffcL.U)
+      dut.io.select.expect(true.B)
+      dut.io.address.poke(0x60001000L.U)
+      dut.io.select.expect(false.B)
+      dut.io.address.poke(0x00000ffcL.U)
+      dut.io.select.expect(false.B)
+    }
+  }
+
+  it should "read a store back in the next cycle" in {
+    test(new DataTCM(4096)).withAnnotations(TestAnnotations.annos) { dut =>
+      write(dut, 0x60000010L, 0x12345678)
+      dut.io.address.poke(0x60000010L.U)
+      dut.io.read_data.expect(0x12345678.U)
+    }
+  }
+
+  it should "merge byte stores under the strobes" in {
+    test(new DataTCM(4096)).withAnnotations(TestAnnotations.annos) { dut =>
+      write(dut, 0x60000020L, 0x11223344)
+      write(dut, 0x60000020L, 0xaabbccddL, Seq(false, true, false, true))
+      dut.io.address.poke(0x60000020L.U)
+      dut.io.read_data.expect(0xaa22cc44L.U)
+    }
+  }
+
+  it should "ignore stores outside its window" in {
+    test(new DataTCM(4096)).withAnnotations(TestAnnotations.annos) { dut =>
+      write(dut, 0x60000000L, 0x55)
+      write(dut, 0x00000000L, 0x66)
+      dut.io.address.poke(0x60000000L.U)
+      dut.io.read_data.expect(0x55.U)
+    }
+  }
+}
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: MIT
+// MyCPU is freely redistributable under the MIT License. See the file
+// "LICENSE" for information on usage and redistribution of this file.
+
+package riscv
+
+import chisel3._
+import chiseltest._
+import org.scalatest.flatspec.AnyFlatSpec
+import riscv.core.ICache
+
+class ICacheTest extends AnyFlatSpec with ChiselScalatestTester {
+  behavior.of("ICache")
+
+  // Serve one 4-word line refill, word i = base + i
+  def refill(dut: ICache, base: Int): Unit = {
+    dut.io.refill.request.expect(true.B)
+    for (i <- 0 until 4) {
+      dut.io.refill.data.poke((base + i).U)
+      dut.io.refill.data_valid.poke(true.B)
+      dut.io.instruction_valid.expect(false.B)
+      dut.clock.step()
+    }
+    dut.io.refill.data_valid.poke(false.B)
+    dut.io.refill.request.expect(false.B)
+  }
+
+  def setup(dut: ICache, address: Int): Unit = {
+    dut.io.enable.poke(true.B)
+    dut.io.fetch.poke(true.B)
+    dut.io.rom_instruction_valid.poke(true.B)
+    dut.io.rom_instruction.poke(0.U)
+    dut.io.refill.data_valid.poke(false.B)
+    dut.io.address.poke(address.U)
+  }
+
+  it should "pass the ROM port through when disabled" in {
+    test(new ICache).withAnnotations(TestAnnotations.annos) { dut =>
+      setup(dut, 0x1000)
+      dut.io.enable.poke(false.B)
+      dut.io.rom_instruction.poke(0x00000013.U)
+      dut.io.instruction.expect(0x00000013.U)
+      dut.io.instruction_valid.expect(true.B)
+      dut.io.miss.expect(false.B)
+      dut.clock.step()
+      dut.io.refill.request.expect(false.B)
+    }
+  }
+
+  it should "refill a line on a miss and hit afterwards" in {
+    test(new ICache).withAnnotations(TestAnnotations.annos) { dut =>
+      setup(dut, 0x1004)
+      dut.io.instruction_valid.expect(false.B)
+      dut.io.miss.expect(true.B)
+      dut.clock.step()
+
+      dut.io.refill.address.expect(0x1000.U)
+      refill(dut, 0x100)
+
+      dut.io.instruction_valid.expect(true.B)
+      dut.io.instruction.expect(0x101.U)
+      dut.io.hit.expect(true.B)
+      dut.io.miss.expect(false.B)
+
+      dut.io.address.poke(0x100c.U)
+      dut.io.instruction.expect(0x103.U)
+      dut.io.instruction_valid.expect(true.B)
+    }
+  }
+
+  it should "evict a conflicting line when direct-mapped" in {
+    test(new ICache).withAnnotations(TestAnnotations.annos) { dut =>
+      setup(dut, 0x1000)
+      dut.clock.step()
+      refill(dut, 0x100)
+
+      // 4 KiB apart: same set, different tag
+      dut.io.address.poke(0x2000.U)
+      dut.io.miss.expect(true.B)
+      dut.clock.step()
+      refill(dut, 0x200)
+      dut.io.instruction.expect(0x200.U)
+
+      dut.io.address.poke(0x1000.U)
+      dut.io.miss.expect(true.B)
+    }
+  }
+
+  it should "keep both conflicting lines when 2-way" in {
+    test(new ICache(ways = 2)).withAnnotations(TestAnnotations.annos) { dut =>
+      setup(dut, 0x1000)
+      dut.clock.step()
+      refill(dut, 0x100)
+
+      // 2 KiB apart: same set of the 2-way cache, different tag
+      dut.io.address.poke(0x1800.U)
+      dut.io.miss.expect(true.B)
+      dut.clock.step()
+      refill(dut, 0x180)
+      dut.io.instruction.expect(0x180.U)
+
+      dut.io.address.poke(0x1000.U)
+      dut.io.instruction_valid.expect(true.B)
+      dut.io.instruction.expect(0x100.U)
+      dut.io.miss.expect(false.B)
+    }
+  }
+}
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: MIT
+// MyCPU is freely redistributable under the MIT License. See the file
+// "LICENSE" for information on usage and redistribution of this file.
+
+package riscv
+
+import chiseltest._
+import org.scalatest.flatspec.AnyFlatSpec
+import org.scalatest.matchers.should.Matchers
+import riscv.core.CPU
+
+class SoCConfigTest extends AnyFlatSpec with ChiselScalatestTester with Matchers {
+  behavior.of("SoCConfig")
+
+  it should "default to the checked-in Top configuration" in {
+    val config = SoCConfig()
+    config.btbEntries should be(32)
+    config.rasDepth should be(4)
+    config.ibtbEntries should be(8)
+    config.memorySizeInBytes should be(Parameters.MemorySizeInBytes)
+    config.slaveDeviceCount should be(Parameters.SlaveDeviceCount)
+    config.slaveDeviceCountBits should be(Parameters.SlaveDeviceCountBits)
+  }
+
+  it should "parse a sweep spec and keep omitted keys" in {
+    val config = SoCConfig.parse("btb=64, ras=8,mem=0x400000")
+    config should be(SoCConfig(btbEntries = 64, rasDepth = 8, memorySizeInBytes = 0x400000))
+    config.tag should be("btb64-ras8-ibtb8-ic4096w1l16-dc4096w1l16-sb4-tcm32768-mem4194304-slv8")
+    SoCConfig.parse("") should be(SoCConfig())
+  }
+
+  it should "reject malformed specs and invalid sizes" in {
+    an[IllegalArgumentException] should be thrownBy SoCConfig.parse("btb")
+    an[IllegalArgumentException] should be thrownBy SoCConfig.parse("bht=16")
+    an[IllegalArgumentException] should be thrownBy SoCConfig.parse("ras=x")
+    an[IllegalArgumentException] should be thrownBy SoCConfig.parse("btb=24")
+    an[IllegalArgumentException] should be thrownBy SoCConfig.parse("ibtb=2")
+    an[IllegalArgumentException] should be thrownBy SoCConfig.parse("icache_ways=4")
+    an[IllegalArgumentException] should be thrownBy SoCConfig.parse("icache=32")
+    an[IllegalArgumentException] should be thrownBy SoCConfig.parse("dcache_line=4")
+    an[IllegalArgumentException] should be thrownBy SoCConfig.parse("sb=-1")
+    an[IllegalArgumentException] should be thrownBy SoCConfig.parse("tcm=3000")
+    an[IllegalArgumentException] should be thrownBy SoCConfig.parse("mem=6")
+    an[IllegalArgumentException] should be thrownBy SoCConfig.parse("slaves=16")
+    an[IllegalArgumentException] should be thrownBy SoCConfig(slaveDeviceCount = 4)
+  }
+
+  it should "elaborate the CPU with non-default predictor sizes" in {
+    test(new CPU(config = SoCConfig(btbEntries = 8, rasDepth = 8, ibtbEntries = 16)))
+      .withAnnotations(TestAnnotations.annos) { dut =>
+        dut.clock.step(4)
+      }
+  }
+}
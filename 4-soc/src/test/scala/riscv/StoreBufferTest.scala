@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: MIT
+// MyCPU is freely redistributable under the MIT License. See the file
+// "LICENSE" for information on usage and redistribution of this file.
+
+package riscv
+
+import scala.collection.mutable
+
+import chisel3._
+import chiseltest._
+import org.scalatest.flatspec.AnyFlatSpec
+import riscv.core.StoreBuffer
+
+class StoreBufferTest extends AnyFlatSpec with ChiselScalatestTester {
+  behavior.of("StoreBuffer")
+
+  // Memory side: an AXI4-Lite master in front of word-addressed memory,
+  // answering each transaction `latency` cycles after it starts; `log`
+  // records every transaction in bus order
+  class MemoryModel(dut: StoreBuffer, latency: Int = 3) {
+    val words      = mutable.Map[Long, BigInt]().withDefault(a => BigInt(a) + 0x1000)
+    val log        = mutable.ArrayBuffer[(Char, Long)]()
+    var busy       = false
+    var remaining  = 0
+    var op_write   = false
+    var op_address = 0L
+
+    // One clock cycle; returns (granted, read_valid, read_data, write_valid) seen by the CPU side
+    def cycle(): (Boolean, Boolean, BigInt, Boolean) = {
+      val respond = busy && remaining == 0
+      dut.io.mem.read_valid.poke((respond && !op_write).B)
+      dut.io.mem.write_valid.poke((respond && op_write).B)
+      dut.io.mem.read_data.poke(if (respond && !op_write) words(op_address).U else 0.U)
+      if (respond) busy = false
+      dut.io.mem.granted.poke((!busy).B)
+      dut.io.mem.busy.poke(busy.B)
+      dut.io.mem.write_data_accepted.poke(false.B)
+
+      val request = dut.io.mem.request.peekBoolean()
+      if (!busy && request && (dut.io.mem.read.peekBoolean() || dut.io.mem.write.peekBoolean())) {
+        op_write   = dut.io.mem.write.peekBoolean()
+        op_address = dut.io.mem.address.peekInt().toLong
+        if (op_write) words(op_address) = dut.io.mem.write_data.peekInt()
+        log += ((if (op_write) 'W' else 'R', op_address))
+        busy      = true
+        remaining = latency
+      }
+      val seen = (
+        dut.io.cpu.granted.peekBoolean(),
+        dut.io.cpu.read_valid.peekBoolean(),
+        dut.io.cpu.read_data.peekInt(),
+        dut.io.cpu.write_valid.peekBoolean()
+      )
+      dut.clock.step()
+      if (busy && remaining > 0) remaining -= 1
+      seen
+    }
+  }
+
+  // Memory side behind the pipelined AXI4-Lite master: grants a write every
+  // cycle and answers each one `latency` cycles later, in order; `log`
+  // records (cycle, address) of every write
+  class PipelinedModel(dut: StoreBuffer, latency: Int = 3) {
+    val log     = mutable.ArrayBuffer[(Int, Long)]()
+    val pending = mutable.Queue[Int]()
+    var now     = 0
+
+    def cycle(): Unit = {
+      val respond = pending.headOption.contains(now)
+      if (respond) pending.dequeue()
+      dut.io.mem.write_valid.poke(respond.B)
+      dut.io.mem.read_valid.poke(false.B)
+      dut.io.mem.read_data.poke(0.U)
+      dut.io.mem.granted.poke(true.B)
+      dut.io.mem.busy.poke(pending.nonEmpty.B)
+      dut.io.mem.write_data_accepted.poke(false.B)
+      if (dut.io.mem.request.peekBoolean() && dut.io.mem.write.peekBoolean()) {
+        log += ((now, dut.io.mem.address.peekInt().toLong))
+        pending.enqueue(now + latency)
+      }
+      dut.clock.step()
+      now += 1
+    }
+  }
+
+  // Issue one access like MemoryAccess (read/write only until granted) and
+  // run until it completes; returns (cycles, read data)
+  def access(dut: StoreBuffer, model: MemoryModel, address: Long, write: Boolean = false, data: BigInt = 0)
+      : (Int, BigInt) = {
+    dut.io.cpu.request.poke(true.B)
+    dut.io.cpu.read.poke((!write).B)
+    dut.io.cpu.write.poke(write.B)
+    dut.io.cpu.address.poke(address.U)
+    dut.io.cpu.write_data.poke(data.U)
+    for (i <- 0 until Parameters.WordSize) dut.io.cpu.write_strobe(i).poke(write.B)
+    var cycles = 0
+    while (cycles < 2000) {
+      val (granted, rv, rdata, wv) = model.cycle()
+      cycles += 1
+      if (rv || wv) {
+        dut.io.cpu.request.poke(false.B)
+        dut.io.cpu.read.poke(false.B)
+        dut.io.cpu.write.poke(false.B)
+        return (cycles, rdata)
+      }
+      if (granted) {
+        dut.io.cpu.read.poke(false.B)
+        dut.io.cpu.write.poke(false.B)
+      }
+    }
+    fail(f"access to 0x$address%x did not complete")
+  }
+
+  def setup(dut: StoreBuffer): MemoryModel = {
+    dut.io.cpu.request.poke(false.B)
+    dut.io.cpu.read.poke(false.B)
+    dut.io.cpu.write.poke(false.B)
+    new MemoryModel(dut)
+  }
+
+  def idle(model: MemoryModel, cycles: Int): Unit = for (_ <- 0 until cycles) model.cycle()
+
+  it should "accept stores without waiting and drain them in order" in {
+    test(new StoreBuffer(4)).withAnnotations(TestAnnotations.annos) { dut =>
+      val model = setup(dut)
+      for (i <- 0 until 3) assert(access(dut, model, 0x2000 + 4 * i, write = true, data = i)._1 == 1)
+      idle(model, 30)
+      assert(model.log == Seq(('W', 0x2000L), ('W', 0x2004L), ('W', 0x2008L)))
+      assert(model.words(0x2008) == 2)
+    }
+  }
+
+  it should "stall a store while every entry is in use" in {
+    test(new StoreBuffer(2)).withAnnotations(TestAnnotations.annos) { dut =>
+      val model = setup(dut)
+      access(dut, model, 0x2000, write = true, data = 1)
+      access(dut, model, 0x2004, write = true, data = 2)
+      dut.io.cpu.request.poke(true.B)
+      dut.io.cpu.write.poke(true.B)
+      dut.io.full_stall.expect(true.B)
+      assert(access(dut, model, 0x2008, write = true, data = 3)._1 > 1)
+    }
+  }
+
+  it should "forward a buffered word to a load" in {
+    test(new StoreBuffer(4)).withAnnotations(TestAnnotations.annos) { dut =>
+      val model = setup(dut)
+      access(dut, model, 0x2000, write = true, data = 0x11)
+      access(dut, model, 0x2004, write = true, data = 0x22)
+      access(dut, model, 0x2004, write = true, data = 0x33)
+      val (cycles, data) = access(dut, model, 0x2004)
+      assert(cycles == 1 && data == 0x33)
+      assert(!model.log.contains(('R', 0x2004L)))
+    }
+  }
+
+  it should "let an unrelated load overtake buffered stores" in {
+    test(new StoreBuffer(4)).withAnnotations(TestAnnotations.annos) { dut =>
+      val model = setup(dut)
+      for (i <- 0 until 3) access(dut, model, 0x2000 + 4 * i, write = true, data = i)
+      assert(access(dut, model, 0x3000)._2 == 0x4000)
+      assert(model.log.indexOf(('R', 0x3000L)) < model.log.indexOf(('W', 0x2008L)))
+    }
+  }
+
+  it should "drain before an MMIO load" in {
+    test(new StoreBuffer(4)).withAnnotations(TestAnnotations.annos) { dut =>
+      val model = setup(dut)
+      access(dut, model, 0x20000014L, write = true, data = 0x55)
+      access(dut, model, 0x20000014L, write = true, data = 0x66)
+      access(dut, model, 0x20000004L)
+      assert(model.log == Seq(('W', 0x20000014L), ('W', 0x20000014L), ('R', 0x20000004L)))
+    }
+  }
+
+  it should "drain back-to-back stores without waiting for each response" in {
+    test(new StoreBuffer(4)).withAnnotations(TestAnnotations.annos) { dut =>
+      setup(dut)
+      val model = new PipelinedModel(dut)
+      dut.io.cpu.request.poke(true.B)
+      dut.io.cpu.write.poke(true.B)
+      for (i <- 0 until Parameters.WordSize) dut.io.cpu.write_strobe(i).poke(true.B)
+      for (i <- 0 until 4) {
+        dut.io.cpu.address.poke((0x20000000L + 4 * i).U)
+        dut.io.cpu.write_data.poke(i.U)
+        dut.io.cpu.granted.expect(true.B)
+        model.cycle()
+      }
+      dut.io.cpu.request.poke(false.B)
+      dut.io.cpu.write.poke(false.B)
+      for (_ <- 0 until 10) model.cycle()
+      assert(model.log.map(_._2) == (0 until 4).map(i => 0x20000000L + 4 * i))
+      val first = model.log.head._1
+      assert(model.log.map(_._1) == (first until first + 4))
+      assert(model.pending.isEmpty)
+    }
+  }
+}
@@ -7,6 +7,7 @@ package riscv
 import java.nio.file.Files
 import java.nio.file.Paths
 
+import chiseltest.simulator.CachingAnnotation
 import chiseltest.VerilatorBackendAnnotation
 import chiseltest.WriteVcdAnnotation
 object VerilatorEnabler {
@@ -47,6 +48,17 @@ object WriteVcdEnabler {
   }
 }
 
+// Reuse a test's compiled Verilator model while its elaborated design is
+// unchanged (chiseltest keys the cache on a hash of the lowered circuit and
+// keeps it in test_run_dir/<test>). NO_SIM_CACHE=1 forces a rebuild.
+object CachingEnabler {
+  val annos = if (VerilatorEnabler.annos.nonEmpty && !sys.env.contains("NO_SIM_CACHE")) {
+    Seq(CachingAnnotation)
+  } else {
+    Seq()
+  }
+}
+
 object TestAnnotations {
-  val annos = VerilatorEnabler.annos ++ WriteVcdEnabler.annos
+  val annos = VerilatorEnabler.annos ++ WriteVcdEnabler.annos ++ CachingEnabler.annos
 }
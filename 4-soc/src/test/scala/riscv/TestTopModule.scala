@@ -46,9 +46,13 @@ class TestTopModule(exeFilename: String) extends Module {
     // AXI4-Lite slave adapter for memory
     val mem_slave = Module(new AXI4LiteSlave(Parameters.AddrBits, Parameters.DataBits))
 
-    cpu.io.debug_read_address     := 0.U
-    cpu.io.csr_debug_read_address := 0.U
-    cpu.io.instruction_valid      := rom_loader.io.load_finished
+    cpu.io.debug_read_address       := 0.U
+    cpu.io.csr_debug_read_address   := 0.U
+    cpu.io.instruction_valid        := rom_loader.io.load_finished
+    cpu.io.icache_enable            := false.B
+    cpu.io.dcache_enable            := false.B
+    cpu.io.icache_refill.data       := 0.U
+    cpu.io.icache_refill.data_valid := false.B
 
     // Instruction fetch from memory
     mem.io.instruction_address := cpu.io.instruction_address
@@ -73,8 +77,11 @@ class TestTopModule(exeFilename: String) extends Module {
 
     // AXI slave read responses
     // Memory is SyncReadMem with 1-cycle read latency.
-    // read_valid must be delayed 1 cycle after the read request.
-    val read_pending = RegNext(mem_slave.io.bundle.read && !loading, false.B)
+    // read_valid must be delayed 1 cycle after the read request. The slave may
+    // present the next read address in the cycle read_valid is returned, so a
+    // response is never given two cycles in a row.
+    val read_pending = RegInit(false.B)
+    read_pending                   := mem_slave.io.bundle.read && !read_pending && !loading
     mem_slave.io.bundle.read_data  := mem.io.bundle.read_data
     mem_slave.io.bundle.read_valid := read_pending
 
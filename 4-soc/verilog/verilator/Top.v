@@ -1,31 +1,31 @@
 module AXI4LiteSlave(
   input         clock,
   input         reset,
-  input         io_channels_write_address_channel_AWVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output        io_channels_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  input  [31:0] io_channels_write_address_channel_AWADDR, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  input         io_channels_write_data_channel_WVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output        io_channels_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  input  [31:0] io_channels_write_data_channel_WDATA, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  input  [3:0]  io_channels_write_data_channel_WSTRB, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output        io_channels_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  input         io_channels_write_response_channel_BREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  input         io_channels_read_address_channel_ARVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output        io_channels_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  input  [31:0] io_channels_read_address_channel_ARADDR, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output        io_channels_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  input         io_channels_read_data_channel_RREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output [31:0] io_channels_read_data_channel_RDATA, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output [31:0] io_bundle_address, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output        io_bundle_read, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  input  [31:0] io_bundle_read_data, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  input         io_bundle_read_valid, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output        io_bundle_write, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output [31:0] io_bundle_write_data, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output        io_bundle_write_strobe_0, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output        io_bundle_write_strobe_1, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output        io_bundle_write_strobe_2, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output        io_bundle_write_strobe_3 // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
+  input         io_channels_write_address_channel_AWVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_channels_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input  [31:0] io_channels_write_address_channel_AWADDR, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input         io_channels_write_data_channel_WVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_channels_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input  [31:0] io_channels_write_data_channel_WDATA, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input  [3:0]  io_channels_write_data_channel_WSTRB, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_channels_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input         io_channels_write_response_channel_BREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input         io_channels_read_address_channel_ARVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_channels_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input  [31:0] io_channels_read_address_channel_ARADDR, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_channels_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input         io_channels_read_data_channel_RREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output [31:0] io_channels_read_data_channel_RDATA, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output [31:0] io_bundle_address, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_bundle_read, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input  [31:0] io_bundle_read_data, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input         io_bundle_read_valid, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_bundle_write, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output [31:0] io_bundle_write_data, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_bundle_write_strobe_0, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_bundle_write_strobe_1, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_bundle_write_strobe_2, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_bundle_write_strobe_3 // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
 );
 `ifdef RANDOMIZE_REG_INIT
   reg [31:0] _RAND_0;
@@ -39,238 +39,111 @@ module AXI4LiteSlave(
   reg [31:0] _RAND_8;
   reg [31:0] _RAND_9;
   reg [31:0] _RAND_10;
-  reg [31:0] _RAND_11;
-  reg [31:0] _RAND_12;
-  reg [31:0] _RAND_13;
-  reg [31:0] _RAND_14;
 `endif // RANDOMIZE_REG_INIT
-  reg [2:0] state; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 136:22]
-  reg [31:0] addr; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 138:21]
-  reg  read; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 142:21]
-  reg [31:0] read_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 144:26]
-  reg  ARREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 147:24]
-  reg  RVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 149:23]
-  reg  write; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 155:22]
-  reg [31:0] write_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 157:27]
-  reg  write_strobe_0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 159:29]
-  reg  write_strobe_1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 159:29]
-  reg  write_strobe_2; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 159:29]
-  reg  write_strobe_3; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 159:29]
-  reg  AWREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 162:24]
-  reg  WREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 164:23]
-  reg  BVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 166:23]
-  wire  _GEN_1 = io_channels_write_address_channel_AWVALID | AWREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 180:61 183:17 162:24]
-  wire  _GEN_3 = io_channels_read_address_channel_ARVALID | ARREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 176:54 179:17 147:24]
-  wire  _GEN_7 = io_channels_read_address_channel_ARVALID & ARREADY | read; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 188:65 192:17 142:21]
-  wire [31:0] _GEN_9 = io_bundle_read_valid ? io_bundle_read_data : read_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 198:34 200:19 144:26]
-  wire  _GEN_10 = io_bundle_read_valid | RVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 198:34 201:19 149:23]
-  wire  _GEN_12 = io_bundle_read_valid ? 1'h0 : read; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 198:34 203:19 142:21]
-  wire  _GEN_13 = RVALID & io_channels_read_data_channel_RREADY ? 1'h0 : _GEN_10; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 206:60 208:16]
-  wire [2:0] _GEN_14 = RVALID & io_channels_read_data_channel_RREADY ? 3'h0 : state; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 206:60 209:16 136:22]
-  wire [31:0] _GEN_15 = io_channels_write_address_channel_AWVALID & AWREADY ? io_channels_write_address_channel_AWADDR
-     : addr; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 214:66 216:17 138:21]
-  wire  _GEN_16 = io_channels_write_address_channel_AWVALID & AWREADY ? 1'h0 : AWREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 214:66 217:17 162:24]
-  wire  _GEN_17 = io_channels_write_address_channel_AWVALID & AWREADY | WREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 214:66 218:17 164:23]
-  wire [2:0] _GEN_18 = io_channels_write_address_channel_AWVALID & AWREADY ? 3'h4 : state; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 214:66 219:17 136:22]
-  wire [31:0] _GEN_19 = io_channels_write_data_channel_WVALID & WREADY ? io_channels_write_data_channel_WDATA :
-    write_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 224:61 226:22 157:27]
-  wire  _GEN_20 = io_channels_write_data_channel_WVALID & WREADY ? io_channels_write_data_channel_WSTRB[0] :
-    write_strobe_0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 224:61 227:22 159:29]
-  wire  _GEN_21 = io_channels_write_data_channel_WVALID & WREADY ? io_channels_write_data_channel_WSTRB[1] :
-    write_strobe_1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 224:61 227:22 159:29]
-  wire  _GEN_22 = io_channels_write_data_channel_WVALID & WREADY ? io_channels_write_data_channel_WSTRB[2] :
-    write_strobe_2; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 224:61 227:22 159:29]
-  wire  _GEN_23 = io_channels_write_data_channel_WVALID & WREADY ? io_channels_write_data_channel_WSTRB[3] :
-    write_strobe_3; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 224:61 227:22 159:29]
-  wire  _GEN_24 = io_channels_write_data_channel_WVALID & WREADY ? 1'h0 : WREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 224:61 228:22 164:23]
-  wire  _GEN_25 = io_channels_write_data_channel_WVALID & WREADY | write; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 155:22 224:61 229:22]
-  wire [2:0] _GEN_26 = io_channels_write_data_channel_WVALID & WREADY ? 3'h5 : state; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 136:22 224:61 230:22]
-  wire  _GEN_27 = BVALID & io_channels_write_response_channel_BREADY ? 1'h0 : 1'h1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 236:14 239:65 241:16]
-  wire [2:0] _GEN_28 = BVALID & io_channels_write_response_channel_BREADY ? 3'h0 : state; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 239:65 242:16 136:22]
-  wire  _GEN_29 = 3'h5 == state ? 1'h0 : write; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 235:14 155:22]
-  wire  _GEN_30 = 3'h5 == state ? _GEN_27 : BVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 166:23]
-  wire [2:0] _GEN_32 = 3'h5 == state ? _GEN_28 : state; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 136:22]
-  wire [31:0] _GEN_33 = 3'h4 == state ? _GEN_19 : write_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 157:27]
-  wire  _GEN_34 = 3'h4 == state ? _GEN_20 : write_strobe_0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 159:29]
-  wire  _GEN_35 = 3'h4 == state ? _GEN_21 : write_strobe_1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 159:29]
-  wire  _GEN_36 = 3'h4 == state ? _GEN_22 : write_strobe_2; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 159:29]
-  wire  _GEN_37 = 3'h4 == state ? _GEN_23 : write_strobe_3; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 159:29]
-  wire  _GEN_38 = 3'h4 == state ? _GEN_24 : WREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 164:23]
-  wire  _GEN_39 = 3'h4 == state ? _GEN_25 : _GEN_29; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-  wire [2:0] _GEN_40 = 3'h4 == state ? _GEN_26 : _GEN_32; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-  wire  _GEN_41 = 3'h4 == state ? BVALID : _GEN_30; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 166:23]
-  wire [31:0] _GEN_43 = 3'h3 == state ? _GEN_15 : addr; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 138:21]
-  wire  _GEN_44 = 3'h3 == state ? _GEN_16 : AWREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 162:24]
-  wire  _GEN_45 = 3'h3 == state ? _GEN_17 : _GEN_38; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-  wire [2:0] _GEN_46 = 3'h3 == state ? _GEN_18 : _GEN_40; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-  wire [31:0] _GEN_47 = 3'h3 == state ? write_data : _GEN_33; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 157:27]
-  wire  _GEN_48 = 3'h3 == state ? write_strobe_0 : _GEN_34; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 159:29]
-  wire  _GEN_49 = 3'h3 == state ? write_strobe_1 : _GEN_35; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 159:29]
-  wire  _GEN_50 = 3'h3 == state ? write_strobe_2 : _GEN_36; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 159:29]
-  wire  _GEN_51 = 3'h3 == state ? write_strobe_3 : _GEN_37; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 159:29]
-  wire  _GEN_52 = 3'h3 == state ? write : _GEN_39; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 155:22]
-  wire  _GEN_53 = 3'h3 == state ? BVALID : _GEN_41; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 166:23]
-  assign io_channels_write_address_channel_AWREADY = AWREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 163:45]
-  assign io_channels_write_data_channel_WREADY = WREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 165:41]
-  assign io_channels_write_response_channel_BVALID = BVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 167:45]
-  assign io_channels_read_address_channel_ARREADY = ARREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 148:44]
-  assign io_channels_read_data_channel_RVALID = RVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 150:40]
-  assign io_channels_read_data_channel_RDATA = read_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 145:39]
-  assign io_bundle_address = addr; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 139:21]
-  assign io_bundle_read = read; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 143:18]
-  assign io_bundle_write = write; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 156:19]
-  assign io_bundle_write_data = write_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 158:24]
-  assign io_bundle_write_strobe_0 = write_strobe_0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 160:26]
-  assign io_bundle_write_strobe_1 = write_strobe_1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 160:26]
-  assign io_bundle_write_strobe_2 = write_strobe_2; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 160:26]
-  assign io_bundle_write_strobe_3 = write_strobe_3; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 160:26]
+  reg [31:0] addr; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 146:21]
+  reg  read; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 148:21]
+  reg  write; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 150:22]
+  reg [31:0] write_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 152:27]
+  reg  write_strobe_0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 154:29]
+  reg  write_strobe_1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 154:29]
+  reg  write_strobe_2; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 154:29]
+  reg  write_strobe_3; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 154:29]
+  reg  RVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 158:23]
+  reg [31:0] read_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 160:26]
+  reg  BVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 163:23]
+  wire  r_free = ~RVALID | io_channels_read_data_channel_RREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 168:29]
+  wire  read_done = read & io_bundle_read_valid & r_free; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 169:48]
+  wire  port_free = ~read | read_done; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 170:26]
+  wire  read_start = io_channels_read_address_channel_ARVALID & port_free; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 174:61]
+  wire  write_ready = port_free & ~io_channels_read_address_channel_ARVALID & (~BVALID |
+    io_channels_write_response_channel_BREADY); // @[4-soc/src/main/scala/bus/AXI4Lite.scala 178:62]
+  wire  write_start = write_ready & io_channels_write_address_channel_AWVALID &
+    io_channels_write_data_channel_WVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 183:62]
+  assign io_channels_write_address_channel_AWREADY = write_ready & io_channels_write_data_channel_WVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 180:61]
+  assign io_channels_write_data_channel_WREADY = write_ready & io_channels_write_address_channel_AWVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 181:61]
+  assign io_channels_write_response_channel_BVALID = BVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 164:45]
+  assign io_channels_read_address_channel_ARREADY = port_free; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 173:44]
+  assign io_channels_read_data_channel_RVALID = RVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 159:40]
+  assign io_channels_read_data_channel_RDATA = read_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 161:39]
+  assign io_bundle_address = addr; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 147:21]
+  assign io_bundle_read = read; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 149:18]
+  assign io_bundle_write = write; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 151:19]
+  assign io_bundle_write_data = write_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 153:24]
+  assign io_bundle_write_strobe_0 = write_strobe_0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 155:26]
+  assign io_bundle_write_strobe_1 = write_strobe_1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 155:26]
+  assign io_bundle_write_strobe_2 = write_strobe_2; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 155:26]
+  assign io_bundle_write_strobe_3 = write_strobe_3; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 155:26]
   always @(posedge clock) begin
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 136:22]
-      state <= 3'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 136:22]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (io_channels_read_address_channel_ARVALID) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 176:54]
-        state <= 3'h1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 178:17]
-      end else if (io_channels_write_address_channel_AWVALID) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 180:61]
-        state <= 3'h3; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 182:17]
-      end
-    end else if (3'h1 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (io_channels_read_address_channel_ARVALID & ARREADY) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 188:65]
-        state <= 3'h2; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 193:17]
-      end
-    end else if (3'h2 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      state <= _GEN_14;
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 146:21]
+      addr <= 32'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 146:21]
+    end else if (read_start) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 185:20]
+      addr <= io_channels_read_address_channel_ARADDR; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 186:10]
+    end else if (write_start) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 187:27]
+      addr <= io_channels_write_address_channel_AWADDR; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 188:18]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 148:21]
+      read <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 148:21]
     end else begin
-      state <= _GEN_46;
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 138:21]
-      addr <= 32'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 138:21]
-    end else if (!(3'h0 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (3'h1 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        if (io_channels_read_address_channel_ARVALID & ARREADY) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 188:65]
-          addr <= io_channels_read_address_channel_ARADDR; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 190:17]
-        end
-      end else if (!(3'h2 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        addr <= _GEN_43;
-      end
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 142:21]
-      read <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 142:21]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      read <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 173:13]
-    end else if (3'h1 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      read <= _GEN_7;
-    end else if (3'h2 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      read <= _GEN_12;
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 144:26]
-      read_data <= 32'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 144:26]
-    end else if (!(3'h0 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (!(3'h1 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        if (3'h2 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-          read_data <= _GEN_9;
-        end
-      end
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 147:24]
-      ARREADY <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 147:24]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      ARREADY <= _GEN_3;
-    end else if (3'h1 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (io_channels_read_address_channel_ARVALID & ARREADY) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 188:65]
-        ARREADY <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 191:17]
-      end
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 149:23]
-      RVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 149:23]
-    end else if (!(3'h0 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (!(3'h1 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        if (3'h2 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-          RVALID <= _GEN_13;
-        end
-      end
+      read <= read_start | read & ~read_done; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 192:9]
     end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 155:22]
-      write <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 155:22]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      write <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 174:13]
-    end else if (!(3'h1 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (!(3'h2 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        write <= _GEN_52;
-      end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 150:22]
+      write <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 150:22]
+    end else begin
+      write <= write_start; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 193:9]
     end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 157:27]
-      write_data <= 32'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 157:27]
-    end else if (!(3'h0 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (!(3'h1 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        if (!(3'h2 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-          write_data <= _GEN_47;
-        end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 152:27]
+      write_data <= 32'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 152:27]
+    end else if (!(read_start)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 185:20]
+      if (write_start) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 187:27]
+        write_data <= io_channels_write_data_channel_WDATA; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 189:18]
       end
     end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 159:29]
-      write_strobe_0 <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 159:29]
-    end else if (!(3'h0 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (!(3'h1 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        if (!(3'h2 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-          write_strobe_0 <= _GEN_48;
-        end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 154:29]
+      write_strobe_0 <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 154:29]
+    end else if (!(read_start)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 185:20]
+      if (write_start) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 187:27]
+        write_strobe_0 <= io_channels_write_data_channel_WSTRB[0]; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 190:18]
       end
     end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 159:29]
-      write_strobe_1 <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 159:29]
-    end else if (!(3'h0 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (!(3'h1 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        if (!(3'h2 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-          write_strobe_1 <= _GEN_49;
-        end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 154:29]
+      write_strobe_1 <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 154:29]
+    end else if (!(read_start)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 185:20]
+      if (write_start) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 187:27]
+        write_strobe_1 <= io_channels_write_data_channel_WSTRB[1]; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 190:18]
       end
     end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 159:29]
-      write_strobe_2 <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 159:29]
-    end else if (!(3'h0 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (!(3'h1 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        if (!(3'h2 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-          write_strobe_2 <= _GEN_50;
-        end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 154:29]
+      write_strobe_2 <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 154:29]
+    end else if (!(read_start)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 185:20]
+      if (write_start) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 187:27]
+        write_strobe_2 <= io_channels_write_data_channel_WSTRB[2]; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 190:18]
       end
     end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 159:29]
-      write_strobe_3 <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 159:29]
-    end else if (!(3'h0 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (!(3'h1 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        if (!(3'h2 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-          write_strobe_3 <= _GEN_51;
-        end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 154:29]
+      write_strobe_3 <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 154:29]
+    end else if (!(read_start)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 185:20]
+      if (write_start) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 187:27]
+        write_strobe_3 <= io_channels_write_data_channel_WSTRB[3]; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 190:18]
       end
     end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 162:24]
-      AWREADY <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 162:24]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (!(io_channels_read_address_channel_ARVALID)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 176:54]
-        AWREADY <= _GEN_1;
-      end
-    end else if (!(3'h1 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (!(3'h2 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        AWREADY <= _GEN_44;
-      end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 158:23]
+      RVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 158:23]
+    end else if (read_done) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 195:19]
+      RVALID <= 1'h1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 198:15]
+    end else if (io_channels_read_data_channel_RREADY) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 199:52]
+      RVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 201:12]
     end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 164:23]
-      WREADY <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 164:23]
-    end else if (!(3'h0 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (!(3'h1 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        if (!(3'h2 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-          WREADY <= _GEN_45;
-        end
-      end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 160:26]
+      read_data <= 32'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 160:26]
+    end else if (read_done) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 195:19]
+      read_data <= io_bundle_read_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 197:15]
     end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 166:23]
-      BVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 166:23]
-    end else if (!(3'h0 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (!(3'h1 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        if (!(3'h2 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-          BVALID <= _GEN_53;
-        end
-      end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 163:23]
+      BVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 163:23]
+    end else if (write_start) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 204:21]
+      BVALID <= 1'h1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 205:12]
+    end else if (io_channels_write_response_channel_BREADY) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 206:57]
+      BVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 208:12]
     end
   end
 // Register and memory initialization
@@ -310,35 +183,27 @@ initial begin
     `endif
 `ifdef RANDOMIZE_REG_INIT
   _RAND_0 = {1{`RANDOM}};
-  state = _RAND_0[2:0];
+  addr = _RAND_0[31:0];
   _RAND_1 = {1{`RANDOM}};
-  addr = _RAND_1[31:0];
+  read = _RAND_1[0:0];
   _RAND_2 = {1{`RANDOM}};
-  read = _RAND_2[0:0];
+  write = _RAND_2[0:0];
   _RAND_3 = {1{`RANDOM}};
-  read_data = _RAND_3[31:0];
+  write_data = _RAND_3[31:0];
   _RAND_4 = {1{`RANDOM}};
-  ARREADY = _RAND_4[0:0];
+  write_strobe_0 = _RAND_4[0:0];
   _RAND_5 = {1{`RANDOM}};
-  RVALID = _RAND_5[0:0];
+  write_strobe_1 = _RAND_5[0:0];
   _RAND_6 = {1{`RANDOM}};
-  write = _RAND_6[0:0];
+  write_strobe_2 = _RAND_6[0:0];
   _RAND_7 = {1{`RANDOM}};
-  write_data = _RAND_7[31:0];
+  write_strobe_3 = _RAND_7[0:0];
   _RAND_8 = {1{`RANDOM}};
-  write_strobe_0 = _RAND_8[0:0];
+  RVALID = _RAND_8[0:0];
   _RAND_9 = {1{`RANDOM}};
-  write_strobe_1 = _RAND_9[0:0];
+  read_data = _RAND_9[31:0];
   _RAND_10 = {1{`RANDOM}};
-  write_strobe_2 = _RAND_10[0:0];
-  _RAND_11 = {1{`RANDOM}};
-  write_strobe_3 = _RAND_11[0:0];
-  _RAND_12 = {1{`RANDOM}};
-  AWREADY = _RAND_12[0:0];
-  _RAND_13 = {1{`RANDOM}};
-  WREADY = _RAND_13[0:0];
-  _RAND_14 = {1{`RANDOM}};
-  BVALID = _RAND_14[0:0];
+  BVALID = _RAND_10[0:0];
 `endif // RANDOMIZE_REG_INIT
   `endif // RANDOMIZE
 end // initial
@@ -350,26 +215,26 @@ endmodule
 module AXI4LiteSlave_1(
   input         clock,
   input         reset,
-  input         io_channels_write_address_channel_AWVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output        io_channels_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  input  [7:0]  io_channels_write_address_channel_AWADDR, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  input         io_channels_write_data_channel_WVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output        io_channels_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  input  [31:0] io_channels_write_data_channel_WDATA, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output        io_channels_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  input         io_channels_write_response_channel_BREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  input         io_channels_read_address_channel_ARVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output        io_channels_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  input  [7:0]  io_channels_read_address_channel_ARADDR, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output        io_channels_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  input         io_channels_read_data_channel_RREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output [31:0] io_channels_read_data_channel_RDATA, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output [7:0]  io_bundle_address, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output        io_bundle_read, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  input  [31:0] io_bundle_read_data, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  input         io_bundle_read_valid, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output        io_bundle_write, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
-  output [31:0] io_bundle_write_data // @[4-soc/src/main/scala/bus/AXI4Lite.scala 131:14]
+  input         io_channels_write_address_channel_AWVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_channels_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input  [15:0] io_channels_write_address_channel_AWADDR, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input         io_channels_write_data_channel_WVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_channels_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input  [31:0] io_channels_write_data_channel_WDATA, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_channels_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input         io_channels_write_response_channel_BREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input         io_channels_read_address_channel_ARVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_channels_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input  [15:0] io_channels_read_address_channel_ARADDR, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_channels_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input         io_channels_read_data_channel_RREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output [31:0] io_channels_read_data_channel_RDATA, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output [15:0] io_bundle_address, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_bundle_read, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input  [31:0] io_bundle_read_data, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input         io_bundle_read_valid, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_bundle_write, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output [31:0] io_bundle_write_data // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
 );
 `ifdef RANDOMIZE_REG_INIT
   reg [31:0] _RAND_0;
@@ -379,178 +244,75 @@ module AXI4LiteSlave_1(
   reg [31:0] _RAND_4;
   reg [31:0] _RAND_5;
   reg [31:0] _RAND_6;
-  reg [31:0] _RAND_7;
-  reg [31:0] _RAND_8;
-  reg [31:0] _RAND_9;
-  reg [31:0] _RAND_10;
 `endif // RANDOMIZE_REG_INIT
-  reg [2:0] state; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 136:22]
-  reg [7:0] addr; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 138:21]
-  reg  read; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 142:21]
-  reg [31:0] read_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 144:26]
-  reg  ARREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 147:24]
-  reg  RVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 149:23]
-  reg  write; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 155:22]
-  reg [31:0] write_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 157:27]
-  reg  AWREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 162:24]
-  reg  WREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 164:23]
-  reg  BVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 166:23]
-  wire  _GEN_1 = io_channels_write_address_channel_AWVALID | AWREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 180:61 183:17 162:24]
-  wire  _GEN_3 = io_channels_read_address_channel_ARVALID | ARREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 176:54 179:17 147:24]
-  wire  _GEN_7 = io_channels_read_address_channel_ARVALID & ARREADY | read; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 188:65 192:17 142:21]
-  wire [31:0] _GEN_9 = io_bundle_read_valid ? io_bundle_read_data : read_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 198:34 200:19 144:26]
-  wire  _GEN_10 = io_bundle_read_valid | RVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 198:34 201:19 149:23]
-  wire  _GEN_12 = io_bundle_read_valid ? 1'h0 : read; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 198:34 203:19 142:21]
-  wire  _GEN_13 = RVALID & io_channels_read_data_channel_RREADY ? 1'h0 : _GEN_10; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 206:60 208:16]
-  wire [2:0] _GEN_14 = RVALID & io_channels_read_data_channel_RREADY ? 3'h0 : state; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 206:60 209:16 136:22]
-  wire [7:0] _GEN_15 = io_channels_write_address_channel_AWVALID & AWREADY ? io_channels_write_address_channel_AWADDR :
-    addr; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 214:66 216:17 138:21]
-  wire  _GEN_16 = io_channels_write_address_channel_AWVALID & AWREADY ? 1'h0 : AWREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 214:66 217:17 162:24]
-  wire  _GEN_17 = io_channels_write_address_channel_AWVALID & AWREADY | WREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 214:66 218:17 164:23]
-  wire [2:0] _GEN_18 = io_channels_write_address_channel_AWVALID & AWREADY ? 3'h4 : state; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 214:66 219:17 136:22]
-  wire [31:0] _GEN_19 = io_channels_write_data_channel_WVALID & WREADY ? io_channels_write_data_channel_WDATA :
-    write_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 224:61 226:22 157:27]
-  wire  _GEN_24 = io_channels_write_data_channel_WVALID & WREADY ? 1'h0 : WREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 224:61 228:22 164:23]
-  wire  _GEN_25 = io_channels_write_data_channel_WVALID & WREADY | write; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 155:22 224:61 229:22]
-  wire [2:0] _GEN_26 = io_channels_write_data_channel_WVALID & WREADY ? 3'h5 : state; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 136:22 224:61 230:22]
-  wire  _GEN_27 = BVALID & io_channels_write_response_channel_BREADY ? 1'h0 : 1'h1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 236:14 239:65 241:16]
-  wire [2:0] _GEN_28 = BVALID & io_channels_write_response_channel_BREADY ? 3'h0 : state; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 239:65 242:16 136:22]
-  wire  _GEN_29 = 3'h5 == state ? 1'h0 : write; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 235:14 155:22]
-  wire  _GEN_30 = 3'h5 == state ? _GEN_27 : BVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 166:23]
-  wire [2:0] _GEN_32 = 3'h5 == state ? _GEN_28 : state; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 136:22]
-  wire [31:0] _GEN_33 = 3'h4 == state ? _GEN_19 : write_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 157:27]
-  wire  _GEN_38 = 3'h4 == state ? _GEN_24 : WREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 164:23]
-  wire  _GEN_39 = 3'h4 == state ? _GEN_25 : _GEN_29; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-  wire [2:0] _GEN_40 = 3'h4 == state ? _GEN_26 : _GEN_32; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-  wire  _GEN_41 = 3'h4 == state ? BVALID : _GEN_30; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 166:23]
-  wire [7:0] _GEN_43 = 3'h3 == state ? _GEN_15 : addr; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 138:21]
-  wire  _GEN_44 = 3'h3 == state ? _GEN_16 : AWREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 162:24]
-  wire  _GEN_45 = 3'h3 == state ? _GEN_17 : _GEN_38; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-  wire [2:0] _GEN_46 = 3'h3 == state ? _GEN_18 : _GEN_40; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-  wire [31:0] _GEN_47 = 3'h3 == state ? write_data : _GEN_33; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 157:27]
-  wire  _GEN_52 = 3'h3 == state ? write : _GEN_39; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 155:22]
-  wire  _GEN_53 = 3'h3 == state ? BVALID : _GEN_41; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17 166:23]
-  assign io_channels_write_address_channel_AWREADY = AWREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 163:45]
-  assign io_channels_write_data_channel_WREADY = WREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 165:41]
-  assign io_channels_write_response_channel_BVALID = BVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 167:45]
-  assign io_channels_read_address_channel_ARREADY = ARREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 148:44]
-  assign io_channels_read_data_channel_RVALID = RVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 150:40]
-  assign io_channels_read_data_channel_RDATA = read_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 145:39]
-  assign io_bundle_address = addr; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 139:21]
-  assign io_bundle_read = read; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 143:18]
-  assign io_bundle_write = write; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 156:19]
-  assign io_bundle_write_data = write_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 158:24]
+  reg [15:0] addr; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 146:21]
+  reg  read; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 148:21]
+  reg  write; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 150:22]
+  reg [31:0] write_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 152:27]
+  reg  RVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 158:23]
+  reg [31:0] read_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 160:26]
+  reg  BVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 163:23]
+  wire  r_free = ~RVALID | io_channels_read_data_channel_RREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 168:29]
+  wire  read_done = read & io_bundle_read_valid & r_free; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 169:48]
+  wire  port_free = ~read | read_done; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 170:26]
+  wire  read_start = io_channels_read_address_channel_ARVALID & port_free; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 174:61]
+  wire  write_ready = port_free & ~io_channels_read_address_channel_ARVALID & (~BVALID |
+    io_channels_write_response_channel_BREADY); // @[4-soc/src/main/scala/bus/AXI4Lite.scala 178:62]
+  wire  write_start = write_ready & io_channels_write_address_channel_AWVALID &
+    io_channels_write_data_channel_WVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 183:62]
+  assign io_channels_write_address_channel_AWREADY = write_ready & io_channels_write_data_channel_WVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 180:61]
+  assign io_channels_write_data_channel_WREADY = write_ready & io_channels_write_address_channel_AWVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 181:61]
+  assign io_channels_write_response_channel_BVALID = BVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 164:45]
+  assign io_channels_read_address_channel_ARREADY = port_free; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 173:44]
+  assign io_channels_read_data_channel_RVALID = RVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 159:40]
+  assign io_channels_read_data_channel_RDATA = read_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 161:39]
+  assign io_bundle_address = addr; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 147:21]
+  assign io_bundle_read = read; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 149:18]
+  assign io_bundle_write = write; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 151:19]
+  assign io_bundle_write_data = write_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 153:24]
   always @(posedge clock) begin
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 136:22]
-      state <= 3'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 136:22]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (io_channels_read_address_channel_ARVALID) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 176:54]
-        state <= 3'h1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 178:17]
-      end else if (io_channels_write_address_channel_AWVALID) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 180:61]
-        state <= 3'h3; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 182:17]
-      end
-    end else if (3'h1 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (io_channels_read_address_channel_ARVALID & ARREADY) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 188:65]
-        state <= 3'h2; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 193:17]
-      end
-    end else if (3'h2 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      state <= _GEN_14;
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 146:21]
+      addr <= 16'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 146:21]
+    end else if (read_start) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 185:20]
+      addr <= io_channels_read_address_channel_ARADDR; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 186:10]
+    end else if (write_start) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 187:27]
+      addr <= io_channels_write_address_channel_AWADDR; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 188:18]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 148:21]
+      read <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 148:21]
     end else begin
-      state <= _GEN_46;
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 138:21]
-      addr <= 8'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 138:21]
-    end else if (!(3'h0 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (3'h1 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        if (io_channels_read_address_channel_ARVALID & ARREADY) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 188:65]
-          addr <= io_channels_read_address_channel_ARADDR; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 190:17]
-        end
-      end else if (!(3'h2 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        addr <= _GEN_43;
-      end
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 142:21]
-      read <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 142:21]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      read <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 173:13]
-    end else if (3'h1 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      read <= _GEN_7;
-    end else if (3'h2 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      read <= _GEN_12;
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 144:26]
-      read_data <= 32'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 144:26]
-    end else if (!(3'h0 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (!(3'h1 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        if (3'h2 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-          read_data <= _GEN_9;
-        end
-      end
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 147:24]
-      ARREADY <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 147:24]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      ARREADY <= _GEN_3;
-    end else if (3'h1 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (io_channels_read_address_channel_ARVALID & ARREADY) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 188:65]
-        ARREADY <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 191:17]
-      end
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 149:23]
-      RVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 149:23]
-    end else if (!(3'h0 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (!(3'h1 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        if (3'h2 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-          RVALID <= _GEN_13;
-        end
-      end
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 155:22]
-      write <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 155:22]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      write <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 174:13]
-    end else if (!(3'h1 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (!(3'h2 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        write <= _GEN_52;
-      end
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 157:27]
-      write_data <= 32'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 157:27]
-    end else if (!(3'h0 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (!(3'h1 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        if (!(3'h2 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-          write_data <= _GEN_47;
-        end
-      end
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 162:24]
-      AWREADY <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 162:24]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (!(io_channels_read_address_channel_ARVALID)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 176:54]
-        AWREADY <= _GEN_1;
-      end
-    end else if (!(3'h1 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (!(3'h2 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        AWREADY <= _GEN_44;
-      end
+      read <= read_start | read & ~read_done; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 192:9]
     end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 164:23]
-      WREADY <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 164:23]
-    end else if (!(3'h0 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (!(3'h1 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        if (!(3'h2 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-          WREADY <= _GEN_45;
-        end
-      end
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 166:23]
-      BVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 166:23]
-    end else if (!(3'h0 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-      if (!(3'h1 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-        if (!(3'h2 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 171:17]
-          BVALID <= _GEN_53;
-        end
-      end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 150:22]
+      write <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 150:22]
+    end else begin
+      write <= write_start; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 193:9]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 152:27]
+      write_data <= 32'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 152:27]
+    end else if (!(read_start)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 185:20]
+      if (write_start) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 187:27]
+        write_data <= io_channels_write_data_channel_WDATA; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 189:18]
+      end
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 158:23]
+      RVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 158:23]
+    end else if (read_done) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 195:19]
+      RVALID <= 1'h1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 198:15]
+    end else if (io_channels_read_data_channel_RREADY) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 199:52]
+      RVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 201:12]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 160:26]
+      read_data <= 32'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 160:26]
+    end else if (read_done) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 195:19]
+      read_data <= io_bundle_read_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 197:15]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 163:23]
+      BVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 163:23]
+    end else if (write_start) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 204:21]
+      BVALID <= 1'h1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 205:12]
+    end else if (io_channels_write_response_channel_BREADY) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 206:57]
+      BVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 208:12]
     end
   end
 // Register and memory initialization
@@ -590,27 +352,19 @@ initial begin
     `endif
 `ifdef RANDOMIZE_REG_INIT
   _RAND_0 = {1{`RANDOM}};
-  state = _RAND_0[2:0];
+  addr = _RAND_0[15:0];
   _RAND_1 = {1{`RANDOM}};
-  addr = _RAND_1[7:0];
+  read = _RAND_1[0:0];
   _RAND_2 = {1{`RANDOM}};
-  read = _RAND_2[0:0];
+  write = _RAND_2[0:0];
   _RAND_3 = {1{`RANDOM}};
-  read_data = _RAND_3[31:0];
+  write_data = _RAND_3[31:0];
   _RAND_4 = {1{`RANDOM}};
-  ARREADY = _RAND_4[0:0];
+  RVALID = _RAND_4[0:0];
   _RAND_5 = {1{`RANDOM}};
-  RVALID = _RAND_5[0:0];
+  read_data = _RAND_5[31:0];
   _RAND_6 = {1{`RANDOM}};
-  write = _RAND_6[0:0];
-  _RAND_7 = {1{`RANDOM}};
-  write_data = _RAND_7[31:0];
-  _RAND_8 = {1{`RANDOM}};
-  AWREADY = _RAND_8[0:0];
-  _RAND_9 = {1{`RANDOM}};
-  WREADY = _RAND_9[0:0];
-  _RAND_10 = {1{`RANDOM}};
-  BVALID = _RAND_10[0:0];
+  BVALID = _RAND_6[0:0];
 `endif // RANDOMIZE_REG_INIT
   `endif // RANDOMIZE
 end // initial
@@ -624,7 +378,7 @@ module VGA(
   input         reset,
   input         io_channels_write_address_channel_AWVALID, // @[4-soc/src/main/scala/peripheral/VGA.scala 35:14]
   output        io_channels_write_address_channel_AWREADY, // @[4-soc/src/main/scala/peripheral/VGA.scala 35:14]
-  input  [7:0]  io_channels_write_address_channel_AWADDR, // @[4-soc/src/main/scala/peripheral/VGA.scala 35:14]
+  input  [15:0] io_channels_write_address_channel_AWADDR, // @[4-soc/src/main/scala/peripheral/VGA.scala 35:14]
   input         io_channels_write_data_channel_WVALID, // @[4-soc/src/main/scala/peripheral/VGA.scala 35:14]
   output        io_channels_write_data_channel_WREADY, // @[4-soc/src/main/scala/peripheral/VGA.scala 35:14]
   input  [31:0] io_channels_write_data_channel_WDATA, // @[4-soc/src/main/scala/peripheral/VGA.scala 35:14]
@@ -632,7 +386,7 @@ module VGA(
   input         io_channels_write_response_channel_BREADY, // @[4-soc/src/main/scala/peripheral/VGA.scala 35:14]
   input         io_channels_read_address_channel_ARVALID, // @[4-soc/src/main/scala/peripheral/VGA.scala 35:14]
   output        io_channels_read_address_channel_ARREADY, // @[4-soc/src/main/scala/peripheral/VGA.scala 35:14]
-  input  [7:0]  io_channels_read_address_channel_ARADDR, // @[4-soc/src/main/scala/peripheral/VGA.scala 35:14]
+  input  [15:0] io_channels_read_address_channel_ARADDR, // @[4-soc/src/main/scala/peripheral/VGA.scala 35:14]
   output        io_channels_read_data_channel_RVALID, // @[4-soc/src/main/scala/peripheral/VGA.scala 35:14]
   input         io_channels_read_data_channel_RREADY, // @[4-soc/src/main/scala/peripheral/VGA.scala 35:14]
   output [31:0] io_channels_read_data_channel_RDATA, // @[4-soc/src/main/scala/peripheral/VGA.scala 35:14]
@@ -729,6 +483,94 @@ module VGA(
   reg [31:0] _RAND_81;
   reg [31:0] _RAND_82;
   reg [31:0] _RAND_83;
+  reg [31:0] _RAND_84;
+  reg [31:0] _RAND_85;
+  reg [31:0] _RAND_86;
+  reg [31:0] _RAND_87;
+  reg [31:0] _RAND_88;
+  reg [31:0] _RAND_89;
+  reg [31:0] _RAND_90;
+  reg [31:0] _RAND_91;
+  reg [31:0] _RAND_92;
+  reg [31:0] _RAND_93;
+  reg [31:0] _RAND_94;
+  reg [31:0] _RAND_95;
+  reg [31:0] _RAND_96;
+  reg [31:0] _RAND_97;
+  reg [31:0] _RAND_98;
+  reg [31:0] _RAND_99;
+  reg [31:0] _RAND_100;
+  reg [31:0] _RAND_101;
+  reg [31:0] _RAND_102;
+  reg [31:0] _RAND_103;
+  reg [31:0] _RAND_104;
+  reg [31:0] _RAND_105;
+  reg [31:0] _RAND_106;
+  reg [31:0] _RAND_107;
+  reg [31:0] _RAND_108;
+  reg [31:0] _RAND_109;
+  reg [31:0] _RAND_110;
+  reg [31:0] _RAND_111;
+  reg [31:0] _RAND_112;
+  reg [31:0] _RAND_113;
+  reg [31:0] _RAND_114;
+  reg [31:0] _RAND_115;
+  reg [31:0] _RAND_116;
+  reg [31:0] _RAND_117;
+  reg [31:0] _RAND_118;
+  reg [31:0] _RAND_119;
+  reg [31:0] _RAND_120;
+  reg [31:0] _RAND_121;
+  reg [31:0] _RAND_122;
+  reg [31:0] _RAND_123;
+  reg [31:0] _RAND_124;
+  reg [31:0] _RAND_125;
+  reg [31:0] _RAND_126;
+  reg [31:0] _RAND_127;
+  reg [31:0] _RAND_128;
+  reg [31:0] _RAND_129;
+  reg [31:0] _RAND_130;
+  reg [31:0] _RAND_131;
+  reg [31:0] _RAND_132;
+  reg [31:0] _RAND_133;
+  reg [31:0] _RAND_134;
+  reg [31:0] _RAND_135;
+  reg [31:0] _RAND_136;
+  reg [31:0] _RAND_137;
+  reg [31:0] _RAND_138;
+  reg [31:0] _RAND_139;
+  reg [31:0] _RAND_140;
+  reg [31:0] _RAND_141;
+  reg [31:0] _RAND_142;
+  reg [31:0] _RAND_143;
+  reg [31:0] _RAND_144;
+  reg [31:0] _RAND_145;
+  reg [31:0] _RAND_146;
+  reg [31:0] _RAND_147;
+  reg [31:0] _RAND_148;
+  reg [31:0] _RAND_149;
+  reg [31:0] _RAND_150;
+  reg [31:0] _RAND_151;
+  reg [31:0] _RAND_152;
+  reg [31:0] _RAND_153;
+  reg [31:0] _RAND_154;
+  reg [31:0] _RAND_155;
+  reg [31:0] _RAND_156;
+  reg [31:0] _RAND_157;
+  reg [31:0] _RAND_158;
+  reg [31:0] _RAND_159;
+  reg [31:0] _RAND_160;
+  reg [31:0] _RAND_161;
+  reg [31:0] _RAND_162;
+  reg [31:0] _RAND_163;
+  reg [31:0] _RAND_164;
+  reg [31:0] _RAND_165;
+  reg [31:0] _RAND_166;
+  reg [31:0] _RAND_167;
+  reg [31:0] _RAND_168;
+  reg [31:0] _RAND_169;
+  reg [31:0] _RAND_170;
+  reg [31:0] _RAND_171;
 `endif // RANDOMIZE_REG_INIT
   wire  framebuffer_clka; // @[4-soc/src/main/scala/peripheral/VGA.scala 99:27]
   wire  framebuffer_wea; // @[4-soc/src/main/scala/peripheral/VGA.scala 99:27]
@@ -737,11 +579,81 @@ module VGA(
   wire  framebuffer_clkb; // @[4-soc/src/main/scala/peripheral/VGA.scala 99:27]
   wire [12:0] framebuffer_addrb; // @[4-soc/src/main/scala/peripheral/VGA.scala 99:27]
   wire [31:0] framebuffer_doutb; // @[4-soc/src/main/scala/peripheral/VGA.scala 99:27]
+  wire  sprites_0_clka; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_0_wea; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [2:0] sprites_0_addra; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [31:0] sprites_0_dina; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_0_clkb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [2:0] sprites_0_addrb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [31:0] sprites_0_doutb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_1_clka; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_1_wea; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [2:0] sprites_1_addra; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [31:0] sprites_1_dina; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_1_clkb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [2:0] sprites_1_addrb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [31:0] sprites_1_doutb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_2_clka; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_2_wea; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [2:0] sprites_2_addra; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [31:0] sprites_2_dina; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_2_clkb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [2:0] sprites_2_addrb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [31:0] sprites_2_doutb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_3_clka; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_3_wea; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [2:0] sprites_3_addra; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [31:0] sprites_3_dina; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_3_clkb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [2:0] sprites_3_addrb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [31:0] sprites_3_doutb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_4_clka; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_4_wea; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [2:0] sprites_4_addra; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [31:0] sprites_4_dina; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_4_clkb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [2:0] sprites_4_addrb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [31:0] sprites_4_doutb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_5_clka; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_5_wea; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [2:0] sprites_5_addra; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [31:0] sprites_5_dina; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_5_clkb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [2:0] sprites_5_addrb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [31:0] sprites_5_doutb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_6_clka; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_6_wea; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [2:0] sprites_6_addra; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [31:0] sprites_6_dina; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_6_clkb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [2:0] sprites_6_addrb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [31:0] sprites_6_doutb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_7_clka; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_7_wea; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [2:0] sprites_7_addra; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [31:0] sprites_7_dina; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  sprites_7_clkb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [2:0] sprites_7_addrb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire [31:0] sprites_7_doutb; // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+  wire  tiles_clka; // @[4-soc/src/main/scala/peripheral/VGA.scala 159:29]
+  wire  tiles_wea; // @[4-soc/src/main/scala/peripheral/VGA.scala 159:29]
+  wire [7:0] tiles_addra; // @[4-soc/src/main/scala/peripheral/VGA.scala 159:29]
+  wire [31:0] tiles_dina; // @[4-soc/src/main/scala/peripheral/VGA.scala 159:29]
+  wire  tiles_clkb; // @[4-soc/src/main/scala/peripheral/VGA.scala 159:29]
+  wire [7:0] tiles_addrb; // @[4-soc/src/main/scala/peripheral/VGA.scala 159:29]
+  wire [31:0] tiles_doutb; // @[4-soc/src/main/scala/peripheral/VGA.scala 159:29]
+  wire  tile_map_clka; // @[4-soc/src/main/scala/peripheral/VGA.scala 160:29]
+  wire  tile_map_wea; // @[4-soc/src/main/scala/peripheral/VGA.scala 160:29]
+  wire [9:0] tile_map_addra; // @[4-soc/src/main/scala/peripheral/VGA.scala 160:29]
+  wire [31:0] tile_map_dina; // @[4-soc/src/main/scala/peripheral/VGA.scala 160:29]
+  wire  tile_map_clkb; // @[4-soc/src/main/scala/peripheral/VGA.scala 160:29]
+  wire [9:0] tile_map_addrb; // @[4-soc/src/main/scala/peripheral/VGA.scala 160:29]
+  wire [31:0] tile_map_doutb; // @[4-soc/src/main/scala/peripheral/VGA.scala 160:29]
   wire  slave_clock; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
   wire  slave_reset; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
   wire  slave_io_channels_write_address_channel_AWVALID; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
   wire  slave_io_channels_write_address_channel_AWREADY; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
-  wire [7:0] slave_io_channels_write_address_channel_AWADDR; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
+  wire [15:0] slave_io_channels_write_address_channel_AWADDR; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
   wire  slave_io_channels_write_data_channel_WVALID; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
   wire  slave_io_channels_write_data_channel_WREADY; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
   wire [31:0] slave_io_channels_write_data_channel_WDATA; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
@@ -749,11 +661,11 @@ module VGA(
   wire  slave_io_channels_write_response_channel_BREADY; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
   wire  slave_io_channels_read_address_channel_ARVALID; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
   wire  slave_io_channels_read_address_channel_ARREADY; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
-  wire [7:0] slave_io_channels_read_address_channel_ARADDR; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
+  wire [15:0] slave_io_channels_read_address_channel_ARADDR; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
   wire  slave_io_channels_read_data_channel_RVALID; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
   wire  slave_io_channels_read_data_channel_RREADY; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
   wire [31:0] slave_io_channels_read_data_channel_RDATA; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
-  wire [7:0] slave_io_bundle_address; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
+  wire [15:0] slave_io_bundle_address; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
   wire  slave_io_bundle_read; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
   wire [31:0] slave_io_bundle_read_data; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
   wire  slave_io_bundle_read_valid; // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
@@ -778,6 +690,18 @@ module VGA(
   reg [5:0] paletteReg_13; // @[4-soc/src/main/scala/peripheral/VGA.scala 112:30]
   reg [5:0] paletteReg_14; // @[4-soc/src/main/scala/peripheral/VGA.scala 112:30]
   reg [5:0] paletteReg_15; // @[4-soc/src/main/scala/peripheral/VGA.scala 112:30]
+  reg [3:0] spriteKeyReg; // @[4-soc/src/main/scala/peripheral/VGA.scala 146:30]
+  reg [16:0] spritePosReg_0; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+  reg [16:0] spritePosReg_1; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+  reg [16:0] spritePosReg_2; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+  reg [16:0] spritePosReg_3; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+  reg [16:0] spritePosReg_4; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+  reg [16:0] spritePosReg_5; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+  reg [16:0] spritePosReg_6; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+  reg [16:0] spritePosReg_7; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+  reg [16:0] tileCtrlReg; // @[4-soc/src/main/scala/peripheral/VGA.scala 181:30]
+  reg [13:0] scrollReg; // @[4-soc/src/main/scala/peripheral/VGA.scala 191:30]
+  reg [5:0] splitReg; // @[4-soc/src/main/scala/peripheral/VGA.scala 192:30]
   wire [3:0] ctrl_frame_sel = ctrlReg[7:4]; // @[4-soc/src/main/scala/peripheral/VGA.scala 118:31]
   wire  ctrl_vblank_ie = ctrlReg[8]; // @[4-soc/src/main/scala/peripheral/VGA.scala 119:31]
   wire [15:0] upload_pix_addr = uploadAddrReg[15:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 128:41]
@@ -796,16 +720,32 @@ module VGA(
   reg  vblank_prev; // @[4-soc/src/main/scala/peripheral/VGA.scala 157:37]
   wire  vblank_rising_edge = vblank_synced & ~vblank_prev; // @[4-soc/src/main/scala/peripheral/VGA.scala 158:44]
   wire [31:0] _GEN_1 = vblank_rising_edge & ctrl_vblank_ie ? 32'h1 : intrStatusReg; // @[4-soc/src/main/scala/peripheral/VGA.scala 160:48 161:21 110:30]
-  wire [7:0] addr = slave_io_bundle_address; // @[4-soc/src/main/scala/peripheral/VGA.scala 167:52]
-  wire  addr_id = addr == 8'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 168:33]
-  wire  addr_status = addr == 8'h4; // @[4-soc/src/main/scala/peripheral/VGA.scala 169:33]
-  wire  addr_intr_status = addr == 8'h8; // @[4-soc/src/main/scala/peripheral/VGA.scala 170:33]
-  wire  addr_upload_addr = addr == 8'h10; // @[4-soc/src/main/scala/peripheral/VGA.scala 171:33]
-  wire  addr_stream_data = addr == 8'h14; // @[4-soc/src/main/scala/peripheral/VGA.scala 172:33]
-  wire  addr_ctrl = addr == 8'h20; // @[4-soc/src/main/scala/peripheral/VGA.scala 173:33]
-  wire  addr_palette = addr >= 8'h24 & addr < 8'h64; // @[4-soc/src/main/scala/peripheral/VGA.scala 174:57]
-  wire [7:0] _palette_idx_T_1 = addr - 8'h24; // @[4-soc/src/main/scala/peripheral/VGA.scala 175:34]
-  wire [5:0] palette_idx = _palette_idx_T_1[7:2]; // @[4-soc/src/main/scala/peripheral/VGA.scala 175:56]
+  wire [15:0] addr = slave_io_bundle_address; // @[4-soc/src/main/scala/peripheral/VGA.scala 180:28]
+  wire  addr_id = addr == 16'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 168:33]
+  wire  addr_status = addr == 16'h4; // @[4-soc/src/main/scala/peripheral/VGA.scala 169:33]
+  wire  addr_intr_status = addr == 16'h8; // @[4-soc/src/main/scala/peripheral/VGA.scala 170:33]
+  wire  addr_upload_addr = addr == 16'h10; // @[4-soc/src/main/scala/peripheral/VGA.scala 171:33]
+  wire  addr_stream_data = addr == 16'h14; // @[4-soc/src/main/scala/peripheral/VGA.scala 172:33]
+  wire  addr_ctrl = addr == 16'h20; // @[4-soc/src/main/scala/peripheral/VGA.scala 173:33]
+  wire  addr_palette = addr >= 16'h24 & addr < 16'h64; // @[4-soc/src/main/scala/peripheral/VGA.scala 174:57]
+  wire [15:0] _palette_idx_T_1 = addr - 16'h24; // @[4-soc/src/main/scala/peripheral/VGA.scala 175:34]
+  wire [13:0] palette_idx = _palette_idx_T_1[15:2]; // @[4-soc/src/main/scala/peripheral/VGA.scala 175:56]
+  wire  addr_sprite_key = addr == 16'h68; // @[4-soc/src/main/scala/peripheral/VGA.scala 212:33]
+  wire  addr_sprite_pos = addr >= 16'h80 & addr < 16'ha0; // @[4-soc/src/main/scala/peripheral/VGA.scala 213:62]
+  wire [15:0] _sprite_pos_idx_T_1 = addr - 16'h80; // @[4-soc/src/main/scala/peripheral/VGA.scala 214:34]
+  wire [13:0] sprite_pos_idx = _sprite_pos_idx_T_1[15:2]; // @[4-soc/src/main/scala/peripheral/VGA.scala 214:54]
+  wire  addr_sprite_data = addr >= 16'h100 & addr < 16'h200; // @[4-soc/src/main/scala/peripheral/VGA.scala 216:35]
+  wire [15:0] _sprite_data_word_T_1 = addr - 16'h100; // @[4-soc/src/main/scala/peripheral/VGA.scala 217:34]
+  wire [13:0] sprite_data_word = _sprite_data_word_T_1[15:2]; // @[4-soc/src/main/scala/peripheral/VGA.scala 217:55]
+  wire  addr_tile_ctrl = addr == 16'h6c; // @[4-soc/src/main/scala/peripheral/VGA.scala 252:33]
+  wire  addr_scroll = addr == 16'h70; // @[4-soc/src/main/scala/peripheral/VGA.scala 264:33]
+  wire  addr_split = addr == 16'h74; // @[4-soc/src/main/scala/peripheral/VGA.scala 265:33]
+  wire  addr_tile_data = addr >= 16'h200 & addr < 16'h600; // @[4-soc/src/main/scala/peripheral/VGA.scala 254:33]
+  wire [15:0] _tile_data_word_T_1 = addr - 16'h200; // @[4-soc/src/main/scala/peripheral/VGA.scala 255:32]
+  wire [13:0] tile_data_word = _tile_data_word_T_1[15:2]; // @[4-soc/src/main/scala/peripheral/VGA.scala 255:51]
+  wire  addr_tile_map = addr >= 16'h1000 & addr < 16'h2000; // @[4-soc/src/main/scala/peripheral/VGA.scala 257:33]
+  wire [15:0] _tile_map_word_T_1 = addr - 16'h1000; // @[4-soc/src/main/scala/peripheral/VGA.scala 258:31]
+  wire [13:0] tile_map_word = _tile_map_word_T_1[15:2]; // @[4-soc/src/main/scala/peripheral/VGA.scala 258:49]
   wire [31:0] _read_data_prepared_T = {timing_error_count,8'h0,curr_frame_synced,1'h0,1'h0,vblank_synced,vblank_synced}; // @[4-soc/src/main/scala/peripheral/VGA.scala 206:32]
   wire [5:0] _GEN_3 = 4'h1 == palette_idx[3:0] ? paletteReg_1 : paletteReg_0; // @[4-soc/src/main/scala/peripheral/VGA.scala 220:{26,26}]
   wire [5:0] _GEN_4 = 4'h2 == palette_idx[3:0] ? paletteReg_2 : _GEN_3; // @[4-soc/src/main/scala/peripheral/VGA.scala 220:{26,26}]
@@ -822,7 +762,19 @@ module VGA(
   wire [5:0] _GEN_15 = 4'hd == palette_idx[3:0] ? paletteReg_13 : _GEN_14; // @[4-soc/src/main/scala/peripheral/VGA.scala 220:{26,26}]
   wire [5:0] _GEN_16 = 4'he == palette_idx[3:0] ? paletteReg_14 : _GEN_15; // @[4-soc/src/main/scala/peripheral/VGA.scala 220:{26,26}]
   wire [5:0] _GEN_17 = 4'hf == palette_idx[3:0] ? paletteReg_15 : _GEN_16; // @[4-soc/src/main/scala/peripheral/VGA.scala 220:{26,26}]
-  wire [31:0] _GEN_18 = addr_palette ? {{26'd0}, _GEN_17} : 32'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 219:30 220:26 191:41]
+  wire [16:0] _GEN_192 = 3'h1 == sprite_pos_idx[2:0] ? spritePosReg_1 : spritePosReg_0; // @[4-soc/src/main/scala/peripheral/VGA.scala 268:{26,26}]
+  wire [16:0] _GEN_193 = 3'h2 == sprite_pos_idx[2:0] ? spritePosReg_2 : _GEN_192; // @[4-soc/src/main/scala/peripheral/VGA.scala 268:{26,26}]
+  wire [16:0] _GEN_194 = 3'h3 == sprite_pos_idx[2:0] ? spritePosReg_3 : _GEN_193; // @[4-soc/src/main/scala/peripheral/VGA.scala 268:{26,26}]
+  wire [16:0] _GEN_195 = 3'h4 == sprite_pos_idx[2:0] ? spritePosReg_4 : _GEN_194; // @[4-soc/src/main/scala/peripheral/VGA.scala 268:{26,26}]
+  wire [16:0] _GEN_196 = 3'h5 == sprite_pos_idx[2:0] ? spritePosReg_5 : _GEN_195; // @[4-soc/src/main/scala/peripheral/VGA.scala 268:{26,26}]
+  wire [16:0] _GEN_197 = 3'h6 == sprite_pos_idx[2:0] ? spritePosReg_6 : _GEN_196; // @[4-soc/src/main/scala/peripheral/VGA.scala 268:{26,26}]
+  wire [16:0] _GEN_198 = 3'h7 == sprite_pos_idx[2:0] ? spritePosReg_7 : _GEN_197; // @[4-soc/src/main/scala/peripheral/VGA.scala 268:{26,26}]
+  wire [31:0] _GEN_371 = addr_split ? {{26'd0}, splitReg} : 32'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 327:30 328:26 276:41]
+  wire [31:0] _GEN_372 = addr_scroll ? {{18'd0}, scrollReg} : _GEN_371; // @[4-soc/src/main/scala/peripheral/VGA.scala 325:31 326:26]
+  wire [31:0] _GEN_326 = addr_tile_ctrl ? {{15'd0}, tileCtrlReg} : _GEN_372; // @[4-soc/src/main/scala/peripheral/VGA.scala 310:32 311:26 276:41]
+  wire [31:0] _GEN_199 = addr_sprite_pos ? {{15'd0}, _GEN_198} : _GEN_326; // @[4-soc/src/main/scala/peripheral/VGA.scala 267:33 268:26 191:41]
+  wire [31:0] _GEN_200 = addr_sprite_key ? {{28'd0}, spriteKeyReg} : _GEN_199; // @[4-soc/src/main/scala/peripheral/VGA.scala 265:33 266:26]
+  wire [31:0] _GEN_18 = addr_palette ? {{26'd0}, _GEN_17} : _GEN_200; // @[4-soc/src/main/scala/peripheral/VGA.scala 219:30 220:26 191:41]
   wire [31:0] _GEN_19 = addr_upload_addr ? uploadAddrReg : _GEN_18; // @[4-soc/src/main/scala/peripheral/VGA.scala 217:34 218:26]
   wire [31:0] _GEN_20 = addr_intr_status ? intrStatusReg : _GEN_19; // @[4-soc/src/main/scala/peripheral/VGA.scala 215:34 216:26]
   wire [31:0] _GEN_21 = addr_status ? _read_data_prepared_T : _GEN_20; // @[4-soc/src/main/scala/peripheral/VGA.scala 197:29 206:26]
@@ -871,8 +823,15 @@ module VGA(
   wire [5:0] _GEN_54 = addr_palette ? _GEN_38 : paletteReg_13; // @[4-soc/src/main/scala/peripheral/VGA.scala 112:30 262:32]
   wire [5:0] _GEN_55 = addr_palette ? _GEN_39 : paletteReg_14; // @[4-soc/src/main/scala/peripheral/VGA.scala 112:30 262:32]
   wire [5:0] _GEN_56 = addr_palette ? _GEN_40 : paletteReg_15; // @[4-soc/src/main/scala/peripheral/VGA.scala 112:30 262:32]
-  wire [13:0] _GEN_58 = addr_stream_data ? fb_addr : 14'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 249:36 256:23 232:36]
-  wire [31:0] _GEN_59 = addr_stream_data ? slave_io_bundle_write_data : 32'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 249:36 257:23 233:36]
+  wire  addr_fb_window = addr[15]; // @[4-soc/src/main/scala/peripheral/VGA.scala 189:32]
+  wire [12:0] fb_window_word = addr[14:2]; // @[4-soc/src/main/scala/peripheral/VGA.scala 190:32]
+  wire  _T_9 = fb_window_word < 13'h1800; // @[4-soc/src/main/scala/peripheral/VGA.scala 280:29]
+  wire  _GEN_188 = addr_fb_window & _T_9; // @[4-soc/src/main/scala/peripheral/VGA.scala 279:40 280:50 281:25 246:36]
+  wire  _GEN_189 = addr_stream_data | (addr_palette ? 1'h0 : _GEN_188); // @[4-soc/src/main/scala/peripheral/VGA.scala 268:40 270:23 276:34]
+  wire [13:0] _GEN_190 = addr_palette | ~_GEN_188 ? 14'h0 : {{1'd0}, fb_window_word}; // @[4-soc/src/main/scala/peripheral/VGA.scala 276:34 282:25 247:36]
+  wire [31:0] _GEN_191 = addr_palette | ~_GEN_188 ? 32'h0 : slave_io_bundle_write_data; // @[4-soc/src/main/scala/peripheral/VGA.scala 276:34 283:25 248:36]
+  wire [13:0] _GEN_58 = addr_stream_data ? fb_addr : _GEN_190; // @[4-soc/src/main/scala/peripheral/VGA.scala 249:36 256:23 232:36]
+  wire [31:0] _GEN_59 = addr_stream_data ? slave_io_bundle_write_data : _GEN_191; // @[4-soc/src/main/scala/peripheral/VGA.scala 249:36 257:23 233:36]
   wire [31:0] _GEN_60 = addr_stream_data ? {{12'd0}, _uploadAddrReg_T} : uploadAddrReg; // @[4-soc/src/main/scala/peripheral/VGA.scala 249:36 261:23 111:30]
   wire [5:0] _GEN_61 = addr_stream_data ? paletteReg_0 : _GEN_41; // @[4-soc/src/main/scala/peripheral/VGA.scala 112:30 249:36]
   wire [5:0] _GEN_62 = addr_stream_data ? paletteReg_1 : _GEN_42; // @[4-soc/src/main/scala/peripheral/VGA.scala 112:30 249:36]
@@ -891,7 +850,7 @@ module VGA(
   wire [5:0] _GEN_75 = addr_stream_data ? paletteReg_14 : _GEN_55; // @[4-soc/src/main/scala/peripheral/VGA.scala 112:30 249:36]
   wire [5:0] _GEN_76 = addr_stream_data ? paletteReg_15 : _GEN_56; // @[4-soc/src/main/scala/peripheral/VGA.scala 112:30 249:36]
   wire [31:0] _GEN_77 = addr_upload_addr ? slave_io_bundle_write_data : _GEN_60; // @[4-soc/src/main/scala/peripheral/VGA.scala 247:36 248:23]
-  wire  _GEN_78 = addr_upload_addr ? 1'h0 : addr_stream_data; // @[4-soc/src/main/scala/peripheral/VGA.scala 231:36 247:36]
+  wire  _GEN_78 = addr_upload_addr ? 1'h0 : _GEN_189; // @[4-soc/src/main/scala/peripheral/VGA.scala 231:36 247:36]
   wire [13:0] _GEN_79 = addr_upload_addr ? 14'h0 : _GEN_58; // @[4-soc/src/main/scala/peripheral/VGA.scala 232:36 247:36]
   wire [31:0] _GEN_80 = addr_upload_addr ? 32'h0 : _GEN_59; // @[4-soc/src/main/scala/peripheral/VGA.scala 233:36 247:36]
   wire [5:0] _GEN_81 = addr_upload_addr ? paletteReg_0 : _GEN_61; // @[4-soc/src/main/scala/peripheral/VGA.scala 112:30 247:36]
@@ -917,6 +876,92 @@ module VGA(
   wire [13:0] _GEN_122 = addr_ctrl ? 14'h0 : _GEN_100; // @[4-soc/src/main/scala/peripheral/VGA.scala 237:23 232:36]
   wire [31:0] _GEN_123 = addr_ctrl ? 32'h0 : _GEN_101; // @[4-soc/src/main/scala/peripheral/VGA.scala 237:23 233:36]
   wire [13:0] _GEN_144 = slave_io_bundle_write ? _GEN_122 : 14'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 236:33 232:36]
+  wire [3:0] _GEN_201 = addr_sprite_key ? slave_io_bundle_write_data[3:0] : spriteKeyReg; // @[4-soc/src/main/scala/peripheral/VGA.scala 318:41 319:22 146:30]
+  wire [3:0] _GEN_202 = addr_fb_window ? spriteKeyReg : _GEN_201; // @[4-soc/src/main/scala/peripheral/VGA.scala 146:30 310:38]
+  wire [3:0] _GEN_203 = addr_palette ? spriteKeyReg : _GEN_202; // @[4-soc/src/main/scala/peripheral/VGA.scala 146:30 308:36]
+  wire [3:0] _GEN_204 = addr_stream_data ? spriteKeyReg : _GEN_203; // @[4-soc/src/main/scala/peripheral/VGA.scala 146:30 293:40]
+  wire [3:0] _GEN_205 = addr_upload_addr ? spriteKeyReg : _GEN_204; // @[4-soc/src/main/scala/peripheral/VGA.scala 146:30 291:40]
+  wire [16:0] _GEN_206 = 3'h0 == sprite_pos_idx[2:0] ? slave_io_bundle_write_data[16:0] : spritePosReg_0; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 321:{38,38}]
+  wire [16:0] _GEN_207 = addr_sprite_pos ? _GEN_206 : spritePosReg_0; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 320:41]
+  wire [16:0] _GEN_208 = addr_sprite_key ? spritePosReg_0 : _GEN_207; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 318:41]
+  wire [16:0] _GEN_209 = addr_fb_window ? spritePosReg_0 : _GEN_208; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 310:38]
+  wire [16:0] _GEN_210 = addr_palette ? spritePosReg_0 : _GEN_209; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 308:36]
+  wire [16:0] _GEN_211 = addr_stream_data ? spritePosReg_0 : _GEN_210; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 293:40]
+  wire [16:0] _GEN_212 = addr_upload_addr ? spritePosReg_0 : _GEN_211; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 291:40]
+  wire [16:0] _GEN_213 = 3'h1 == sprite_pos_idx[2:0] ? slave_io_bundle_write_data[16:0] : spritePosReg_1; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 321:{38,38}]
+  wire [16:0] _GEN_214 = addr_sprite_pos ? _GEN_213 : spritePosReg_1; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 320:41]
+  wire [16:0] _GEN_215 = addr_sprite_key ? spritePosReg_1 : _GEN_214; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 318:41]
+  wire [16:0] _GEN_216 = addr_fb_window ? spritePosReg_1 : _GEN_215; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 310:38]
+  wire [16:0] _GEN_217 = addr_palette ? spritePosReg_1 : _GEN_216; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 308:36]
+  wire [16:0] _GEN_218 = addr_stream_data ? spritePosReg_1 : _GEN_217; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 293:40]
+  wire [16:0] _GEN_219 = addr_upload_addr ? spritePosReg_1 : _GEN_218; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 291:40]
+  wire [16:0] _GEN_220 = 3'h2 == sprite_pos_idx[2:0] ? slave_io_bundle_write_data[16:0] : spritePosReg_2; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 321:{38,38}]
+  wire [16:0] _GEN_221 = addr_sprite_pos ? _GEN_220 : spritePosReg_2; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 320:41]
+  wire [16:0] _GEN_222 = addr_sprite_key ? spritePosReg_2 : _GEN_221; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 318:41]
+  wire [16:0] _GEN_223 = addr_fb_window ? spritePosReg_2 : _GEN_222; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 310:38]
+  wire [16:0] _GEN_224 = addr_palette ? spritePosReg_2 : _GEN_223; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 308:36]
+  wire [16:0] _GEN_225 = addr_stream_data ? spritePosReg_2 : _GEN_224; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 293:40]
+  wire [16:0] _GEN_226 = addr_upload_addr ? spritePosReg_2 : _GEN_225; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 291:40]
+  wire [16:0] _GEN_227 = 3'h3 == sprite_pos_idx[2:0] ? slave_io_bundle_write_data[16:0] : spritePosReg_3; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 321:{38,38}]
+  wire [16:0] _GEN_228 = addr_sprite_pos ? _GEN_227 : spritePosReg_3; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 320:41]
+  wire [16:0] _GEN_229 = addr_sprite_key ? spritePosReg_3 : _GEN_228; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 318:41]
+  wire [16:0] _GEN_230 = addr_fb_window ? spritePosReg_3 : _GEN_229; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 310:38]
+  wire [16:0] _GEN_231 = addr_palette ? spritePosReg_3 : _GEN_230; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 308:36]
+  wire [16:0] _GEN_232 = addr_stream_data ? spritePosReg_3 : _GEN_231; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 293:40]
+  wire [16:0] _GEN_233 = addr_upload_addr ? spritePosReg_3 : _GEN_232; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 291:40]
+  wire [16:0] _GEN_234 = 3'h4 == sprite_pos_idx[2:0] ? slave_io_bundle_write_data[16:0] : spritePosReg_4; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 321:{38,38}]
+  wire [16:0] _GEN_235 = addr_sprite_pos ? _GEN_234 : spritePosReg_4; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 320:41]
+  wire [16:0] _GEN_236 = addr_sprite_key ? spritePosReg_4 : _GEN_235; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 318:41]
+  wire [16:0] _GEN_237 = addr_fb_window ? spritePosReg_4 : _GEN_236; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 310:38]
+  wire [16:0] _GEN_238 = addr_palette ? spritePosReg_4 : _GEN_237; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 308:36]
+  wire [16:0] _GEN_239 = addr_stream_data ? spritePosReg_4 : _GEN_238; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 293:40]
+  wire [16:0] _GEN_240 = addr_upload_addr ? spritePosReg_4 : _GEN_239; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 291:40]
+  wire [16:0] _GEN_241 = 3'h5 == sprite_pos_idx[2:0] ? slave_io_bundle_write_data[16:0] : spritePosReg_5; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 321:{38,38}]
+  wire [16:0] _GEN_242 = addr_sprite_pos ? _GEN_241 : spritePosReg_5; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 320:41]
+  wire [16:0] _GEN_243 = addr_sprite_key ? spritePosReg_5 : _GEN_242; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 318:41]
+  wire [16:0] _GEN_244 = addr_fb_window ? spritePosReg_5 : _GEN_243; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 310:38]
+  wire [16:0] _GEN_245 = addr_palette ? spritePosReg_5 : _GEN_244; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 308:36]
+  wire [16:0] _GEN_246 = addr_stream_data ? spritePosReg_5 : _GEN_245; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 293:40]
+  wire [16:0] _GEN_247 = addr_upload_addr ? spritePosReg_5 : _GEN_246; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 291:40]
+  wire [16:0] _GEN_248 = 3'h6 == sprite_pos_idx[2:0] ? slave_io_bundle_write_data[16:0] : spritePosReg_6; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 321:{38,38}]
+  wire [16:0] _GEN_249 = addr_sprite_pos ? _GEN_248 : spritePosReg_6; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 320:41]
+  wire [16:0] _GEN_250 = addr_sprite_key ? spritePosReg_6 : _GEN_249; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 318:41]
+  wire [16:0] _GEN_251 = addr_fb_window ? spritePosReg_6 : _GEN_250; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 310:38]
+  wire [16:0] _GEN_252 = addr_palette ? spritePosReg_6 : _GEN_251; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 308:36]
+  wire [16:0] _GEN_253 = addr_stream_data ? spritePosReg_6 : _GEN_252; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 293:40]
+  wire [16:0] _GEN_254 = addr_upload_addr ? spritePosReg_6 : _GEN_253; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 291:40]
+  wire [16:0] _GEN_255 = 3'h7 == sprite_pos_idx[2:0] ? slave_io_bundle_write_data[16:0] : spritePosReg_7; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 321:{38,38}]
+  wire [16:0] _GEN_256 = addr_sprite_pos ? _GEN_255 : spritePosReg_7; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 320:41]
+  wire [16:0] _GEN_257 = addr_sprite_key ? spritePosReg_7 : _GEN_256; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 318:41]
+  wire [16:0] _GEN_258 = addr_fb_window ? spritePosReg_7 : _GEN_257; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 310:38]
+  wire [16:0] _GEN_259 = addr_palette ? spritePosReg_7 : _GEN_258; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 308:36]
+  wire [16:0] _GEN_260 = addr_stream_data ? spritePosReg_7 : _GEN_259; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 293:40]
+  wire [16:0] _GEN_261 = addr_upload_addr ? spritePosReg_7 : _GEN_260; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30 291:40]
+  wire [10:0] sprite_data_sel = sprite_data_word[13:3]; // @[4-soc/src/main/scala/peripheral/VGA.scala 330:44]
+  wire [16:0] _GEN_327 = addr_tile_ctrl ? slave_io_bundle_write_data[16:0] : tileCtrlReg; // @[4-soc/src/main/scala/peripheral/VGA.scala 365:40 366:21 181:30]
+  wire [16:0] _GEN_328 = addr_sprite_pos ? tileCtrlReg : _GEN_327; // @[4-soc/src/main/scala/peripheral/VGA.scala 181:30 363:41]
+  wire [16:0] _GEN_329 = addr_sprite_key ? tileCtrlReg : _GEN_328; // @[4-soc/src/main/scala/peripheral/VGA.scala 181:30 361:41]
+  wire [16:0] _GEN_330 = addr_fb_window ? tileCtrlReg : _GEN_329; // @[4-soc/src/main/scala/peripheral/VGA.scala 181:30 355:38]
+  wire [16:0] _GEN_331 = addr_palette ? tileCtrlReg : _GEN_330; // @[4-soc/src/main/scala/peripheral/VGA.scala 181:30 353:36]
+  wire [16:0] _GEN_332 = addr_stream_data ? tileCtrlReg : _GEN_331; // @[4-soc/src/main/scala/peripheral/VGA.scala 181:30 340:40]
+  wire [16:0] _GEN_333 = addr_upload_addr ? tileCtrlReg : _GEN_332; // @[4-soc/src/main/scala/peripheral/VGA.scala 181:30 338:40]
+  wire [13:0] _GEN_373 = addr_scroll ? slave_io_bundle_write_data[13:0] : scrollReg; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:37 385:19 191:30]
+  wire [13:0] _GEN_374 = addr_tile_ctrl ? scrollReg : _GEN_373; // @[4-soc/src/main/scala/peripheral/VGA.scala 191:30 383:40]
+  wire [13:0] _GEN_375 = addr_sprite_pos ? scrollReg : _GEN_374; // @[4-soc/src/main/scala/peripheral/VGA.scala 191:30 363:41]
+  wire [13:0] _GEN_376 = addr_sprite_key ? scrollReg : _GEN_375; // @[4-soc/src/main/scala/peripheral/VGA.scala 191:30 361:41]
+  wire [13:0] _GEN_377 = addr_fb_window ? scrollReg : _GEN_376; // @[4-soc/src/main/scala/peripheral/VGA.scala 191:30 355:38]
+  wire [13:0] _GEN_378 = addr_palette ? scrollReg : _GEN_377; // @[4-soc/src/main/scala/peripheral/VGA.scala 191:30 353:36]
+  wire [13:0] _GEN_379 = addr_stream_data ? scrollReg : _GEN_378; // @[4-soc/src/main/scala/peripheral/VGA.scala 191:30 340:40]
+  wire [13:0] _GEN_380 = addr_upload_addr ? scrollReg : _GEN_379; // @[4-soc/src/main/scala/peripheral/VGA.scala 191:30 338:40]
+  wire [5:0] _GEN_381 = addr_split ? slave_io_bundle_write_data[5:0] : splitReg; // @[4-soc/src/main/scala/peripheral/VGA.scala 386:36 387:18 192:30]
+  wire [5:0] _GEN_382 = addr_scroll ? splitReg : _GEN_381; // @[4-soc/src/main/scala/peripheral/VGA.scala 192:30 384:37]
+  wire [5:0] _GEN_383 = addr_tile_ctrl ? splitReg : _GEN_382; // @[4-soc/src/main/scala/peripheral/VGA.scala 192:30 383:40]
+  wire [5:0] _GEN_384 = addr_sprite_pos ? splitReg : _GEN_383; // @[4-soc/src/main/scala/peripheral/VGA.scala 192:30 363:41]
+  wire [5:0] _GEN_385 = addr_sprite_key ? splitReg : _GEN_384; // @[4-soc/src/main/scala/peripheral/VGA.scala 192:30 361:41]
+  wire [5:0] _GEN_386 = addr_fb_window ? splitReg : _GEN_385; // @[4-soc/src/main/scala/peripheral/VGA.scala 192:30 355:38]
+  wire [5:0] _GEN_387 = addr_palette ? splitReg : _GEN_386; // @[4-soc/src/main/scala/peripheral/VGA.scala 192:30 353:36]
+  wire [5:0] _GEN_388 = addr_stream_data ? splitReg : _GEN_387; // @[4-soc/src/main/scala/peripheral/VGA.scala 192:30 340:40]
+  wire [5:0] _GEN_389 = addr_upload_addr ? splitReg : _GEN_388; // @[4-soc/src/main/scala/peripheral/VGA.scala 192:30 338:40]
   reg [9:0] h_count; // @[4-soc/src/main/scala/peripheral/VGA.scala 274:26]
   reg [9:0] v_count; // @[4-soc/src/main/scala/peripheral/VGA.scala 275:26]
   wire  _T_5 = h_count == 10'h33f; // @[4-soc/src/main/scala/peripheral/VGA.scala 277:18]
@@ -986,19 +1031,163 @@ module VGA(
   reg [5:0] palette_sync_13; // @[4-soc/src/main/scala/peripheral/VGA.scala 335:32]
   reg [5:0] palette_sync_14; // @[4-soc/src/main/scala/peripheral/VGA.scala 335:32]
   reg [5:0] palette_sync_15; // @[4-soc/src/main/scala/peripheral/VGA.scala 335:32]
+  reg [3:0] sprite_key_sync1; // @[4-soc/src/main/scala/peripheral/VGA.scala 404:35]
+  reg [3:0] sprite_key; // @[4-soc/src/main/scala/peripheral/VGA.scala 405:35]
+  reg [16:0] sprite_pos_sync1_0; // @[4-soc/src/main/scala/peripheral/VGA.scala 406:35]
+  reg [16:0] sprite_pos_sync1_1; // @[4-soc/src/main/scala/peripheral/VGA.scala 406:35]
+  reg [16:0] sprite_pos_sync1_2; // @[4-soc/src/main/scala/peripheral/VGA.scala 406:35]
+  reg [16:0] sprite_pos_sync1_3; // @[4-soc/src/main/scala/peripheral/VGA.scala 406:35]
+  reg [16:0] sprite_pos_sync1_4; // @[4-soc/src/main/scala/peripheral/VGA.scala 406:35]
+  reg [16:0] sprite_pos_sync1_5; // @[4-soc/src/main/scala/peripheral/VGA.scala 406:35]
+  reg [16:0] sprite_pos_sync1_6; // @[4-soc/src/main/scala/peripheral/VGA.scala 406:35]
+  reg [16:0] sprite_pos_sync1_7; // @[4-soc/src/main/scala/peripheral/VGA.scala 406:35]
+  reg [16:0] sprite_pos_0; // @[4-soc/src/main/scala/peripheral/VGA.scala 407:35]
+  reg [16:0] sprite_pos_1; // @[4-soc/src/main/scala/peripheral/VGA.scala 407:35]
+  reg [16:0] sprite_pos_2; // @[4-soc/src/main/scala/peripheral/VGA.scala 407:35]
+  reg [16:0] sprite_pos_3; // @[4-soc/src/main/scala/peripheral/VGA.scala 407:35]
+  reg [16:0] sprite_pos_4; // @[4-soc/src/main/scala/peripheral/VGA.scala 407:35]
+  reg [16:0] sprite_pos_5; // @[4-soc/src/main/scala/peripheral/VGA.scala 407:35]
+  reg [16:0] sprite_pos_6; // @[4-soc/src/main/scala/peripheral/VGA.scala 407:35]
+  reg [16:0] sprite_pos_7; // @[4-soc/src/main/scala/peripheral/VGA.scala 407:35]
+  reg [16:0] tile_ctrl_sync1; // @[4-soc/src/main/scala/peripheral/VGA.scala 463:35]
+  reg [16:0] tile_ctrl; // @[4-soc/src/main/scala/peripheral/VGA.scala 464:35]
+  reg [13:0] scroll_sync1; // @[4-soc/src/main/scala/peripheral/VGA.scala 486:35]
+  reg [13:0] scroll; // @[4-soc/src/main/scala/peripheral/VGA.scala 487:35]
+  reg [5:0] split_sync1; // @[4-soc/src/main/scala/peripheral/VGA.scala 488:35]
+  reg [5:0] split; // @[4-soc/src/main/scala/peripheral/VGA.scala 489:35]
   reg  in_display_d1; // @[4-soc/src/main/scala/peripheral/VGA.scala 340:37]
   reg  h_active_d1; // @[4-soc/src/main/scala/peripheral/VGA.scala 347:30]
   reg  v_active_d1; // @[4-soc/src/main/scala/peripheral/VGA.scala 348:30]
   reg  h_active_d2; // @[4-soc/src/main/scala/peripheral/VGA.scala 349:30]
   reg  v_active_d2; // @[4-soc/src/main/scala/peripheral/VGA.scala 350:30]
-  wire [12:0] _pixel_idx_T = frame_y * 7'h40; // @[4-soc/src/main/scala/peripheral/VGA.scala 352:33]
-  wire [12:0] _GEN_186 = {{7'd0}, frame_x}; // @[4-soc/src/main/scala/peripheral/VGA.scala 352:49]
+  wire  scrolled = frame_y >= split; // @[4-soc/src/main/scala/peripheral/VGA.scala 507:35]
+  wire [5:0] _read_x_T_1 = frame_x + scroll[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 508:51]
+  wire [5:0] read_x = scrolled ? _read_x_T_1 : frame_x; // @[4-soc/src/main/scala/peripheral/VGA.scala 508:26]
+  wire [5:0] _read_y_T_1 = frame_y + scroll[13:8]; // @[4-soc/src/main/scala/peripheral/VGA.scala 509:51]
+  wire [5:0] read_y = scrolled ? _read_y_T_1 : frame_y; // @[4-soc/src/main/scala/peripheral/VGA.scala 509:26]
+  wire [12:0] _pixel_idx_T = read_y * 7'h40; // @[4-soc/src/main/scala/peripheral/VGA.scala 510:32]
+  wire [12:0] _GEN_186 = {{7'd0}, read_x}; // @[4-soc/src/main/scala/peripheral/VGA.scala 510:48]
   wire [12:0] pixel_idx = _pixel_idx_T + _GEN_186; // @[4-soc/src/main/scala/peripheral/VGA.scala 352:49]
   wire [9:0] word_offset_1 = pixel_idx[12:3]; // @[4-soc/src/main/scala/peripheral/VGA.scala 353:35]
   wire [13:0] frame_base_1 = curr_frame * 10'h200; // @[4-soc/src/main/scala/peripheral/VGA.scala 355:36]
   wire [13:0] _GEN_187 = {{4'd0}, word_offset_1}; // @[4-soc/src/main/scala/peripheral/VGA.scala 356:36]
   wire [13:0] fb_read_addr = frame_base_1 + _GEN_187; // @[4-soc/src/main/scala/peripheral/VGA.scala 356:36]
+  wire  enable = sprite_pos_0[16]; // @[4-soc/src/main/scala/peripheral/VGA.scala 454:36]
+  wire [7:0] _GEN_262 = {{2'd0}, frame_x}; // @[4-soc/src/main/scala/peripheral/VGA.scala 455:29]
+  wire [7:0] dx = _GEN_262 - sprite_pos_0[7:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 455:29]
+  wire [7:0] _GEN_263 = {{2'd0}, frame_y}; // @[4-soc/src/main/scala/peripheral/VGA.scala 456:29]
+  wire [7:0] dy = _GEN_263 - sprite_pos_0[15:8]; // @[4-soc/src/main/scala/peripheral/VGA.scala 456:29]
+  wire  hit = enable & dx < 8'h8 & dy < 8'h8; // @[4-soc/src/main/scala/peripheral/VGA.scala 457:55]
+  wire  enable_1 = sprite_pos_1[16]; // @[4-soc/src/main/scala/peripheral/VGA.scala 454:36]
+  wire [7:0] _GEN_264 = {{2'd0}, frame_x}; // @[4-soc/src/main/scala/peripheral/VGA.scala 455:29]
+  wire [7:0] dx_1 = _GEN_264 - sprite_pos_1[7:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 455:29]
+  wire [7:0] _GEN_265 = {{2'd0}, frame_y}; // @[4-soc/src/main/scala/peripheral/VGA.scala 456:29]
+  wire [7:0] dy_1 = _GEN_265 - sprite_pos_1[15:8]; // @[4-soc/src/main/scala/peripheral/VGA.scala 456:29]
+  wire  hit_1 = enable_1 & dx_1 < 8'h8 & dy_1 < 8'h8; // @[4-soc/src/main/scala/peripheral/VGA.scala 457:55]
+  wire  enable_2 = sprite_pos_2[16]; // @[4-soc/src/main/scala/peripheral/VGA.scala 454:36]
+  wire [7:0] _GEN_266 = {{2'd0}, frame_x}; // @[4-soc/src/main/scala/peripheral/VGA.scala 455:29]
+  wire [7:0] dx_2 = _GEN_266 - sprite_pos_2[7:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 455:29]
+  wire [7:0] _GEN_267 = {{2'd0}, frame_y}; // @[4-soc/src/main/scala/peripheral/VGA.scala 456:29]
+  wire [7:0] dy_2 = _GEN_267 - sprite_pos_2[15:8]; // @[4-soc/src/main/scala/peripheral/VGA.scala 456:29]
+  wire  hit_2 = enable_2 & dx_2 < 8'h8 & dy_2 < 8'h8; // @[4-soc/src/main/scala/peripheral/VGA.scala 457:55]
+  wire  enable_3 = sprite_pos_3[16]; // @[4-soc/src/main/scala/peripheral/VGA.scala 454:36]
+  wire [7:0] _GEN_268 = {{2'd0}, frame_x}; // @[4-soc/src/main/scala/peripheral/VGA.scala 455:29]
+  wire [7:0] dx_3 = _GEN_268 - sprite_pos_3[7:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 455:29]
+  wire [7:0] _GEN_269 = {{2'd0}, frame_y}; // @[4-soc/src/main/scala/peripheral/VGA.scala 456:29]
+  wire [7:0] dy_3 = _GEN_269 - sprite_pos_3[15:8]; // @[4-soc/src/main/scala/peripheral/VGA.scala 456:29]
+  wire  hit_3 = enable_3 & dx_3 < 8'h8 & dy_3 < 8'h8; // @[4-soc/src/main/scala/peripheral/VGA.scala 457:55]
+  wire  enable_4 = sprite_pos_4[16]; // @[4-soc/src/main/scala/peripheral/VGA.scala 454:36]
+  wire [7:0] _GEN_270 = {{2'd0}, frame_x}; // @[4-soc/src/main/scala/peripheral/VGA.scala 455:29]
+  wire [7:0] dx_4 = _GEN_270 - sprite_pos_4[7:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 455:29]
+  wire [7:0] _GEN_271 = {{2'd0}, frame_y}; // @[4-soc/src/main/scala/peripheral/VGA.scala 456:29]
+  wire [7:0] dy_4 = _GEN_271 - sprite_pos_4[15:8]; // @[4-soc/src/main/scala/peripheral/VGA.scala 456:29]
+  wire  hit_4 = enable_4 & dx_4 < 8'h8 & dy_4 < 8'h8; // @[4-soc/src/main/scala/peripheral/VGA.scala 457:55]
+  wire  enable_5 = sprite_pos_5[16]; // @[4-soc/src/main/scala/peripheral/VGA.scala 454:36]
+  wire [7:0] _GEN_272 = {{2'd0}, frame_x}; // @[4-soc/src/main/scala/peripheral/VGA.scala 455:29]
+  wire [7:0] dx_5 = _GEN_272 - sprite_pos_5[7:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 455:29]
+  wire [7:0] _GEN_273 = {{2'd0}, frame_y}; // @[4-soc/src/main/scala/peripheral/VGA.scala 456:29]
+  wire [7:0] dy_5 = _GEN_273 - sprite_pos_5[15:8]; // @[4-soc/src/main/scala/peripheral/VGA.scala 456:29]
+  wire  hit_5 = enable_5 & dx_5 < 8'h8 & dy_5 < 8'h8; // @[4-soc/src/main/scala/peripheral/VGA.scala 457:55]
+  wire  enable_6 = sprite_pos_6[16]; // @[4-soc/src/main/scala/peripheral/VGA.scala 454:36]
+  wire [7:0] _GEN_274 = {{2'd0}, frame_x}; // @[4-soc/src/main/scala/peripheral/VGA.scala 455:29]
+  wire [7:0] dx_6 = _GEN_274 - sprite_pos_6[7:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 455:29]
+  wire [7:0] _GEN_275 = {{2'd0}, frame_y}; // @[4-soc/src/main/scala/peripheral/VGA.scala 456:29]
+  wire [7:0] dy_6 = _GEN_275 - sprite_pos_6[15:8]; // @[4-soc/src/main/scala/peripheral/VGA.scala 456:29]
+  wire  hit_6 = enable_6 & dx_6 < 8'h8 & dy_6 < 8'h8; // @[4-soc/src/main/scala/peripheral/VGA.scala 457:55]
+  wire  enable_7 = sprite_pos_7[16]; // @[4-soc/src/main/scala/peripheral/VGA.scala 454:36]
+  wire [7:0] _GEN_276 = {{2'd0}, frame_x}; // @[4-soc/src/main/scala/peripheral/VGA.scala 455:29]
+  wire [7:0] dx_7 = _GEN_276 - sprite_pos_7[7:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 455:29]
+  wire [7:0] _GEN_277 = {{2'd0}, frame_y}; // @[4-soc/src/main/scala/peripheral/VGA.scala 456:29]
+  wire [7:0] dy_7 = _GEN_277 - sprite_pos_7[15:8]; // @[4-soc/src/main/scala/peripheral/VGA.scala 456:29]
+  wire  hit_7 = enable_7 & dx_7 < 8'h8 & dy_7 < 8'h8; // @[4-soc/src/main/scala/peripheral/VGA.scala 457:55]
+  wire [7:0] _GEN_334 = {{2'd0}, frame_x}; // @[4-soc/src/main/scala/peripheral/VGA.scala 527:34]
+  wire [7:0] tile_x = _GEN_334 - tile_ctrl[7:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 527:34]
+  wire [7:0] _GEN_335 = {{2'd0}, frame_y}; // @[4-soc/src/main/scala/peripheral/VGA.scala 528:34]
+  wire [7:0] tile_y = _GEN_335 - tile_ctrl[15:8]; // @[4-soc/src/main/scala/peripheral/VGA.scala 528:34]
+  wire  tile_hit = tile_ctrl[16] & tile_x < 8'h60 & tile_y < 8'h60; // @[4-soc/src/main/scala/peripheral/VGA.scala 529:70]
+  wire [13:0] tile_col_mult = tile_x[6:0] * 7'h56; // @[4-soc/src/main/scala/peripheral/VGA.scala 530:36]
+  wire [13:0] tile_row_mult = tile_y[6:0] * 7'h56; // @[4-soc/src/main/scala/peripheral/VGA.scala 531:36]
+  wire [4:0] tile_col = tile_col_mult[12:8]; // @[4-soc/src/main/scala/peripheral/VGA.scala 532:37]
+  wire [4:0] tile_row = tile_row_mult[12:8]; // @[4-soc/src/main/scala/peripheral/VGA.scala 533:37]
+  wire [6:0] _tile_column_T = tile_col * 2'h3; // @[4-soc/src/main/scala/peripheral/VGA.scala 534:41]
+  wire [7:0] _GEN_336 = {{1'd0}, _tile_column_T}; // @[4-soc/src/main/scala/peripheral/VGA.scala 534:30]
+  wire [7:0] tile_column = tile_x - _GEN_336; // @[4-soc/src/main/scala/peripheral/VGA.scala 534:30]
+  wire [6:0] _tile_row_pixel_T = tile_row * 2'h3; // @[4-soc/src/main/scala/peripheral/VGA.scala 535:41]
+  wire [7:0] _GEN_337 = {{1'd0}, _tile_row_pixel_T}; // @[4-soc/src/main/scala/peripheral/VGA.scala 535:30]
+  wire [7:0] tile_row_pixel = tile_y - _GEN_337; // @[4-soc/src/main/scala/peripheral/VGA.scala 535:30]
   reg [2:0] pixel_in_word_d1; // @[4-soc/src/main/scala/peripheral/VGA.scala 361:35]
+  reg  hit_d1; // @[4-soc/src/main/scala/peripheral/VGA.scala 462:30]
+  reg [2:0] column_d1; // @[4-soc/src/main/scala/peripheral/VGA.scala 463:30]
+  reg  hit_d1_1; // @[4-soc/src/main/scala/peripheral/VGA.scala 462:30]
+  reg [2:0] column_d1_1; // @[4-soc/src/main/scala/peripheral/VGA.scala 463:30]
+  reg  hit_d1_2; // @[4-soc/src/main/scala/peripheral/VGA.scala 462:30]
+  reg [2:0] column_d1_2; // @[4-soc/src/main/scala/peripheral/VGA.scala 463:30]
+  reg  hit_d1_3; // @[4-soc/src/main/scala/peripheral/VGA.scala 462:30]
+  reg [2:0] column_d1_3; // @[4-soc/src/main/scala/peripheral/VGA.scala 463:30]
+  reg  hit_d1_4; // @[4-soc/src/main/scala/peripheral/VGA.scala 462:30]
+  reg [2:0] column_d1_4; // @[4-soc/src/main/scala/peripheral/VGA.scala 463:30]
+  reg  hit_d1_5; // @[4-soc/src/main/scala/peripheral/VGA.scala 462:30]
+  reg [2:0] column_d1_5; // @[4-soc/src/main/scala/peripheral/VGA.scala 463:30]
+  reg  hit_d1_6; // @[4-soc/src/main/scala/peripheral/VGA.scala 462:30]
+  reg [2:0] column_d1_6; // @[4-soc/src/main/scala/peripheral/VGA.scala 463:30]
+  reg  hit_d1_7; // @[4-soc/src/main/scala/peripheral/VGA.scala 462:30]
+  reg [2:0] column_d1_7; // @[4-soc/src/main/scala/peripheral/VGA.scala 463:30]
+  reg [5:0] tile_line_0; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_1; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_2; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_3; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_4; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_5; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_6; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_7; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_8; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_9; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_10; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_11; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_12; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_13; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_14; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_15; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_16; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_17; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_18; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_19; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_20; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_21; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_22; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_23; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_24; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_25; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_26; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_27; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_28; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_29; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_30; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg [5:0] tile_line_31; // @[4-soc/src/main/scala/peripheral/VGA.scala 540:30]
+  reg  tile_fetch_d1; // @[4-soc/src/main/scala/peripheral/VGA.scala 541:37]
+  reg [4:0] tile_fetch_col_d1; // @[4-soc/src/main/scala/peripheral/VGA.scala 542:37]
+  reg  tile_hit_d1; // @[4-soc/src/main/scala/peripheral/VGA.scala 552:35]
+  reg [1:0] tile_column_d1; // @[4-soc/src/main/scala/peripheral/VGA.scala 553:35]
   wire [3:0] _pixel_4bit_T_9 = 3'h0 == pixel_in_word_d1 ? framebuffer_doutb[3:0] : 4'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 365:51]
   wire [3:0] _pixel_4bit_T_11 = 3'h1 == pixel_in_word_d1 ? framebuffer_doutb[7:4] : _pixel_4bit_T_9; // @[4-soc/src/main/scala/peripheral/VGA.scala 365:51]
   wire [3:0] _pixel_4bit_T_13 = 3'h2 == pixel_in_word_d1 ? framebuffer_doutb[11:8] : _pixel_4bit_T_11; // @[4-soc/src/main/scala/peripheral/VGA.scala 365:51]
@@ -1007,21 +1196,130 @@ module VGA(
   wire [3:0] _pixel_4bit_T_19 = 3'h5 == pixel_in_word_d1 ? framebuffer_doutb[23:20] : _pixel_4bit_T_17; // @[4-soc/src/main/scala/peripheral/VGA.scala 365:51]
   wire [3:0] _pixel_4bit_T_21 = 3'h6 == pixel_in_word_d1 ? framebuffer_doutb[27:24] : _pixel_4bit_T_19; // @[4-soc/src/main/scala/peripheral/VGA.scala 365:51]
   wire [3:0] pixel_4bit = 3'h7 == pixel_in_word_d1 ? framebuffer_doutb[31:28] : _pixel_4bit_T_21; // @[4-soc/src/main/scala/peripheral/VGA.scala 365:51]
-  wire [5:0] _GEN_167 = 4'h1 == pixel_4bit ? palette_sync_1 : palette_sync_0; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
-  wire [5:0] _GEN_168 = 4'h2 == pixel_4bit ? palette_sync_2 : _GEN_167; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
-  wire [5:0] _GEN_169 = 4'h3 == pixel_4bit ? palette_sync_3 : _GEN_168; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
-  wire [5:0] _GEN_170 = 4'h4 == pixel_4bit ? palette_sync_4 : _GEN_169; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
-  wire [5:0] _GEN_171 = 4'h5 == pixel_4bit ? palette_sync_5 : _GEN_170; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
-  wire [5:0] _GEN_172 = 4'h6 == pixel_4bit ? palette_sync_6 : _GEN_171; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
-  wire [5:0] _GEN_173 = 4'h7 == pixel_4bit ? palette_sync_7 : _GEN_172; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
-  wire [5:0] _GEN_174 = 4'h8 == pixel_4bit ? palette_sync_8 : _GEN_173; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
-  wire [5:0] _GEN_175 = 4'h9 == pixel_4bit ? palette_sync_9 : _GEN_174; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
-  wire [5:0] _GEN_176 = 4'ha == pixel_4bit ? palette_sync_10 : _GEN_175; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
-  wire [5:0] _GEN_177 = 4'hb == pixel_4bit ? palette_sync_11 : _GEN_176; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
-  wire [5:0] _GEN_178 = 4'hc == pixel_4bit ? palette_sync_12 : _GEN_177; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
-  wire [5:0] _GEN_179 = 4'hd == pixel_4bit ? palette_sync_13 : _GEN_178; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
-  wire [5:0] _GEN_180 = 4'he == pixel_4bit ? palette_sync_14 : _GEN_179; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
-  wire [5:0] _GEN_181 = 4'hf == pixel_4bit ? palette_sync_15 : _GEN_180; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
+  wire [3:0] _GEN_278 = 3'h1 == column_d1 ? sprites_0_doutb[7:4] : sprites_0_doutb[3:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_279 = 3'h2 == column_d1 ? sprites_0_doutb[11:8] : _GEN_278; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_280 = 3'h3 == column_d1 ? sprites_0_doutb[15:12] : _GEN_279; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_281 = 3'h4 == column_d1 ? sprites_0_doutb[19:16] : _GEN_280; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_282 = 3'h5 == column_d1 ? sprites_0_doutb[23:20] : _GEN_281; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_283 = 3'h6 == column_d1 ? sprites_0_doutb[27:24] : _GEN_282; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] sprite_pixel_0 = 3'h7 == column_d1 ? sprites_0_doutb[31:28] : _GEN_283; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire  sprite_visible_0 = hit_d1 & sprite_pixel_0 != sprite_key; // @[4-soc/src/main/scala/peripheral/VGA.scala 466:35]
+  wire [3:0] _GEN_284 = 3'h1 == column_d1_1 ? sprites_1_doutb[7:4] : sprites_1_doutb[3:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_285 = 3'h2 == column_d1_1 ? sprites_1_doutb[11:8] : _GEN_284; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_286 = 3'h3 == column_d1_1 ? sprites_1_doutb[15:12] : _GEN_285; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_287 = 3'h4 == column_d1_1 ? sprites_1_doutb[19:16] : _GEN_286; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_288 = 3'h5 == column_d1_1 ? sprites_1_doutb[23:20] : _GEN_287; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_289 = 3'h6 == column_d1_1 ? sprites_1_doutb[27:24] : _GEN_288; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] sprite_pixel_1 = 3'h7 == column_d1_1 ? sprites_1_doutb[31:28] : _GEN_289; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire  sprite_visible_1 = hit_d1_1 & sprite_pixel_1 != sprite_key; // @[4-soc/src/main/scala/peripheral/VGA.scala 466:35]
+  wire [3:0] _GEN_290 = 3'h1 == column_d1_2 ? sprites_2_doutb[7:4] : sprites_2_doutb[3:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_291 = 3'h2 == column_d1_2 ? sprites_2_doutb[11:8] : _GEN_290; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_292 = 3'h3 == column_d1_2 ? sprites_2_doutb[15:12] : _GEN_291; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_293 = 3'h4 == column_d1_2 ? sprites_2_doutb[19:16] : _GEN_292; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_294 = 3'h5 == column_d1_2 ? sprites_2_doutb[23:20] : _GEN_293; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_295 = 3'h6 == column_d1_2 ? sprites_2_doutb[27:24] : _GEN_294; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] sprite_pixel_2 = 3'h7 == column_d1_2 ? sprites_2_doutb[31:28] : _GEN_295; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire  sprite_visible_2 = hit_d1_2 & sprite_pixel_2 != sprite_key; // @[4-soc/src/main/scala/peripheral/VGA.scala 466:35]
+  wire [3:0] _GEN_296 = 3'h1 == column_d1_3 ? sprites_3_doutb[7:4] : sprites_3_doutb[3:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_297 = 3'h2 == column_d1_3 ? sprites_3_doutb[11:8] : _GEN_296; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_298 = 3'h3 == column_d1_3 ? sprites_3_doutb[15:12] : _GEN_297; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_299 = 3'h4 == column_d1_3 ? sprites_3_doutb[19:16] : _GEN_298; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_300 = 3'h5 == column_d1_3 ? sprites_3_doutb[23:20] : _GEN_299; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_301 = 3'h6 == column_d1_3 ? sprites_3_doutb[27:24] : _GEN_300; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] sprite_pixel_3 = 3'h7 == column_d1_3 ? sprites_3_doutb[31:28] : _GEN_301; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire  sprite_visible_3 = hit_d1_3 & sprite_pixel_3 != sprite_key; // @[4-soc/src/main/scala/peripheral/VGA.scala 466:35]
+  wire [3:0] _GEN_302 = 3'h1 == column_d1_4 ? sprites_4_doutb[7:4] : sprites_4_doutb[3:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_303 = 3'h2 == column_d1_4 ? sprites_4_doutb[11:8] : _GEN_302; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_304 = 3'h3 == column_d1_4 ? sprites_4_doutb[15:12] : _GEN_303; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_305 = 3'h4 == column_d1_4 ? sprites_4_doutb[19:16] : _GEN_304; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_306 = 3'h5 == column_d1_4 ? sprites_4_doutb[23:20] : _GEN_305; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_307 = 3'h6 == column_d1_4 ? sprites_4_doutb[27:24] : _GEN_306; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] sprite_pixel_4 = 3'h7 == column_d1_4 ? sprites_4_doutb[31:28] : _GEN_307; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire  sprite_visible_4 = hit_d1_4 & sprite_pixel_4 != sprite_key; // @[4-soc/src/main/scala/peripheral/VGA.scala 466:35]
+  wire [3:0] _GEN_308 = 3'h1 == column_d1_5 ? sprites_5_doutb[7:4] : sprites_5_doutb[3:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_309 = 3'h2 == column_d1_5 ? sprites_5_doutb[11:8] : _GEN_308; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_310 = 3'h3 == column_d1_5 ? sprites_5_doutb[15:12] : _GEN_309; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_311 = 3'h4 == column_d1_5 ? sprites_5_doutb[19:16] : _GEN_310; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_312 = 3'h5 == column_d1_5 ? sprites_5_doutb[23:20] : _GEN_311; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_313 = 3'h6 == column_d1_5 ? sprites_5_doutb[27:24] : _GEN_312; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] sprite_pixel_5 = 3'h7 == column_d1_5 ? sprites_5_doutb[31:28] : _GEN_313; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire  sprite_visible_5 = hit_d1_5 & sprite_pixel_5 != sprite_key; // @[4-soc/src/main/scala/peripheral/VGA.scala 466:35]
+  wire [3:0] _GEN_314 = 3'h1 == column_d1_6 ? sprites_6_doutb[7:4] : sprites_6_doutb[3:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_315 = 3'h2 == column_d1_6 ? sprites_6_doutb[11:8] : _GEN_314; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_316 = 3'h3 == column_d1_6 ? sprites_6_doutb[15:12] : _GEN_315; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_317 = 3'h4 == column_d1_6 ? sprites_6_doutb[19:16] : _GEN_316; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_318 = 3'h5 == column_d1_6 ? sprites_6_doutb[23:20] : _GEN_317; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_319 = 3'h6 == column_d1_6 ? sprites_6_doutb[27:24] : _GEN_318; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] sprite_pixel_6 = 3'h7 == column_d1_6 ? sprites_6_doutb[31:28] : _GEN_319; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire  sprite_visible_6 = hit_d1_6 & sprite_pixel_6 != sprite_key; // @[4-soc/src/main/scala/peripheral/VGA.scala 466:35]
+  wire [3:0] _GEN_320 = 3'h1 == column_d1_7 ? sprites_7_doutb[7:4] : sprites_7_doutb[3:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_321 = 3'h2 == column_d1_7 ? sprites_7_doutb[11:8] : _GEN_320; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_322 = 3'h3 == column_d1_7 ? sprites_7_doutb[15:12] : _GEN_321; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_323 = 3'h4 == column_d1_7 ? sprites_7_doutb[19:16] : _GEN_322; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_324 = 3'h5 == column_d1_7 ? sprites_7_doutb[23:20] : _GEN_323; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] _GEN_325 = 3'h6 == column_d1_7 ? sprites_7_doutb[27:24] : _GEN_324; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire [3:0] sprite_pixel_7 = 3'h7 == column_d1_7 ? sprites_7_doutb[31:28] : _GEN_325; // @[4-soc/src/main/scala/peripheral/VGA.scala 465:{25,25}]
+  wire  sprite_visible_7 = hit_d1_7 & sprite_pixel_7 != sprite_key; // @[4-soc/src/main/scala/peripheral/VGA.scala 466:35]
+  wire  _tile_fetch_d1_T = x_px < 10'h20; // @[4-soc/src/main/scala/peripheral/VGA.scala 541:45]
+  wire [5:0] _GEN_338 = 5'h1 == tile_col ? tile_line_1 : tile_line_0; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_339 = 5'h2 == tile_col ? tile_line_2 : _GEN_338; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_340 = 5'h3 == tile_col ? tile_line_3 : _GEN_339; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_341 = 5'h4 == tile_col ? tile_line_4 : _GEN_340; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_342 = 5'h5 == tile_col ? tile_line_5 : _GEN_341; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_343 = 5'h6 == tile_col ? tile_line_6 : _GEN_342; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_344 = 5'h7 == tile_col ? tile_line_7 : _GEN_343; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_345 = 5'h8 == tile_col ? tile_line_8 : _GEN_344; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_346 = 5'h9 == tile_col ? tile_line_9 : _GEN_345; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_347 = 5'ha == tile_col ? tile_line_10 : _GEN_346; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_348 = 5'hb == tile_col ? tile_line_11 : _GEN_347; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_349 = 5'hc == tile_col ? tile_line_12 : _GEN_348; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_350 = 5'hd == tile_col ? tile_line_13 : _GEN_349; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_351 = 5'he == tile_col ? tile_line_14 : _GEN_350; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_352 = 5'hf == tile_col ? tile_line_15 : _GEN_351; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_353 = 5'h10 == tile_col ? tile_line_16 : _GEN_352; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_354 = 5'h11 == tile_col ? tile_line_17 : _GEN_353; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_355 = 5'h12 == tile_col ? tile_line_18 : _GEN_354; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_356 = 5'h13 == tile_col ? tile_line_19 : _GEN_355; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_357 = 5'h14 == tile_col ? tile_line_20 : _GEN_356; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_358 = 5'h15 == tile_col ? tile_line_21 : _GEN_357; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_359 = 5'h16 == tile_col ? tile_line_22 : _GEN_358; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_360 = 5'h17 == tile_col ? tile_line_23 : _GEN_359; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_361 = 5'h18 == tile_col ? tile_line_24 : _GEN_360; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_362 = 5'h19 == tile_col ? tile_line_25 : _GEN_361; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_363 = 5'h1a == tile_col ? tile_line_26 : _GEN_362; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_364 = 5'h1b == tile_col ? tile_line_27 : _GEN_363; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_365 = 5'h1c == tile_col ? tile_line_28 : _GEN_364; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_366 = 5'h1d == tile_col ? tile_line_29 : _GEN_365; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_367 = 5'h1e == tile_col ? tile_line_30 : _GEN_366; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [5:0] _GEN_368 = 5'h1f == tile_col ? tile_line_31 : _GEN_367; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:{26,26}]
+  wire [3:0] _GEN_369 = 2'h1 == tile_column_d1 ? tiles_doutb[7:4] : tiles_doutb[3:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 555:{30,30}]
+  wire [3:0] _GEN_370 = 2'h2 == tile_column_d1 ? tiles_doutb[11:8] : _GEN_369; // @[4-soc/src/main/scala/peripheral/VGA.scala 555:{30,30}]
+  wire [3:0] tile_pixel = 2'h3 == tile_column_d1 ? tiles_doutb[15:12] : _GEN_370; // @[4-soc/src/main/scala/peripheral/VGA.scala 555:{30,30}]
+  wire  tile_visible = tile_hit_d1 & tile_pixel != sprite_key; // @[4-soc/src/main/scala/peripheral/VGA.scala 556:46]
+  wire [3:0] _pixel_index_T = tile_visible ? tile_pixel : pixel_4bit; // @[src/main/scala/chisel3/util/Mux.scala 47:70]
+  wire [3:0] _pixel_index_T_1 = sprite_visible_7 ? sprite_pixel_7 : _pixel_index_T; // @[src/main/scala/chisel3/util/Mux.scala 47:70]
+  wire [3:0] _pixel_index_T_2 = sprite_visible_6 ? sprite_pixel_6 : _pixel_index_T_1; // @[src/main/scala/chisel3/util/Mux.scala 47:70]
+  wire [3:0] _pixel_index_T_3 = sprite_visible_5 ? sprite_pixel_5 : _pixel_index_T_2; // @[src/main/scala/chisel3/util/Mux.scala 47:70]
+  wire [3:0] _pixel_index_T_4 = sprite_visible_4 ? sprite_pixel_4 : _pixel_index_T_3; // @[src/main/scala/chisel3/util/Mux.scala 47:70]
+  wire [3:0] _pixel_index_T_5 = sprite_visible_3 ? sprite_pixel_3 : _pixel_index_T_4; // @[src/main/scala/chisel3/util/Mux.scala 47:70]
+  wire [3:0] _pixel_index_T_6 = sprite_visible_2 ? sprite_pixel_2 : _pixel_index_T_5; // @[src/main/scala/chisel3/util/Mux.scala 47:70]
+  wire [3:0] _pixel_index_T_7 = sprite_visible_1 ? sprite_pixel_1 : _pixel_index_T_6; // @[src/main/scala/chisel3/util/Mux.scala 47:70]
+  wire [3:0] pixel_index = sprite_visible_0 ? sprite_pixel_0 : _pixel_index_T_7; // @[src/main/scala/chisel3/util/Mux.scala 47:70]
+  wire [5:0] _GEN_167 = 4'h1 == pixel_index ? palette_sync_1 : palette_sync_0; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
+  wire [5:0] _GEN_168 = 4'h2 == pixel_index ? palette_sync_2 : _GEN_167; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
+  wire [5:0] _GEN_169 = 4'h3 == pixel_index ? palette_sync_3 : _GEN_168; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
+  wire [5:0] _GEN_170 = 4'h4 == pixel_index ? palette_sync_4 : _GEN_169; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
+  wire [5:0] _GEN_171 = 4'h5 == pixel_index ? palette_sync_5 : _GEN_170; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
+  wire [5:0] _GEN_172 = 4'h6 == pixel_index ? palette_sync_6 : _GEN_171; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
+  wire [5:0] _GEN_173 = 4'h7 == pixel_index ? palette_sync_7 : _GEN_172; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
+  wire [5:0] _GEN_174 = 4'h8 == pixel_index ? palette_sync_8 : _GEN_173; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
+  wire [5:0] _GEN_175 = 4'h9 == pixel_index ? palette_sync_9 : _GEN_174; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
+  wire [5:0] _GEN_176 = 4'ha == pixel_index ? palette_sync_10 : _GEN_175; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
+  wire [5:0] _GEN_177 = 4'hb == pixel_index ? palette_sync_11 : _GEN_176; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
+  wire [5:0] _GEN_178 = 4'hc == pixel_index ? palette_sync_12 : _GEN_177; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
+  wire [5:0] _GEN_179 = 4'hd == pixel_index ? palette_sync_13 : _GEN_178; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
+  wire [5:0] _GEN_180 = 4'he == pixel_index ? palette_sync_14 : _GEN_179; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
+  wire [5:0] _GEN_181 = 4'hf == pixel_index ? palette_sync_15 : _GEN_180; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:{20,20}]
   wire [5:0] _GEN_182 = display_enabled & in_display_d1 ? _GEN_181 : 6'h1; // @[4-soc/src/main/scala/peripheral/VGA.scala 383:50 384:20 386:20]
   wire [5:0] output_color = blanking ? 6'h0 : _GEN_182; // @[4-soc/src/main/scala/peripheral/VGA.scala 381:20 382:20]
   reg [9:0] x_px_d1; // @[4-soc/src/main/scala/peripheral/VGA.scala 393:26]
@@ -1039,6 +1337,96 @@ module VGA(
     .addrb(framebuffer_addrb),
     .doutb(framebuffer_doutb)
   );
+  TrueDualPortRAM32 #(.ADDR_WIDTH(3), .DEPTH(8)) sprites_0 ( // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+    .clka(sprites_0_clka),
+    .wea(sprites_0_wea),
+    .addra(sprites_0_addra),
+    .dina(sprites_0_dina),
+    .clkb(sprites_0_clkb),
+    .addrb(sprites_0_addrb),
+    .doutb(sprites_0_doutb)
+  );
+  TrueDualPortRAM32 #(.ADDR_WIDTH(3), .DEPTH(8)) sprites_1 ( // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+    .clka(sprites_1_clka),
+    .wea(sprites_1_wea),
+    .addra(sprites_1_addra),
+    .dina(sprites_1_dina),
+    .clkb(sprites_1_clkb),
+    .addrb(sprites_1_addrb),
+    .doutb(sprites_1_doutb)
+  );
+  TrueDualPortRAM32 #(.ADDR_WIDTH(3), .DEPTH(8)) sprites_2 ( // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+    .clka(sprites_2_clka),
+    .wea(sprites_2_wea),
+    .addra(sprites_2_addra),
+    .dina(sprites_2_dina),
+    .clkb(sprites_2_clkb),
+    .addrb(sprites_2_addrb),
+    .doutb(sprites_2_doutb)
+  );
+  TrueDualPortRAM32 #(.ADDR_WIDTH(3), .DEPTH(8)) sprites_3 ( // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+    .clka(sprites_3_clka),
+    .wea(sprites_3_wea),
+    .addra(sprites_3_addra),
+    .dina(sprites_3_dina),
+    .clkb(sprites_3_clkb),
+    .addrb(sprites_3_addrb),
+    .doutb(sprites_3_doutb)
+  );
+  TrueDualPortRAM32 #(.ADDR_WIDTH(3), .DEPTH(8)) sprites_4 ( // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+    .clka(sprites_4_clka),
+    .wea(sprites_4_wea),
+    .addra(sprites_4_addra),
+    .dina(sprites_4_dina),
+    .clkb(sprites_4_clkb),
+    .addrb(sprites_4_addrb),
+    .doutb(sprites_4_doutb)
+  );
+  TrueDualPortRAM32 #(.ADDR_WIDTH(3), .DEPTH(8)) sprites_5 ( // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+    .clka(sprites_5_clka),
+    .wea(sprites_5_wea),
+    .addra(sprites_5_addra),
+    .dina(sprites_5_dina),
+    .clkb(sprites_5_clkb),
+    .addrb(sprites_5_addrb),
+    .doutb(sprites_5_doutb)
+  );
+  TrueDualPortRAM32 #(.ADDR_WIDTH(3), .DEPTH(8)) sprites_6 ( // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+    .clka(sprites_6_clka),
+    .wea(sprites_6_wea),
+    .addra(sprites_6_addra),
+    .dina(sprites_6_dina),
+    .clkb(sprites_6_clkb),
+    .addrb(sprites_6_addrb),
+    .doutb(sprites_6_doutb)
+  );
+  TrueDualPortRAM32 #(.ADDR_WIDTH(3), .DEPTH(8)) sprites_7 ( // @[4-soc/src/main/scala/peripheral/VGA.scala 132:73]
+    .clka(sprites_7_clka),
+    .wea(sprites_7_wea),
+    .addra(sprites_7_addra),
+    .dina(sprites_7_dina),
+    .clkb(sprites_7_clkb),
+    .addrb(sprites_7_addrb),
+    .doutb(sprites_7_doutb)
+  );
+  TrueDualPortRAM32 #(.ADDR_WIDTH(8), .DEPTH(256)) tiles ( // @[4-soc/src/main/scala/peripheral/VGA.scala 159:29]
+    .clka(tiles_clka),
+    .wea(tiles_wea),
+    .addra(tiles_addra),
+    .dina(tiles_dina),
+    .clkb(tiles_clkb),
+    .addrb(tiles_addrb),
+    .doutb(tiles_doutb)
+  );
+  TrueDualPortRAM32 #(.ADDR_WIDTH(10), .DEPTH(1024)) tile_map ( // @[4-soc/src/main/scala/peripheral/VGA.scala 160:29]
+    .clka(tile_map_clka),
+    .wea(tile_map_wea),
+    .addra(tile_map_addra),
+    .dina(tile_map_dina),
+    .clkb(tile_map_clkb),
+    .addrb(tile_map_addrb),
+    .doutb(tile_map_doutb)
+  );
   AXI4LiteSlave_1 slave ( // @[4-soc/src/main/scala/peripheral/VGA.scala 102:21]
     .clock(slave_clock),
     .reset(slave_reset),
@@ -1081,6 +1469,66 @@ module VGA(
   assign framebuffer_dina = slave_io_bundle_write ? _GEN_123 : 32'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 236:33 233:36]
   assign framebuffer_clkb = io_pixClock; // @[4-soc/src/main/scala/peripheral/VGA.scala 358:26]
   assign framebuffer_addrb = fb_read_addr[12:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 359:26]
+  assign sprites_0_clka = clock; // @[4-soc/src/main/scala/peripheral/VGA.scala 332:23]
+  assign sprites_0_wea = slave_io_bundle_write & addr_sprite_data & sprite_data_sel == 11'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 333:77]
+  assign sprites_0_addra = sprite_data_word[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 334:23]
+  assign sprites_0_dina = slave_io_bundle_write_data; // @[4-soc/src/main/scala/peripheral/VGA.scala 335:23]
+  assign sprites_0_clkb = io_pixClock; // @[4-soc/src/main/scala/peripheral/VGA.scala 459:23]
+  assign sprites_0_addrb = dy[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 460:23]
+  assign sprites_1_clka = clock; // @[4-soc/src/main/scala/peripheral/VGA.scala 332:23]
+  assign sprites_1_wea = slave_io_bundle_write & addr_sprite_data & sprite_data_sel == 11'h1; // @[4-soc/src/main/scala/peripheral/VGA.scala 333:77]
+  assign sprites_1_addra = sprite_data_word[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 334:23]
+  assign sprites_1_dina = slave_io_bundle_write_data; // @[4-soc/src/main/scala/peripheral/VGA.scala 335:23]
+  assign sprites_1_clkb = io_pixClock; // @[4-soc/src/main/scala/peripheral/VGA.scala 459:23]
+  assign sprites_1_addrb = dy_1[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 460:23]
+  assign sprites_2_clka = clock; // @[4-soc/src/main/scala/peripheral/VGA.scala 332:23]
+  assign sprites_2_wea = slave_io_bundle_write & addr_sprite_data & sprite_data_sel == 11'h2; // @[4-soc/src/main/scala/peripheral/VGA.scala 333:77]
+  assign sprites_2_addra = sprite_data_word[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 334:23]
+  assign sprites_2_dina = slave_io_bundle_write_data; // @[4-soc/src/main/scala/peripheral/VGA.scala 335:23]
+  assign sprites_2_clkb = io_pixClock; // @[4-soc/src/main/scala/peripheral/VGA.scala 459:23]
+  assign sprites_2_addrb = dy_2[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 460:23]
+  assign sprites_3_clka = clock; // @[4-soc/src/main/scala/peripheral/VGA.scala 332:23]
+  assign sprites_3_wea = slave_io_bundle_write & addr_sprite_data & sprite_data_sel == 11'h3; // @[4-soc/src/main/scala/peripheral/VGA.scala 333:77]
+  assign sprites_3_addra = sprite_data_word[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 334:23]
+  assign sprites_3_dina = slave_io_bundle_write_data; // @[4-soc/src/main/scala/peripheral/VGA.scala 335:23]
+  assign sprites_3_clkb = io_pixClock; // @[4-soc/src/main/scala/peripheral/VGA.scala 459:23]
+  assign sprites_3_addrb = dy_3[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 460:23]
+  assign sprites_4_clka = clock; // @[4-soc/src/main/scala/peripheral/VGA.scala 332:23]
+  assign sprites_4_wea = slave_io_bundle_write & addr_sprite_data & sprite_data_sel == 11'h4; // @[4-soc/src/main/scala/peripheral/VGA.scala 333:77]
+  assign sprites_4_addra = sprite_data_word[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 334:23]
+  assign sprites_4_dina = slave_io_bundle_write_data; // @[4-soc/src/main/scala/peripheral/VGA.scala 335:23]
+  assign sprites_4_clkb = io_pixClock; // @[4-soc/src/main/scala/peripheral/VGA.scala 459:23]
+  assign sprites_4_addrb = dy_4[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 460:23]
+  assign sprites_5_clka = clock; // @[4-soc/src/main/scala/peripheral/VGA.scala 332:23]
+  assign sprites_5_wea = slave_io_bundle_write & addr_sprite_data & sprite_data_sel == 11'h5; // @[4-soc/src/main/scala/peripheral/VGA.scala 333:77]
+  assign sprites_5_addra = sprite_data_word[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 334:23]
+  assign sprites_5_dina = slave_io_bundle_write_data; // @[4-soc/src/main/scala/peripheral/VGA.scala 335:23]
+  assign sprites_5_clkb = io_pixClock; // @[4-soc/src/main/scala/peripheral/VGA.scala 459:23]
+  assign sprites_5_addrb = dy_5[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 460:23]
+  assign sprites_6_clka = clock; // @[4-soc/src/main/scala/peripheral/VGA.scala 332:23]
+  assign sprites_6_wea = slave_io_bundle_write & addr_sprite_data & sprite_data_sel == 11'h6; // @[4-soc/src/main/scala/peripheral/VGA.scala 333:77]
+  assign sprites_6_addra = sprite_data_word[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 334:23]
+  assign sprites_6_dina = slave_io_bundle_write_data; // @[4-soc/src/main/scala/peripheral/VGA.scala 335:23]
+  assign sprites_6_clkb = io_pixClock; // @[4-soc/src/main/scala/peripheral/VGA.scala 459:23]
+  assign sprites_6_addrb = dy_6[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 460:23]
+  assign sprites_7_clka = clock; // @[4-soc/src/main/scala/peripheral/VGA.scala 332:23]
+  assign sprites_7_wea = slave_io_bundle_write & addr_sprite_data & sprite_data_sel == 11'h7; // @[4-soc/src/main/scala/peripheral/VGA.scala 333:77]
+  assign sprites_7_addra = sprite_data_word[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 334:23]
+  assign sprites_7_dina = slave_io_bundle_write_data; // @[4-soc/src/main/scala/peripheral/VGA.scala 335:23]
+  assign sprites_7_clkb = io_pixClock; // @[4-soc/src/main/scala/peripheral/VGA.scala 459:23]
+  assign sprites_7_addrb = dy_7[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 460:23]
+  assign tiles_clka = clock; // @[4-soc/src/main/scala/peripheral/VGA.scala 384:21]
+  assign tiles_wea = slave_io_bundle_write & addr_tile_data; // @[4-soc/src/main/scala/peripheral/VGA.scala 385:46]
+  assign tiles_addra = tile_data_word[7:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 386:21]
+  assign tiles_dina = slave_io_bundle_write_data; // @[4-soc/src/main/scala/peripheral/VGA.scala 387:21]
+  assign tiles_clkb = io_pixClock; // @[4-soc/src/main/scala/peripheral/VGA.scala 549:20]
+  assign tiles_addrb = {_GEN_368,tile_row_pixel[1:0]}; // @[4-soc/src/main/scala/peripheral/VGA.scala 550:20]
+  assign tile_map_clka = clock; // @[4-soc/src/main/scala/peripheral/VGA.scala 388:21]
+  assign tile_map_wea = slave_io_bundle_write & addr_tile_map; // @[4-soc/src/main/scala/peripheral/VGA.scala 389:46]
+  assign tile_map_addra = tile_map_word[9:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 390:21]
+  assign tile_map_dina = slave_io_bundle_write_data; // @[4-soc/src/main/scala/peripheral/VGA.scala 391:21]
+  assign tile_map_clkb = io_pixClock; // @[4-soc/src/main/scala/peripheral/VGA.scala 543:23]
+  assign tile_map_addrb = {tile_row,x_px[4:0]}; // @[4-soc/src/main/scala/peripheral/VGA.scala 544:27]
   assign slave_clock = clock;
   assign slave_reset = reset;
   assign slave_io_channels_write_address_channel_AWVALID = io_channels_write_address_channel_AWVALID; // @[4-soc/src/main/scala/peripheral/VGA.scala 103:21]
@@ -1284,6 +1732,114 @@ module VGA(
       timing_error_count <= _timing_error_count_T_1; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:26]
     end
     vblank_prev <= vblank_synced; // @[4-soc/src/main/scala/peripheral/VGA.scala 157:37]
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 146:30]
+      spriteKeyReg <= 4'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 146:30]
+    end else if (slave_io_bundle_write) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 236:33]
+      if (!(addr_ctrl)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 237:23]
+        if (!(addr_intr_status)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 245:36]
+          spriteKeyReg <= _GEN_205;
+        end
+      end
+    end
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+      spritePosReg_0 <= 17'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+    end else if (slave_io_bundle_write) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 236:33]
+      if (!(addr_ctrl)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 237:23]
+        if (!(addr_intr_status)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 245:36]
+          spritePosReg_0 <= _GEN_212;
+        end
+      end
+    end
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+      spritePosReg_1 <= 17'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+    end else if (slave_io_bundle_write) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 236:33]
+      if (!(addr_ctrl)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 237:23]
+        if (!(addr_intr_status)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 245:36]
+          spritePosReg_1 <= _GEN_219;
+        end
+      end
+    end
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+      spritePosReg_2 <= 17'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+    end else if (slave_io_bundle_write) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 236:33]
+      if (!(addr_ctrl)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 237:23]
+        if (!(addr_intr_status)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 245:36]
+          spritePosReg_2 <= _GEN_226;
+        end
+      end
+    end
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+      spritePosReg_3 <= 17'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+    end else if (slave_io_bundle_write) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 236:33]
+      if (!(addr_ctrl)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 237:23]
+        if (!(addr_intr_status)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 245:36]
+          spritePosReg_3 <= _GEN_233;
+        end
+      end
+    end
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+      spritePosReg_4 <= 17'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+    end else if (slave_io_bundle_write) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 236:33]
+      if (!(addr_ctrl)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 237:23]
+        if (!(addr_intr_status)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 245:36]
+          spritePosReg_4 <= _GEN_240;
+        end
+      end
+    end
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+      spritePosReg_5 <= 17'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+    end else if (slave_io_bundle_write) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 236:33]
+      if (!(addr_ctrl)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 237:23]
+        if (!(addr_intr_status)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 245:36]
+          spritePosReg_5 <= _GEN_247;
+        end
+      end
+    end
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+      spritePosReg_6 <= 17'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+    end else if (slave_io_bundle_write) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 236:33]
+      if (!(addr_ctrl)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 237:23]
+        if (!(addr_intr_status)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 245:36]
+          spritePosReg_6 <= _GEN_254;
+        end
+      end
+    end
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+      spritePosReg_7 <= 17'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 147:30]
+    end else if (slave_io_bundle_write) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 236:33]
+      if (!(addr_ctrl)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 237:23]
+        if (!(addr_intr_status)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 245:36]
+          spritePosReg_7 <= _GEN_261;
+        end
+      end
+    end
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 181:30]
+      tileCtrlReg <= 17'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 181:30]
+    end else if (slave_io_bundle_write) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 327:33]
+      if (!(addr_ctrl)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 328:23]
+        if (!(addr_intr_status)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 336:36]
+          tileCtrlReg <= _GEN_333;
+        end
+      end
+    end
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 191:30]
+      scrollReg <= 14'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 191:30]
+    end else if (slave_io_bundle_write) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 327:33]
+      if (!(addr_ctrl)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 328:23]
+        if (!(addr_intr_status)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 336:36]
+          scrollReg <= _GEN_380;
+        end
+      end
+    end
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 192:30]
+      splitReg <= 6'h0; // @[4-soc/src/main/scala/peripheral/VGA.scala 192:30]
+    end else if (slave_io_bundle_write) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 327:33]
+      if (!(addr_ctrl)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 328:23]
+        if (!(addr_intr_status)) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 336:36]
+          splitReg <= _GEN_389;
+        end
+      end
+    end
   end
   always @(posedge io_pixClock) begin
     if (reset) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 274:26]
@@ -1351,12 +1907,216 @@ module VGA(
     palette_sync_13 <= palette_sync1_13; // @[4-soc/src/main/scala/peripheral/VGA.scala 335:32]
     palette_sync_14 <= palette_sync1_14; // @[4-soc/src/main/scala/peripheral/VGA.scala 335:32]
     palette_sync_15 <= palette_sync1_15; // @[4-soc/src/main/scala/peripheral/VGA.scala 335:32]
+    sprite_key_sync1 <= spriteKeyReg; // @[4-soc/src/main/scala/peripheral/VGA.scala 404:35]
+    sprite_key <= sprite_key_sync1; // @[4-soc/src/main/scala/peripheral/VGA.scala 405:35]
+    sprite_pos_sync1_0 <= spritePosReg_0; // @[4-soc/src/main/scala/peripheral/VGA.scala 406:35]
+    sprite_pos_sync1_1 <= spritePosReg_1; // @[4-soc/src/main/scala/peripheral/VGA.scala 406:35]
+    sprite_pos_sync1_2 <= spritePosReg_2; // @[4-soc/src/main/scala/peripheral/VGA.scala 406:35]
+    sprite_pos_sync1_3 <= spritePosReg_3; // @[4-soc/src/main/scala/peripheral/VGA.scala 406:35]
+    sprite_pos_sync1_4 <= spritePosReg_4; // @[4-soc/src/main/scala/peripheral/VGA.scala 406:35]
+    sprite_pos_sync1_5 <= spritePosReg_5; // @[4-soc/src/main/scala/peripheral/VGA.scala 406:35]
+    sprite_pos_sync1_6 <= spritePosReg_6; // @[4-soc/src/main/scala/peripheral/VGA.scala 406:35]
+    sprite_pos_sync1_7 <= spritePosReg_7; // @[4-soc/src/main/scala/peripheral/VGA.scala 406:35]
+    sprite_pos_0 <= sprite_pos_sync1_0; // @[4-soc/src/main/scala/peripheral/VGA.scala 407:35]
+    sprite_pos_1 <= sprite_pos_sync1_1; // @[4-soc/src/main/scala/peripheral/VGA.scala 407:35]
+    sprite_pos_2 <= sprite_pos_sync1_2; // @[4-soc/src/main/scala/peripheral/VGA.scala 407:35]
+    sprite_pos_3 <= sprite_pos_sync1_3; // @[4-soc/src/main/scala/peripheral/VGA.scala 407:35]
+    sprite_pos_4 <= sprite_pos_sync1_4; // @[4-soc/src/main/scala/peripheral/VGA.scala 407:35]
+    sprite_pos_5 <= sprite_pos_sync1_5; // @[4-soc/src/main/scala/peripheral/VGA.scala 407:35]
+    sprite_pos_6 <= sprite_pos_sync1_6; // @[4-soc/src/main/scala/peripheral/VGA.scala 407:35]
+    sprite_pos_7 <= sprite_pos_sync1_7; // @[4-soc/src/main/scala/peripheral/VGA.scala 407:35]
+    tile_ctrl_sync1 <= tileCtrlReg; // @[4-soc/src/main/scala/peripheral/VGA.scala 463:35]
+    tile_ctrl <= tile_ctrl_sync1; // @[4-soc/src/main/scala/peripheral/VGA.scala 464:35]
+    scroll_sync1 <= scrollReg; // @[4-soc/src/main/scala/peripheral/VGA.scala 486:35]
+    scroll <= scroll_sync1; // @[4-soc/src/main/scala/peripheral/VGA.scala 487:35]
+    split_sync1 <= splitReg; // @[4-soc/src/main/scala/peripheral/VGA.scala 488:35]
+    split <= split_sync1; // @[4-soc/src/main/scala/peripheral/VGA.scala 489:35]
     in_display_d1 <= in_display_x & in_display_y; // @[4-soc/src/main/scala/peripheral/VGA.scala 311:37]
     h_active_d1 <= h_count < 10'h280; // @[4-soc/src/main/scala/peripheral/VGA.scala 303:28]
     v_active_d1 <= v_count < 10'h1e0; // @[4-soc/src/main/scala/peripheral/VGA.scala 304:28]
     h_active_d2 <= h_active_d1; // @[4-soc/src/main/scala/peripheral/VGA.scala 349:30]
     v_active_d2 <= v_active_d1; // @[4-soc/src/main/scala/peripheral/VGA.scala 350:30]
     pixel_in_word_d1 <= pixel_idx[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 354:34]
+    hit_d1 <= hit; // @[4-soc/src/main/scala/peripheral/VGA.scala 462:30]
+    column_d1 <= dx[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 463:30]
+    hit_d1_1 <= hit_1; // @[4-soc/src/main/scala/peripheral/VGA.scala 462:30]
+    column_d1_1 <= dx_1[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 463:30]
+    hit_d1_2 <= hit_2; // @[4-soc/src/main/scala/peripheral/VGA.scala 462:30]
+    column_d1_2 <= dx_2[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 463:30]
+    hit_d1_3 <= hit_3; // @[4-soc/src/main/scala/peripheral/VGA.scala 462:30]
+    column_d1_3 <= dx_3[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 463:30]
+    hit_d1_4 <= hit_4; // @[4-soc/src/main/scala/peripheral/VGA.scala 462:30]
+    column_d1_4 <= dx_4[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 463:30]
+    hit_d1_5 <= hit_5; // @[4-soc/src/main/scala/peripheral/VGA.scala 462:30]
+    column_d1_5 <= dx_5[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 463:30]
+    hit_d1_6 <= hit_6; // @[4-soc/src/main/scala/peripheral/VGA.scala 462:30]
+    column_d1_6 <= dx_6[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 463:30]
+    hit_d1_7 <= hit_7; // @[4-soc/src/main/scala/peripheral/VGA.scala 462:30]
+    column_d1_7 <= dx_7[2:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 463:30]
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h0 == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_0 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h1 == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_1 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h2 == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_2 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h3 == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_3 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h4 == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_4 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h5 == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_5 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h6 == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_6 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h7 == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_7 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h8 == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_8 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h9 == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_9 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'ha == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_10 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'hb == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_11 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'hc == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_12 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'hd == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_13 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'he == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_14 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'hf == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_15 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h10 == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_16 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h11 == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_17 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h12 == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_18 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h13 == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_19 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h14 == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_20 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h15 == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_21 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h16 == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_22 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h17 == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_23 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h18 == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_24 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h19 == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_25 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h1a == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_26 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h1b == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_27 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h1c == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_28 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h1d == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_29 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h1e == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_30 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    if (tile_fetch_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 545:25]
+      if (5'h1f == tile_fetch_col_d1) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+        tile_line_31 <= tile_map_doutb[5:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 546:36]
+      end
+    end
+    tile_fetch_d1 <= _tile_fetch_d1_T; // @[4-soc/src/main/scala/peripheral/VGA.scala 541:37]
+    tile_fetch_col_d1 <= x_px[4:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 542:37]
+    tile_hit_d1 <= tile_hit; // @[4-soc/src/main/scala/peripheral/VGA.scala 552:35]
+    tile_column_d1 <= tile_column[1:0]; // @[4-soc/src/main/scala/peripheral/VGA.scala 553:35]
     x_px_d1 <= x_px; // @[4-soc/src/main/scala/peripheral/VGA.scala 393:26]
     y_px_d1 <= y_px; // @[4-soc/src/main/scala/peripheral/VGA.scala 394:26]
     if (reset) begin // @[4-soc/src/main/scala/peripheral/VGA.scala 407:36]
@@ -1440,137 +2200,474 @@ initial begin
   _RAND_18 = {1{`RANDOM}};
   paletteReg_15 = _RAND_18[5:0];
   _RAND_19 = {1{`RANDOM}};
-  vblank_sync1 = _RAND_19[0:0];
+  spriteKeyReg = _RAND_19[3:0];
   _RAND_20 = {1{`RANDOM}};
-  vblank_synced = _RAND_20[0:0];
+  spritePosReg_0 = _RAND_20[16:0];
   _RAND_21 = {1{`RANDOM}};
-  curr_frame_sync1 = _RAND_21[3:0];
+  spritePosReg_1 = _RAND_21[16:0];
   _RAND_22 = {1{`RANDOM}};
-  curr_frame_synced = _RAND_22[3:0];
+  spritePosReg_2 = _RAND_22[16:0];
   _RAND_23 = {1{`RANDOM}};
-  timing_err_sync1 = _RAND_23[0:0];
+  spritePosReg_3 = _RAND_23[16:0];
   _RAND_24 = {1{`RANDOM}};
-  timing_err_sync2 = _RAND_24[0:0];
+  spritePosReg_4 = _RAND_24[16:0];
   _RAND_25 = {1{`RANDOM}};
-  timing_err_sync3 = _RAND_25[0:0];
+  spritePosReg_5 = _RAND_25[16:0];
   _RAND_26 = {1{`RANDOM}};
-  timing_error_count = _RAND_26[15:0];
+  spritePosReg_6 = _RAND_26[16:0];
   _RAND_27 = {1{`RANDOM}};
-  vblank_prev = _RAND_27[0:0];
+  spritePosReg_7 = _RAND_27[16:0];
   _RAND_28 = {1{`RANDOM}};
-  h_count = _RAND_28[9:0];
+  tileCtrlReg = _RAND_28[16:0];
   _RAND_29 = {1{`RANDOM}};
-  v_count = _RAND_29[9:0];
+  scrollReg = _RAND_29[13:0];
   _RAND_30 = {1{`RANDOM}};
-  frame_count = _RAND_30[1:0];
+  splitReg = _RAND_30[5:0];
   _RAND_31 = {1{`RANDOM}};
-  hsync_d1 = _RAND_31[0:0];
+  vblank_sync1 = _RAND_31[0:0];
   _RAND_32 = {1{`RANDOM}};
-  vsync_d1 = _RAND_32[0:0];
+  vblank_synced = _RAND_32[0:0];
   _RAND_33 = {1{`RANDOM}};
-  io_hsync_REG = _RAND_33[0:0];
+  curr_frame_sync1 = _RAND_33[3:0];
   _RAND_34 = {1{`RANDOM}};
-  io_vsync_REG = _RAND_34[0:0];
+  curr_frame_synced = _RAND_34[3:0];
   _RAND_35 = {1{`RANDOM}};
-  x_px = _RAND_35[9:0];
+  timing_err_sync1 = _RAND_35[0:0];
   _RAND_36 = {1{`RANDOM}};
-  y_px = _RAND_36[9:0];
+  timing_err_sync2 = _RAND_36[0:0];
   _RAND_37 = {1{`RANDOM}};
-  curr_frame_sync1_1 = _RAND_37[3:0];
+  timing_err_sync3 = _RAND_37[0:0];
   _RAND_38 = {1{`RANDOM}};
-  curr_frame = _RAND_38[3:0];
+  timing_error_count = _RAND_38[15:0];
   _RAND_39 = {1{`RANDOM}};
-  display_enabled_sync1 = _RAND_39[0:0];
+  vblank_prev = _RAND_39[0:0];
   _RAND_40 = {1{`RANDOM}};
-  display_enabled = _RAND_40[0:0];
+  h_count = _RAND_40[9:0];
   _RAND_41 = {1{`RANDOM}};
-  blanking_sync1 = _RAND_41[0:0];
+  v_count = _RAND_41[9:0];
   _RAND_42 = {1{`RANDOM}};
-  blanking = _RAND_42[0:0];
+  frame_count = _RAND_42[1:0];
   _RAND_43 = {1{`RANDOM}};
-  palette_sync1_0 = _RAND_43[5:0];
+  hsync_d1 = _RAND_43[0:0];
   _RAND_44 = {1{`RANDOM}};
-  palette_sync1_1 = _RAND_44[5:0];
+  vsync_d1 = _RAND_44[0:0];
   _RAND_45 = {1{`RANDOM}};
-  palette_sync1_2 = _RAND_45[5:0];
+  io_hsync_REG = _RAND_45[0:0];
   _RAND_46 = {1{`RANDOM}};
-  palette_sync1_3 = _RAND_46[5:0];
+  io_vsync_REG = _RAND_46[0:0];
   _RAND_47 = {1{`RANDOM}};
-  palette_sync1_4 = _RAND_47[5:0];
+  x_px = _RAND_47[9:0];
   _RAND_48 = {1{`RANDOM}};
-  palette_sync1_5 = _RAND_48[5:0];
+  y_px = _RAND_48[9:0];
   _RAND_49 = {1{`RANDOM}};
-  palette_sync1_6 = _RAND_49[5:0];
+  curr_frame_sync1_1 = _RAND_49[3:0];
   _RAND_50 = {1{`RANDOM}};
-  palette_sync1_7 = _RAND_50[5:0];
+  curr_frame = _RAND_50[3:0];
   _RAND_51 = {1{`RANDOM}};
-  palette_sync1_8 = _RAND_51[5:0];
+  display_enabled_sync1 = _RAND_51[0:0];
   _RAND_52 = {1{`RANDOM}};
-  palette_sync1_9 = _RAND_52[5:0];
+  display_enabled = _RAND_52[0:0];
   _RAND_53 = {1{`RANDOM}};
-  palette_sync1_10 = _RAND_53[5:0];
+  blanking_sync1 = _RAND_53[0:0];
   _RAND_54 = {1{`RANDOM}};
-  palette_sync1_11 = _RAND_54[5:0];
+  blanking = _RAND_54[0:0];
   _RAND_55 = {1{`RANDOM}};
-  palette_sync1_12 = _RAND_55[5:0];
+  palette_sync1_0 = _RAND_55[5:0];
   _RAND_56 = {1{`RANDOM}};
-  palette_sync1_13 = _RAND_56[5:0];
+  palette_sync1_1 = _RAND_56[5:0];
   _RAND_57 = {1{`RANDOM}};
-  palette_sync1_14 = _RAND_57[5:0];
+  palette_sync1_2 = _RAND_57[5:0];
   _RAND_58 = {1{`RANDOM}};
-  palette_sync1_15 = _RAND_58[5:0];
+  palette_sync1_3 = _RAND_58[5:0];
   _RAND_59 = {1{`RANDOM}};
-  palette_sync_0 = _RAND_59[5:0];
+  palette_sync1_4 = _RAND_59[5:0];
   _RAND_60 = {1{`RANDOM}};
-  palette_sync_1 = _RAND_60[5:0];
+  palette_sync1_5 = _RAND_60[5:0];
   _RAND_61 = {1{`RANDOM}};
-  palette_sync_2 = _RAND_61[5:0];
+  palette_sync1_6 = _RAND_61[5:0];
   _RAND_62 = {1{`RANDOM}};
-  palette_sync_3 = _RAND_62[5:0];
+  palette_sync1_7 = _RAND_62[5:0];
   _RAND_63 = {1{`RANDOM}};
-  palette_sync_4 = _RAND_63[5:0];
+  palette_sync1_8 = _RAND_63[5:0];
   _RAND_64 = {1{`RANDOM}};
-  palette_sync_5 = _RAND_64[5:0];
+  palette_sync1_9 = _RAND_64[5:0];
   _RAND_65 = {1{`RANDOM}};
-  palette_sync_6 = _RAND_65[5:0];
+  palette_sync1_10 = _RAND_65[5:0];
   _RAND_66 = {1{`RANDOM}};
-  palette_sync_7 = _RAND_66[5:0];
+  palette_sync1_11 = _RAND_66[5:0];
   _RAND_67 = {1{`RANDOM}};
-  palette_sync_8 = _RAND_67[5:0];
+  palette_sync1_12 = _RAND_67[5:0];
   _RAND_68 = {1{`RANDOM}};
-  palette_sync_9 = _RAND_68[5:0];
+  palette_sync1_13 = _RAND_68[5:0];
   _RAND_69 = {1{`RANDOM}};
-  palette_sync_10 = _RAND_69[5:0];
+  palette_sync1_14 = _RAND_69[5:0];
   _RAND_70 = {1{`RANDOM}};
-  palette_sync_11 = _RAND_70[5:0];
+  palette_sync1_15 = _RAND_70[5:0];
   _RAND_71 = {1{`RANDOM}};
-  palette_sync_12 = _RAND_71[5:0];
+  palette_sync_0 = _RAND_71[5:0];
   _RAND_72 = {1{`RANDOM}};
-  palette_sync_13 = _RAND_72[5:0];
+  palette_sync_1 = _RAND_72[5:0];
   _RAND_73 = {1{`RANDOM}};
-  palette_sync_14 = _RAND_73[5:0];
+  palette_sync_2 = _RAND_73[5:0];
   _RAND_74 = {1{`RANDOM}};
-  palette_sync_15 = _RAND_74[5:0];
+  palette_sync_3 = _RAND_74[5:0];
   _RAND_75 = {1{`RANDOM}};
-  in_display_d1 = _RAND_75[0:0];
+  palette_sync_4 = _RAND_75[5:0];
   _RAND_76 = {1{`RANDOM}};
-  h_active_d1 = _RAND_76[0:0];
+  palette_sync_5 = _RAND_76[5:0];
   _RAND_77 = {1{`RANDOM}};
-  v_active_d1 = _RAND_77[0:0];
+  palette_sync_6 = _RAND_77[5:0];
   _RAND_78 = {1{`RANDOM}};
-  h_active_d2 = _RAND_78[0:0];
+  palette_sync_7 = _RAND_78[5:0];
   _RAND_79 = {1{`RANDOM}};
-  v_active_d2 = _RAND_79[0:0];
+  palette_sync_8 = _RAND_79[5:0];
   _RAND_80 = {1{`RANDOM}};
-  pixel_in_word_d1 = _RAND_80[2:0];
+  palette_sync_9 = _RAND_80[5:0];
   _RAND_81 = {1{`RANDOM}};
-  x_px_d1 = _RAND_81[9:0];
+  palette_sync_10 = _RAND_81[5:0];
   _RAND_82 = {1{`RANDOM}};
-  y_px_d1 = _RAND_82[9:0];
+  palette_sync_11 = _RAND_82[5:0];
   _RAND_83 = {1{`RANDOM}};
-  timing_err_toggle = _RAND_83[0:0];
-`endif // RANDOMIZE_REG_INIT
-  `endif // RANDOMIZE
+  palette_sync_12 = _RAND_83[5:0];
+  _RAND_84 = {1{`RANDOM}};
+  palette_sync_13 = _RAND_84[5:0];
+  _RAND_85 = {1{`RANDOM}};
+  palette_sync_14 = _RAND_85[5:0];
+  _RAND_86 = {1{`RANDOM}};
+  palette_sync_15 = _RAND_86[5:0];
+  _RAND_87 = {1{`RANDOM}};
+  sprite_key_sync1 = _RAND_87[3:0];
+  _RAND_88 = {1{`RANDOM}};
+  sprite_key = _RAND_88[3:0];
+  _RAND_89 = {1{`RANDOM}};
+  sprite_pos_sync1_0 = _RAND_89[16:0];
+  _RAND_90 = {1{`RANDOM}};
+  sprite_pos_sync1_1 = _RAND_90[16:0];
+  _RAND_91 = {1{`RANDOM}};
+  sprite_pos_sync1_2 = _RAND_91[16:0];
+  _RAND_92 = {1{`RANDOM}};
+  sprite_pos_sync1_3 = _RAND_92[16:0];
+  _RAND_93 = {1{`RANDOM}};
+  sprite_pos_sync1_4 = _RAND_93[16:0];
+  _RAND_94 = {1{`RANDOM}};
+  sprite_pos_sync1_5 = _RAND_94[16:0];
+  _RAND_95 = {1{`RANDOM}};
+  sprite_pos_sync1_6 = _RAND_95[16:0];
+  _RAND_96 = {1{`RANDOM}};
+  sprite_pos_sync1_7 = _RAND_96[16:0];
+  _RAND_97 = {1{`RANDOM}};
+  sprite_pos_0 = _RAND_97[16:0];
+  _RAND_98 = {1{`RANDOM}};
+  sprite_pos_1 = _RAND_98[16:0];
+  _RAND_99 = {1{`RANDOM}};
+  sprite_pos_2 = _RAND_99[16:0];
+  _RAND_100 = {1{`RANDOM}};
+  sprite_pos_3 = _RAND_100[16:0];
+  _RAND_101 = {1{`RANDOM}};
+  sprite_pos_4 = _RAND_101[16:0];
+  _RAND_102 = {1{`RANDOM}};
+  sprite_pos_5 = _RAND_102[16:0];
+  _RAND_103 = {1{`RANDOM}};
+  sprite_pos_6 = _RAND_103[16:0];
+  _RAND_104 = {1{`RANDOM}};
+  sprite_pos_7 = _RAND_104[16:0];
+  _RAND_105 = {1{`RANDOM}};
+  tile_ctrl_sync1 = _RAND_105[16:0];
+  _RAND_106 = {1{`RANDOM}};
+  tile_ctrl = _RAND_106[16:0];
+  _RAND_107 = {1{`RANDOM}};
+  scroll_sync1 = _RAND_107[13:0];
+  _RAND_108 = {1{`RANDOM}};
+  scroll = _RAND_108[13:0];
+  _RAND_109 = {1{`RANDOM}};
+  split_sync1 = _RAND_109[5:0];
+  _RAND_110 = {1{`RANDOM}};
+  split = _RAND_110[5:0];
+  _RAND_111 = {1{`RANDOM}};
+  in_display_d1 = _RAND_111[0:0];
+  _RAND_112 = {1{`RANDOM}};
+  h_active_d1 = _RAND_112[0:0];
+  _RAND_113 = {1{`RANDOM}};
+  v_active_d1 = _RAND_113[0:0];
+  _RAND_114 = {1{`RANDOM}};
+  h_active_d2 = _RAND_114[0:0];
+  _RAND_115 = {1{`RANDOM}};
+  v_active_d2 = _RAND_115[0:0];
+  _RAND_116 = {1{`RANDOM}};
+  pixel_in_word_d1 = _RAND_116[2:0];
+  _RAND_117 = {1{`RANDOM}};
+  hit_d1 = _RAND_117[0:0];
+  _RAND_118 = {1{`RANDOM}};
+  column_d1 = _RAND_118[2:0];
+  _RAND_119 = {1{`RANDOM}};
+  hit_d1_1 = _RAND_119[0:0];
+  _RAND_120 = {1{`RANDOM}};
+  column_d1_1 = _RAND_120[2:0];
+  _RAND_121 = {1{`RANDOM}};
+  hit_d1_2 = _RAND_121[0:0];
+  _RAND_122 = {1{`RANDOM}};
+  column_d1_2 = _RAND_122[2:0];
+  _RAND_123 = {1{`RANDOM}};
+  hit_d1_3 = _RAND_123[0:0];
+  _RAND_124 = {1{`RANDOM}};
+  column_d1_3 = _RAND_124[2:0];
+  _RAND_125 = {1{`RANDOM}};
+  hit_d1_4 = _RAND_125[0:0];
+  _RAND_126 = {1{`RANDOM}};
+  column_d1_4 = _RAND_126[2:0];
+  _RAND_127 = {1{`RANDOM}};
+  hit_d1_5 = _RAND_127[0:0];
+  _RAND_128 = {1{`RANDOM}};
+  column_d1_5 = _RAND_128[2:0];
+  _RAND_129 = {1{`RANDOM}};
+  hit_d1_6 = _RAND_129[0:0];
+  _RAND_130 = {1{`RANDOM}};
+  column_d1_6 = _RAND_130[2:0];
+  _RAND_131 = {1{`RANDOM}};
+  hit_d1_7 = _RAND_131[0:0];
+  _RAND_132 = {1{`RANDOM}};
+  column_d1_7 = _RAND_132[2:0];
+  _RAND_133 = {1{`RANDOM}};
+  tile_line_0 = _RAND_133[5:0];
+  _RAND_134 = {1{`RANDOM}};
+  tile_line_1 = _RAND_134[5:0];
+  _RAND_135 = {1{`RANDOM}};
+  tile_line_2 = _RAND_135[5:0];
+  _RAND_136 = {1{`RANDOM}};
+  tile_line_3 = _RAND_136[5:0];
+  _RAND_137 = {1{`RANDOM}};
+  tile_line_4 = _RAND_137[5:0];
+  _RAND_138 = {1{`RANDOM}};
+  tile_line_5 = _RAND_138[5:0];
+  _RAND_139 = {1{`RANDOM}};
+  tile_line_6 = _RAND_139[5:0];
+  _RAND_140 = {1{`RANDOM}};
+  tile_line_7 = _RAND_140[5:0];
+  _RAND_141 = {1{`RANDOM}};
+  tile_line_8 = _RAND_141[5:0];
+  _RAND_142 = {1{`RANDOM}};
+  tile_line_9 = _RAND_142[5:0];
+  _RAND_143 = {1{`RANDOM}};
+  tile_line_10 = _RAND_143[5:0];
+  _RAND_144 = {1{`RANDOM}};
+  tile_line_11 = _RAND_144[5:0];
+  _RAND_145 = {1{`RANDOM}};
+  tile_line_12 = _RAND_145[5:0];
+  _RAND_146 = {1{`RANDOM}};
+  tile_line_13 = _RAND_146[5:0];
+  _RAND_147 = {1{`RANDOM}};
+  tile_line_14 = _RAND_147[5:0];
+  _RAND_148 = {1{`RANDOM}};
+  tile_line_15 = _RAND_148[5:0];
+  _RAND_149 = {1{`RANDOM}};
+  tile_line_16 = _RAND_149[5:0];
+  _RAND_150 = {1{`RANDOM}};
+  tile_line_17 = _RAND_150[5:0];
+  _RAND_151 = {1{`RANDOM}};
+  tile_line_18 = _RAND_151[5:0];
+  _RAND_152 = {1{`RANDOM}};
+  tile_line_19 = _RAND_152[5:0];
+  _RAND_153 = {1{`RANDOM}};
+  tile_line_20 = _RAND_153[5:0];
+  _RAND_154 = {1{`RANDOM}};
+  tile_line_21 = _RAND_154[5:0];
+  _RAND_155 = {1{`RANDOM}};
+  tile_line_22 = _RAND_155[5:0];
+  _RAND_156 = {1{`RANDOM}};
+  tile_line_23 = _RAND_156[5:0];
+  _RAND_157 = {1{`RANDOM}};
+  tile_line_24 = _RAND_157[5:0];
+  _RAND_158 = {1{`RANDOM}};
+  tile_line_25 = _RAND_158[5:0];
+  _RAND_159 = {1{`RANDOM}};
+  tile_line_26 = _RAND_159[5:0];
+  _RAND_160 = {1{`RANDOM}};
+  tile_line_27 = _RAND_160[5:0];
+  _RAND_161 = {1{`RANDOM}};
+  tile_line_28 = _RAND_161[5:0];
+  _RAND_162 = {1{`RANDOM}};
+  tile_line_29 = _RAND_162[5:0];
+  _RAND_163 = {1{`RANDOM}};
+  tile_line_30 = _RAND_163[5:0];
+  _RAND_164 = {1{`RANDOM}};
+  tile_line_31 = _RAND_164[5:0];
+  _RAND_165 = {1{`RANDOM}};
+  tile_fetch_d1 = _RAND_165[0:0];
+  _RAND_166 = {1{`RANDOM}};
+  tile_fetch_col_d1 = _RAND_166[4:0];
+  _RAND_167 = {1{`RANDOM}};
+  tile_hit_d1 = _RAND_167[0:0];
+  _RAND_168 = {1{`RANDOM}};
+  tile_column_d1 = _RAND_168[1:0];
+  _RAND_169 = {1{`RANDOM}};
+  x_px_d1 = _RAND_169[9:0];
+  _RAND_170 = {1{`RANDOM}};
+  y_px_d1 = _RAND_170[9:0];
+  _RAND_171 = {1{`RANDOM}};
+  timing_err_toggle = _RAND_171[0:0];
+`endif // RANDOMIZE_REG_INIT
+  `endif // RANDOMIZE
+end // initial
+`ifdef FIRRTL_AFTER_INITIAL
+`FIRRTL_AFTER_INITIAL
+`endif
+`endif // SYNTHESIS
+endmodule
+module AXI4LiteSlave_2(
+  input         clock,
+  input         reset,
+  input         io_channels_write_address_channel_AWVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_channels_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input  [7:0]  io_channels_write_address_channel_AWADDR, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input         io_channels_write_data_channel_WVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_channels_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input  [31:0] io_channels_write_data_channel_WDATA, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_channels_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input         io_channels_write_response_channel_BREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input         io_channels_read_address_channel_ARVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_channels_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input  [7:0]  io_channels_read_address_channel_ARADDR, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_channels_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input         io_channels_read_data_channel_RREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output [31:0] io_channels_read_data_channel_RDATA, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output [7:0]  io_bundle_address, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_bundle_read, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input  [31:0] io_bundle_read_data, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  input         io_bundle_read_valid, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output        io_bundle_write, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+  output [31:0] io_bundle_write_data // @[4-soc/src/main/scala/bus/AXI4Lite.scala 140:14]
+);
+`ifdef RANDOMIZE_REG_INIT
+  reg [31:0] _RAND_0;
+  reg [31:0] _RAND_1;
+  reg [31:0] _RAND_2;
+  reg [31:0] _RAND_3;
+  reg [31:0] _RAND_4;
+  reg [31:0] _RAND_5;
+  reg [31:0] _RAND_6;
+`endif // RANDOMIZE_REG_INIT
+  reg [7:0] addr; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 146:21]
+  reg  read; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 148:21]
+  reg  write; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 150:22]
+  reg [31:0] write_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 152:27]
+  reg  RVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 158:23]
+  reg [31:0] read_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 160:26]
+  reg  BVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 163:23]
+  wire  r_free = ~RVALID | io_channels_read_data_channel_RREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 168:29]
+  wire  read_done = read & io_bundle_read_valid & r_free; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 169:48]
+  wire  port_free = ~read | read_done; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 170:26]
+  wire  read_start = io_channels_read_address_channel_ARVALID & port_free; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 174:61]
+  wire  write_ready = port_free & ~io_channels_read_address_channel_ARVALID & (~BVALID |
+    io_channels_write_response_channel_BREADY); // @[4-soc/src/main/scala/bus/AXI4Lite.scala 178:62]
+  wire  write_start = write_ready & io_channels_write_address_channel_AWVALID &
+    io_channels_write_data_channel_WVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 183:62]
+  assign io_channels_write_address_channel_AWREADY = write_ready & io_channels_write_data_channel_WVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 180:61]
+  assign io_channels_write_data_channel_WREADY = write_ready & io_channels_write_address_channel_AWVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 181:61]
+  assign io_channels_write_response_channel_BVALID = BVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 164:45]
+  assign io_channels_read_address_channel_ARREADY = port_free; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 173:44]
+  assign io_channels_read_data_channel_RVALID = RVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 159:40]
+  assign io_channels_read_data_channel_RDATA = read_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 161:39]
+  assign io_bundle_address = addr; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 147:21]
+  assign io_bundle_read = read; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 149:18]
+  assign io_bundle_write = write; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 151:19]
+  assign io_bundle_write_data = write_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 153:24]
+  always @(posedge clock) begin
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 146:21]
+      addr <= 8'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 146:21]
+    end else if (read_start) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 185:20]
+      addr <= io_channels_read_address_channel_ARADDR; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 186:10]
+    end else if (write_start) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 187:27]
+      addr <= io_channels_write_address_channel_AWADDR; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 188:18]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 148:21]
+      read <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 148:21]
+    end else begin
+      read <= read_start | read & ~read_done; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 192:9]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 150:22]
+      write <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 150:22]
+    end else begin
+      write <= write_start; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 193:9]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 152:27]
+      write_data <= 32'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 152:27]
+    end else if (!(read_start)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 185:20]
+      if (write_start) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 187:27]
+        write_data <= io_channels_write_data_channel_WDATA; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 189:18]
+      end
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 158:23]
+      RVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 158:23]
+    end else if (read_done) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 195:19]
+      RVALID <= 1'h1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 198:15]
+    end else if (io_channels_read_data_channel_RREADY) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 199:52]
+      RVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 201:12]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 160:26]
+      read_data <= 32'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 160:26]
+    end else if (read_done) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 195:19]
+      read_data <= io_bundle_read_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 197:15]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 163:23]
+      BVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 163:23]
+    end else if (write_start) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 204:21]
+      BVALID <= 1'h1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 205:12]
+    end else if (io_channels_write_response_channel_BREADY) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 206:57]
+      BVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 208:12]
+    end
+  end
+// Register and memory initialization
+`ifdef RANDOMIZE_GARBAGE_ASSIGN
+`define RANDOMIZE
+`endif
+`ifdef RANDOMIZE_INVALID_ASSIGN
+`define RANDOMIZE
+`endif
+`ifdef RANDOMIZE_REG_INIT
+`define RANDOMIZE
+`endif
+`ifdef RANDOMIZE_MEM_INIT
+`define RANDOMIZE
+`endif
+`ifndef RANDOM
+`define RANDOM $random
+`endif
+`ifdef RANDOMIZE_MEM_INIT
+  integer initvar;
+`endif
+`ifndef SYNTHESIS
+`ifdef FIRRTL_BEFORE_INITIAL
+`FIRRTL_BEFORE_INITIAL
+`endif
+initial begin
+  `ifdef RANDOMIZE
+    `ifdef INIT_RANDOM
+      `INIT_RANDOM
+    `endif
+    `ifndef VERILATOR
+      `ifdef RANDOMIZE_DELAY
+        #`RANDOMIZE_DELAY begin end
+      `else
+        #0.002 begin end
+      `endif
+    `endif
+`ifdef RANDOMIZE_REG_INIT
+  _RAND_0 = {1{`RANDOM}};
+  addr = _RAND_0[7:0];
+  _RAND_1 = {1{`RANDOM}};
+  read = _RAND_1[0:0];
+  _RAND_2 = {1{`RANDOM}};
+  write = _RAND_2[0:0];
+  _RAND_3 = {1{`RANDOM}};
+  write_data = _RAND_3[31:0];
+  _RAND_4 = {1{`RANDOM}};
+  RVALID = _RAND_4[0:0];
+  _RAND_5 = {1{`RANDOM}};
+  read_data = _RAND_5[31:0];
+  _RAND_6 = {1{`RANDOM}};
+  BVALID = _RAND_6[0:0];
+`endif // RANDOMIZE_REG_INIT
+  `endif // RANDOMIZE
 end // initial
 `ifdef FIRRTL_AFTER_INITIAL
 `FIRRTL_AFTER_INITIAL
@@ -2149,7 +3246,7 @@ module Uart(
   wire  _GEN_5 = _T_1 | _GEN_4; // @[4-soc/src/main/scala/peripheral/UART.scala 255:34 257:15]
   wire  _T_5 = addr_tx_data & tx_io_channel_ready; // @[4-soc/src/main/scala/peripheral/UART.scala 270:23]
   wire [7:0] _GEN_8 = addr_tx_data & tx_io_channel_ready ? slave_io_bundle_write_data[7:0] : 8'h0; // @[4-soc/src/main/scala/peripheral/UART.scala 268:23 270:47 275:26]
-  AXI4LiteSlave_1 slave ( // @[4-soc/src/main/scala/peripheral/UART.scala 209:25]
+  AXI4LiteSlave_2 slave ( // @[4-soc/src/main/scala/peripheral/UART.scala 209:25]
     .clock(slave_clock),
     .reset(slave_reset),
     .io_channels_write_address_channel_AWVALID(slave_io_channels_write_address_channel_AWVALID),
@@ -7790,7 +8887,16 @@ module MemoryAccess(
   output        io_bus_write_strobe_3, // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 44:14]
   input         io_bus_write_valid, // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 44:14]
   output        io_bus_request, // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 44:14]
-  input         io_bus_granted // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 44:14]
+  input         io_bus_granted, // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 44:14]
+  output [31:0] io_tcm_address, // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 44:14]
+  input         io_tcm_select, // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 44:14]
+  input  [31:0] io_tcm_read_data, // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 44:14]
+  output        io_tcm_write, // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 44:14]
+  output [31:0] io_tcm_write_data, // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 44:14]
+  output        io_tcm_write_strobe_0, // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 44:14]
+  output        io_tcm_write_strobe_1, // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 44:14]
+  output        io_tcm_write_strobe_2, // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 44:14]
+  output        io_tcm_write_strobe_3 // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 44:14]
 );
 `ifdef RANDOMIZE_REG_INIT
   reg [31:0] _RAND_0;
@@ -7806,39 +8912,40 @@ module MemoryAccess(
   reg [4:0] latched_regs_write_address; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 80:43]
   reg  latched_regs_write_enable; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 81:43]
   wire  _T = mem_access_state == 2'h1; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 134:25]
-  wire [23:0] _processed_data_T_1 = io_bus_read_data[31] ? 24'hffffff : 24'h0; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 150:21]
-  wire [31:0] _processed_data_T_3 = {_processed_data_T_1,io_bus_read_data[31:24]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 150:16]
-  wire [23:0] _processed_data_T_5 = io_bus_read_data[7] ? 24'hffffff : 24'h0; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 152:30]
-  wire [31:0] _processed_data_T_7 = {_processed_data_T_5,io_bus_read_data[7:0]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 152:25]
-  wire [23:0] _processed_data_T_9 = io_bus_read_data[15] ? 24'hffffff : 24'h0; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 153:30]
-  wire [31:0] _processed_data_T_11 = {_processed_data_T_9,io_bus_read_data[15:8]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 153:25]
-  wire [23:0] _processed_data_T_13 = io_bus_read_data[23] ? 24'hffffff : 24'h0; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 154:30]
-  wire [31:0] _processed_data_T_15 = {_processed_data_T_13,io_bus_read_data[23:16]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 154:25]
+  wire [31:0] data = io_tcm_select ? io_tcm_read_data : io_bus_read_data; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 143:17]
+  wire [23:0] _processed_data_T_1 = data[31] ? 24'hffffff : 24'h0; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 150:21]
+  wire [31:0] _processed_data_T_3 = {_processed_data_T_1,data[31:24]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 150:16]
+  wire [23:0] _processed_data_T_5 = data[7] ? 24'hffffff : 24'h0; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 152:30]
+  wire [31:0] _processed_data_T_7 = {_processed_data_T_5,data[7:0]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 152:25]
+  wire [23:0] _processed_data_T_9 = data[15] ? 24'hffffff : 24'h0; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 153:30]
+  wire [31:0] _processed_data_T_11 = {_processed_data_T_9,data[15:8]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 153:25]
+  wire [23:0] _processed_data_T_13 = data[23] ? 24'hffffff : 24'h0; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 154:30]
+  wire [31:0] _processed_data_T_15 = {_processed_data_T_13,data[23:16]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 154:25]
   wire  _processed_data_T_16 = 2'h0 == mem_address_index; // @[src/main/scala/chisel3/util/Mux.scala 77:13]
   wire [31:0] _processed_data_T_17 = 2'h0 == mem_address_index ? _processed_data_T_7 : _processed_data_T_3; // @[src/main/scala/chisel3/util/Mux.scala 77:13]
   wire  _processed_data_T_18 = 2'h1 == mem_address_index; // @[src/main/scala/chisel3/util/Mux.scala 77:13]
   wire [31:0] _processed_data_T_19 = 2'h1 == mem_address_index ? _processed_data_T_11 : _processed_data_T_17; // @[src/main/scala/chisel3/util/Mux.scala 77:13]
   wire  _processed_data_T_20 = 2'h2 == mem_address_index; // @[src/main/scala/chisel3/util/Mux.scala 77:13]
   wire [31:0] _processed_data_T_21 = 2'h2 == mem_address_index ? _processed_data_T_15 : _processed_data_T_19; // @[src/main/scala/chisel3/util/Mux.scala 77:13]
-  wire [31:0] _processed_data_T_24 = {24'h0,io_bus_read_data[31:24]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 159:16]
-  wire [31:0] _processed_data_T_27 = {24'h0,io_bus_read_data[7:0]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 161:25]
-  wire [31:0] _processed_data_T_30 = {24'h0,io_bus_read_data[15:8]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 162:25]
-  wire [31:0] _processed_data_T_33 = {24'h0,io_bus_read_data[23:16]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 163:25]
+  wire [31:0] _processed_data_T_24 = {24'h0,data[31:24]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 159:16]
+  wire [31:0] _processed_data_T_27 = {24'h0,data[7:0]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 161:25]
+  wire [31:0] _processed_data_T_30 = {24'h0,data[15:8]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 162:25]
+  wire [31:0] _processed_data_T_33 = {24'h0,data[23:16]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 163:25]
   wire [31:0] _processed_data_T_35 = 2'h0 == mem_address_index ? _processed_data_T_27 : _processed_data_T_24; // @[src/main/scala/chisel3/util/Mux.scala 77:13]
   wire [31:0] _processed_data_T_37 = 2'h1 == mem_address_index ? _processed_data_T_30 : _processed_data_T_35; // @[src/main/scala/chisel3/util/Mux.scala 77:13]
   wire [31:0] _processed_data_T_39 = 2'h2 == mem_address_index ? _processed_data_T_33 : _processed_data_T_37; // @[src/main/scala/chisel3/util/Mux.scala 77:13]
-  wire [15:0] _processed_data_T_41 = io_bus_read_data[31] ? 16'hffff : 16'h0; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 168:21]
-  wire [31:0] _processed_data_T_43 = {_processed_data_T_41,io_bus_read_data[31:16]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 168:16]
-  wire [15:0] _processed_data_T_45 = io_bus_read_data[15] ? 16'hffff : 16'h0; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 170:30]
-  wire [31:0] _processed_data_T_47 = {_processed_data_T_45,io_bus_read_data[15:0]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 170:25]
-  wire [15:0] _processed_data_T_49 = io_bus_read_data[23] ? 16'hffff : 16'h0; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 171:30]
-  wire [31:0] _processed_data_T_51 = {_processed_data_T_49,io_bus_read_data[23:8]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 171:25]
+  wire [15:0] _processed_data_T_41 = data[31] ? 16'hffff : 16'h0; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 168:21]
+  wire [31:0] _processed_data_T_43 = {_processed_data_T_41,data[31:16]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 168:16]
+  wire [15:0] _processed_data_T_45 = data[15] ? 16'hffff : 16'h0; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 170:30]
+  wire [31:0] _processed_data_T_47 = {_processed_data_T_45,data[15:0]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 170:25]
+  wire [15:0] _processed_data_T_49 = data[23] ? 16'hffff : 16'h0; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 171:30]
+  wire [31:0] _processed_data_T_51 = {_processed_data_T_49,data[23:8]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 171:25]
   wire [31:0] _processed_data_T_57 = 2'h0 == mem_address_index ? _processed_data_T_47 : _processed_data_T_43; // @[src/main/scala/chisel3/util/Mux.scala 77:13]
   wire [31:0] _processed_data_T_59 = 2'h1 == mem_address_index ? _processed_data_T_51 : _processed_data_T_57; // @[src/main/scala/chisel3/util/Mux.scala 77:13]
   wire [31:0] _processed_data_T_61 = 2'h2 == mem_address_index ? _processed_data_T_43 : _processed_data_T_59; // @[src/main/scala/chisel3/util/Mux.scala 77:13]
-  wire [31:0] _processed_data_T_64 = {16'h0,io_bus_read_data[31:16]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 177:16]
-  wire [31:0] _processed_data_T_67 = {16'h0,io_bus_read_data[15:0]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 179:25]
-  wire [31:0] _processed_data_T_70 = {16'h0,io_bus_read_data[23:8]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 180:25]
+  wire [31:0] _processed_data_T_64 = {16'h0,data[31:16]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 177:16]
+  wire [31:0] _processed_data_T_67 = {16'h0,data[15:0]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 179:25]
+  wire [31:0] _processed_data_T_70 = {16'h0,data[23:8]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 180:25]
   wire [31:0] _processed_data_T_75 = 2'h0 == mem_address_index ? _processed_data_T_67 : _processed_data_T_64; // @[src/main/scala/chisel3/util/Mux.scala 77:13]
   wire [31:0] _processed_data_T_77 = 2'h1 == mem_address_index ? _processed_data_T_70 : _processed_data_T_75; // @[src/main/scala/chisel3/util/Mux.scala 77:13]
   wire [31:0] _processed_data_T_79 = 2'h2 == mem_address_index ? _processed_data_T_64 : _processed_data_T_77; // @[src/main/scala/chisel3/util/Mux.scala 77:13]
@@ -7846,11 +8953,14 @@ module MemoryAccess(
   wire [31:0] _processed_data_T_83 = 3'h4 == io_funct3 ? _processed_data_T_39 : _processed_data_T_81; // @[src/main/scala/chisel3/util/Mux.scala 77:13]
   wire [31:0] _processed_data_T_85 = 3'h1 == io_funct3 ? _processed_data_T_61 : _processed_data_T_83; // @[src/main/scala/chisel3/util/Mux.scala 77:13]
   wire [31:0] _processed_data_T_87 = 3'h5 == io_funct3 ? _processed_data_T_79 : _processed_data_T_85; // @[src/main/scala/chisel3/util/Mux.scala 77:13]
-  wire [31:0] processed_data = 3'h2 == io_funct3 ? io_bus_read_data : _processed_data_T_87; // @[src/main/scala/chisel3/util/Mux.scala 77:13]
+  wire [31:0] processed_data = 3'h2 == io_funct3 ? data : _processed_data_T_87; // @[src/main/scala/chisel3/util/Mux.scala 77:13]
   wire [31:0] _GEN_1 = io_bus_read_valid ? processed_data : latched_memory_read_data; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 138:29 188:32 72:41]
   wire  _GEN_4 = io_bus_read_valid ? 1'h0 : 1'h1; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 137:24 138:29 95:24]
   wire  _GEN_6 = io_bus_write_valid ? 1'h0 : 1'h1; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 206:24 208:30 95:24]
-  wire [1:0] _GEN_7 = io_bus_granted ? 2'h1 : mem_access_state; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 224:28 225:26 68:34]
+  wire [1:0] _GEN_7 = io_bus_granted ? 2'h1 : mem_access_state; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 232:36 233:26 68:34]
+  wire [1:0] _GEN_8 = io_tcm_select | io_bus_read_valid ? mem_access_state : _GEN_7; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 227:31 68:34]
+  wire  idle_read_valid = ~(mem_access_state == 2'h1) & ~(mem_access_state == 2'h2) & io_memory_read_enable &
+    (io_tcm_select | io_bus_read_valid); // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 227:31]
   wire  _GEN_11 = 2'h3 == mem_address_index; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 232:27 234:{48,48}]
   wire [4:0] _io_bus_write_data_T_1 = {mem_address_index, 3'h0}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 236:93]
   wire [38:0] _GEN_85 = {{31'd0}, io_reg2_data[7:0]}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 236:71]
@@ -7879,23 +8989,25 @@ module MemoryAccess(
   wire  _GEN_34 = io_funct3 == 3'h0 ? _processed_data_T_20 : _GEN_30; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 233:48]
   wire  _GEN_35 = io_funct3 == 3'h0 ? _GEN_11 : _GEN_31; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 233:48]
   wire [46:0] _GEN_36 = io_funct3 == 3'h0 ? {{8'd0}, _io_bus_write_data_T_2} : _GEN_29; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 233:48 236:27]
-  wire [1:0] _GEN_37 = io_bus_granted ? 2'h2 : mem_access_state; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 267:28 268:26 68:34]
+  wire [1:0] _GEN_37 = ~io_tcm_select & ~io_bus_write_valid & io_bus_granted ? 2'h2 : mem_access_state; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 276:50 277:26 68:34]
   wire [46:0] _GEN_39 = io_memory_write_enable ? _GEN_36 : 47'h0; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 114:26 227:40]
   wire  _GEN_40 = io_memory_write_enable & _GEN_32; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 115:26 227:40]
   wire  _GEN_41 = io_memory_write_enable & _GEN_33; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 115:26 227:40]
   wire  _GEN_42 = io_memory_write_enable & _GEN_34; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 115:26 227:40]
   wire  _GEN_43 = io_memory_write_enable & _GEN_35; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 115:26 227:40]
   wire [1:0] _GEN_44 = io_memory_write_enable ? _GEN_37 : mem_access_state; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 227:40 68:34]
-  wire  _GEN_45 = io_memory_read_enable | io_memory_write_enable; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 213:33 215:26]
+  wire  _GEN_45 = (io_memory_read_enable | io_memory_write_enable) & ~io_tcm_select; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 213:33 215:26]
   wire [46:0] _GEN_51 = io_memory_read_enable ? 47'h0 : _GEN_39; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 114:26 213:33]
-  wire  _GEN_52 = io_memory_read_enable ? 1'h0 : io_memory_write_enable; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 116:26 213:33]
+  wire  _GEN_52 = io_memory_read_enable ? 1'h0 : io_memory_write_enable & ~io_tcm_select; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 116:26 213:33]
   wire  _GEN_53 = io_memory_read_enable ? 1'h0 : _GEN_40; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 115:26 213:33]
   wire  _GEN_54 = io_memory_read_enable ? 1'h0 : _GEN_41; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 115:26 213:33]
   wire  _GEN_55 = io_memory_read_enable ? 1'h0 : _GEN_42; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 115:26 213:33]
   wire  _GEN_56 = io_memory_read_enable ? 1'h0 : _GEN_43; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 115:26 213:33]
   wire  _GEN_57 = mem_access_state == 2'h2 | _GEN_45; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 197:61 205:24]
-  wire  _GEN_58 = mem_access_state == 2'h2 ? _GEN_6 : _GEN_45; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 197:61]
-  wire  _GEN_60 = mem_access_state == 2'h2 ? 1'h0 : io_memory_read_enable; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 110:18 197:61]
+  wire  _GEN_46 = io_memory_read_enable ? ~(io_tcm_select | io_bus_read_valid) : io_memory_write_enable & ~(io_tcm_select |
+    io_bus_write_valid); // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 216:33 218:26 238:27]
+  wire  _GEN_58 = mem_access_state == 2'h2 ? _GEN_6 : _GEN_46; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 197:61]
+  wire  _GEN_60 = mem_access_state == 2'h2 ? 1'h0 : io_memory_read_enable & ~io_tcm_select; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 110:18 197:61]
   wire [46:0] _GEN_64 = mem_access_state == 2'h2 ? 47'h0 : _GEN_51; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 114:26 197:61]
   wire  _GEN_65 = mem_access_state == 2'h2 ? 1'h0 : _GEN_52; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 116:26 197:61]
   wire  _GEN_66 = mem_access_state == 2'h2 ? 1'h0 : _GEN_53; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 115:26 197:61]
@@ -7903,12 +9015,14 @@ module MemoryAccess(
   wire  _GEN_68 = mem_access_state == 2'h2 ? 1'h0 : _GEN_55; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 115:26 197:61]
   wire  _GEN_69 = mem_access_state == 2'h2 ? 1'h0 : _GEN_56; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 115:26 197:61]
   wire [46:0] _GEN_79 = mem_access_state == 2'h1 ? 47'h0 : _GEN_64; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 114:26 134:54]
+  wire  _GEN_86 = io_memory_read_enable ? 1'h0 : io_memory_write_enable & io_tcm_select; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 124:26 220:33]
+  wire  _GEN_87 = mem_access_state == 2'h2 ? 1'h0 : _GEN_86; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 124:26 204:61]
   wire  in_active_read = _T & ~io_bus_read_valid; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 301:69]
   wire [1:0] forward_regs_write_source = in_active_read ? latched_regs_write_source : io_regs_write_source; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 304:38]
   wire [31:0] _io_forward_to_ex_T_1 = io_instruction_address + 32'h4; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 335:72]
   wire [31:0] _io_forward_to_ex_T_3 = 2'h1 == forward_regs_write_source ? io_wb_memory_read_data : io_alu_result; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 331:74]
   wire [31:0] _io_forward_to_ex_T_5 = 2'h2 == forward_regs_write_source ? io_csr_read_data : _io_forward_to_ex_T_3; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 331:74]
-  assign io_wb_memory_read_data = mem_access_state == 2'h1 ? _GEN_1 : latched_memory_read_data; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 134:54 72:41]
+  assign io_wb_memory_read_data = mem_access_state == 2'h1 | idle_read_valid ? _GEN_1 : latched_memory_read_data; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 134:54 229:34 72:41]
   assign io_forward_to_ex = 2'h3 == forward_regs_write_source ? _io_forward_to_ex_T_1 : _io_forward_to_ex_T_5; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 331:74]
   assign io_ctrl_stall_flag = mem_access_state == 2'h1 ? _GEN_4 : _GEN_58; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 134:54]
   assign io_wb_regs_write_source = in_active_read ? latched_regs_write_source : io_regs_write_source; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 310:43]
@@ -7923,6 +9037,13 @@ module MemoryAccess(
   assign io_bus_write_strobe_2 = mem_access_state == 2'h1 ? 1'h0 : _GEN_68; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 115:26 134:54]
   assign io_bus_write_strobe_3 = mem_access_state == 2'h1 ? 1'h0 : _GEN_69; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 115:26 134:54]
   assign io_bus_request = mem_access_state == 2'h1 | _GEN_57; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 134:54 136:24]
+  assign io_tcm_address = {io_alu_result[31:2],2'h0}; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 111:89]
+  assign io_tcm_write = mem_access_state == 2'h1 ? 1'h0 : _GEN_87; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 124:26 141:54]
+  assign io_tcm_write_data = _GEN_79[31:0];
+  assign io_tcm_write_strobe_0 = mem_access_state == 2'h1 ? 1'h0 : _GEN_66; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 115:26 134:54]
+  assign io_tcm_write_strobe_1 = mem_access_state == 2'h1 ? 1'h0 : _GEN_67; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 115:26 134:54]
+  assign io_tcm_write_strobe_2 = mem_access_state == 2'h1 ? 1'h0 : _GEN_68; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 115:26 134:54]
+  assign io_tcm_write_strobe_3 = mem_access_state == 2'h1 ? 1'h0 : _GEN_69; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 115:26 134:54]
   always @(posedge clock) begin
     if (reset) begin // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 68:34]
       mem_access_state <= 2'h0; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 68:34]
@@ -7935,7 +9056,7 @@ module MemoryAccess(
         mem_access_state <= 2'h0; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 94:24]
       end
     end else if (io_memory_read_enable) begin // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 213:33]
-      mem_access_state <= _GEN_7;
+      mem_access_state <= _GEN_8;
     end else begin
       mem_access_state <= _GEN_44;
     end
@@ -7944,11 +9065,13 @@ module MemoryAccess(
     end else if (mem_access_state == 2'h1) begin // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 134:54]
       if (io_bus_read_valid) begin // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 138:29]
         if (3'h2 == io_funct3) begin // @[src/main/scala/chisel3/util/Mux.scala 77:13]
-          latched_memory_read_data <= io_bus_read_data;
+          latched_memory_read_data <= data;
         end else begin
           latched_memory_read_data <= _processed_data_T_87;
         end
       end
+    end else if (idle_read_valid) begin // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 227:31]
+      latched_memory_read_data <= processed_data; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 228:34]
     end
     if (reset) begin // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 79:43]
       latched_regs_write_source <= 2'h0; // @[4-soc/src/main/scala/riscv/core/MemoryAccess.scala 79:43]
@@ -8310,7 +9433,13 @@ module CSR(
   input         io_control_stall, // @[4-soc/src/main/scala/riscv/core/CSR.scala 134:14]
   input         io_btb_miss_taken, // @[4-soc/src/main/scala/riscv/core/CSR.scala 134:14]
   input         io_branch_resolved, // @[4-soc/src/main/scala/riscv/core/CSR.scala 134:14]
-  input         io_btb_predicted // @[4-soc/src/main/scala/riscv/core/CSR.scala 134:14]
+  input         io_btb_predicted, // @[4-soc/src/main/scala/riscv/core/CSR.scala 134:14]
+  input         io_icache_hit, // @[4-soc/src/main/scala/riscv/core/CSR.scala 134:14]
+  input         io_icache_miss, // @[4-soc/src/main/scala/riscv/core/CSR.scala 134:14]
+  input         io_dcache_hit, // @[4-soc/src/main/scala/riscv/core/CSR.scala 134:14]
+  input         io_dcache_miss, // @[4-soc/src/main/scala/riscv/core/CSR.scala 134:14]
+  input         io_dcache_write_back, // @[4-soc/src/main/scala/riscv/core/CSR.scala 134:14]
+  input         io_store_buffer_full // @[4-soc/src/main/scala/riscv/core/CSR.scala 134:14]
 );
 `ifdef RANDOMIZE_REG_INIT
   reg [31:0] _RAND_0;
@@ -8338,6 +9467,18 @@ module CSR(
   reg [31:0] _RAND_22;
   reg [31:0] _RAND_23;
   reg [31:0] _RAND_24;
+  reg [63:0] _RAND_25;
+  reg [63:0] _RAND_26;
+  reg [31:0] _RAND_27;
+  reg [31:0] _RAND_28;
+  reg [63:0] _RAND_29;
+  reg [63:0] _RAND_30;
+  reg [63:0] _RAND_31;
+  reg [63:0] _RAND_32;
+  reg [31:0] _RAND_33;
+  reg [31:0] _RAND_34;
+  reg [31:0] _RAND_35;
+  reg [31:0] _RAND_36;
 `endif // RANDOMIZE_REG_INIT
   reg [31:0] mstatus; // @[4-soc/src/main/scala/riscv/core/CSR.scala 158:25]
   reg [31:0] mie; // @[4-soc/src/main/scala/riscv/core/CSR.scala 159:25]
@@ -8355,6 +9496,12 @@ module CSR(
   reg [63:0] mhpmcounter7; // @[4-soc/src/main/scala/riscv/core/CSR.scala 177:29]
   reg [63:0] mhpmcounter8; // @[4-soc/src/main/scala/riscv/core/CSR.scala 178:29]
   reg [63:0] mhpmcounter9; // @[4-soc/src/main/scala/riscv/core/CSR.scala 179:29]
+  reg [63:0] mhpmcounter10; // @[4-soc/src/main/scala/riscv/core/CSR.scala 191:29]
+  reg [63:0] mhpmcounter11; // @[4-soc/src/main/scala/riscv/core/CSR.scala 192:29]
+  reg [63:0] mhpmcounter12; // @[4-soc/src/main/scala/riscv/core/CSR.scala 209:29]
+  reg [63:0] mhpmcounter13; // @[4-soc/src/main/scala/riscv/core/CSR.scala 210:29]
+  reg [63:0] mhpmcounter14; // @[4-soc/src/main/scala/riscv/core/CSR.scala 211:29]
+  reg [63:0] mhpmcounter15; // @[4-soc/src/main/scala/riscv/core/CSR.scala 217:29]
   reg [31:0] mcycle_shadow; // @[4-soc/src/main/scala/riscv/core/CSR.scala 185:36]
   reg [31:0] minstret_shadow; // @[4-soc/src/main/scala/riscv/core/CSR.scala 186:36]
   reg [31:0] mhpmcounter3_shadow; // @[4-soc/src/main/scala/riscv/core/CSR.scala 187:36]
@@ -8364,6 +9511,12 @@ module CSR(
   reg [31:0] mhpmcounter7_shadow; // @[4-soc/src/main/scala/riscv/core/CSR.scala 191:36]
   reg [31:0] mhpmcounter8_shadow; // @[4-soc/src/main/scala/riscv/core/CSR.scala 192:36]
   reg [31:0] mhpmcounter9_shadow; // @[4-soc/src/main/scala/riscv/core/CSR.scala 193:36]
+  reg [31:0] mhpmcounter10_shadow; // @[4-soc/src/main/scala/riscv/core/CSR.scala 207:36]
+  reg [31:0] mhpmcounter11_shadow; // @[4-soc/src/main/scala/riscv/core/CSR.scala 208:36]
+  reg [31:0] mhpmcounter12_shadow; // @[4-soc/src/main/scala/riscv/core/CSR.scala 228:36]
+  reg [31:0] mhpmcounter13_shadow; // @[4-soc/src/main/scala/riscv/core/CSR.scala 229:36]
+  reg [31:0] mhpmcounter14_shadow; // @[4-soc/src/main/scala/riscv/core/CSR.scala 230:36]
+  reg [31:0] mhpmcounter15_shadow; // @[4-soc/src/main/scala/riscv/core/CSR.scala 237:36]
   wire  reading_cycle_low = io_reg_read_address_id == 12'hc00 | io_reg_read_address_id == 12'hb00; // @[4-soc/src/main/scala/riscv/core/CSR.scala 199:51]
   wire  reading_instret_low = io_reg_read_address_id == 12'hc02 | io_reg_read_address_id == 12'hb02; // @[4-soc/src/main/scala/riscv/core/CSR.scala 201:53]
   wire  reading_hpm3_low = io_reg_read_address_id == 12'hb03; // @[4-soc/src/main/scala/riscv/core/CSR.scala 202:49]
@@ -8373,6 +9526,12 @@ module CSR(
   wire  reading_hpm7_low = io_reg_read_address_id == 12'hb07; // @[4-soc/src/main/scala/riscv/core/CSR.scala 206:49]
   wire  reading_hpm8_low = io_reg_read_address_id == 12'hb08; // @[4-soc/src/main/scala/riscv/core/CSR.scala 207:49]
   wire  reading_hpm9_low = io_reg_read_address_id == 12'hb09; // @[4-soc/src/main/scala/riscv/core/CSR.scala 208:49]
+  wire  reading_hpm10_low = io_reg_read_address_id == 12'hb0a; // @[4-soc/src/main/scala/riscv/core/CSR.scala 224:49]
+  wire  reading_hpm11_low = io_reg_read_address_id == 12'hb0b; // @[4-soc/src/main/scala/riscv/core/CSR.scala 225:49]
+  wire  reading_hpm12_low = io_reg_read_address_id == 12'hb0c; // @[4-soc/src/main/scala/riscv/core/CSR.scala 248:49]
+  wire  reading_hpm13_low = io_reg_read_address_id == 12'hb0d; // @[4-soc/src/main/scala/riscv/core/CSR.scala 249:49]
+  wire  reading_hpm14_low = io_reg_read_address_id == 12'hb0e; // @[4-soc/src/main/scala/riscv/core/CSR.scala 250:49]
+  wire  reading_hpm15_low = io_reg_read_address_id == 12'hb0f; // @[4-soc/src/main/scala/riscv/core/CSR.scala 258:49]
   wire  inhibit_cy = mcountinhibit[0]; // @[4-soc/src/main/scala/riscv/core/CSR.scala 239:35]
   wire  inhibit_ir = mcountinhibit[2]; // @[4-soc/src/main/scala/riscv/core/CSR.scala 240:35]
   wire  inhibit_hpm3 = mcountinhibit[3]; // @[4-soc/src/main/scala/riscv/core/CSR.scala 241:35]
@@ -8382,6 +9541,12 @@ module CSR(
   wire  inhibit_hpm7 = mcountinhibit[7]; // @[4-soc/src/main/scala/riscv/core/CSR.scala 245:35]
   wire  inhibit_hpm8 = mcountinhibit[8]; // @[4-soc/src/main/scala/riscv/core/CSR.scala 246:35]
   wire  inhibit_hpm9 = mcountinhibit[9]; // @[4-soc/src/main/scala/riscv/core/CSR.scala 247:35]
+  wire  inhibit_hpm10 = mcountinhibit[10]; // @[4-soc/src/main/scala/riscv/core/CSR.scala 271:35]
+  wire  inhibit_hpm11 = mcountinhibit[11]; // @[4-soc/src/main/scala/riscv/core/CSR.scala 272:35]
+  wire  inhibit_hpm12 = mcountinhibit[12]; // @[4-soc/src/main/scala/riscv/core/CSR.scala 307:35]
+  wire  inhibit_hpm13 = mcountinhibit[13]; // @[4-soc/src/main/scala/riscv/core/CSR.scala 308:35]
+  wire  inhibit_hpm14 = mcountinhibit[14]; // @[4-soc/src/main/scala/riscv/core/CSR.scala 309:35]
+  wire  inhibit_hpm15 = mcountinhibit[15]; // @[4-soc/src/main/scala/riscv/core/CSR.scala 321:35]
   wire [63:0] _mcycle_T_1 = mcycle + 64'h1; // @[4-soc/src/main/scala/riscv/core/CSR.scala 252:22]
   wire [63:0] _GEN_9 = ~inhibit_cy ? _mcycle_T_1 : mcycle; // @[4-soc/src/main/scala/riscv/core/CSR.scala 251:21 252:12 171:29]
   wire [63:0] _minstret_T_1 = minstret + 64'h1; // @[4-soc/src/main/scala/riscv/core/CSR.scala 255:26]
@@ -8400,6 +9565,18 @@ module CSR(
   wire [63:0] _GEN_16 = io_branch_resolved & ~inhibit_hpm8 ? _mhpmcounter8_T_1 : mhpmcounter8; // @[4-soc/src/main/scala/riscv/core/CSR.scala 272:45 273:18 178:29]
   wire [63:0] _mhpmcounter9_T_1 = mhpmcounter9 + 64'h1; // @[4-soc/src/main/scala/riscv/core/CSR.scala 276:34]
   wire [63:0] _GEN_17 = io_btb_predicted & ~inhibit_hpm9 ? _mhpmcounter9_T_1 : mhpmcounter9; // @[4-soc/src/main/scala/riscv/core/CSR.scala 275:43 276:18 179:29]
+  wire [63:0] _mhpmcounter10_T_1 = mhpmcounter10 + 64'h1; // @[4-soc/src/main/scala/riscv/core/CSR.scala 304:36]
+  wire [63:0] _GEN_116 = io_icache_hit & ~inhibit_hpm10 ? _mhpmcounter10_T_1 : mhpmcounter10; // @[4-soc/src/main/scala/riscv/core/CSR.scala 303:41 304:19 191:29]
+  wire [63:0] _mhpmcounter11_T_1 = mhpmcounter11 + 64'h1; // @[4-soc/src/main/scala/riscv/core/CSR.scala 307:36]
+  wire [63:0] _GEN_117 = io_icache_miss & ~inhibit_hpm11 ? _mhpmcounter11_T_1 : mhpmcounter11; // @[4-soc/src/main/scala/riscv/core/CSR.scala 306:42 307:19 192:29]
+  wire [63:0] _mhpmcounter12_T_1 = mhpmcounter12 + 64'h1; // @[4-soc/src/main/scala/riscv/core/CSR.scala 347:36]
+  wire [63:0] _GEN_118 = io_dcache_hit & ~inhibit_hpm12 ? _mhpmcounter12_T_1 : mhpmcounter12; // @[4-soc/src/main/scala/riscv/core/CSR.scala 346:41 347:19 209:29]
+  wire [63:0] _mhpmcounter13_T_1 = mhpmcounter13 + 64'h1; // @[4-soc/src/main/scala/riscv/core/CSR.scala 350:36]
+  wire [63:0] _GEN_119 = io_dcache_miss & ~inhibit_hpm13 ? _mhpmcounter13_T_1 : mhpmcounter13; // @[4-soc/src/main/scala/riscv/core/CSR.scala 349:42 350:19 210:29]
+  wire [63:0] _mhpmcounter14_T_1 = mhpmcounter14 + 64'h1; // @[4-soc/src/main/scala/riscv/core/CSR.scala 353:36]
+  wire [63:0] _GEN_120 = io_dcache_write_back & ~inhibit_hpm14 ? _mhpmcounter14_T_1 : mhpmcounter14; // @[4-soc/src/main/scala/riscv/core/CSR.scala 352:48 353:19 211:29]
+  wire [63:0] _mhpmcounter15_T_1 = mhpmcounter15 + 64'h1; // @[4-soc/src/main/scala/riscv/core/CSR.scala 368:36]
+  wire [63:0] _GEN_121 = io_store_buffer_full & ~inhibit_hpm15 ? _mhpmcounter15_T_1 : mhpmcounter15; // @[4-soc/src/main/scala/riscv/core/CSR.scala 367:48 368:19 217:29]
   wire [31:0] _io_id_reg_read_data_T_1 = 12'h300 == io_reg_read_address_id ? mstatus : 32'h0; // @[4-soc/src/main/scala/riscv/core/CSR.scala 323:67]
   wire [31:0] _io_id_reg_read_data_T_3 = 12'h301 == io_reg_read_address_id ? 32'h40001100 : _io_id_reg_read_data_T_1; // @[4-soc/src/main/scala/riscv/core/CSR.scala 323:67]
   wire [31:0] _io_id_reg_read_data_T_5 = 12'h304 == io_reg_read_address_id ? mie : _io_id_reg_read_data_T_3; // @[4-soc/src/main/scala/riscv/core/CSR.scala 323:67]
@@ -8500,6 +9677,54 @@ module CSR(
     _io_debug_reg_read_data_T_53; // @[4-soc/src/main/scala/riscv/core/CSR.scala 324:70]
   wire [31:0] _io_debug_reg_read_data_T_57 = 12'hb09 == io_debug_reg_read_address ? mhpmcounter9[31:0] :
     _io_debug_reg_read_data_T_55; // @[4-soc/src/main/scala/riscv/core/CSR.scala 324:70]
+  wire [31:0] _io_id_reg_read_data_T_59 = 12'hb89 == io_reg_read_address_id ? mhpmcounter9_shadow :
+    _io_id_reg_read_data_T_57; // @[4-soc/src/main/scala/riscv/core/CSR.scala 323:67]
+  wire [31:0] _io_id_reg_read_data_T_61 = 12'hb0a == io_reg_read_address_id ? mhpmcounter10[31:0] :
+    _io_id_reg_read_data_T_59; // @[4-soc/src/main/scala/riscv/core/CSR.scala 323:67]
+  wire [31:0] _io_id_reg_read_data_T_63 = 12'hb8a == io_reg_read_address_id ? mhpmcounter10_shadow :
+    _io_id_reg_read_data_T_61; // @[4-soc/src/main/scala/riscv/core/CSR.scala 323:67]
+  wire [31:0] _io_id_reg_read_data_T_65 = 12'hb0b == io_reg_read_address_id ? mhpmcounter11[31:0] :
+    _io_id_reg_read_data_T_63; // @[4-soc/src/main/scala/riscv/core/CSR.scala 323:67]
+  wire [31:0] _io_debug_reg_read_data_T_59 = 12'hb89 == io_debug_reg_read_address ? mhpmcounter9_shadow :
+    _io_debug_reg_read_data_T_57; // @[4-soc/src/main/scala/riscv/core/CSR.scala 324:70]
+  wire [31:0] _io_debug_reg_read_data_T_61 = 12'hb0a == io_debug_reg_read_address ? mhpmcounter10[31:0] :
+    _io_debug_reg_read_data_T_59; // @[4-soc/src/main/scala/riscv/core/CSR.scala 324:70]
+  wire [31:0] _io_debug_reg_read_data_T_63 = 12'hb8a == io_debug_reg_read_address ? mhpmcounter10_shadow :
+    _io_debug_reg_read_data_T_61; // @[4-soc/src/main/scala/riscv/core/CSR.scala 324:70]
+  wire [31:0] _io_debug_reg_read_data_T_65 = 12'hb0b == io_debug_reg_read_address ? mhpmcounter11[31:0] :
+    _io_debug_reg_read_data_T_63; // @[4-soc/src/main/scala/riscv/core/CSR.scala 324:70]
+  wire [31:0] _io_id_reg_read_data_T_67 = 12'hb8b == io_reg_read_address_id ? mhpmcounter11_shadow :
+    _io_id_reg_read_data_T_65; // @[4-soc/src/main/scala/riscv/core/CSR.scala 323:67]
+  wire [31:0] _io_id_reg_read_data_T_69 = 12'hb0c == io_reg_read_address_id ? mhpmcounter12[31:0] :
+    _io_id_reg_read_data_T_67; // @[4-soc/src/main/scala/riscv/core/CSR.scala 323:67]
+  wire [31:0] _io_id_reg_read_data_T_71 = 12'hb8c == io_reg_read_address_id ? mhpmcounter12_shadow :
+    _io_id_reg_read_data_T_69; // @[4-soc/src/main/scala/riscv/core/CSR.scala 323:67]
+  wire [31:0] _io_id_reg_read_data_T_73 = 12'hb0d == io_reg_read_address_id ? mhpmcounter13[31:0] :
+    _io_id_reg_read_data_T_71; // @[4-soc/src/main/scala/riscv/core/CSR.scala 323:67]
+  wire [31:0] _io_id_reg_read_data_T_75 = 12'hb8d == io_reg_read_address_id ? mhpmcounter13_shadow :
+    _io_id_reg_read_data_T_73; // @[4-soc/src/main/scala/riscv/core/CSR.scala 323:67]
+  wire [31:0] _io_id_reg_read_data_T_77 = 12'hb0e == io_reg_read_address_id ? mhpmcounter14[31:0] :
+    _io_id_reg_read_data_T_75; // @[4-soc/src/main/scala/riscv/core/CSR.scala 323:67]
+  wire [31:0] _io_id_reg_read_data_T_79 = 12'hb8e == io_reg_read_address_id ? mhpmcounter14_shadow :
+    _io_id_reg_read_data_T_77; // @[4-soc/src/main/scala/riscv/core/CSR.scala 323:67]
+  wire [31:0] _io_id_reg_read_data_T_81 = 12'hb0f == io_reg_read_address_id ? mhpmcounter15[31:0] :
+    _io_id_reg_read_data_T_79; // @[4-soc/src/main/scala/riscv/core/CSR.scala 323:67]
+  wire [31:0] _io_debug_reg_read_data_T_67 = 12'hb8b == io_debug_reg_read_address ? mhpmcounter11_shadow :
+    _io_debug_reg_read_data_T_65; // @[4-soc/src/main/scala/riscv/core/CSR.scala 324:70]
+  wire [31:0] _io_debug_reg_read_data_T_69 = 12'hb0c == io_debug_reg_read_address ? mhpmcounter12[31:0] :
+    _io_debug_reg_read_data_T_67; // @[4-soc/src/main/scala/riscv/core/CSR.scala 324:70]
+  wire [31:0] _io_debug_reg_read_data_T_71 = 12'hb8c == io_debug_reg_read_address ? mhpmcounter12_shadow :
+    _io_debug_reg_read_data_T_69; // @[4-soc/src/main/scala/riscv/core/CSR.scala 324:70]
+  wire [31:0] _io_debug_reg_read_data_T_73 = 12'hb0d == io_debug_reg_read_address ? mhpmcounter13[31:0] :
+    _io_debug_reg_read_data_T_71; // @[4-soc/src/main/scala/riscv/core/CSR.scala 324:70]
+  wire [31:0] _io_debug_reg_read_data_T_75 = 12'hb8d == io_debug_reg_read_address ? mhpmcounter13_shadow :
+    _io_debug_reg_read_data_T_73; // @[4-soc/src/main/scala/riscv/core/CSR.scala 324:70]
+  wire [31:0] _io_debug_reg_read_data_T_77 = 12'hb0e == io_debug_reg_read_address ? mhpmcounter14[31:0] :
+    _io_debug_reg_read_data_T_75; // @[4-soc/src/main/scala/riscv/core/CSR.scala 324:70]
+  wire [31:0] _io_debug_reg_read_data_T_79 = 12'hb8e == io_debug_reg_read_address ? mhpmcounter14_shadow :
+    _io_debug_reg_read_data_T_77; // @[4-soc/src/main/scala/riscv/core/CSR.scala 324:70]
+  wire [31:0] _io_debug_reg_read_data_T_81 = 12'hb0f == io_debug_reg_read_address ? mhpmcounter15[31:0] :
+    _io_debug_reg_read_data_T_79; // @[4-soc/src/main/scala/riscv/core/CSR.scala 324:70]
   wire  _io_clint_access_bundle_mstatus_T = io_reg_write_address_ex == 12'h300; // @[4-soc/src/main/scala/riscv/core/CSR.scala 327:55]
   wire  _io_clint_access_bundle_mstatus_T_1 = io_reg_write_enable_ex & io_reg_write_address_ex == 12'h300; // @[4-soc/src/main/scala/riscv/core/CSR.scala 327:28]
   wire  _io_clint_access_bundle_mtvec_T = io_reg_write_address_ex == 12'h305; // @[4-soc/src/main/scala/riscv/core/CSR.scala 332:55]
@@ -8513,7 +9738,7 @@ module CSR(
   wire [31:0] _GEN_18 = _io_clint_access_bundle_mcause_T ? io_reg_write_data_ex : mcause; // @[4-soc/src/main/scala/riscv/core/CSR.scala 361:64 362:14 163:25]
   wire [31:0] _GEN_19 = _io_clint_access_bundle_mepc_T ? io_reg_write_data_ex : mepc; // @[4-soc/src/main/scala/riscv/core/CSR.scala 359:62 360:12 162:25]
   wire [31:0] _GEN_20 = _io_clint_access_bundle_mepc_T ? mcause : _GEN_18; // @[4-soc/src/main/scala/riscv/core/CSR.scala 163:25 359:62]
-  wire [31:0] _mcountinhibit_T = io_reg_write_data_ex & 32'h3fd; // @[4-soc/src/main/scala/riscv/core/CSR.scala 376:45]
+  wire [31:0] _mcountinhibit_T = io_reg_write_data_ex & 32'hfffd; // @[4-soc/src/main/scala/riscv/core/CSR.scala 461:45]
   wire [31:0] _GEN_30 = io_reg_write_address_ex == 12'h320 ? _mcountinhibit_T : mcountinhibit; // @[4-soc/src/main/scala/riscv/core/CSR.scala 373:71 376:21 168:30]
   wire [31:0] _GEN_31 = io_reg_write_address_ex == 12'h340 ? io_reg_write_data_ex : mscratch; // @[4-soc/src/main/scala/riscv/core/CSR.scala 371:66 372:16 161:25]
   wire [31:0] _GEN_32 = io_reg_write_address_ex == 12'h340 ? mcountinhibit : _GEN_30; // @[4-soc/src/main/scala/riscv/core/CSR.scala 168:30 371:66]
@@ -8535,6 +9760,18 @@ module CSR(
   wire [63:0] _mhpmcounter8_T_5 = {io_reg_write_data_ex,mhpmcounter8[31:0]}; // @[4-soc/src/main/scala/riscv/core/CSR.scala 415:26]
   wire [63:0] _mhpmcounter9_T_3 = {mhpmcounter9[63:32],io_reg_write_data_ex}; // @[4-soc/src/main/scala/riscv/core/CSR.scala 417:26]
   wire [63:0] _mhpmcounter9_T_5 = {io_reg_write_data_ex,mhpmcounter9[31:0]}; // @[4-soc/src/main/scala/riscv/core/CSR.scala 419:26]
+  wire [63:0] _mhpmcounter10_T_3 = {mhpmcounter10[63:32],io_reg_write_data_ex}; // @[4-soc/src/main/scala/riscv/core/CSR.scala 456:27]
+  wire [63:0] _mhpmcounter10_T_5 = {io_reg_write_data_ex,mhpmcounter10[31:0]}; // @[4-soc/src/main/scala/riscv/core/CSR.scala 458:27]
+  wire [63:0] _mhpmcounter11_T_3 = {mhpmcounter11[63:32],io_reg_write_data_ex}; // @[4-soc/src/main/scala/riscv/core/CSR.scala 460:27]
+  wire [63:0] _mhpmcounter11_T_5 = {io_reg_write_data_ex,mhpmcounter11[31:0]}; // @[4-soc/src/main/scala/riscv/core/CSR.scala 462:27]
+  wire [63:0] _mhpmcounter12_T_3 = {mhpmcounter12[63:32],io_reg_write_data_ex}; // @[4-soc/src/main/scala/riscv/core/CSR.scala 510:27]
+  wire [63:0] _mhpmcounter12_T_5 = {io_reg_write_data_ex,mhpmcounter12[31:0]}; // @[4-soc/src/main/scala/riscv/core/CSR.scala 512:27]
+  wire [63:0] _mhpmcounter13_T_3 = {mhpmcounter13[63:32],io_reg_write_data_ex}; // @[4-soc/src/main/scala/riscv/core/CSR.scala 514:27]
+  wire [63:0] _mhpmcounter13_T_5 = {io_reg_write_data_ex,mhpmcounter13[31:0]}; // @[4-soc/src/main/scala/riscv/core/CSR.scala 516:27]
+  wire [63:0] _mhpmcounter14_T_3 = {mhpmcounter14[63:32],io_reg_write_data_ex}; // @[4-soc/src/main/scala/riscv/core/CSR.scala 518:27]
+  wire [63:0] _mhpmcounter14_T_5 = {io_reg_write_data_ex,mhpmcounter14[31:0]}; // @[4-soc/src/main/scala/riscv/core/CSR.scala 520:27]
+  wire [63:0] _mhpmcounter15_T_3 = {mhpmcounter15[63:32],io_reg_write_data_ex}; // @[4-soc/src/main/scala/riscv/core/CSR.scala 545:27]
+  wire [63:0] _mhpmcounter15_T_5 = {io_reg_write_data_ex,mhpmcounter15[31:0]}; // @[4-soc/src/main/scala/riscv/core/CSR.scala 547:27]
   wire [63:0] _GEN_44 = io_reg_write_address_ex == 12'hb89 ? _mhpmcounter9_T_5 : _GEN_17; // @[4-soc/src/main/scala/riscv/core/CSR.scala 418:71 419:20]
   wire [63:0] _GEN_45 = io_reg_write_address_ex == 12'hb09 ? _mhpmcounter9_T_3 : _GEN_44; // @[4-soc/src/main/scala/riscv/core/CSR.scala 416:71 417:20]
   wire [63:0] _GEN_46 = io_reg_write_address_ex == 12'hb88 ? _mhpmcounter8_T_5 : _GEN_16; // @[4-soc/src/main/scala/riscv/core/CSR.scala 414:71 415:20]
@@ -8607,9 +9844,10 @@ module CSR(
   wire [63:0] _GEN_113 = io_reg_write_address_ex == 12'hb02 ? _GEN_15 : _GEN_105; // @[4-soc/src/main/scala/riscv/core/CSR.scala 388:67]
   wire [63:0] _GEN_114 = io_reg_write_address_ex == 12'hb02 ? _GEN_16 : _GEN_106; // @[4-soc/src/main/scala/riscv/core/CSR.scala 388:67]
   wire [63:0] _GEN_115 = io_reg_write_address_ex == 12'hb02 ? _GEN_17 : _GEN_107; // @[4-soc/src/main/scala/riscv/core/CSR.scala 388:67]
-  assign io_id_reg_read_data = 12'hb89 == io_reg_read_address_id ? mhpmcounter9_shadow : _io_id_reg_read_data_T_57; // @[4-soc/src/main/scala/riscv/core/CSR.scala 323:67]
-  assign io_debug_reg_read_data = 12'hb89 == io_debug_reg_read_address ? mhpmcounter9_shadow :
-    _io_debug_reg_read_data_T_57; // @[4-soc/src/main/scala/riscv/core/CSR.scala 324:70]
+  assign io_id_reg_read_data = 12'hb8f == io_reg_read_address_id ? mhpmcounter15_shadow :
+    _io_id_reg_read_data_T_81; // @[4-soc/src/main/scala/riscv/core/CSR.scala 323:67]
+  assign io_debug_reg_read_data = 12'hb8f == io_debug_reg_read_address ? mhpmcounter15_shadow :
+    _io_debug_reg_read_data_T_81; // @[4-soc/src/main/scala/riscv/core/CSR.scala 324:70]
   assign io_clint_access_bundle_mstatus = _io_clint_access_bundle_mstatus_T_1 ? io_reg_write_data_ex : mstatus; // @[4-soc/src/main/scala/riscv/core/CSR.scala 326:40]
   assign io_clint_access_bundle_mepc = _io_clint_access_bundle_mepc_T_1 ? io_reg_write_data_ex : mepc; // @[4-soc/src/main/scala/riscv/core/CSR.scala 341:37]
   assign io_clint_access_bundle_mcause = _io_clint_access_bundle_mcause_T_1 ? io_reg_write_data_ex : mcause; // @[4-soc/src/main/scala/riscv/core/CSR.scala 336:39]
@@ -8794,6 +10032,60 @@ module CSR(
     end else begin
       mhpmcounter9 <= _GEN_17;
     end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 191:29]
+      mhpmcounter10 <= 64'h0; // @[4-soc/src/main/scala/riscv/core/CSR.scala 191:29]
+    end else if (io_reg_write_enable_ex & io_reg_write_address_ex == 12'hb0a) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 455:72]
+      mhpmcounter10 <= _mhpmcounter10_T_3; // @[4-soc/src/main/scala/riscv/core/CSR.scala 456:21]
+    end else if (io_reg_write_enable_ex & io_reg_write_address_ex == 12'hb8a) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 457:72]
+      mhpmcounter10 <= _mhpmcounter10_T_5; // @[4-soc/src/main/scala/riscv/core/CSR.scala 458:21]
+    end else begin
+      mhpmcounter10 <= _GEN_116;
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 192:29]
+      mhpmcounter11 <= 64'h0; // @[4-soc/src/main/scala/riscv/core/CSR.scala 192:29]
+    end else if (io_reg_write_enable_ex & io_reg_write_address_ex == 12'hb0b) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 459:72]
+      mhpmcounter11 <= _mhpmcounter11_T_3; // @[4-soc/src/main/scala/riscv/core/CSR.scala 460:21]
+    end else if (io_reg_write_enable_ex & io_reg_write_address_ex == 12'hb8b) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 461:72]
+      mhpmcounter11 <= _mhpmcounter11_T_5; // @[4-soc/src/main/scala/riscv/core/CSR.scala 462:21]
+    end else begin
+      mhpmcounter11 <= _GEN_117;
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 209:29]
+      mhpmcounter12 <= 64'h0; // @[4-soc/src/main/scala/riscv/core/CSR.scala 209:29]
+    end else if (io_reg_write_enable_ex & io_reg_write_address_ex == 12'hb0c) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 509:72]
+      mhpmcounter12 <= _mhpmcounter12_T_3; // @[4-soc/src/main/scala/riscv/core/CSR.scala 510:21]
+    end else if (io_reg_write_enable_ex & io_reg_write_address_ex == 12'hb8c) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 511:72]
+      mhpmcounter12 <= _mhpmcounter12_T_5; // @[4-soc/src/main/scala/riscv/core/CSR.scala 512:21]
+    end else begin
+      mhpmcounter12 <= _GEN_118;
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 210:29]
+      mhpmcounter13 <= 64'h0; // @[4-soc/src/main/scala/riscv/core/CSR.scala 210:29]
+    end else if (io_reg_write_enable_ex & io_reg_write_address_ex == 12'hb0d) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 513:72]
+      mhpmcounter13 <= _mhpmcounter13_T_3; // @[4-soc/src/main/scala/riscv/core/CSR.scala 514:21]
+    end else if (io_reg_write_enable_ex & io_reg_write_address_ex == 12'hb8d) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 515:72]
+      mhpmcounter13 <= _mhpmcounter13_T_5; // @[4-soc/src/main/scala/riscv/core/CSR.scala 516:21]
+    end else begin
+      mhpmcounter13 <= _GEN_119;
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 211:29]
+      mhpmcounter14 <= 64'h0; // @[4-soc/src/main/scala/riscv/core/CSR.scala 211:29]
+    end else if (io_reg_write_enable_ex & io_reg_write_address_ex == 12'hb0e) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 517:72]
+      mhpmcounter14 <= _mhpmcounter14_T_3; // @[4-soc/src/main/scala/riscv/core/CSR.scala 518:21]
+    end else if (io_reg_write_enable_ex & io_reg_write_address_ex == 12'hb8e) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 519:72]
+      mhpmcounter14 <= _mhpmcounter14_T_5; // @[4-soc/src/main/scala/riscv/core/CSR.scala 520:21]
+    end else begin
+      mhpmcounter14 <= _GEN_120;
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 217:29]
+      mhpmcounter15 <= 64'h0; // @[4-soc/src/main/scala/riscv/core/CSR.scala 217:29]
+    end else if (io_reg_write_enable_ex & io_reg_write_address_ex == 12'hb0f) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 544:72]
+      mhpmcounter15 <= _mhpmcounter15_T_3; // @[4-soc/src/main/scala/riscv/core/CSR.scala 545:21]
+    end else if (io_reg_write_enable_ex & io_reg_write_address_ex == 12'hb8f) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 546:72]
+      mhpmcounter15 <= _mhpmcounter15_T_5; // @[4-soc/src/main/scala/riscv/core/CSR.scala 547:21]
+    end else begin
+      mhpmcounter15 <= _GEN_121;
+    end
     if (reset) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 185:36]
       mcycle_shadow <= 32'h0; // @[4-soc/src/main/scala/riscv/core/CSR.scala 185:36]
     end else if (reading_cycle_low) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 210:27]
@@ -8839,6 +10131,36 @@ module CSR(
     end else if (reading_hpm9_low) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 234:26]
       mhpmcounter9_shadow <= mhpmcounter9[63:32]; // @[4-soc/src/main/scala/riscv/core/CSR.scala 235:25]
     end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 207:36]
+      mhpmcounter10_shadow <= 32'h0; // @[4-soc/src/main/scala/riscv/core/CSR.scala 207:36]
+    end else if (reading_hpm10_low) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 254:27]
+      mhpmcounter10_shadow <= mhpmcounter10[63:32]; // @[4-soc/src/main/scala/riscv/core/CSR.scala 255:26]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 208:36]
+      mhpmcounter11_shadow <= 32'h0; // @[4-soc/src/main/scala/riscv/core/CSR.scala 208:36]
+    end else if (reading_hpm11_low) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 257:27]
+      mhpmcounter11_shadow <= mhpmcounter11[63:32]; // @[4-soc/src/main/scala/riscv/core/CSR.scala 258:26]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 228:36]
+      mhpmcounter12_shadow <= 32'h0; // @[4-soc/src/main/scala/riscv/core/CSR.scala 228:36]
+    end else if (reading_hpm12_low) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 297:27]
+      mhpmcounter12_shadow <= mhpmcounter12[63:32]; // @[4-soc/src/main/scala/riscv/core/CSR.scala 298:26]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 229:36]
+      mhpmcounter13_shadow <= 32'h0; // @[4-soc/src/main/scala/riscv/core/CSR.scala 229:36]
+    end else if (reading_hpm13_low) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 300:27]
+      mhpmcounter13_shadow <= mhpmcounter13[63:32]; // @[4-soc/src/main/scala/riscv/core/CSR.scala 301:26]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 230:36]
+      mhpmcounter14_shadow <= 32'h0; // @[4-soc/src/main/scala/riscv/core/CSR.scala 230:36]
+    end else if (reading_hpm14_low) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 303:27]
+      mhpmcounter14_shadow <= mhpmcounter14[63:32]; // @[4-soc/src/main/scala/riscv/core/CSR.scala 304:26]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 237:36]
+      mhpmcounter15_shadow <= 32'h0; // @[4-soc/src/main/scala/riscv/core/CSR.scala 237:36]
+    end else if (reading_hpm15_low) begin // @[4-soc/src/main/scala/riscv/core/CSR.scala 302:27]
+      mhpmcounter15_shadow <= mhpmcounter15[63:32]; // @[4-soc/src/main/scala/riscv/core/CSR.scala 303:26]
+    end
   end
 // Register and memory initialization
 `ifdef RANDOMIZE_GARBAGE_ASSIGN
@@ -8926,6 +10248,30 @@ initial begin
   mhpmcounter8_shadow = _RAND_23[31:0];
   _RAND_24 = {1{`RANDOM}};
   mhpmcounter9_shadow = _RAND_24[31:0];
+  _RAND_25 = {2{`RANDOM}};
+  mhpmcounter10 = _RAND_25[63:0];
+  _RAND_26 = {2{`RANDOM}};
+  mhpmcounter11 = _RAND_26[63:0];
+  _RAND_27 = {1{`RANDOM}};
+  mhpmcounter10_shadow = _RAND_27[31:0];
+  _RAND_28 = {1{`RANDOM}};
+  mhpmcounter11_shadow = _RAND_28[31:0];
+  _RAND_29 = {2{`RANDOM}};
+  mhpmcounter12 = _RAND_29[63:0];
+  _RAND_30 = {2{`RANDOM}};
+  mhpmcounter13 = _RAND_30[63:0];
+  _RAND_31 = {2{`RANDOM}};
+  mhpmcounter14 = _RAND_31[63:0];
+  _RAND_32 = {2{`RANDOM}};
+  mhpmcounter15 = _RAND_32[63:0];
+  _RAND_33 = {1{`RANDOM}};
+  mhpmcounter12_shadow = _RAND_33[31:0];
+  _RAND_34 = {1{`RANDOM}};
+  mhpmcounter13_shadow = _RAND_34[31:0];
+  _RAND_35 = {1{`RANDOM}};
+  mhpmcounter14_shadow = _RAND_35[31:0];
+  _RAND_36 = {1{`RANDOM}};
+  mhpmcounter15_shadow = _RAND_36[31:0];
 `endif // RANDOMIZE_REG_INIT
   `endif // RANDOMIZE
 end // initial
@@ -8934,113 +10280,877 @@ end // initial
 `endif
 `endif // SYNTHESIS
 endmodule
-module PipelinedCPU(
+module ICache(
   input         clock,
   input         reset,
-  output [31:0] io_instruction_address, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
-  input  [31:0] io_instruction, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
-  input         io_instruction_valid, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
-  output [31:0] io_memory_bundle_address, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
-  output        io_memory_bundle_read, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
-  input  [31:0] io_memory_bundle_read_data, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
-  input         io_memory_bundle_read_valid, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
-  output        io_memory_bundle_write, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
-  output [31:0] io_memory_bundle_write_data, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
-  output        io_memory_bundle_write_strobe_0, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
-  output        io_memory_bundle_write_strobe_1, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
-  output        io_memory_bundle_write_strobe_2, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
-  output        io_memory_bundle_write_strobe_3, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
-  input         io_memory_bundle_write_valid, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
-  output        io_memory_bundle_request, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
-  input         io_memory_bundle_granted, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
-  output [2:0]  io_device_select, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
-  input  [31:0] io_interrupt_flag, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
-  input  [4:0]  io_debug_read_address, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
-  output [31:0] io_debug_read_data, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
-  input  [11:0] io_csr_debug_read_address, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
-  output [31:0] io_csr_debug_read_data // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  input         io_enable, // @[4-soc/src/main/scala/riscv/core/ICache.scala 66:14]
+  input  [31:0] io_address, // @[4-soc/src/main/scala/riscv/core/ICache.scala 66:14]
+  input         io_fetch, // @[4-soc/src/main/scala/riscv/core/ICache.scala 66:14]
+  input  [31:0] io_rom_instruction, // @[4-soc/src/main/scala/riscv/core/ICache.scala 66:14]
+  input         io_rom_instruction_valid, // @[4-soc/src/main/scala/riscv/core/ICache.scala 66:14]
+  output [31:0] io_instruction, // @[4-soc/src/main/scala/riscv/core/ICache.scala 66:14]
+  output        io_instruction_valid, // @[4-soc/src/main/scala/riscv/core/ICache.scala 66:14]
+  output        io_refill_request, // @[4-soc/src/main/scala/riscv/core/ICache.scala 66:14]
+  output [31:0] io_refill_address, // @[4-soc/src/main/scala/riscv/core/ICache.scala 66:14]
+  input  [31:0] io_refill_data, // @[4-soc/src/main/scala/riscv/core/ICache.scala 66:14]
+  input         io_refill_data_valid, // @[4-soc/src/main/scala/riscv/core/ICache.scala 66:14]
+  output        io_hit, // @[4-soc/src/main/scala/riscv/core/ICache.scala 66:14]
+  output        io_miss // @[4-soc/src/main/scala/riscv/core/ICache.scala 66:14]
+);
+  reg [31:0] data_0 [0:1023]; // @[4-soc/src/main/scala/riscv/core/ICache.scala 86:37]
+  reg [19:0] tags_0 [0:255]; // @[4-soc/src/main/scala/riscv/core/ICache.scala 87:20]
+  reg [255:0] valid_0; // @[4-soc/src/main/scala/riscv/core/ICache.scala 88:22]
+  reg  state; // @[4-soc/src/main/scala/riscv/core/ICache.scala 92:42]
+  reg [31:0] refill_address; // @[4-soc/src/main/scala/riscv/core/ICache.scala 93:42]
+  reg [1:0] beat; // @[4-soc/src/main/scala/riscv/core/ICache.scala 95:42]
+  wire [7:0] index = io_address[11:4]; // @[4-soc/src/main/scala/riscv/core/ICache.scala 98:28]
+  wire [19:0] tag = io_address[31:12]; // @[4-soc/src/main/scala/riscv/core/ICache.scala 99:28]
+  wire [1:0] word = io_address[3:2]; // @[4-soc/src/main/scala/riscv/core/ICache.scala 100:28]
+  wire  way_hit_0 = valid_0[index] & tags_0[index] == tag; // @[4-soc/src/main/scala/riscv/core/ICache.scala 101:78]
+  wire [31:0] hit_data = data_0[{index,word}]; // @[4-soc/src/main/scala/riscv/core/ICache.scala 103:42]
+  wire  lookup = io_enable & io_rom_instruction_valid & ~state; // @[4-soc/src/main/scala/riscv/core/ICache.scala 105:63]
+  wire  start_refill = lookup & ~way_hit_0; // @[4-soc/src/main/scala/riscv/core/ICache.scala 106:29]
+  wire [7:0] refill_index = refill_address[11:4]; // @[4-soc/src/main/scala/riscv/core/ICache.scala 122:36]
+  wire [19:0] refill_tag = refill_address[31:12]; // @[4-soc/src/main/scala/riscv/core/ICache.scala 123:36]
+  wire  refill_beat = state & io_refill_data_valid; // @[4-soc/src/main/scala/riscv/core/ICache.scala 124:27]
+  wire  last_beat = refill_beat & beat == 2'h3; // @[4-soc/src/main/scala/riscv/core/ICache.scala 131:15]
+  assign io_instruction = io_enable ? hit_data : io_rom_instruction; // @[4-soc/src/main/scala/riscv/core/ICache.scala 141:30]
+  assign io_instruction_valid = io_enable ? lookup & way_hit_0 : io_rom_instruction_valid; // @[4-soc/src/main/scala/riscv/core/ICache.scala 142:30]
+  assign io_refill_request = state; // @[4-soc/src/main/scala/riscv/core/ICache.scala 139:33]
+  assign io_refill_address = refill_address; // @[4-soc/src/main/scala/riscv/core/ICache.scala 140:24]
+  assign io_hit = lookup & way_hit_0 & io_fetch; // @[4-soc/src/main/scala/riscv/core/ICache.scala 144:35]
+  assign io_miss = start_refill; // @[4-soc/src/main/scala/riscv/core/ICache.scala 145:11]
+  always @(posedge clock) begin
+    if (refill_beat) begin // @[4-soc/src/main/scala/riscv/core/ICache.scala 124:50]
+      data_0[{refill_index,beat}] <= io_refill_data; // @[4-soc/src/main/scala/riscv/core/ICache.scala 127:35]
+    end
+    if (last_beat) begin // @[4-soc/src/main/scala/riscv/core/ICache.scala 131:40]
+      tags_0[refill_index] <= refill_tag; // @[4-soc/src/main/scala/riscv/core/ICache.scala 132:39]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/ICache.scala 88:22]
+      valid_0 <= 256'h0; // @[4-soc/src/main/scala/riscv/core/ICache.scala 88:22]
+    end else if (last_beat) begin // @[4-soc/src/main/scala/riscv/core/ICache.scala 131:40]
+      valid_0[refill_index] <= 1'h1; // @[4-soc/src/main/scala/riscv/core/ICache.scala 133:39]
+    end else if (start_refill) begin // @[4-soc/src/main/scala/riscv/core/ICache.scala 114:22]
+      valid_0[index] <= 1'h0; // @[4-soc/src/main/scala/riscv/core/ICache.scala 119:26]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/ICache.scala 92:42]
+      state <= 1'h0; // @[4-soc/src/main/scala/riscv/core/ICache.scala 92:42]
+    end else if (last_beat) begin // @[4-soc/src/main/scala/riscv/core/ICache.scala 131:40]
+      state <= 1'h0; // @[4-soc/src/main/scala/riscv/core/ICache.scala 135:39]
+    end else if (start_refill) begin // @[4-soc/src/main/scala/riscv/core/ICache.scala 114:22]
+      state <= 1'h1; // @[4-soc/src/main/scala/riscv/core/ICache.scala 115:26]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/ICache.scala 93:42]
+      refill_address <= 32'h0; // @[4-soc/src/main/scala/riscv/core/ICache.scala 93:42]
+    end else if (start_refill) begin // @[4-soc/src/main/scala/riscv/core/ICache.scala 114:22]
+      refill_address <= {io_address[31:4], 4'h0}; // @[4-soc/src/main/scala/riscv/core/ICache.scala 116:26]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/ICache.scala 95:42]
+      beat <= 2'h0; // @[4-soc/src/main/scala/riscv/core/ICache.scala 95:42]
+    end else if (start_refill) begin // @[4-soc/src/main/scala/riscv/core/ICache.scala 114:22]
+      beat <= 2'h0; // @[4-soc/src/main/scala/riscv/core/ICache.scala 118:26]
+    end else if (refill_beat) begin // @[4-soc/src/main/scala/riscv/core/ICache.scala 124:50]
+      beat <= beat + 2'h1; // @[4-soc/src/main/scala/riscv/core/ICache.scala 130:10]
+    end
+  end
+endmodule
+module DCache(
+  input         clock,
+  input         reset,
+  input         io_enable, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  input  [31:0] io_cpu_address, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  input         io_cpu_read, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  output [31:0] io_cpu_read_data, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  output        io_cpu_read_valid, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  input         io_cpu_write, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  input  [31:0] io_cpu_write_data, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  input         io_cpu_write_strobe_0, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  input         io_cpu_write_strobe_1, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  input         io_cpu_write_strobe_2, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  input         io_cpu_write_strobe_3, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  output        io_cpu_write_valid, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  input         io_cpu_request, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  output        io_cpu_granted, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  output [31:0] io_mem_address, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  output        io_mem_read, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  input  [31:0] io_mem_read_data, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  input         io_mem_read_valid, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  output        io_mem_write, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  output [31:0] io_mem_write_data, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  output        io_mem_write_strobe_0, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  output        io_mem_write_strobe_1, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  output        io_mem_write_strobe_2, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  output        io_mem_write_strobe_3, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  input         io_mem_write_valid, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  input         io_mem_busy, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  output        io_mem_request, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  input         io_mem_granted, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  output        io_hit, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  output        io_miss, // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
+  output        io_write_back // @[4-soc/src/main/scala/riscv/core/DCache.scala 68:14]
 );
 `ifdef RANDOMIZE_REG_INIT
   reg [31:0] _RAND_0;
   reg [31:0] _RAND_1;
+  reg [31:0] _RAND_2;
+  reg [31:0] _RAND_3;
+  reg [31:0] _RAND_4;
+  reg [31:0] _RAND_5;
+  reg [31:0] _RAND_6;
+  reg [31:0] _RAND_7;
+  reg [31:0] _RAND_8;
+  reg [31:0] _RAND_9;
 `endif // RANDOMIZE_REG_INIT
-  wire  ctrl_io_jump_flag; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
-  wire  ctrl_io_jump_instruction_id; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
-  wire [4:0] ctrl_io_rs1_id; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
-  wire [4:0] ctrl_io_rs2_id; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
-  wire  ctrl_io_memory_read_enable_ex; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
-  wire [4:0] ctrl_io_rd_ex; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
-  wire  ctrl_io_memory_read_enable_mem; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
-  wire [4:0] ctrl_io_rd_mem; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
-  wire  ctrl_io_memory_write_enable_mem; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
-  wire [1:0] ctrl_io_regs_write_source_ex; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
-  wire [1:0] ctrl_io_regs_write_source_mem; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
-  wire [1:0] ctrl_io_regs_write_source_wb; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
-  wire [4:0] ctrl_io_rd_wb; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
-  wire  ctrl_io_if_flush; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
-  wire  ctrl_io_id_flush; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
-  wire  ctrl_io_pc_stall; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
-  wire  ctrl_io_if_stall; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
-  wire  ctrl_io_branch_hazard; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
-  wire  ctrl_io_jal_jalr_hazard; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
-  wire  regs_clock; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
-  wire  regs_reset; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
-  wire  regs_io_write_enable; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
-  wire [4:0] regs_io_write_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
-  wire [31:0] regs_io_write_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
-  wire [4:0] regs_io_read_address1; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
-  wire [4:0] regs_io_read_address2; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
-  wire [31:0] regs_io_read_data1; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
-  wire [31:0] regs_io_read_data2; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
-  wire [4:0] regs_io_debug_read_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
-  wire [31:0] regs_io_debug_read_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
-  wire  inst_fetch_clock; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire  inst_fetch_reset; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire  inst_fetch_io_stall_flag_ctrl; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire  inst_fetch_io_jump_flag_id; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire [31:0] inst_fetch_io_jump_address_id; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire [31:0] inst_fetch_io_rom_instruction; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire  inst_fetch_io_instruction_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire  inst_fetch_io_btb_mispredict; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire [31:0] inst_fetch_io_btb_correction_addr; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire  inst_fetch_io_btb_correct_prediction; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire [31:0] inst_fetch_io_instruction_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire [31:0] inst_fetch_io_id_instruction; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire  inst_fetch_io_btb_predicted_taken; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire [31:0] inst_fetch_io_btb_predicted_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire  inst_fetch_io_btb_update_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire [31:0] inst_fetch_io_btb_update_pc; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire [31:0] inst_fetch_io_btb_update_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire  inst_fetch_io_btb_update_taken; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire  inst_fetch_io_ras_predicted_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire [31:0] inst_fetch_io_ras_predicted_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire  inst_fetch_io_ras_push; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire [31:0] inst_fetch_io_ras_push_addr; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire  inst_fetch_io_ibtb_predicted_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire [31:0] inst_fetch_io_ibtb_predicted_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire  inst_fetch_io_ibtb_update_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire [31:0] inst_fetch_io_ibtb_update_pc; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire [7:0] inst_fetch_io_ibtb_update_rs1_hash; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire [31:0] inst_fetch_io_ibtb_update_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
-  wire  if2id_clock; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
-  wire  if2id_reset; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
-  wire  if2id_io_stall; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
-  wire  if2id_io_flush; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
-  wire [31:0] if2id_io_instruction; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
-  wire [31:0] if2id_io_instruction_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
-  wire [31:0] if2id_io_interrupt_flag; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
-  wire  if2id_io_btb_predicted_taken; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
-  wire [31:0] if2id_io_btb_predicted_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
-  wire  if2id_io_ras_predicted_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
-  wire [31:0] if2id_io_ras_predicted_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
-  wire  if2id_io_ibtb_predicted_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
-  wire [31:0] if2id_io_ibtb_predicted_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
-  wire [31:0] if2id_io_output_instruction; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
-  wire [31:0] if2id_io_output_instruction_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
-  wire  if2id_io_output_btb_predicted_taken; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
-  wire [31:0] if2id_io_output_btb_predicted_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
-  wire  if2id_io_output_ras_predicted_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
-  wire [31:0] if2id_io_output_ras_predicted_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
+  reg [31:0] data_0 [0:1023]; // @[4-soc/src/main/scala/riscv/core/DCache.scala 79:37]
+  reg [19:0] tags_0 [0:255]; // @[4-soc/src/main/scala/riscv/core/DCache.scala 80:20]
+  reg [255:0] valid_0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 81:22]
+  reg [255:0] dirty_0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 82:22]
+  reg [2:0] state; // @[4-soc/src/main/scala/riscv/core/DCache.scala 86:79]
+  reg [31:0] op_address; // @[4-soc/src/main/scala/riscv/core/DCache.scala 90:27]
+  reg  op_write; // @[4-soc/src/main/scala/riscv/core/DCache.scala 91:27]
+  reg [31:0] op_data; // @[4-soc/src/main/scala/riscv/core/DCache.scala 92:27]
+  reg [3:0] op_strobe; // @[4-soc/src/main/scala/riscv/core/DCache.scala 93:27]
+  reg [31:0] line_address; // @[4-soc/src/main/scala/riscv/core/DCache.scala 96:29]
+  reg [1:0] beat; // @[4-soc/src/main/scala/riscv/core/DCache.scala 98:29]
+  reg  issued; // @[4-soc/src/main/scala/riscv/core/DCache.scala 99:29]
+  reg  flushing; // @[4-soc/src/main/scala/riscv/core/DCache.scala 100:29]
+  reg [7:0] flush_set; // @[4-soc/src/main/scala/riscv/core/DCache.scala 101:29]
+  wire [7:0] index = io_cpu_address[11:4]; // @[4-soc/src/main/scala/riscv/core/DCache.scala 103:46]
+  wire  way_hit_0 = valid_0[index] & tags_0[index] == io_cpu_address[31:12]; // @[4-soc/src/main/scala/riscv/core/DCache.scala 123:88]
+  wire [31:0] hit_data = data_0[{index,io_cpu_address[3:2]}]; // @[4-soc/src/main/scala/riscv/core/DCache.scala 126:59]
+  wire  request = io_cpu_request & (io_cpu_read | io_cpu_write); // @[4-soc/src/main/scala/riscv/core/DCache.scala 128:32]
+  wire  slave0 = io_cpu_address[31:29] == 3'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 129:95]
+  wire  mailbox = io_cpu_address[31:12] == 20'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 130:81]
+  wire  cached = io_enable & slave0 & ~mailbox; // @[4-soc/src/main/scala/riscv/core/DCache.scala 131:39]
+  wire  flush = io_enable & mailbox & io_cpu_write; // @[4-soc/src/main/scala/riscv/core/DCache.scala 132:38]
+  wire  idle = state == 3'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 193:17]
+  wire  quiet = ~io_mem_busy; // @[4-soc/src/main/scala/riscv/core/DCache.scala 198:19]
+  wire  hit_access = idle & request & cached & way_hit_0 & quiet; // @[4-soc/src/main/scala/riscv/core/DCache.scala 205:45]
+  wire  miss_access = idle & request & cached & ~way_hit_0 & quiet; // @[4-soc/src/main/scala/riscv/core/DCache.scala 221:20]
+  wire  flush_access = idle & request & flush & quiet; // @[4-soc/src/main/scala/riscv/core/DCache.scala 237:20]
+  wire  intercept = idle & request & (cached | flush); // @[4-soc/src/main/scala/riscv/core/DCache.scala 195:24]
+  wire  in_write_back = state == 3'h1; // @[4-soc/src/main/scala/riscv/core/DCache.scala 193:17]
+  wire  in_refill = state == 3'h2; // @[4-soc/src/main/scala/riscv/core/DCache.scala 193:17]
+  wire  in_respond = state == 3'h3; // @[4-soc/src/main/scala/riscv/core/DCache.scala 193:17]
+  wire  in_flush = state == 3'h4; // @[4-soc/src/main/scala/riscv/core/DCache.scala 193:17]
+  wire  in_uncached = state == 3'h5; // @[4-soc/src/main/scala/riscv/core/DCache.scala 193:17]
+  wire  transferring = in_write_back | in_refill | in_uncached; // @[4-soc/src/main/scala/riscv/core/DCache.scala 193:17]
+  wire  transfer_write = in_write_back | in_uncached; // @[4-soc/src/main/scala/riscv/core/DCache.scala 193:17]
+  wire  transfer_done = issued & (transfer_write ? io_mem_write_valid : io_mem_read_valid); // @[4-soc/src/main/scala/riscv/core/DCache.scala 163:24]
+  wire [31:0] beat_address = {line_address[31:4],beat,2'h0}; // @[4-soc/src/main/scala/riscv/core/DCache.scala 190:25]
+  wire  last_beat = beat == 2'h3; // @[4-soc/src/main/scala/riscv/core/DCache.scala 191:25]
+  wire [7:0] line_index = line_address[11:4]; // @[4-soc/src/main/scala/riscv/core/DCache.scala 103:46]
+  wire [31:0] wb_data = data_0[{line_index,beat}]; // @[4-soc/src/main/scala/riscv/core/DCache.scala 243:41]
+  wire  wb_last = in_write_back & transfer_done & last_beat; // @[4-soc/src/main/scala/riscv/core/DCache.scala 246:23]
+  wire  refill_beat = in_refill & transfer_done; // @[4-soc/src/main/scala/riscv/core/DCache.scala 257:50]
+  wire  refill_last = refill_beat & last_beat; // @[4-soc/src/main/scala/riscv/core/DCache.scala 260:23]
+  wire [7:0] op_index = op_address[11:4]; // @[4-soc/src/main/scala/riscv/core/DCache.scala 270:38]
+  wire [31:0] op_word = data_0[{op_index,op_address[3:2]}]; // @[4-soc/src/main/scala/riscv/core/DCache.scala 271:52]
+  wire  victim_dirty = valid_0[index] & dirty_0[index]; // @[4-soc/src/main/scala/riscv/core/DCache.scala 222:37]
+  wire  flush_dirty = valid_0[flush_set] & dirty_0[flush_set]; // @[4-soc/src/main/scala/riscv/core/DCache.scala 288:38]
+  wire  flush_next = in_flush & ~flush_dirty; // @[4-soc/src/main/scala/riscv/core/DCache.scala 288:61]
+  wire  flush_end = flush_next & flush_set == 8'hff; // @[4-soc/src/main/scala/riscv/core/DCache.scala 297:27]
+  wire  hit_write = hit_access & io_cpu_write; // @[4-soc/src/main/scala/riscv/core/DCache.scala 204:28]
+  wire [31:0] hit_merged = {io_cpu_write_strobe_3 ? io_cpu_write_data[31:24] : hit_data[31:24],
+    io_cpu_write_strobe_2 ? io_cpu_write_data[23:16] : hit_data[23:16],
+    io_cpu_write_strobe_1 ? io_cpu_write_data[15:8] : hit_data[15:8],
+    io_cpu_write_strobe_0 ? io_cpu_write_data[7:0] : hit_data[7:0]}; // @[4-soc/src/main/scala/riscv/core/DCache.scala 111:8]
+  wire  respond_write = in_respond & op_write; // @[4-soc/src/main/scala/riscv/core/DCache.scala 272:22]
+  wire [31:0] op_merged = {op_strobe[3] ? op_data[31:24] : op_word[31:24],op_strobe[2] ? op_data[23:16] : op_word[23:16],
+    op_strobe[1] ? op_data[15:8] : op_word[15:8],op_strobe[0] ? op_data[7:0] : op_word[7:0]}; // @[4-soc/src/main/scala/riscv/core/DCache.scala 111:8]
+  assign io_cpu_read_data = hit_access & ~io_cpu_write ? hit_data : in_respond & ~op_write ? op_word : io_mem_read_data; // @[4-soc/src/main/scala/riscv/core/DCache.scala 141:30 209:27 277:27]
+  assign io_cpu_read_valid = idle ? hit_access & ~io_cpu_write | ~hit_access & io_mem_read_valid : in_respond & ~op_write; // @[4-soc/src/main/scala/riscv/core/DCache.scala 142:30 183:32 210:27 278:27]
+  assign io_cpu_write_valid = idle ? hit_write | io_mem_write_valid : respond_write | in_uncached & transfer_done; // @[4-soc/src/main/scala/riscv/core/DCache.scala 143:30 184:32 207:31 275:28 312:28]
+  assign io_cpu_granted = idle & (hit_access | miss_access | flush_access | ~intercept & io_mem_granted); // @[4-soc/src/main/scala/riscv/core/DCache.scala 146:30 187:32 202:24 206:24 225:26 239:26]
+  assign io_mem_address = in_write_back | in_refill ? beat_address : in_uncached ? op_address : io_cpu_address; // @[4-soc/src/main/scala/riscv/core/DCache.scala 135:30 157:25]
+  assign io_mem_read = idle ? io_cpu_read & ~intercept : in_refill & ~issued; // @[4-soc/src/main/scala/riscv/core/DCache.scala 136:30 155:25 181:32 197:24]
+  assign io_mem_write_data = in_write_back ? wb_data : in_uncached ? op_data : io_cpu_write_data; // @[4-soc/src/main/scala/riscv/core/DCache.scala 138:30 158:25]
+  assign io_mem_write_strobe_0 = in_uncached ? op_strobe[0] : transferring | io_cpu_write_strobe_0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 139:30 159:25 310:27]
+  assign io_mem_write_strobe_1 = in_uncached ? op_strobe[1] : transferring | io_cpu_write_strobe_1; // @[4-soc/src/main/scala/riscv/core/DCache.scala 139:30 159:25 310:27]
+  assign io_mem_write_strobe_2 = in_uncached ? op_strobe[2] : transferring | io_cpu_write_strobe_2; // @[4-soc/src/main/scala/riscv/core/DCache.scala 139:30 159:25 310:27]
+  assign io_mem_write_strobe_3 = in_uncached ? op_strobe[3] : transferring | io_cpu_write_strobe_3; // @[4-soc/src/main/scala/riscv/core/DCache.scala 139:30 159:25 310:27]
+  assign io_mem_write = idle ? io_cpu_write & ~intercept : transfer_write & ~issued; // @[4-soc/src/main/scala/riscv/core/DCache.scala 137:30 156:25 182:32 198:24]
+  assign io_mem_request = idle ? io_cpu_request & ~intercept : transferring & ~issued; // @[4-soc/src/main/scala/riscv/core/DCache.scala 140:30 154:25 180:32 196:24]
+  assign io_hit = hit_access; // @[4-soc/src/main/scala/riscv/core/DCache.scala 148:14 203:24]
+  assign io_miss = miss_access; // @[4-soc/src/main/scala/riscv/core/DCache.scala 149:14 220:17]
+  assign io_write_back = wb_last; // @[4-soc/src/main/scala/riscv/core/DCache.scala 150:17 247:32]
+  always @(posedge clock) begin
+    if (hit_write) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 204:28]
+      data_0[{index,io_cpu_address[3:2]}] <= hit_merged; // @[4-soc/src/main/scala/riscv/core/DCache.scala 116:33]
+    end
+    if (refill_beat) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 257:50]
+      data_0[{line_index,beat}] <= io_mem_read_data; // @[4-soc/src/main/scala/riscv/core/DCache.scala 116:33]
+    end
+    if (respond_write) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 272:22]
+      data_0[{op_index,op_address[3:2]}] <= op_merged; // @[4-soc/src/main/scala/riscv/core/DCache.scala 116:33]
+    end
+    if (refill_last) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 260:23]
+      tags_0[line_index] <= line_address[31:12]; // @[4-soc/src/main/scala/riscv/core/DCache.scala 261:44]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 81:22]
+      valid_0 <= 256'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 81:22]
+    end else if (wb_last) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 246:23]
+      valid_0[line_index] <= 1'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 248:32]
+    end else if (refill_last) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 260:23]
+      valid_0[line_index] <= 1'h1; // @[4-soc/src/main/scala/riscv/core/DCache.scala 262:44]
+    end else if (flush_next) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 292:19]
+      valid_0[flush_set] <= 1'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 293:31]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 82:22]
+      dirty_0 <= 256'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 82:22]
+    end else if (hit_write) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 204:28]
+      dirty_0[index] <= 1'h1; // @[4-soc/src/main/scala/riscv/core/DCache.scala 206:33]
+    end else if (wb_last) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 246:23]
+      dirty_0[line_index] <= 1'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 249:32]
+    end else if (respond_write) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 272:22]
+      dirty_0[op_index] <= 1'h1; // @[4-soc/src/main/scala/riscv/core/DCache.scala 274:30]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 86:79]
+      state <= 3'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 86:79]
+    end else if (miss_access) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 216:28]
+      if (victim_dirty) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 222:60]
+        state <= 3'h1; // @[4-soc/src/main/scala/riscv/core/DCache.scala 224:24]
+      end else begin
+        state <= 3'h2; // @[4-soc/src/main/scala/riscv/core/DCache.scala 227:24]
+      end
+    end else if (flush_access) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 231:28]
+      state <= 3'h4; // @[4-soc/src/main/scala/riscv/core/DCache.scala 236:19]
+    end else if (wb_last) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 246:23]
+      if (flushing) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 251:36]
+        state <= 3'h4; // @[4-soc/src/main/scala/riscv/core/DCache.scala 251:30]
+      end else begin
+        state <= 3'h2; // @[4-soc/src/main/scala/riscv/core/DCache.scala 251:30]
+      end
+    end else if (refill_last) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 260:23]
+      state <= 3'h3; // @[4-soc/src/main/scala/riscv/core/DCache.scala 263:44]
+    end else if (in_respond) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 193:17]
+      state <= 3'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 283:13]
+    end else if (in_flush & flush_dirty) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 288:61]
+      state <= 3'h1; // @[4-soc/src/main/scala/riscv/core/DCache.scala 291:22]
+    end else if (flush_end) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 297:47]
+      state <= 3'h5; // @[4-soc/src/main/scala/riscv/core/DCache.scala 299:22]
+    end else if (in_uncached & transfer_done) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 311:18]
+      state <= 3'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 313:28]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 90:27]
+      op_address <= 32'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 90:27]
+      op_write <= 1'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 91:27]
+      op_data <= 32'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 92:27]
+      op_strobe <= 4'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 93:27]
+    end else if (miss_access | flush_access) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 219:15 232:15]
+      op_address <= io_cpu_address; // @[4-soc/src/main/scala/riscv/core/DCache.scala 171:16]
+      op_write <= io_cpu_write; // @[4-soc/src/main/scala/riscv/core/DCache.scala 172:16]
+      op_data <= io_cpu_write_data; // @[4-soc/src/main/scala/riscv/core/DCache.scala 173:16]
+      op_strobe <= {io_cpu_write_strobe_3,io_cpu_write_strobe_2,io_cpu_write_strobe_1,io_cpu_write_strobe_0}; // @[4-soc/src/main/scala/riscv/core/DCache.scala 174:16]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 96:29]
+      line_address <= 32'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 96:29]
+    end else if (miss_access) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 216:28]
+      if (victim_dirty) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 222:60]
+        line_address <= {tags_0[index],index,4'h0}; // @[4-soc/src/main/scala/riscv/core/DCache.scala 223:24]
+      end else begin
+        line_address <= {io_cpu_address[31:4],4'h0}; // @[4-soc/src/main/scala/riscv/core/DCache.scala 226:24]
+      end
+    end else if (wb_last) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 246:23]
+      line_address <= {op_address[31:4],4'h0}; // @[4-soc/src/main/scala/riscv/core/DCache.scala 250:32]
+    end else if (in_flush & flush_dirty) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 288:61]
+      line_address <= {tags_0[flush_set],flush_set,4'h0}; // @[4-soc/src/main/scala/riscv/core/DCache.scala 289:22]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 98:29]
+      beat <= 2'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 98:29]
+    end else if (miss_access | flush_access | in_flush) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 175:16 290:22]
+      beat <= 2'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 175:16]
+    end else if (transfer_done & ~in_uncached) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 244:62 257:50]
+      beat <= beat + 2'h1; // @[4-soc/src/main/scala/riscv/core/DCache.scala 245:22]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 99:29]
+      issued <= 1'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 99:29]
+    end else if (miss_access | flush_access | transfer_done) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 164:16]
+      issued <= 1'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 165:14]
+    end else if (transferring & ~issued & io_mem_granted) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 160:36]
+      issued <= 1'h1; // @[4-soc/src/main/scala/riscv/core/DCache.scala 161:14]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 100:29]
+      flushing <= 1'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 100:29]
+    end else if (flush_access) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 231:28]
+      flushing <= 1'h1; // @[4-soc/src/main/scala/riscv/core/DCache.scala 235:19]
+    end else if (flush_end) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 297:47]
+      flushing <= 1'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 298:22]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 101:29]
+      flush_set <= 8'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 101:29]
+    end else if (flush_access) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 231:28]
+      flush_set <= 8'h0; // @[4-soc/src/main/scala/riscv/core/DCache.scala 234:19]
+    end else if (flush_next) begin // @[4-soc/src/main/scala/riscv/core/DCache.scala 294:36]
+      flush_set <= flush_set + 8'h1; // @[4-soc/src/main/scala/riscv/core/DCache.scala 296:21]
+    end
+  end
+// Register and memory initialization
+`ifdef RANDOMIZE_GARBAGE_ASSIGN
+`define RANDOMIZE
+`endif
+`ifdef RANDOMIZE_INVALID_ASSIGN
+`define RANDOMIZE
+`endif
+`ifdef RANDOMIZE_REG_INIT
+`define RANDOMIZE
+`endif
+`ifdef RANDOMIZE_MEM_INIT
+`define RANDOMIZE
+`endif
+`ifndef RANDOM
+`define RANDOM $random
+`endif
+`ifdef RANDOMIZE_MEM_INIT
+  integer initvar;
+`endif
+`ifndef SYNTHESIS
+`ifdef FIRRTL_BEFORE_INITIAL
+`FIRRTL_BEFORE_INITIAL
+`endif
+initial begin
+  `ifdef RANDOMIZE
+    `ifdef INIT_RANDOM
+      `INIT_RANDOM
+    `endif
+    `ifndef VERILATOR
+      `ifdef RANDOMIZE_DELAY
+        #`RANDOMIZE_DELAY begin end
+      `else
+        #0.002 begin end
+      `endif
+    `endif
+`ifdef RANDOMIZE_REG_INIT
+  _RAND_0 = {1{`RANDOM}};
+  state = _RAND_0[2:0];
+  _RAND_1 = {1{`RANDOM}};
+  op_address = _RAND_1[31:0];
+  _RAND_2 = {1{`RANDOM}};
+  op_write = _RAND_2[0:0];
+  _RAND_3 = {1{`RANDOM}};
+  op_data = _RAND_3[31:0];
+  _RAND_4 = {1{`RANDOM}};
+  op_strobe = _RAND_4[3:0];
+  _RAND_5 = {1{`RANDOM}};
+  line_address = _RAND_5[31:0];
+  _RAND_6 = {1{`RANDOM}};
+  beat = _RAND_6[1:0];
+  _RAND_7 = {1{`RANDOM}};
+  issued = _RAND_7[0:0];
+  _RAND_8 = {1{`RANDOM}};
+  flushing = _RAND_8[0:0];
+  _RAND_9 = {1{`RANDOM}};
+  flush_set = _RAND_9[7:0];
+`endif // RANDOMIZE_REG_INIT
+  `endif // RANDOMIZE
+end // initial
+`ifdef FIRRTL_AFTER_INITIAL
+`FIRRTL_AFTER_INITIAL
+`endif
+`endif // SYNTHESIS
+endmodule
+module DataTCM(
+  input         clock,
+  input  [31:0] io_address, // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 46:14]
+  output        io_select, // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 46:14]
+  output [31:0] io_read_data, // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 46:14]
+  input         io_write, // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 46:14]
+  input  [31:0] io_write_data, // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 46:14]
+  input         io_write_strobe_0, // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 46:14]
+  input         io_write_strobe_1, // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 46:14]
+  input         io_write_strobe_2, // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 46:14]
+  input         io_write_strobe_3 // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 46:14]
+);
+`ifdef RANDOMIZE_MEM_INIT
+  reg [31:0] _RAND_0;
+  reg [31:0] _RAND_1;
+  reg [31:0] _RAND_2;
+  reg [31:0] _RAND_3;
+`endif // RANDOMIZE_MEM_INIT
+  reg [7:0] ram_0 [0:8191]; // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 49:22]
+  reg [7:0] ram_1 [0:8191]; // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 49:22]
+  reg [7:0] ram_2 [0:8191]; // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 49:22]
+  reg [7:0] ram_3 [0:8191]; // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 49:22]
+  wire [12:0] index = io_address[14:2]; // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 50:28]
+  wire [7:0] ram_0_io_read_data_MPORT_data = ram_0[index]; // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 49:22]
+  wire [7:0] ram_1_io_read_data_MPORT_data = ram_1[index]; // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 49:22]
+  wire [7:0] ram_2_io_read_data_MPORT_data = ram_2[index]; // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 49:22]
+  wire [7:0] ram_3_io_read_data_MPORT_data = ram_3[index]; // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 49:22]
+  wire  write_en = io_select & io_write; // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 55:21]
+  assign io_select = io_address[31:15] == 17'hc000; // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 52:55]
+  assign io_read_data = {ram_3_io_read_data_MPORT_data,ram_2_io_read_data_MPORT_data,ram_1_io_read_data_MPORT_data,
+    ram_0_io_read_data_MPORT_data}; // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 53:36]
+  always @(posedge clock) begin
+    if (write_en & io_write_strobe_0) begin
+      ram_0[index] <= io_write_data[7:0]; // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 49:22]
+    end
+    if (write_en & io_write_strobe_1) begin
+      ram_1[index] <= io_write_data[15:8]; // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 49:22]
+    end
+    if (write_en & io_write_strobe_2) begin
+      ram_2[index] <= io_write_data[23:16]; // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 49:22]
+    end
+    if (write_en & io_write_strobe_3) begin
+      ram_3[index] <= io_write_data[31:24]; // @[4-soc/src/main/scala/riscv/core/DataTCM.scala 49:22]
+    end
+  end
+// Register and memory initialization
+`ifdef RANDOMIZE_GARBAGE_ASSIGN
+`define RANDOMIZE
+`endif
+`ifdef RANDOMIZE_INVALID_ASSIGN
+`define RANDOMIZE
+`endif
+`ifdef RANDOMIZE_REG_INIT
+`define RANDOMIZE
+`endif
+`ifdef RANDOMIZE_MEM_INIT
+`define RANDOMIZE
+`endif
+`ifndef RANDOM
+`define RANDOM $random
+`endif
+`ifdef RANDOMIZE_MEM_INIT
+  integer initvar;
+`endif
+`ifndef SYNTHESIS
+`ifdef FIRRTL_BEFORE_INITIAL
+`FIRRTL_BEFORE_INITIAL
+`endif
+initial begin
+  `ifdef RANDOMIZE
+    `ifdef INIT_RANDOM
+      `INIT_RANDOM
+    `endif
+    `ifndef VERILATOR
+      `ifdef RANDOMIZE_DELAY
+        #`RANDOMIZE_DELAY begin end
+      `else
+        #0.002 begin end
+      `endif
+    `endif
+`ifdef RANDOMIZE_MEM_INIT
+  _RAND_0 = {1{`RANDOM}};
+  _RAND_1 = {1{`RANDOM}};
+  _RAND_2 = {1{`RANDOM}};
+  _RAND_3 = {1{`RANDOM}};
+  for (initvar = 0; initvar < 8192; initvar = initvar+1)
+    ram_0[initvar] = _RAND_0[7:0];
+  for (initvar = 0; initvar < 8192; initvar = initvar+1)
+    ram_1[initvar] = _RAND_1[7:0];
+  for (initvar = 0; initvar < 8192; initvar = initvar+1)
+    ram_2[initvar] = _RAND_2[7:0];
+  for (initvar = 0; initvar < 8192; initvar = initvar+1)
+    ram_3[initvar] = _RAND_3[7:0];
+`endif // RANDOMIZE_MEM_INIT
+  `endif // RANDOMIZE
+end // initial
+`ifdef FIRRTL_AFTER_INITIAL
+`FIRRTL_AFTER_INITIAL
+`endif
+`endif // SYNTHESIS
+endmodule
+module StoreBuffer(
+  input         clock,
+  input         reset,
+  input  [31:0] io_cpu_address, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  input         io_cpu_read, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  output [31:0] io_cpu_read_data, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  output        io_cpu_read_valid, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  input         io_cpu_write, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  input  [31:0] io_cpu_write_data, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  input         io_cpu_write_strobe_0, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  input         io_cpu_write_strobe_1, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  input         io_cpu_write_strobe_2, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  input         io_cpu_write_strobe_3, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  output        io_cpu_write_valid, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  input         io_cpu_request, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  output        io_cpu_granted, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  output [31:0] io_mem_address, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  output        io_mem_read, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  input  [31:0] io_mem_read_data, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  input         io_mem_read_valid, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  output        io_mem_write, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  output [31:0] io_mem_write_data, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  output        io_mem_write_strobe_0, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  output        io_mem_write_strobe_1, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  output        io_mem_write_strobe_2, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  output        io_mem_write_strobe_3, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  input         io_mem_write_valid, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  output        io_mem_request, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  input         io_mem_granted, // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+  output        io_full_stall // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 44:14]
+);
+`ifdef RANDOMIZE_REG_INIT
+  reg [31:0] _RAND_0;
+  reg [31:0] _RAND_1;
+  reg [31:0] _RAND_2;
+  reg [31:0] _RAND_3;
+  reg [31:0] _RAND_4;
+  reg [31:0] _RAND_5;
+  reg [31:0] _RAND_6;
+  reg [31:0] _RAND_7;
+  reg [31:0] _RAND_8;
+  reg [31:0] _RAND_9;
+  reg [31:0] _RAND_10;
+  reg [31:0] _RAND_11;
+  reg [31:0] _RAND_12;
+  reg [31:0] _RAND_13;
+  reg [31:0] _RAND_14;
+`endif // RANDOMIZE_REG_INIT
+  reg [31:0] entries_0_address; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 51:20]
+  reg [31:0] entries_0_data; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 51:20]
+  reg [3:0] entries_0_strobe; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 51:20]
+  reg [31:0] entries_1_address; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 51:20]
+  reg [31:0] entries_1_data; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 51:20]
+  reg [3:0] entries_1_strobe; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 51:20]
+  reg [31:0] entries_2_address; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 51:20]
+  reg [31:0] entries_2_data; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 51:20]
+  reg [3:0] entries_2_strobe; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 51:20]
+  reg [31:0] entries_3_address; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 51:20]
+  reg [31:0] entries_3_data; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 51:20]
+  reg [3:0] entries_3_strobe; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 51:20]
+  reg [2:0] count; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 52:24]
+  reg [2:0] inflight; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 56:27]
+  reg  loading; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 57:27]
+  wire  empty = count == 3'h0; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 56:21]
+  wire  full = count == 3'h4; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 57:21]
+  wire  live_0 = 3'h0 < count; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 58:55]
+  wire  live_1 = 3'h1 < count; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 58:55]
+  wire  live_2 = 3'h2 < count; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 58:55]
+  wire  live_3 = 3'h3 < count; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 58:55]
+  wire  load = io_cpu_request & io_cpu_read & ~loading; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 66:47]
+  wire  store = io_cpu_request & io_cpu_write; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 67:32]
+  wire  matches_0 = live_0 & entries_0_address[31:2] == io_cpu_address[31:2]; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 70:73]
+  wire  matches_1 = live_1 & entries_1_address[31:2] == io_cpu_address[31:2]; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 70:73]
+  wire  matches_2 = live_2 & entries_2_address[31:2] == io_cpu_address[31:2]; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 70:73]
+  wire  matches_3 = live_3 & entries_3_address[31:2] == io_cpu_address[31:2]; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 70:73]
+  wire  _barrier_T_1 = entries_0_address[31:29] == 3'h0 & entries_0_address[31:12] != 20'h0; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 62:92]
+  wire  _barrier_T_3 = entries_1_address[31:29] == 3'h0 & entries_1_address[31:12] != 20'h0; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 62:92]
+  wire  _barrier_T_5 = entries_2_address[31:29] == 3'h0 & entries_2_address[31:12] != 20'h0; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 62:92]
+  wire  _barrier_T_7 = entries_3_address[31:29] == 3'h0 & entries_3_address[31:12] != 20'h0; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 62:92]
+  wire  barrier = live_0 & ~_barrier_T_1 | live_1 & ~_barrier_T_3 | live_2 & ~_barrier_T_5 | live_3 & ~_barrier_T_7; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 71:99]
+  wire [31:0] youngest_data = matches_3 ? entries_3_data : matches_2 ? entries_2_data : matches_1 ? entries_1_data :
+    entries_0_data; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 72:28]
+  wire [3:0] youngest_strobe = matches_3 ? entries_3_strobe : matches_2 ? entries_2_strobe : matches_1 ? entries_1_strobe
+     : entries_0_strobe; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 72:28]
+  wire  ordered = ~(io_cpu_address[31:29] == 3'h0 & io_cpu_address[31:12] != 20'h0) | barrier; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 73:41]
+  wire  _forward_T_2 = |{matches_3,matches_2,matches_1,matches_0}; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 74:52]
+  wire  forward = load & ~ordered & _forward_T_2 & &youngest_strobe; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 74:56]
+  wire  bypass = load & (empty | ~ordered & ~_forward_T_2); // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 78:25]
+  wire [31:0] next_address = 3'h3 == inflight ? entries_3_address : 3'h2 == inflight ? entries_2_address : 3'h1 ==
+    inflight ? entries_1_address : entries_0_address; // @[src/main/scala/chisel3/util/Mux.scala 81:58]
+  wire [31:0] next_data = 3'h3 == inflight ? entries_3_data : 3'h2 == inflight ? entries_2_data : 3'h1 == inflight ?
+    entries_1_data : entries_0_data; // @[src/main/scala/chisel3/util/Mux.scala 81:58]
+  wire [3:0] next_strobe = 3'h3 == inflight ? entries_3_strobe : 3'h2 == inflight ? entries_2_strobe : 3'h1 ==
+    inflight ? entries_1_strobe : entries_0_strobe; // @[src/main/scala/chisel3/util/Mux.scala 81:58]
+  wire  drain = inflight != count & ~loading; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 82:38]
+  wire  _T = bypass | loading; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 92:15]
+  wire  _GEN_9 = _T ? io_cpu_request : drain; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 83:30 92:27 98:25]
+  wire  _GEN_8 = _T ? 1'h0 : drain; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 80:30 92:27 96:25]
+  wire  issue = _GEN_9 & _GEN_8 & io_mem_granted; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 119:50]
+  wire  dequeue = io_mem_write_valid & (inflight != 3'h0 | issue); // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 120:36]
+  wire [2:0] _inflight_T_1 = inflight + {{2'd0}, issue}; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 121:24]
+  wire [2:0] _inflight_T_3 = _inflight_T_1 - {{2'd0}, dequeue}; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 121:40]
+  wire  enqueue = store & ~full; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 121:26]
+  wire [2:0] _tail_T_1 = count - 3'h1; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 132:46]
+  wire [2:0] tail = dequeue ? _tail_T_1 : count; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 132:25]
+  wire [3:0] _entries_strobe_T = {io_cpu_write_strobe_3,io_cpu_write_strobe_2,io_cpu_write_strobe_1,io_cpu_write_strobe_0}; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 137:55]
+  wire [2:0] _count_T_1 = count + {{2'd0}, enqueue}; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 139:18]
+  wire [2:0] _count_T_3 = _count_T_1 - {{2'd0}, dequeue}; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 139:37]
+  wire  _GEN_13 = _T ? io_mem_granted : forward; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 107:{27,28} 100:22 110:23]
+  assign io_cpu_read_data = ~_T & forward ? youngest_data : io_mem_read_data; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 84:30 92:27 108:23]
+  assign io_cpu_read_valid = _T ? io_mem_read_valid : forward; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 92:27 99:25]
+  assign io_cpu_write_valid = store & ~full; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 121:26]
+  assign io_cpu_granted = enqueue | _GEN_13; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 122:18 123:24]
+  assign io_mem_address = _T ? io_cpu_address : next_address; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 83:30 97:27 99:25]
+  assign io_mem_read = _T & io_cpu_read; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 79:30 92:27 95:25]
+  assign io_mem_write = _T ? 1'h0 : drain; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 80:30 92:27 96:25]
+  assign io_mem_write_data = next_data; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 86:30]
+  assign io_mem_write_strobe_0 = _T ? 1'h0 : next_strobe[0]; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 87:30 97:27 102:25]
+  assign io_mem_write_strobe_1 = _T ? 1'h0 : next_strobe[1]; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 87:30 97:27 102:25]
+  assign io_mem_write_strobe_2 = _T ? 1'h0 : next_strobe[2]; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 87:30 97:27 102:25]
+  assign io_mem_write_strobe_3 = _T ? 1'h0 : next_strobe[3]; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 87:30 97:27 102:25]
+  assign io_mem_request = _T ? io_cpu_request : drain; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 83:30 92:27 98:25]
+  assign io_full_stall = store & full; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 90:36]
+  always @(posedge clock) begin
+    if (enqueue & 2'h0 == tail[1:0]) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 134:17]
+      entries_0_address <= {io_cpu_address[31:2],2'h0}; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 135:27]
+    end else if (dequeue) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 131:25]
+      entries_0_address <= entries_1_address;
+    end
+    if (enqueue & 2'h0 == tail[1:0]) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 134:17]
+      entries_0_data <= io_cpu_write_data; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 136:27]
+    end else if (dequeue) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 131:25]
+      entries_0_data <= entries_1_data;
+    end
+    if (enqueue & 2'h0 == tail[1:0]) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 134:17]
+      entries_0_strobe <= _entries_strobe_T; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 137:27]
+    end else if (dequeue) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 131:25]
+      entries_0_strobe <= entries_1_strobe;
+    end
+    if (enqueue & 2'h1 == tail[1:0]) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 134:17]
+      entries_1_address <= {io_cpu_address[31:2],2'h0}; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 135:27]
+    end else if (dequeue) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 131:25]
+      entries_1_address <= entries_2_address;
+    end
+    if (enqueue & 2'h1 == tail[1:0]) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 134:17]
+      entries_1_data <= io_cpu_write_data; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 136:27]
+    end else if (dequeue) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 131:25]
+      entries_1_data <= entries_2_data;
+    end
+    if (enqueue & 2'h1 == tail[1:0]) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 134:17]
+      entries_1_strobe <= _entries_strobe_T; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 137:27]
+    end else if (dequeue) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 131:25]
+      entries_1_strobe <= entries_2_strobe;
+    end
+    if (enqueue & 2'h2 == tail[1:0]) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 134:17]
+      entries_2_address <= {io_cpu_address[31:2],2'h0}; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 135:27]
+    end else if (dequeue) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 131:25]
+      entries_2_address <= entries_3_address;
+    end
+    if (enqueue & 2'h2 == tail[1:0]) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 134:17]
+      entries_2_data <= io_cpu_write_data; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 136:27]
+    end else if (dequeue) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 131:25]
+      entries_2_data <= entries_3_data;
+    end
+    if (enqueue & 2'h2 == tail[1:0]) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 134:17]
+      entries_2_strobe <= _entries_strobe_T; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 137:27]
+    end else if (dequeue) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 131:25]
+      entries_2_strobe <= entries_3_strobe;
+    end
+    if (enqueue & 2'h3 == tail[1:0]) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 134:17]
+      entries_3_address <= {io_cpu_address[31:2],2'h0}; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 135:27]
+    end else if (dequeue) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 131:25]
+      entries_3_address <= entries_3_address;
+    end
+    if (enqueue & 2'h3 == tail[1:0]) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 134:17]
+      entries_3_data <= io_cpu_write_data; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 136:27]
+    end else if (dequeue) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 131:25]
+      entries_3_data <= entries_3_data;
+    end
+    if (enqueue & 2'h3 == tail[1:0]) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 134:17]
+      entries_3_strobe <= _entries_strobe_T; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 137:27]
+    end else if (dequeue) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 131:25]
+      entries_3_strobe <= entries_3_strobe;
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 52:24]
+      count <= 3'h0; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 52:24]
+    end else begin
+      count <= _count_T_3; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 139:9]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 56:27]
+      inflight <= 3'h0; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 56:27]
+    end else begin
+      inflight <= _inflight_T_3; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 121:12]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 57:27]
+      loading <= 1'h0; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 57:27]
+    end else if (_T) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 92:27]
+      if (loading & io_mem_read_valid) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 104:37]
+        loading <= 1'h0; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 105:15]
+      end else if (bypass & io_mem_granted & ~io_mem_read_valid) begin // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 101:56]
+        loading <= 1'h1; // @[4-soc/src/main/scala/riscv/core/StoreBuffer.scala 102:15]
+      end
+    end
+  end
+// Register and memory initialization
+`ifdef RANDOMIZE_GARBAGE_ASSIGN
+`define RANDOMIZE
+`endif
+`ifdef RANDOMIZE_INVALID_ASSIGN
+`define RANDOMIZE
+`endif
+`ifdef RANDOMIZE_REG_INIT
+`define RANDOMIZE
+`endif
+`ifdef RANDOMIZE_MEM_INIT
+`define RANDOMIZE
+`endif
+`ifndef RANDOM
+`define RANDOM $random
+`endif
+`ifdef RANDOMIZE_MEM_INIT
+  integer initvar;
+`endif
+`ifndef SYNTHESIS
+`ifdef FIRRTL_BEFORE_INITIAL
+`FIRRTL_BEFORE_INITIAL
+`endif
+initial begin
+  `ifdef RANDOMIZE
+    `ifdef INIT_RANDOM
+      `INIT_RANDOM
+    `endif
+    `ifndef VERILATOR
+      `ifdef RANDOMIZE_DELAY
+        #`RANDOMIZE_DELAY begin end
+      `else
+        #0.002 begin end
+      `endif
+    `endif
+`ifdef RANDOMIZE_REG_INIT
+  _RAND_0 = {1{`RANDOM}};
+  entries_0_address = _RAND_0[31:0];
+  _RAND_1 = {1{`RANDOM}};
+  entries_0_data = _RAND_1[31:0];
+  _RAND_2 = {1{`RANDOM}};
+  entries_0_strobe = _RAND_2[3:0];
+  _RAND_3 = {1{`RANDOM}};
+  entries_1_address = _RAND_3[31:0];
+  _RAND_4 = {1{`RANDOM}};
+  entries_1_data = _RAND_4[31:0];
+  _RAND_5 = {1{`RANDOM}};
+  entries_1_strobe = _RAND_5[3:0];
+  _RAND_6 = {1{`RANDOM}};
+  entries_2_address = _RAND_6[31:0];
+  _RAND_7 = {1{`RANDOM}};
+  entries_2_data = _RAND_7[31:0];
+  _RAND_8 = {1{`RANDOM}};
+  entries_2_strobe = _RAND_8[3:0];
+  _RAND_9 = {1{`RANDOM}};
+  entries_3_address = _RAND_9[31:0];
+  _RAND_10 = {1{`RANDOM}};
+  entries_3_data = _RAND_10[31:0];
+  _RAND_11 = {1{`RANDOM}};
+  entries_3_strobe = _RAND_11[3:0];
+  _RAND_12 = {1{`RANDOM}};
+  count = _RAND_12[2:0];
+  _RAND_13 = {1{`RANDOM}};
+  inflight = _RAND_13[2:0];
+  _RAND_14 = {1{`RANDOM}};
+  loading = _RAND_14[0:0];
+`endif // RANDOMIZE_REG_INIT
+  `endif // RANDOMIZE
+end // initial
+`ifdef FIRRTL_AFTER_INITIAL
+`FIRRTL_AFTER_INITIAL
+`endif
+`endif // SYNTHESIS
+endmodule
+module PipelinedCPU(
+  input         clock,
+  input         reset,
+  output [31:0] io_instruction_address, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  input  [31:0] io_instruction, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  input         io_instruction_valid, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  input         io_icache_enable, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:14]
+  output        io_icache_refill_request, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:14]
+  output [31:0] io_icache_refill_address, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:14]
+  input  [31:0] io_icache_refill_data, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:14]
+  input         io_icache_refill_data_valid, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:14]
+  input         io_dcache_enable, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:14]
+  output [31:0] io_memory_bundle_address, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  output        io_memory_bundle_read, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  input  [31:0] io_memory_bundle_read_data, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  input         io_memory_bundle_read_valid, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  output        io_memory_bundle_write, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  output [31:0] io_memory_bundle_write_data, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  output        io_memory_bundle_write_strobe_0, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  output        io_memory_bundle_write_strobe_1, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  output        io_memory_bundle_write_strobe_2, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  output        io_memory_bundle_write_strobe_3, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  input         io_memory_bundle_write_valid, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  input         io_memory_bundle_busy, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  output        io_memory_bundle_request, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  input         io_memory_bundle_granted, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  output [2:0]  io_device_select, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  input  [31:0] io_interrupt_flag, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  input  [4:0]  io_debug_read_address, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  output [31:0] io_debug_read_data, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  input  [11:0] io_csr_debug_read_address, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  output [31:0] io_csr_debug_read_data, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  output        io_retire_reg_valid, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  output [31:0] io_retire_reg_pc, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  output [4:0]  io_retire_reg_rd, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  output [31:0] io_retire_reg_data, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  output        io_retire_store_valid, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  output [31:0] io_retire_store_address, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  output [31:0] io_retire_store_data, // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+  output [3:0]  io_retire_store_strobe // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 116:14]
+);
+`ifdef RANDOMIZE_REG_INIT
+  reg [31:0] _RAND_0;
+  reg [31:0] _RAND_1;
+`endif // RANDOMIZE_REG_INIT
+  wire  ctrl_io_jump_flag; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
+  wire  ctrl_io_jump_instruction_id; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
+  wire [4:0] ctrl_io_rs1_id; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
+  wire [4:0] ctrl_io_rs2_id; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
+  wire  ctrl_io_memory_read_enable_ex; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
+  wire [4:0] ctrl_io_rd_ex; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
+  wire  ctrl_io_memory_read_enable_mem; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
+  wire [4:0] ctrl_io_rd_mem; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
+  wire  ctrl_io_memory_write_enable_mem; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
+  wire [1:0] ctrl_io_regs_write_source_ex; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
+  wire [1:0] ctrl_io_regs_write_source_mem; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
+  wire [1:0] ctrl_io_regs_write_source_wb; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
+  wire [4:0] ctrl_io_rd_wb; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
+  wire  ctrl_io_if_flush; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
+  wire  ctrl_io_id_flush; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
+  wire  ctrl_io_pc_stall; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
+  wire  ctrl_io_if_stall; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
+  wire  ctrl_io_branch_hazard; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
+  wire  ctrl_io_jal_jalr_hazard; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 118:26]
+  wire  regs_clock; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
+  wire  regs_reset; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
+  wire  regs_io_write_enable; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
+  wire [4:0] regs_io_write_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
+  wire [31:0] regs_io_write_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
+  wire [4:0] regs_io_read_address1; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
+  wire [4:0] regs_io_read_address2; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
+  wire [31:0] regs_io_read_data1; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
+  wire [31:0] regs_io_read_data2; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
+  wire [4:0] regs_io_debug_read_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
+  wire [31:0] regs_io_debug_read_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 119:26]
+  wire  inst_fetch_clock; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire  inst_fetch_reset; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire  inst_fetch_io_stall_flag_ctrl; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire  inst_fetch_io_jump_flag_id; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire [31:0] inst_fetch_io_jump_address_id; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire [31:0] inst_fetch_io_rom_instruction; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire  inst_fetch_io_instruction_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire  inst_fetch_io_btb_mispredict; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire [31:0] inst_fetch_io_btb_correction_addr; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire  inst_fetch_io_btb_correct_prediction; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire [31:0] inst_fetch_io_instruction_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire [31:0] inst_fetch_io_id_instruction; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire  inst_fetch_io_btb_predicted_taken; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire [31:0] inst_fetch_io_btb_predicted_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire  inst_fetch_io_btb_update_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire [31:0] inst_fetch_io_btb_update_pc; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire [31:0] inst_fetch_io_btb_update_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire  inst_fetch_io_btb_update_taken; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire  inst_fetch_io_ras_predicted_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire [31:0] inst_fetch_io_ras_predicted_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire  inst_fetch_io_ras_push; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire [31:0] inst_fetch_io_ras_push_addr; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire  inst_fetch_io_ibtb_predicted_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire [31:0] inst_fetch_io_ibtb_predicted_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire  inst_fetch_io_ibtb_update_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire [31:0] inst_fetch_io_ibtb_update_pc; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire [7:0] inst_fetch_io_ibtb_update_rs1_hash; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire [31:0] inst_fetch_io_ibtb_update_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 120:26]
+  wire  if2id_clock; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
+  wire  if2id_reset; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
+  wire  if2id_io_stall; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
+  wire  if2id_io_flush; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
+  wire [31:0] if2id_io_instruction; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
+  wire [31:0] if2id_io_instruction_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
+  wire [31:0] if2id_io_interrupt_flag; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
+  wire  if2id_io_btb_predicted_taken; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
+  wire [31:0] if2id_io_btb_predicted_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
+  wire  if2id_io_ras_predicted_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
+  wire [31:0] if2id_io_ras_predicted_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
+  wire  if2id_io_ibtb_predicted_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
+  wire [31:0] if2id_io_ibtb_predicted_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
+  wire [31:0] if2id_io_output_instruction; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
+  wire [31:0] if2id_io_output_instruction_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
+  wire  if2id_io_output_btb_predicted_taken; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
+  wire [31:0] if2id_io_output_btb_predicted_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
+  wire  if2id_io_output_ras_predicted_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
+  wire [31:0] if2id_io_output_ras_predicted_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
   wire  if2id_io_output_ibtb_predicted_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
   wire [31:0] if2id_io_output_ibtb_predicted_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 121:26]
   wire [31:0] id_io_instruction; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 122:26]
@@ -9178,6 +11288,15 @@ module PipelinedCPU(
   wire  mem_io_bus_write_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 126:26]
   wire  mem_io_bus_request; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 126:26]
   wire  mem_io_bus_granted; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 126:26]
+  wire [31:0] mem_io_tcm_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 126:26]
+  wire  mem_io_tcm_select; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 126:26]
+  wire [31:0] mem_io_tcm_read_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 126:26]
+  wire  mem_io_tcm_write; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 126:26]
+  wire [31:0] mem_io_tcm_write_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 126:26]
+  wire  mem_io_tcm_write_strobe_0; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 126:26]
+  wire  mem_io_tcm_write_strobe_1; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 126:26]
+  wire  mem_io_tcm_write_strobe_2; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 126:26]
+  wire  mem_io_tcm_write_strobe_3; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 126:26]
   wire  mem2wb_clock; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 127:26]
   wire  mem2wb_reset; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 127:26]
   wire  mem2wb_io_stall; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 127:26]
@@ -9255,6 +11374,99 @@ module PipelinedCPU(
   wire  csr_regs_io_btb_miss_taken; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 131:26]
   wire  csr_regs_io_branch_resolved; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 131:26]
   wire  csr_regs_io_btb_predicted; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 131:26]
+  wire  csr_regs_io_icache_hit; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 131:26]
+  wire  csr_regs_io_icache_miss; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 131:26]
+  wire  icache_clock; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 135:26]
+  wire  icache_reset; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 135:26]
+  wire  icache_io_enable; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 135:26]
+  wire [31:0] icache_io_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 135:26]
+  wire  icache_io_fetch; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 135:26]
+  wire [31:0] icache_io_rom_instruction; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 135:26]
+  wire  icache_io_rom_instruction_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 135:26]
+  wire [31:0] icache_io_instruction; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 135:26]
+  wire  icache_io_instruction_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 135:26]
+  wire  icache_io_refill_request; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 135:26]
+  wire [31:0] icache_io_refill_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 135:26]
+  wire [31:0] icache_io_refill_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 135:26]
+  wire  icache_io_refill_data_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 135:26]
+  wire  icache_io_hit; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 135:26]
+  wire  icache_io_miss; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 135:26]
+  wire  csr_regs_io_dcache_hit; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 131:26]
+  wire  csr_regs_io_dcache_miss; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 131:26]
+  wire  csr_regs_io_dcache_write_back; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 131:26]
+  wire  csr_regs_io_store_buffer_full; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 131:26]
+  wire  dcache_clock; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_reset; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_enable; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire [31:0] dcache_io_cpu_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_cpu_read; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire [31:0] dcache_io_cpu_read_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_cpu_read_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_cpu_write; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire [31:0] dcache_io_cpu_write_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_cpu_write_strobe_0; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_cpu_write_strobe_1; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_cpu_write_strobe_2; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_cpu_write_strobe_3; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_cpu_write_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_cpu_request; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_cpu_granted; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire [31:0] dcache_io_mem_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_mem_read; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire [31:0] dcache_io_mem_read_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_mem_read_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_mem_write; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire [31:0] dcache_io_mem_write_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_mem_write_strobe_0; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_mem_write_strobe_1; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_mem_write_strobe_2; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_mem_write_strobe_3; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_mem_write_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_mem_busy; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_mem_request; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_mem_granted; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_hit; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_miss; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  dcache_io_write_back; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+  wire  tcm_clock; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 139:19]
+  wire [31:0] tcm_io_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 139:19]
+  wire  tcm_io_select; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 139:19]
+  wire [31:0] tcm_io_read_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 139:19]
+  wire  tcm_io_write; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 139:19]
+  wire [31:0] tcm_io_write_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 139:19]
+  wire  tcm_io_write_strobe_0; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 139:19]
+  wire  tcm_io_write_strobe_1; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 139:19]
+  wire  tcm_io_write_strobe_2; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 139:19]
+  wire  tcm_io_write_strobe_3; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 139:19]
+  wire  store_buffer_clock; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_reset; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire [31:0] store_buffer_io_cpu_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_io_cpu_read; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire [31:0] store_buffer_io_cpu_read_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_io_cpu_read_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_io_cpu_write; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire [31:0] store_buffer_io_cpu_write_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_io_cpu_write_strobe_0; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_io_cpu_write_strobe_1; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_io_cpu_write_strobe_2; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_io_cpu_write_strobe_3; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_io_cpu_write_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_io_cpu_request; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_io_cpu_granted; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire [31:0] store_buffer_io_mem_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_io_mem_read; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire [31:0] store_buffer_io_mem_read_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_io_mem_read_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_io_mem_write; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire [31:0] store_buffer_io_mem_write_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_io_mem_write_strobe_0; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_io_mem_write_strobe_1; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_io_mem_write_strobe_2; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_io_mem_write_strobe_3; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_io_mem_write_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_io_mem_request; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_io_mem_granted; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+  wire  store_buffer_io_full_stall; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
   wire  _btb_wrong_direction_T = if2id_io_output_btb_predicted_taken & id_io_ctrl_jump_instruction; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 191:43]
   wire  btb_wrong_direction = if2id_io_output_btb_predicted_taken & id_io_ctrl_jump_instruction & ~id_io_if_jump_flag; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 191:64]
   wire  btb_non_branch = if2id_io_output_btb_predicted_taken & ~id_io_ctrl_jump_instruction; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 195:38]
@@ -9306,7 +11518,7 @@ module PipelinedCPU(
   wire [7:0] _ibtb_rs1_hash_T_1 = _ibtb_rs1_hash_T ^ ibtb_rs1_hash_b2; // @[4-soc/src/main/scala/riscv/core/IndirectBTB.scala 180:13]
   wire  prediction_correct = btb_correct_prediction | ras_correct_predict | ibtb_correct_predict; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 358:74]
   wire  need_if_flush = ctrl_io_if_flush & ~prediction_correct | btb_mispredict | ras_wrong_target | ibtb_wrong_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 360:85]
-  wire  store_completed = mem_io_bus_write & mem_io_bus_write_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 523:47]
+  wire  store_completed = mem_io_bus_write_valid | mem_io_tcm_write; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 545:53]
   wire  control_flush_event = (need_if_flush | btb_mispredict | ras_wrong_target | ibtb_wrong_target) & _T_1; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 554:104]
   wire  _btb_miss_penalty_T_3 = ~if2id_io_output_btb_predicted_taken & id_io_ctrl_jump_instruction & id_io_if_jump_flag
      | btb_wrong_target; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 573:59]
@@ -9540,7 +11752,16 @@ module PipelinedCPU(
     .io_bus_write_strobe_3(mem_io_bus_write_strobe_3),
     .io_bus_write_valid(mem_io_bus_write_valid),
     .io_bus_request(mem_io_bus_request),
-    .io_bus_granted(mem_io_bus_granted)
+    .io_bus_granted(mem_io_bus_granted),
+    .io_tcm_address(mem_io_tcm_address),
+    .io_tcm_select(mem_io_tcm_select),
+    .io_tcm_read_data(mem_io_tcm_read_data),
+    .io_tcm_write(mem_io_tcm_write),
+    .io_tcm_write_data(mem_io_tcm_write_data),
+    .io_tcm_write_strobe_0(mem_io_tcm_write_strobe_0),
+    .io_tcm_write_strobe_1(mem_io_tcm_write_strobe_1),
+    .io_tcm_write_strobe_2(mem_io_tcm_write_strobe_2),
+    .io_tcm_write_strobe_3(mem_io_tcm_write_strobe_3)
   );
   MEM2WB mem2wb ( // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 127:26]
     .clock(mem2wb_clock),
@@ -9627,21 +11848,132 @@ module PipelinedCPU(
     .io_control_stall(csr_regs_io_control_stall),
     .io_btb_miss_taken(csr_regs_io_btb_miss_taken),
     .io_branch_resolved(csr_regs_io_branch_resolved),
-    .io_btb_predicted(csr_regs_io_btb_predicted)
+    .io_btb_predicted(csr_regs_io_btb_predicted),
+    .io_icache_hit(csr_regs_io_icache_hit),
+    .io_icache_miss(csr_regs_io_icache_miss),
+    .io_dcache_hit(csr_regs_io_dcache_hit),
+    .io_dcache_miss(csr_regs_io_dcache_miss),
+    .io_dcache_write_back(csr_regs_io_dcache_write_back),
+    .io_store_buffer_full(csr_regs_io_store_buffer_full)
+  );
+  ICache icache ( // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 135:26]
+    .clock(icache_clock),
+    .reset(icache_reset),
+    .io_enable(icache_io_enable),
+    .io_address(icache_io_address),
+    .io_fetch(icache_io_fetch),
+    .io_rom_instruction(icache_io_rom_instruction),
+    .io_rom_instruction_valid(icache_io_rom_instruction_valid),
+    .io_instruction(icache_io_instruction),
+    .io_instruction_valid(icache_io_instruction_valid),
+    .io_refill_request(icache_io_refill_request),
+    .io_refill_address(icache_io_refill_address),
+    .io_refill_data(icache_io_refill_data),
+    .io_refill_data_valid(icache_io_refill_data_valid),
+    .io_hit(icache_io_hit),
+    .io_miss(icache_io_miss)
+  );
+  DCache dcache ( // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 136:26]
+    .clock(dcache_clock),
+    .reset(dcache_reset),
+    .io_enable(dcache_io_enable),
+    .io_cpu_address(dcache_io_cpu_address),
+    .io_cpu_read(dcache_io_cpu_read),
+    .io_cpu_read_data(dcache_io_cpu_read_data),
+    .io_cpu_read_valid(dcache_io_cpu_read_valid),
+    .io_cpu_write(dcache_io_cpu_write),
+    .io_cpu_write_data(dcache_io_cpu_write_data),
+    .io_cpu_write_strobe_0(dcache_io_cpu_write_strobe_0),
+    .io_cpu_write_strobe_1(dcache_io_cpu_write_strobe_1),
+    .io_cpu_write_strobe_2(dcache_io_cpu_write_strobe_2),
+    .io_cpu_write_strobe_3(dcache_io_cpu_write_strobe_3),
+    .io_cpu_write_valid(dcache_io_cpu_write_valid),
+    .io_cpu_request(dcache_io_cpu_request),
+    .io_cpu_granted(dcache_io_cpu_granted),
+    .io_mem_address(dcache_io_mem_address),
+    .io_mem_read(dcache_io_mem_read),
+    .io_mem_read_data(dcache_io_mem_read_data),
+    .io_mem_read_valid(dcache_io_mem_read_valid),
+    .io_mem_write(dcache_io_mem_write),
+    .io_mem_write_data(dcache_io_mem_write_data),
+    .io_mem_write_strobe_0(dcache_io_mem_write_strobe_0),
+    .io_mem_write_strobe_1(dcache_io_mem_write_strobe_1),
+    .io_mem_write_strobe_2(dcache_io_mem_write_strobe_2),
+    .io_mem_write_strobe_3(dcache_io_mem_write_strobe_3),
+    .io_mem_write_valid(dcache_io_mem_write_valid),
+    .io_mem_busy(dcache_io_mem_busy),
+    .io_mem_request(dcache_io_mem_request),
+    .io_mem_granted(dcache_io_mem_granted),
+    .io_hit(dcache_io_hit),
+    .io_miss(dcache_io_miss),
+    .io_write_back(dcache_io_write_back)
+  );
+  DataTCM tcm ( // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 139:19]
+    .clock(tcm_clock),
+    .io_address(tcm_io_address),
+    .io_select(tcm_io_select),
+    .io_read_data(tcm_io_read_data),
+    .io_write(tcm_io_write),
+    .io_write_data(tcm_io_write_data),
+    .io_write_strobe_0(tcm_io_write_strobe_0),
+    .io_write_strobe_1(tcm_io_write_strobe_1),
+    .io_write_strobe_2(tcm_io_write_strobe_2),
+    .io_write_strobe_3(tcm_io_write_strobe_3)
+  );
+  StoreBuffer store_buffer ( // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 473:30]
+    .clock(store_buffer_clock),
+    .reset(store_buffer_reset),
+    .io_cpu_address(store_buffer_io_cpu_address),
+    .io_cpu_read(store_buffer_io_cpu_read),
+    .io_cpu_read_data(store_buffer_io_cpu_read_data),
+    .io_cpu_read_valid(store_buffer_io_cpu_read_valid),
+    .io_cpu_write(store_buffer_io_cpu_write),
+    .io_cpu_write_data(store_buffer_io_cpu_write_data),
+    .io_cpu_write_strobe_0(store_buffer_io_cpu_write_strobe_0),
+    .io_cpu_write_strobe_1(store_buffer_io_cpu_write_strobe_1),
+    .io_cpu_write_strobe_2(store_buffer_io_cpu_write_strobe_2),
+    .io_cpu_write_strobe_3(store_buffer_io_cpu_write_strobe_3),
+    .io_cpu_write_valid(store_buffer_io_cpu_write_valid),
+    .io_cpu_request(store_buffer_io_cpu_request),
+    .io_cpu_granted(store_buffer_io_cpu_granted),
+    .io_mem_address(store_buffer_io_mem_address),
+    .io_mem_read(store_buffer_io_mem_read),
+    .io_mem_read_data(store_buffer_io_mem_read_data),
+    .io_mem_read_valid(store_buffer_io_mem_read_valid),
+    .io_mem_write(store_buffer_io_mem_write),
+    .io_mem_write_data(store_buffer_io_mem_write_data),
+    .io_mem_write_strobe_0(store_buffer_io_mem_write_strobe_0),
+    .io_mem_write_strobe_1(store_buffer_io_mem_write_strobe_1),
+    .io_mem_write_strobe_2(store_buffer_io_mem_write_strobe_2),
+    .io_mem_write_strobe_3(store_buffer_io_mem_write_strobe_3),
+    .io_mem_write_valid(store_buffer_io_mem_write_valid),
+    .io_mem_request(store_buffer_io_mem_request),
+    .io_mem_granted(store_buffer_io_mem_granted),
+    .io_full_stall(store_buffer_io_full_stall)
   );
   assign io_instruction_address = inst_fetch_io_instruction_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 163:35]
-  assign io_memory_bundle_address = {3'h0,mem_io_bus_address[28:0]}; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 453:70]
-  assign io_memory_bundle_read = mem_io_bus_read; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 452:20]
-  assign io_memory_bundle_write = mem_io_bus_write; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 452:20]
-  assign io_memory_bundle_write_data = mem_io_bus_write_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 452:20]
-  assign io_memory_bundle_write_strobe_0 = mem_io_bus_write_strobe_0; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 452:20]
-  assign io_memory_bundle_write_strobe_1 = mem_io_bus_write_strobe_1; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 452:20]
-  assign io_memory_bundle_write_strobe_2 = mem_io_bus_write_strobe_2; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 452:20]
-  assign io_memory_bundle_write_strobe_3 = mem_io_bus_write_strobe_3; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 452:20]
-  assign io_memory_bundle_request = mem_io_bus_request; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 452:20]
-  assign io_device_select = mem_io_bus_address[31:29]; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 451:13]
+  assign io_icache_refill_request = icache_io_refill_request; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 180:20]
+  assign io_icache_refill_address = icache_io_refill_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 180:20]
+  assign io_memory_bundle_address = {3'h0,dcache_io_mem_address[28:0]}; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 472:70]
+  assign io_memory_bundle_read = dcache_io_mem_read; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 471:20]
+  assign io_memory_bundle_write = dcache_io_mem_write; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 471:20]
+  assign io_memory_bundle_write_data = dcache_io_mem_write_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 471:20]
+  assign io_memory_bundle_write_strobe_0 = dcache_io_mem_write_strobe_0; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 471:20]
+  assign io_memory_bundle_write_strobe_1 = dcache_io_mem_write_strobe_1; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 471:20]
+  assign io_memory_bundle_write_strobe_2 = dcache_io_mem_write_strobe_2; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 471:20]
+  assign io_memory_bundle_write_strobe_3 = dcache_io_mem_write_strobe_3; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 471:20]
+  assign io_memory_bundle_request = dcache_io_mem_request; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 471:20]
+  assign io_device_select = dcache_io_mem_address[31:29]; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 470:13]
   assign io_debug_read_data = regs_io_debug_read_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 157:30]
   assign io_csr_debug_read_data = csr_regs_io_debug_reg_read_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 495:38]
+  assign io_retire_reg_valid = mem2wb_io_output_regs_write_enable & _T_1; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 527:53]
+  assign io_retire_reg_pc = mem2wb_io_output_instruction_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 528:27]
+  assign io_retire_reg_rd = mem2wb_io_output_regs_write_address[4:0]; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 529:27]
+  assign io_retire_reg_data = wb_io_regs_write_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 530:27]
+  assign io_retire_store_valid = mem_io_bus_write & mem_io_bus_granted | mem_io_tcm_write; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 553:69]
+  assign io_retire_store_address = mem_io_bus_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 532:27]
+  assign io_retire_store_data = mem_io_bus_write_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 533:27]
+  assign io_retire_store_strobe = {mem_io_bus_write_strobe_3,mem_io_bus_write_strobe_2,mem_io_bus_write_strobe_1,mem_io_bus_write_strobe_0}; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 534:59]
   assign ctrl_io_jump_flag = id_io_if_jump_flag; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 133:35]
   assign ctrl_io_jump_instruction_id = id_io_ctrl_jump_instruction; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 134:35]
   assign ctrl_io_rs1_id = id_io_regs_reg1_read_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 135:35]
@@ -9668,8 +12000,8 @@ module PipelinedCPU(
   assign inst_fetch_io_stall_flag_ctrl = ctrl_io_pc_stall | mem_io_ctrl_stall_flag; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 164:55]
   assign inst_fetch_io_jump_flag_id = id_io_if_jump_flag; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 165:35]
   assign inst_fetch_io_jump_address_id = id_io_if_jump_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 166:35]
-  assign inst_fetch_io_rom_instruction = io_instruction; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 167:35]
-  assign inst_fetch_io_instruction_valid = io_instruction_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 168:35]
+  assign inst_fetch_io_rom_instruction = icache_io_instruction; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 171:35]
+  assign inst_fetch_io_instruction_valid = icache_io_instruction_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 172:35]
   assign inst_fetch_io_btb_mispredict = btb_mispredict_raw | _T_2; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 228:43]
   assign inst_fetch_io_btb_correction_addr = _T_2 ? btb_correction_addr_pending : btb_correction_addr_raw; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 229:42]
   assign inst_fetch_io_btb_correct_prediction = _btb_wrong_target_T & if2id_io_output_btb_predicted_target ==
@@ -9769,10 +12101,10 @@ module PipelinedCPU(
   assign mem_io_regs_write_enable = ex2mem_io_output_regs_write_enable; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 447:30]
   assign mem_io_csr_read_data = ex2mem_io_output_csr_read_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 448:30]
   assign mem_io_instruction_address = ex2mem_io_output_instruction_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 449:30]
-  assign mem_io_bus_read_data = io_memory_bundle_read_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 452:20]
-  assign mem_io_bus_read_valid = io_memory_bundle_read_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 452:20]
-  assign mem_io_bus_write_valid = io_memory_bundle_write_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 452:20]
-  assign mem_io_bus_granted = io_memory_bundle_granted; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 452:20]
+  assign mem_io_bus_read_data = store_buffer_io_cpu_read_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 474:25]
+  assign mem_io_bus_read_valid = store_buffer_io_cpu_read_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 474:25]
+  assign mem_io_bus_write_valid = store_buffer_io_cpu_write_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 474:25]
+  assign mem_io_bus_granted = store_buffer_io_cpu_granted; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 474:25]
   assign mem2wb_clock = clock;
   assign mem2wb_reset = reset;
   assign mem2wb_io_stall = mem_io_ctrl_stall_flag; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 456:33]
@@ -9825,6 +12157,63 @@ module PipelinedCPU(
   assign csr_regs_io_btb_miss_taken = _btb_miss_penalty_T_3 & _btb_mispredict_raw_T_2 & _T_1; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 575:29]
   assign csr_regs_io_branch_resolved = id_io_ctrl_jump_instruction & _btb_mispredict_raw_T_2 & _T_1; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 585:76]
   assign csr_regs_io_btb_predicted = _btb_wrong_direction_T & _btb_mispredict_raw_T_2 & _T_1; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 593:91]
+  assign csr_regs_io_icache_hit = icache_io_hit; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 619:27]
+  assign csr_regs_io_icache_miss = icache_io_miss; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 620:27]
+  assign icache_clock = clock;
+  assign icache_reset = reset;
+  assign icache_io_enable = io_icache_enable; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 175:35]
+  assign icache_io_address = inst_fetch_io_instruction_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 176:35]
+  assign icache_io_fetch = ~(ctrl_io_pc_stall | mem_io_ctrl_stall_flag); // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 177:38]
+  assign icache_io_rom_instruction = io_instruction; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 178:35]
+  assign icache_io_rom_instruction_valid = io_instruction_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 179:35]
+  assign icache_io_refill_data = io_icache_refill_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 180:20]
+  assign icache_io_refill_data_valid = io_icache_refill_data_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 180:20]
+  assign csr_regs_io_dcache_hit = dcache_io_hit; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 632:33]
+  assign csr_regs_io_dcache_miss = dcache_io_miss; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 633:33]
+  assign csr_regs_io_dcache_write_back = dcache_io_write_back; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 634:33]
+  assign csr_regs_io_store_buffer_full = store_buffer_io_full_stall; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 649:33]
+  assign dcache_clock = clock;
+  assign dcache_reset = reset;
+  assign mem_io_tcm_select = tcm_io_select; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 469:10]
+  assign mem_io_tcm_read_data = tcm_io_read_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 469:10]
+  assign dcache_io_enable = io_dcache_enable; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 467:20]
+  assign dcache_io_cpu_address = store_buffer_io_mem_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 475:19]
+  assign dcache_io_cpu_read = store_buffer_io_mem_read; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 475:19]
+  assign dcache_io_cpu_write = store_buffer_io_mem_write; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 475:19]
+  assign dcache_io_cpu_write_data = store_buffer_io_mem_write_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 475:19]
+  assign dcache_io_cpu_write_strobe_0 = store_buffer_io_mem_write_strobe_0; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 475:19]
+  assign dcache_io_cpu_write_strobe_1 = store_buffer_io_mem_write_strobe_1; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 475:19]
+  assign dcache_io_cpu_write_strobe_2 = store_buffer_io_mem_write_strobe_2; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 475:19]
+  assign dcache_io_cpu_write_strobe_3 = store_buffer_io_mem_write_strobe_3; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 475:19]
+  assign dcache_io_cpu_request = store_buffer_io_mem_request; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 475:19]
+  assign dcache_io_mem_read_data = io_memory_bundle_read_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 471:20]
+  assign dcache_io_mem_read_valid = io_memory_bundle_read_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 471:20]
+  assign dcache_io_mem_write_valid = io_memory_bundle_write_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 471:20]
+  assign dcache_io_mem_busy = io_memory_bundle_busy; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 471:20]
+  assign dcache_io_mem_granted = io_memory_bundle_granted; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 471:20]
+  assign tcm_clock = clock;
+  assign tcm_io_address = mem_io_tcm_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 469:10]
+  assign tcm_io_write = mem_io_tcm_write; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 469:10]
+  assign tcm_io_write_data = mem_io_tcm_write_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 469:10]
+  assign tcm_io_write_strobe_0 = mem_io_tcm_write_strobe_0; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 469:10]
+  assign tcm_io_write_strobe_1 = mem_io_tcm_write_strobe_1; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 469:10]
+  assign tcm_io_write_strobe_2 = mem_io_tcm_write_strobe_2; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 469:10]
+  assign tcm_io_write_strobe_3 = mem_io_tcm_write_strobe_3; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 469:10]
+  assign store_buffer_clock = clock;
+  assign store_buffer_reset = reset;
+  assign store_buffer_io_cpu_address = mem_io_bus_address; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 474:25]
+  assign store_buffer_io_cpu_read = mem_io_bus_read; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 474:25]
+  assign store_buffer_io_cpu_write = mem_io_bus_write; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 474:25]
+  assign store_buffer_io_cpu_write_data = mem_io_bus_write_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 474:25]
+  assign store_buffer_io_cpu_write_strobe_0 = mem_io_bus_write_strobe_0; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 474:25]
+  assign store_buffer_io_cpu_write_strobe_1 = mem_io_bus_write_strobe_1; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 474:25]
+  assign store_buffer_io_cpu_write_strobe_2 = mem_io_bus_write_strobe_2; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 474:25]
+  assign store_buffer_io_cpu_write_strobe_3 = mem_io_bus_write_strobe_3; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 474:25]
+  assign store_buffer_io_cpu_request = mem_io_bus_request; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 474:25]
+  assign store_buffer_io_mem_read_data = dcache_io_cpu_read_data; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 475:19]
+  assign store_buffer_io_mem_read_valid = dcache_io_cpu_read_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 475:19]
+  assign store_buffer_io_mem_write_valid = dcache_io_cpu_write_valid; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 475:19]
+  assign store_buffer_io_mem_granted = dcache_io_cpu_granted; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 475:19]
   always @(posedge clock) begin
     if (reset) begin // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 218:44]
       btb_mispredict_pending <= 1'h0; // @[4-soc/src/main/scala/riscv/core/PipelinedCPU.scala 218:44]
@@ -9892,33 +12281,34 @@ endmodule
 module AXI4LiteMaster(
   input         clock,
   input         reset,
-  output        io_channels_write_address_channel_AWVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  input         io_channels_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  output [31:0] io_channels_write_address_channel_AWADDR, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  output        io_channels_write_data_channel_WVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  input         io_channels_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  output [31:0] io_channels_write_data_channel_WDATA, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  output [3:0]  io_channels_write_data_channel_WSTRB, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  input         io_channels_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  output        io_channels_write_response_channel_BREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  output        io_channels_read_address_channel_ARVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  input         io_channels_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  output [31:0] io_channels_read_address_channel_ARADDR, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  input         io_channels_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  output        io_channels_read_data_channel_RREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  input  [31:0] io_channels_read_data_channel_RDATA, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  input  [31:0] io_bundle_address, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  input         io_bundle_read, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  input         io_bundle_write, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  output [31:0] io_bundle_read_data, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  input  [31:0] io_bundle_write_data, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  input         io_bundle_write_strobe_0, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  input         io_bundle_write_strobe_1, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  input         io_bundle_write_strobe_2, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  input         io_bundle_write_strobe_3, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  output        io_bundle_busy, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  output        io_bundle_read_valid, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
-  output        io_bundle_write_valid // @[4-soc/src/main/scala/bus/AXI4Lite.scala 249:14]
+  output        io_channels_write_address_channel_AWVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  input         io_channels_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  output [31:0] io_channels_write_address_channel_AWADDR, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  output        io_channels_write_data_channel_WVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  input         io_channels_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  output [31:0] io_channels_write_data_channel_WDATA, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  output [3:0]  io_channels_write_data_channel_WSTRB, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  input         io_channels_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  output        io_channels_write_response_channel_BREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  output        io_channels_read_address_channel_ARVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  input         io_channels_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  output [31:0] io_channels_read_address_channel_ARADDR, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  input         io_channels_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  output        io_channels_read_data_channel_RREADY, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  input  [31:0] io_channels_read_data_channel_RDATA, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  input  [31:0] io_bundle_address, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  input         io_bundle_read, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  input         io_bundle_write, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  output [31:0] io_bundle_read_data, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  input  [31:0] io_bundle_write_data, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  input         io_bundle_write_strobe_0, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  input         io_bundle_write_strobe_1, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  input         io_bundle_write_strobe_2, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  input         io_bundle_write_strobe_3, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  output        io_bundle_granted, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  output        io_bundle_busy, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  output        io_bundle_read_valid, // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
+  output        io_bundle_write_valid // @[4-soc/src/main/scala/bus/AXI4Lite.scala 237:14]
 );
 `ifdef RANDOMIZE_REG_INIT
   reg [31:0] _RAND_0;
@@ -9937,202 +12327,134 @@ module AXI4LiteMaster(
   reg [31:0] _RAND_13;
   reg [31:0] _RAND_14;
 `endif // RANDOMIZE_REG_INIT
-  reg [2:0] state; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 254:22]
-  reg [31:0] addr; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 257:21]
-  reg  read_valid; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 262:27]
-  reg [31:0] read_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 264:26]
-  reg  ARVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 267:24]
-  reg  RREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 269:23]
-  reg  write_valid; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 275:28]
-  reg [31:0] write_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 277:27]
-  reg  write_strobe_0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 279:29]
-  reg  write_strobe_1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 279:29]
-  reg  write_strobe_2; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 279:29]
-  reg  write_strobe_3; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 279:29]
-  wire [1:0] io_channels_write_data_channel_WSTRB_lo = {write_strobe_1,write_strobe_0}; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 280:56]
-  wire [1:0] io_channels_write_data_channel_WSTRB_hi = {write_strobe_3,write_strobe_2}; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 280:56]
-  reg  AWVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 282:24]
-  reg  WVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 284:23]
-  reg  BREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 286:23]
-  wire  _GEN_6 = io_bundle_write | AWVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 311:35 316:22 282:24]
-  wire  _GEN_7 = io_bundle_write | WVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 311:35 317:22 284:23]
-  wire  _GEN_10 = io_bundle_read & ~io_bundle_write | ARVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 305:48 308:17 267:24]
-  wire  _GEN_11 = io_bundle_read & ~io_bundle_write | RREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 305:48 309:17 269:23]
-  wire  _GEN_23 = io_channels_read_data_channel_RVALID & RREADY | read_valid; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 328:60 332:20 262:27]
-  wire  _GEN_25 = AWVALID & io_channels_write_address_channel_AWREADY ? 1'h0 : AWVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 339:66 340:17 282:24]
-  wire  _GEN_26 = WVALID & io_channels_write_data_channel_WREADY ? 1'h0 : WVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 284:23 343:61 345:29]
-  wire  _GEN_27 = WVALID & io_channels_write_data_channel_WREADY | BREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 286:23 343:61 346:29]
-  wire [2:0] _GEN_29 = WVALID & io_channels_write_data_channel_WREADY ? 3'h5 : state; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 254:22 343:61 348:29]
-  wire  _GEN_31 = io_channels_write_response_channel_BVALID & BREADY ? 1'h0 : BREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 359:65 361:21 286:23]
-  wire  _GEN_32 = io_channels_write_response_channel_BVALID & BREADY | write_valid; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 359:65 362:21 275:28]
-  wire [2:0] _GEN_33 = io_channels_write_response_channel_BVALID & BREADY ? 3'h0 : state; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 359:65 363:21 254:22]
-  wire  _GEN_34 = 3'h5 == state ? _GEN_25 : AWVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17 282:24]
-  wire  _GEN_35 = 3'h5 == state ? _GEN_31 : BREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17 286:23]
-  wire  _GEN_36 = 3'h5 == state ? _GEN_32 : write_valid; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17 275:28]
-  wire [2:0] _GEN_37 = 3'h5 == state ? _GEN_33 : state; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17 254:22]
-  assign io_channels_write_address_channel_AWVALID = AWVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 283:45]
-  assign io_channels_write_address_channel_AWADDR = addr; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 259:44]
-  assign io_channels_write_data_channel_WVALID = WVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 285:41]
-  assign io_channels_write_data_channel_WDATA = write_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 278:40]
-  assign io_channels_write_data_channel_WSTRB = {io_channels_write_data_channel_WSTRB_hi,
-    io_channels_write_data_channel_WSTRB_lo}; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 280:56]
-  assign io_channels_write_response_channel_BREADY = BREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 287:45]
-  assign io_channels_read_address_channel_ARVALID = ARVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 268:44]
-  assign io_channels_read_address_channel_ARADDR = addr; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 258:44]
-  assign io_channels_read_data_channel_RREADY = RREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 270:40]
-  assign io_bundle_read_data = read_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 265:23]
-  assign io_bundle_busy = state != 3'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 255:27]
-  assign io_bundle_read_valid = read_valid; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 263:24]
-  assign io_bundle_write_valid = write_valid; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 276:25]
-  always @(posedge clock) begin
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 254:22]
-      state <= 3'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 254:22]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      if (io_bundle_read & ~io_bundle_write) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 305:48]
-        state <= 3'h2; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 310:17]
-      end else if (io_bundle_write) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 311:35]
-        state <= 3'h4; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 318:22]
-      end
-    end else if (3'h2 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      if (io_channels_read_data_channel_RVALID & RREADY) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 328:60]
-        state <= 3'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 333:20]
-      end
-    end else if (3'h4 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      state <= _GEN_29;
-    end else begin
-      state <= _GEN_37;
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 257:21]
-      addr <= 32'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 257:21]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      if (io_bundle_read & ~io_bundle_write) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 305:48]
-        addr <= io_bundle_address; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 307:17]
-      end else if (io_bundle_write) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 311:35]
-        addr <= io_bundle_address; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 313:22]
-      end
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 262:27]
-      read_valid <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 262:27]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      read_valid <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 301:27]
-    end else if (3'h2 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      read_valid <= _GEN_23;
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 264:26]
-      read_data <= 32'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 264:26]
-    end else if (!(3'h0 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      if (3'h2 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-        if (io_channels_read_data_channel_RVALID & RREADY) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 328:60]
-          read_data <= io_channels_read_data_channel_RDATA; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 330:20]
-        end
-      end
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 267:24]
-      ARVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 267:24]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      ARVALID <= _GEN_10;
-    end else if (3'h2 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      if (ARVALID & io_channels_read_address_channel_ARREADY) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 324:65]
-        ARVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 325:17]
-      end
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 269:23]
-      RREADY <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 269:23]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      RREADY <= _GEN_11;
-    end else if (3'h2 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      if (io_channels_read_data_channel_RVALID & RREADY) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 328:60]
-        RREADY <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 331:20]
-      end
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 275:28]
-      write_valid <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 275:28]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      write_valid <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 302:27]
-    end else if (!(3'h2 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      if (!(3'h4 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-        write_valid <= _GEN_36;
-      end
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 277:27]
-      write_data <= 32'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 277:27]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      if (!(io_bundle_read & ~io_bundle_write)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 305:48]
-        if (io_bundle_write) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 311:35]
-          write_data <= io_bundle_write_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 314:22]
-        end
-      end
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 279:29]
-      write_strobe_0 <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 279:29]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      if (!(io_bundle_read & ~io_bundle_write)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 305:48]
-        if (io_bundle_write) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 311:35]
-          write_strobe_0 <= io_bundle_write_strobe_0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 315:22]
-        end
-      end
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 279:29]
-      write_strobe_1 <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 279:29]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      if (!(io_bundle_read & ~io_bundle_write)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 305:48]
-        if (io_bundle_write) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 311:35]
-          write_strobe_1 <= io_bundle_write_strobe_1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 315:22]
-        end
-      end
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 279:29]
-      write_strobe_2 <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 279:29]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      if (!(io_bundle_read & ~io_bundle_write)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 305:48]
-        if (io_bundle_write) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 311:35]
-          write_strobe_2 <= io_bundle_write_strobe_2; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 315:22]
-        end
-      end
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 279:29]
-      write_strobe_3 <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 279:29]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      if (!(io_bundle_read & ~io_bundle_write)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 305:48]
-        if (io_bundle_write) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 311:35]
-          write_strobe_3 <= io_bundle_write_strobe_3; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 315:22]
-        end
-      end
+  reg  ARVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 243:24]
+  reg [31:0] read_addr; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 245:26]
+  reg  read_valid; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 250:27]
+  reg [31:0] read_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 252:26]
+  reg [2:0] read_count; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 254:27]
+  reg  AWVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 257:24]
+  reg [31:0] write_addr; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 259:27]
+  reg  WVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 262:23]
+  reg [31:0] write_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 264:27]
+  reg  write_strobe_0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 266:29]
+  reg  write_strobe_1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 266:29]
+  reg  write_strobe_2; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 266:29]
+  reg  write_strobe_3; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 266:29]
+  wire [1:0] io_channels_write_data_channel_WSTRB_lo = {write_strobe_1,write_strobe_0}; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 267:58]
+  wire [1:0] io_channels_write_data_channel_WSTRB_hi = {write_strobe_3,write_strobe_2}; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 267:58]
+  reg  write_valid; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 270:28]
+  reg [2:0] write_count; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 272:28]
+  wire  ar_free = ~ARVALID | io_channels_read_address_channel_ARREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 278:26]
+  wire  aw_free = ~AWVALID | io_channels_write_address_channel_AWREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 279:26]
+  wire  w_free = ~WVALID | io_channels_write_data_channel_WREADY; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 280:25]
+  wire  read_grant = io_bundle_read & ~io_bundle_write & ar_free & (read_count != 3'h4 |
+    io_channels_read_data_channel_RVALID); // @[4-soc/src/main/scala/bus/AXI4Lite.scala 285:48]
+  wire  write_grant = io_bundle_write & aw_free & w_free & (write_count != 3'h4 |
+    io_channels_write_response_channel_BVALID); // @[4-soc/src/main/scala/bus/AXI4Lite.scala 287:43]
+  wire [2:0] _GEN_0 = {{2'd0}, read_grant}; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 313:29]
+  wire [2:0] _read_count_T_1 = read_count + _GEN_0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 313:29]
+  wire [2:0] _GEN_1 = {{2'd0}, io_channels_read_data_channel_RVALID}; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 313:50]
+  wire [2:0] _read_count_T_3 = _read_count_T_1 - _GEN_1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 313:50]
+  wire [2:0] _GEN_2 = {{2'd0}, write_grant}; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 314:31]
+  wire [2:0] _write_count_T_1 = write_count + _GEN_2; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 314:31]
+  wire [2:0] _GEN_3 = {{2'd0}, io_channels_write_response_channel_BVALID}; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 314:53]
+  wire [2:0] _write_count_T_3 = _write_count_T_1 - _GEN_3; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 314:53]
+  assign io_channels_write_address_channel_AWVALID = AWVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 258:45]
+  assign io_channels_write_address_channel_AWADDR = write_addr; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 260:44]
+  assign io_channels_write_data_channel_WVALID = WVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 263:41]
+  assign io_channels_write_data_channel_WDATA = write_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 265:40]
+  assign io_channels_write_data_channel_WSTRB = {io_channels_write_data_channel_WSTRB_hi,
+    io_channels_write_data_channel_WSTRB_lo}; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 267:58]
+  assign io_channels_write_response_channel_BREADY = 1'h1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 268:45]
+  assign io_channels_read_address_channel_ARVALID = ARVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 244:44]
+  assign io_channels_read_address_channel_ARADDR = read_addr; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 246:43]
+  assign io_channels_read_data_channel_RREADY = 1'h1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 248:43]
+  assign io_bundle_read_data = read_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 253:23]
+  assign io_bundle_granted = read_grant | write_grant; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 288:35]
+  assign io_bundle_busy = read_count != 3'h0 | write_count != 3'h0 | read_valid | write_valid; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 289:83]
+  assign io_bundle_read_valid = read_valid; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 251:24]
+  assign io_bundle_write_valid = write_valid; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 271:25]
+  always @(posedge clock) begin
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 243:24]
+      ARVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 243:24]
+    end else if (read_grant) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 291:20]
+      ARVALID <= 1'h1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 293:15]
+    end else if (io_channels_read_address_channel_ARREADY) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 294:55]
+      ARVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 295:13]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 245:26]
+      read_addr <= 32'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 245:26]
+    end else if (read_grant) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 291:20]
+      read_addr <= io_bundle_address; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 292:15]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 250:27]
+      read_valid <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 250:27]
+    end else begin
+      read_valid <= io_channels_read_data_channel_RVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 316:23]
     end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 282:24]
-      AWVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 282:24]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      if (!(io_bundle_read & ~io_bundle_write)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 305:48]
-        AWVALID <= _GEN_6;
-      end
-    end else if (!(3'h2 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      if (3'h4 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-        AWVALID <= _GEN_25;
-      end else begin
-        AWVALID <= _GEN_34;
-      end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 252:26]
+      read_data <= 32'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 252:26]
+    end else if (io_channels_read_data_channel_RVALID) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 319:16]
+      read_data <= io_channels_read_data_channel_RDATA; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 320:15]
     end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 284:23]
-      WVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 284:23]
-    end else if (3'h0 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      if (!(io_bundle_read & ~io_bundle_write)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 305:48]
-        WVALID <= _GEN_7;
-      end
-    end else if (!(3'h2 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      if (3'h4 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-        WVALID <= _GEN_26;
-      end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 254:27]
+      read_count <= 3'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 254:27]
+    end else begin
+      read_count <= _read_count_T_3; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 313:15]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 257:24]
+      AWVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 257:24]
+    end else if (write_grant) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 298:21]
+      AWVALID <= 1'h1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 302:18]
+    end else if (io_channels_write_address_channel_AWREADY) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 305:53]
+      AWVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 306:15]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 259:27]
+      write_addr <= 32'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 259:27]
+    end else if (write_grant) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 298:21]
+      write_addr <= io_bundle_address; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:18]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 262:23]
+      WVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 262:23]
+    end else if (write_grant) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 298:21]
+      WVALID <= 1'h1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 303:18]
+    end else if (io_channels_write_data_channel_WREADY) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 308:49]
+      WVALID <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 309:14]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 264:27]
+      write_data <= 32'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 264:27]
+    end else if (write_grant) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 298:21]
+      write_data <= io_bundle_write_data; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 300:18]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 266:29]
+      write_strobe_0 <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 266:29]
+    end else if (write_grant) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 298:21]
+      write_strobe_0 <= io_bundle_write_strobe_0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 301:18]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 266:29]
+      write_strobe_1 <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 266:29]
+    end else if (write_grant) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 298:21]
+      write_strobe_1 <= io_bundle_write_strobe_1; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 301:18]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 266:29]
+      write_strobe_2 <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 266:29]
+    end else if (write_grant) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 298:21]
+      write_strobe_2 <= io_bundle_write_strobe_2; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 301:18]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 266:29]
+      write_strobe_3 <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 266:29]
+    end else if (write_grant) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 298:21]
+      write_strobe_3 <= io_bundle_write_strobe_3; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 301:18]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 270:28]
+      write_valid <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 270:28]
+    end else begin
+      write_valid <= io_channels_write_response_channel_BVALID; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 317:23]
     end
-    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 286:23]
-      BREADY <= 1'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 286:23]
-    end else if (!(3'h0 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-      if (!(3'h2 == state)) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-        if (3'h4 == state) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 299:17]
-          BREADY <= _GEN_27;
-        end else begin
-          BREADY <= _GEN_35;
-        end
-      end
+    if (reset) begin // @[4-soc/src/main/scala/bus/AXI4Lite.scala 272:28]
+      write_count <= 3'h0; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 272:28]
+    end else begin
+      write_count <= _write_count_T_3; // @[4-soc/src/main/scala/bus/AXI4Lite.scala 314:15]
     end
   end
 // Register and memory initialization
@@ -10172,35 +12494,35 @@ initial begin
     `endif
 `ifdef RANDOMIZE_REG_INIT
   _RAND_0 = {1{`RANDOM}};
-  state = _RAND_0[2:0];
+  ARVALID = _RAND_0[0:0];
   _RAND_1 = {1{`RANDOM}};
-  addr = _RAND_1[31:0];
+  read_addr = _RAND_1[31:0];
   _RAND_2 = {1{`RANDOM}};
   read_valid = _RAND_2[0:0];
   _RAND_3 = {1{`RANDOM}};
   read_data = _RAND_3[31:0];
   _RAND_4 = {1{`RANDOM}};
-  ARVALID = _RAND_4[0:0];
+  read_count = _RAND_4[2:0];
   _RAND_5 = {1{`RANDOM}};
-  RREADY = _RAND_5[0:0];
+  AWVALID = _RAND_5[0:0];
   _RAND_6 = {1{`RANDOM}};
-  write_valid = _RAND_6[0:0];
+  write_addr = _RAND_6[31:0];
   _RAND_7 = {1{`RANDOM}};
-  write_data = _RAND_7[31:0];
+  WVALID = _RAND_7[0:0];
   _RAND_8 = {1{`RANDOM}};
-  write_strobe_0 = _RAND_8[0:0];
+  write_data = _RAND_8[31:0];
   _RAND_9 = {1{`RANDOM}};
-  write_strobe_1 = _RAND_9[0:0];
+  write_strobe_0 = _RAND_9[0:0];
   _RAND_10 = {1{`RANDOM}};
-  write_strobe_2 = _RAND_10[0:0];
+  write_strobe_1 = _RAND_10[0:0];
   _RAND_11 = {1{`RANDOM}};
-  write_strobe_3 = _RAND_11[0:0];
+  write_strobe_2 = _RAND_11[0:0];
   _RAND_12 = {1{`RANDOM}};
-  AWVALID = _RAND_12[0:0];
+  write_strobe_3 = _RAND_12[0:0];
   _RAND_13 = {1{`RANDOM}};
-  WVALID = _RAND_13[0:0];
+  write_valid = _RAND_13[0:0];
   _RAND_14 = {1{`RANDOM}};
-  BREADY = _RAND_14[0:0];
+  write_count = _RAND_14[2:0];
 `endif // RANDOMIZE_REG_INIT
   `endif // RANDOMIZE
 end // initial
@@ -10215,6 +12537,12 @@ module CPU(
   output [31:0] io_instruction_address, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
   input  [31:0] io_instruction, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
   input         io_instruction_valid, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
+  input         io_icache_enable, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
+  output        io_icache_refill_request, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
+  output [31:0] io_icache_refill_address, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
+  input  [31:0] io_icache_refill_data, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
+  input         io_icache_refill_data_valid, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
+  input         io_dcache_enable, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
   output        io_axi4_channels_write_address_channel_AWVALID, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
   input         io_axi4_channels_write_address_channel_AWREADY, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
   output [31:0] io_axi4_channels_write_address_channel_AWADDR, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
@@ -10235,97 +12563,512 @@ module CPU(
   output [31:0] io_debug_read_data, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
   input  [11:0] io_csr_debug_read_address, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
   output [31:0] io_csr_debug_read_data, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
-  output [31:0] io_bus_address // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
+  output        io_retire_reg_valid, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
+  output [31:0] io_retire_reg_pc, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
+  output [4:0]  io_retire_reg_rd, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
+  output [31:0] io_retire_reg_data, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
+  output        io_retire_store_valid, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
+  output [31:0] io_retire_store_address, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
+  output [31:0] io_retire_store_data, // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
+  output [3:0]  io_retire_store_strobe // @[4-soc/src/main/scala/riscv/core/CPU.scala 14:14]
+);
+  wire  cpu_clock; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire  cpu_reset; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire [31:0] cpu_io_instruction_address; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire [31:0] cpu_io_instruction; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire  cpu_io_instruction_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire  cpu_io_icache_enable; // @[4-soc/src/main/scala/riscv/core/CPU.scala 19:23]
+  wire  cpu_io_dcache_enable; // @[4-soc/src/main/scala/riscv/core/CPU.scala 19:23]
+  wire  cpu_io_icache_refill_request; // @[4-soc/src/main/scala/riscv/core/CPU.scala 19:23]
+  wire [31:0] cpu_io_icache_refill_address; // @[4-soc/src/main/scala/riscv/core/CPU.scala 19:23]
+  wire [31:0] cpu_io_icache_refill_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 19:23]
+  wire  cpu_io_icache_refill_data_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 19:23]
+  wire [31:0] cpu_io_memory_bundle_address; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire  cpu_io_memory_bundle_read; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire [31:0] cpu_io_memory_bundle_read_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire  cpu_io_memory_bundle_read_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire  cpu_io_memory_bundle_write; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire [31:0] cpu_io_memory_bundle_write_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire  cpu_io_memory_bundle_write_strobe_0; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire  cpu_io_memory_bundle_write_strobe_1; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire  cpu_io_memory_bundle_write_strobe_2; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire  cpu_io_memory_bundle_write_strobe_3; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire  cpu_io_memory_bundle_write_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire  cpu_io_memory_bundle_busy; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire  cpu_io_memory_bundle_request; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire  cpu_io_memory_bundle_granted; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire [2:0] cpu_io_device_select; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire [31:0] cpu_io_interrupt_flag; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire [4:0] cpu_io_debug_read_address; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire [31:0] cpu_io_debug_read_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire [11:0] cpu_io_csr_debug_read_address; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire [31:0] cpu_io_csr_debug_read_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire  cpu_io_retire_reg_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire [31:0] cpu_io_retire_reg_pc; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire [4:0] cpu_io_retire_reg_rd; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire [31:0] cpu_io_retire_reg_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire  cpu_io_retire_store_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire [31:0] cpu_io_retire_store_address; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire [31:0] cpu_io_retire_store_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire [3:0] cpu_io_retire_store_strobe; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+  wire  axi_master_clock; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire  axi_master_reset; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire  axi_master_io_channels_write_address_channel_AWVALID; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire  axi_master_io_channels_write_address_channel_AWREADY; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire [31:0] axi_master_io_channels_write_address_channel_AWADDR; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire  axi_master_io_channels_write_data_channel_WVALID; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire  axi_master_io_channels_write_data_channel_WREADY; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire [31:0] axi_master_io_channels_write_data_channel_WDATA; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire [3:0] axi_master_io_channels_write_data_channel_WSTRB; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire  axi_master_io_channels_write_response_channel_BVALID; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire  axi_master_io_channels_write_response_channel_BREADY; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire  axi_master_io_channels_read_address_channel_ARVALID; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire  axi_master_io_channels_read_address_channel_ARREADY; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire [31:0] axi_master_io_channels_read_address_channel_ARADDR; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire  axi_master_io_channels_read_data_channel_RVALID; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire  axi_master_io_channels_read_data_channel_RREADY; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire [31:0] axi_master_io_channels_read_data_channel_RDATA; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire [31:0] axi_master_io_bundle_address; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire  axi_master_io_bundle_read; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire  axi_master_io_bundle_write; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire [31:0] axi_master_io_bundle_read_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire [31:0] axi_master_io_bundle_write_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire  axi_master_io_bundle_write_strobe_0; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire  axi_master_io_bundle_write_strobe_1; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire  axi_master_io_bundle_write_strobe_2; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire  axi_master_io_bundle_write_strobe_3; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire  axi_master_io_bundle_granted; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire  axi_master_io_bundle_busy; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire  axi_master_io_bundle_read_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  wire  axi_master_io_bundle_write_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  PipelinedCPU cpu ( // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
+    .clock(cpu_clock),
+    .reset(cpu_reset),
+    .io_instruction_address(cpu_io_instruction_address),
+    .io_instruction(cpu_io_instruction),
+    .io_instruction_valid(cpu_io_instruction_valid),
+    .io_icache_enable(cpu_io_icache_enable),
+    .io_icache_refill_request(cpu_io_icache_refill_request),
+    .io_icache_refill_address(cpu_io_icache_refill_address),
+    .io_icache_refill_data(cpu_io_icache_refill_data),
+    .io_icache_refill_data_valid(cpu_io_icache_refill_data_valid),
+    .io_dcache_enable(cpu_io_dcache_enable),
+    .io_memory_bundle_address(cpu_io_memory_bundle_address),
+    .io_memory_bundle_read(cpu_io_memory_bundle_read),
+    .io_memory_bundle_read_data(cpu_io_memory_bundle_read_data),
+    .io_memory_bundle_read_valid(cpu_io_memory_bundle_read_valid),
+    .io_memory_bundle_write(cpu_io_memory_bundle_write),
+    .io_memory_bundle_write_data(cpu_io_memory_bundle_write_data),
+    .io_memory_bundle_write_strobe_0(cpu_io_memory_bundle_write_strobe_0),
+    .io_memory_bundle_write_strobe_1(cpu_io_memory_bundle_write_strobe_1),
+    .io_memory_bundle_write_strobe_2(cpu_io_memory_bundle_write_strobe_2),
+    .io_memory_bundle_write_strobe_3(cpu_io_memory_bundle_write_strobe_3),
+    .io_memory_bundle_write_valid(cpu_io_memory_bundle_write_valid),
+    .io_memory_bundle_busy(cpu_io_memory_bundle_busy),
+    .io_memory_bundle_request(cpu_io_memory_bundle_request),
+    .io_memory_bundle_granted(cpu_io_memory_bundle_granted),
+    .io_device_select(cpu_io_device_select),
+    .io_interrupt_flag(cpu_io_interrupt_flag),
+    .io_debug_read_address(cpu_io_debug_read_address),
+    .io_debug_read_data(cpu_io_debug_read_data),
+    .io_csr_debug_read_address(cpu_io_csr_debug_read_address),
+    .io_csr_debug_read_data(cpu_io_csr_debug_read_data),
+    .io_retire_reg_valid(cpu_io_retire_reg_valid),
+    .io_retire_reg_pc(cpu_io_retire_reg_pc),
+    .io_retire_reg_rd(cpu_io_retire_reg_rd),
+    .io_retire_reg_data(cpu_io_retire_reg_data),
+    .io_retire_store_valid(cpu_io_retire_store_valid),
+    .io_retire_store_address(cpu_io_retire_store_address),
+    .io_retire_store_data(cpu_io_retire_store_data),
+    .io_retire_store_strobe(cpu_io_retire_store_strobe)
+  );
+  AXI4LiteMaster axi_master ( // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+    .clock(axi_master_clock),
+    .reset(axi_master_reset),
+    .io_channels_write_address_channel_AWVALID(axi_master_io_channels_write_address_channel_AWVALID),
+    .io_channels_write_address_channel_AWREADY(axi_master_io_channels_write_address_channel_AWREADY),
+    .io_channels_write_address_channel_AWADDR(axi_master_io_channels_write_address_channel_AWADDR),
+    .io_channels_write_data_channel_WVALID(axi_master_io_channels_write_data_channel_WVALID),
+    .io_channels_write_data_channel_WREADY(axi_master_io_channels_write_data_channel_WREADY),
+    .io_channels_write_data_channel_WDATA(axi_master_io_channels_write_data_channel_WDATA),
+    .io_channels_write_data_channel_WSTRB(axi_master_io_channels_write_data_channel_WSTRB),
+    .io_channels_write_response_channel_BVALID(axi_master_io_channels_write_response_channel_BVALID),
+    .io_channels_write_response_channel_BREADY(axi_master_io_channels_write_response_channel_BREADY),
+    .io_channels_read_address_channel_ARVALID(axi_master_io_channels_read_address_channel_ARVALID),
+    .io_channels_read_address_channel_ARREADY(axi_master_io_channels_read_address_channel_ARREADY),
+    .io_channels_read_address_channel_ARADDR(axi_master_io_channels_read_address_channel_ARADDR),
+    .io_channels_read_data_channel_RVALID(axi_master_io_channels_read_data_channel_RVALID),
+    .io_channels_read_data_channel_RREADY(axi_master_io_channels_read_data_channel_RREADY),
+    .io_channels_read_data_channel_RDATA(axi_master_io_channels_read_data_channel_RDATA),
+    .io_bundle_address(axi_master_io_bundle_address),
+    .io_bundle_read(axi_master_io_bundle_read),
+    .io_bundle_write(axi_master_io_bundle_write),
+    .io_bundle_read_data(axi_master_io_bundle_read_data),
+    .io_bundle_write_data(axi_master_io_bundle_write_data),
+    .io_bundle_write_strobe_0(axi_master_io_bundle_write_strobe_0),
+    .io_bundle_write_strobe_1(axi_master_io_bundle_write_strobe_1),
+    .io_bundle_write_strobe_2(axi_master_io_bundle_write_strobe_2),
+    .io_bundle_write_strobe_3(axi_master_io_bundle_write_strobe_3),
+    .io_bundle_granted(axi_master_io_bundle_granted),
+    .io_bundle_busy(axi_master_io_bundle_busy),
+    .io_bundle_read_valid(axi_master_io_bundle_read_valid),
+    .io_bundle_write_valid(axi_master_io_bundle_write_valid)
+  );
+  assign io_instruction_address = cpu_io_instruction_address; // @[4-soc/src/main/scala/riscv/core/CPU.scala 21:32]
+  assign io_axi4_channels_write_address_channel_AWVALID = axi_master_io_channels_write_address_channel_AWVALID; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
+  assign io_axi4_channels_write_address_channel_AWADDR = axi_master_io_channels_write_address_channel_AWADDR; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
+  assign io_axi4_channels_write_data_channel_WVALID = axi_master_io_channels_write_data_channel_WVALID; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
+  assign io_axi4_channels_write_data_channel_WDATA = axi_master_io_channels_write_data_channel_WDATA; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
+  assign io_axi4_channels_write_data_channel_WSTRB = axi_master_io_channels_write_data_channel_WSTRB; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
+  assign io_axi4_channels_write_response_channel_BREADY = axi_master_io_channels_write_response_channel_BREADY; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
+  assign io_axi4_channels_read_address_channel_ARVALID = axi_master_io_channels_read_address_channel_ARVALID; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
+  assign io_axi4_channels_read_address_channel_ARADDR = axi_master_io_channels_read_address_channel_ARADDR; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
+  assign io_axi4_channels_read_data_channel_RREADY = axi_master_io_channels_read_data_channel_RREADY; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
+  assign io_debug_read_data = cpu_io_debug_read_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 102:33]
+  assign io_csr_debug_read_data = cpu_io_csr_debug_read_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 105:37]
+  assign io_retire_reg_valid = cpu_io_retire_reg_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 107:17]
+  assign io_retire_reg_pc = cpu_io_retire_reg_pc; // @[4-soc/src/main/scala/riscv/core/CPU.scala 107:17]
+  assign io_retire_reg_rd = cpu_io_retire_reg_rd; // @[4-soc/src/main/scala/riscv/core/CPU.scala 107:17]
+  assign io_retire_reg_data = cpu_io_retire_reg_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 107:17]
+  assign io_retire_store_valid = cpu_io_retire_store_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 107:17]
+  assign io_retire_store_address = cpu_io_retire_store_address; // @[4-soc/src/main/scala/riscv/core/CPU.scala 107:17]
+  assign io_retire_store_data = cpu_io_retire_store_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 107:17]
+  assign io_retire_store_strobe = cpu_io_retire_store_strobe; // @[4-soc/src/main/scala/riscv/core/CPU.scala 107:17]
+  assign cpu_clock = clock;
+  assign cpu_reset = reset;
+  assign cpu_io_instruction = io_instruction; // @[4-soc/src/main/scala/riscv/core/CPU.scala 22:32]
+  assign io_icache_refill_request = cpu_io_icache_refill_request; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:24]
+  assign io_icache_refill_address = cpu_io_icache_refill_address; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:24]
+  assign cpu_io_instruction_valid = io_instruction_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 23:32]
+  assign cpu_io_icache_enable = io_icache_enable; // @[4-soc/src/main/scala/riscv/core/CPU.scala 25:32]
+  assign cpu_io_dcache_enable = io_dcache_enable; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:32]
+  assign cpu_io_icache_refill_data = io_icache_refill_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:24]
+  assign cpu_io_icache_refill_data_valid = io_icache_refill_data_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:24]
+  assign cpu_io_memory_bundle_read_data = axi_master_io_bundle_read_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 39:48]
+  assign cpu_io_memory_bundle_read_valid = axi_master_io_bundle_read_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 40:48]
+  assign cpu_io_memory_bundle_write_valid = axi_master_io_bundle_write_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 41:48]
+  assign cpu_io_memory_bundle_busy = axi_master_io_bundle_busy; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:48]
+  assign cpu_io_memory_bundle_granted = axi_master_io_bundle_granted; // @[4-soc/src/main/scala/riscv/core/CPU.scala 48:48]
+  assign cpu_io_interrupt_flag = io_interrupt_flag; // @[4-soc/src/main/scala/riscv/core/CPU.scala 98:29]
+  assign cpu_io_debug_read_address = io_debug_read_address; // @[4-soc/src/main/scala/riscv/core/CPU.scala 101:33]
+  assign cpu_io_csr_debug_read_address = io_csr_debug_read_address; // @[4-soc/src/main/scala/riscv/core/CPU.scala 104:37]
+  assign axi_master_clock = clock;
+  assign axi_master_reset = reset;
+  assign axi_master_io_channels_write_address_channel_AWREADY = io_axi4_channels_write_address_channel_AWREADY; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
+  assign axi_master_io_channels_write_data_channel_WREADY = io_axi4_channels_write_data_channel_WREADY; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
+  assign axi_master_io_channels_write_response_channel_BVALID = io_axi4_channels_write_response_channel_BVALID; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
+  assign axi_master_io_channels_read_address_channel_ARREADY = io_axi4_channels_read_address_channel_ARREADY; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
+  assign axi_master_io_channels_read_data_channel_RVALID = io_axi4_channels_read_data_channel_RVALID; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
+  assign axi_master_io_channels_read_data_channel_RDATA = io_axi4_channels_read_data_channel_RDATA; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
+  assign axi_master_io_bundle_address = {cpu_io_device_select,cpu_io_memory_bundle_address[28:0]}; // @[4-soc/src/main/scala/riscv/core/CPU.scala 29:51]
+  assign axi_master_io_bundle_read = cpu_io_memory_bundle_request & cpu_io_memory_bundle_read; // @[4-soc/src/main/scala/riscv/core/CPU.scala 34:73]
+  assign axi_master_io_bundle_write = cpu_io_memory_bundle_request & cpu_io_memory_bundle_write; // @[4-soc/src/main/scala/riscv/core/CPU.scala 35:73]
+  assign axi_master_io_bundle_write_data = cpu_io_memory_bundle_write_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 36:41]
+  assign axi_master_io_bundle_write_strobe_0 = cpu_io_memory_bundle_write_strobe_0; // @[4-soc/src/main/scala/riscv/core/CPU.scala 37:41]
+  assign axi_master_io_bundle_write_strobe_1 = cpu_io_memory_bundle_write_strobe_1; // @[4-soc/src/main/scala/riscv/core/CPU.scala 37:41]
+  assign axi_master_io_bundle_write_strobe_2 = cpu_io_memory_bundle_write_strobe_2; // @[4-soc/src/main/scala/riscv/core/CPU.scala 37:41]
+  assign axi_master_io_bundle_write_strobe_3 = cpu_io_memory_bundle_write_strobe_3; // @[4-soc/src/main/scala/riscv/core/CPU.scala 37:41]
+endmodule
+module Queue_1(
+  input         clock,
+  input         reset,
+  input         io_enq_valid, // @[src/main/scala/chisel3/util/Decoupled.scala 278:14]
+  input  [31:0] io_enq_bits, // @[src/main/scala/chisel3/util/Decoupled.scala 278:14]
+  input         io_deq_ready, // @[src/main/scala/chisel3/util/Decoupled.scala 278:14]
+  output        io_deq_valid, // @[src/main/scala/chisel3/util/Decoupled.scala 278:14]
+  output [31:0] io_deq_bits, // @[src/main/scala/chisel3/util/Decoupled.scala 278:14]
+  output [2:0]  io_count // @[src/main/scala/chisel3/util/Decoupled.scala 278:14]
+);
+`ifdef RANDOMIZE_MEM_INIT
+  reg [31:0] _RAND_0;
+`endif // RANDOMIZE_MEM_INIT
+`ifdef RANDOMIZE_REG_INIT
+  reg [31:0] _RAND_1;
+  reg [31:0] _RAND_2;
+  reg [31:0] _RAND_3;
+`endif // RANDOMIZE_REG_INIT
+  reg [31:0] ram [0:3]; // @[src/main/scala/chisel3/util/Decoupled.scala 279:95]
+  wire  ram_io_deq_bits_MPORT_en; // @[src/main/scala/chisel3/util/Decoupled.scala 279:95]
+  wire [1:0] ram_io_deq_bits_MPORT_addr; // @[src/main/scala/chisel3/util/Decoupled.scala 279:95]
+  wire [31:0] ram_io_deq_bits_MPORT_data; // @[src/main/scala/chisel3/util/Decoupled.scala 279:95]
+  wire [31:0] ram_MPORT_data; // @[src/main/scala/chisel3/util/Decoupled.scala 279:95]
+  wire [1:0] ram_MPORT_addr; // @[src/main/scala/chisel3/util/Decoupled.scala 279:95]
+  wire  ram_MPORT_mask; // @[src/main/scala/chisel3/util/Decoupled.scala 279:95]
+  wire  ram_MPORT_en; // @[src/main/scala/chisel3/util/Decoupled.scala 279:95]
+  reg [1:0] enq_ptr_value; // @[src/main/scala/chisel3/util/Counter.scala 61:40]
+  reg [1:0] deq_ptr_value; // @[src/main/scala/chisel3/util/Counter.scala 61:40]
+  reg  maybe_full; // @[src/main/scala/chisel3/util/Decoupled.scala 282:27]
+  wire  ptr_match = enq_ptr_value == deq_ptr_value; // @[src/main/scala/chisel3/util/Decoupled.scala 283:33]
+  wire  empty = ptr_match & ~maybe_full; // @[src/main/scala/chisel3/util/Decoupled.scala 284:25]
+  wire  full = ptr_match & maybe_full; // @[src/main/scala/chisel3/util/Decoupled.scala 285:24]
+  wire  do_enq = ~full & io_enq_valid; // @[src/main/scala/chisel3/util/Decoupled.scala 57:35]
+  wire  do_deq = io_deq_ready & io_deq_valid; // @[src/main/scala/chisel3/util/Decoupled.scala 57:35]
+  wire [1:0] _value_T_1 = enq_ptr_value + 2'h1; // @[src/main/scala/chisel3/util/Counter.scala 77:24]
+  wire [1:0] _value_T_3 = deq_ptr_value + 2'h1; // @[src/main/scala/chisel3/util/Counter.scala 77:24]
+  wire [1:0] ptr_diff = enq_ptr_value - deq_ptr_value; // @[src/main/scala/chisel3/util/Decoupled.scala 332:32]
+  wire [2:0] _io_count_T_1 = maybe_full & ptr_match ? 3'h4 : 3'h0; // @[src/main/scala/chisel3/util/Decoupled.scala 335:20]
+  wire [2:0] _GEN_12 = {{1'd0}, ptr_diff}; // @[src/main/scala/chisel3/util/Decoupled.scala 335:62]
+  assign ram_io_deq_bits_MPORT_en = 1'h1;
+  assign ram_io_deq_bits_MPORT_addr = deq_ptr_value;
+  assign ram_io_deq_bits_MPORT_data = ram[ram_io_deq_bits_MPORT_addr]; // @[src/main/scala/chisel3/util/Decoupled.scala 279:95]
+  assign ram_MPORT_data = io_enq_bits;
+  assign ram_MPORT_addr = enq_ptr_value;
+  assign ram_MPORT_mask = 1'h1;
+  assign ram_MPORT_en = ~full & io_enq_valid;
+  assign io_deq_valid = ~empty; // @[src/main/scala/chisel3/util/Decoupled.scala 308:19]
+  assign io_deq_bits = ram_io_deq_bits_MPORT_data; // @[src/main/scala/chisel3/util/Decoupled.scala 316:17]
+  assign io_count = _io_count_T_1 | _GEN_12; // @[src/main/scala/chisel3/util/Decoupled.scala 335:62]
+  always @(posedge clock) begin
+    if (ram_MPORT_en & ram_MPORT_mask) begin
+      ram[ram_MPORT_addr] <= ram_MPORT_data; // @[src/main/scala/chisel3/util/Decoupled.scala 279:95]
+    end
+    if (reset) begin // @[src/main/scala/chisel3/util/Counter.scala 61:40]
+      enq_ptr_value <= 2'h0; // @[src/main/scala/chisel3/util/Counter.scala 61:40]
+    end else if (do_enq) begin // @[src/main/scala/chisel3/util/Decoupled.scala 292:16]
+      enq_ptr_value <= _value_T_1; // @[src/main/scala/chisel3/util/Counter.scala 77:15]
+    end
+    if (reset) begin // @[src/main/scala/chisel3/util/Counter.scala 61:40]
+      deq_ptr_value <= 2'h0; // @[src/main/scala/chisel3/util/Counter.scala 61:40]
+    end else if (do_deq) begin // @[src/main/scala/chisel3/util/Decoupled.scala 296:16]
+      deq_ptr_value <= _value_T_3; // @[src/main/scala/chisel3/util/Counter.scala 77:15]
+    end
+    if (reset) begin // @[src/main/scala/chisel3/util/Decoupled.scala 282:27]
+      maybe_full <= 1'h0; // @[src/main/scala/chisel3/util/Decoupled.scala 282:27]
+    end else if (do_enq != do_deq) begin // @[src/main/scala/chisel3/util/Decoupled.scala 299:27]
+      maybe_full <= do_enq; // @[src/main/scala/chisel3/util/Decoupled.scala 300:16]
+    end
+  end
+// Register and memory initialization
+`ifdef RANDOMIZE_GARBAGE_ASSIGN
+`define RANDOMIZE
+`endif
+`ifdef RANDOMIZE_INVALID_ASSIGN
+`define RANDOMIZE
+`endif
+`ifdef RANDOMIZE_REG_INIT
+`define RANDOMIZE
+`endif
+`ifdef RANDOMIZE_MEM_INIT
+`define RANDOMIZE
+`endif
+`ifndef RANDOM
+`define RANDOM $random
+`endif
+`ifdef RANDOMIZE_MEM_INIT
+  integer initvar;
+`endif
+`ifndef SYNTHESIS
+`ifdef FIRRTL_BEFORE_INITIAL
+`FIRRTL_BEFORE_INITIAL
+`endif
+initial begin
+  `ifdef RANDOMIZE
+    `ifdef INIT_RANDOM
+      `INIT_RANDOM
+    `endif
+    `ifndef VERILATOR
+      `ifdef RANDOMIZE_DELAY
+        #`RANDOMIZE_DELAY begin end
+      `else
+        #0.002 begin end
+      `endif
+    `endif
+`ifdef RANDOMIZE_MEM_INIT
+  _RAND_0 = {1{`RANDOM}};
+  for (initvar = 0; initvar < 4; initvar = initvar+1)
+    ram[initvar] = _RAND_0[31:0];
+`endif // RANDOMIZE_MEM_INIT
+`ifdef RANDOMIZE_REG_INIT
+  _RAND_1 = {1{`RANDOM}};
+  enq_ptr_value = _RAND_1[1:0];
+  _RAND_2 = {1{`RANDOM}};
+  deq_ptr_value = _RAND_2[1:0];
+  _RAND_3 = {1{`RANDOM}};
+  maybe_full = _RAND_3[0:0];
+`endif // RANDOMIZE_REG_INIT
+  `endif // RANDOMIZE
+end // initial
+`ifdef FIRRTL_AFTER_INITIAL
+`FIRRTL_AFTER_INITIAL
+`endif
+`endif // SYNTHESIS
+endmodule
+module DMA(
+  input         clock,
+  input         reset,
+  input         io_channels_write_address_channel_AWVALID, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  output        io_channels_write_address_channel_AWREADY, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  input  [7:0]  io_channels_write_address_channel_AWADDR, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  input         io_channels_write_data_channel_WVALID, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  output        io_channels_write_data_channel_WREADY, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  input  [31:0] io_channels_write_data_channel_WDATA, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  output        io_channels_write_response_channel_BVALID, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  input         io_channels_write_response_channel_BREADY, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  input         io_channels_read_address_channel_ARVALID, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  output        io_channels_read_address_channel_ARREADY, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  input  [7:0]  io_channels_read_address_channel_ARADDR, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  output        io_channels_read_data_channel_RVALID, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  input         io_channels_read_data_channel_RREADY, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  output [31:0] io_channels_read_data_channel_RDATA, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  output        io_master_write_address_channel_AWVALID, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  input         io_master_write_address_channel_AWREADY, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  output [31:0] io_master_write_address_channel_AWADDR, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  output        io_master_write_data_channel_WVALID, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  input         io_master_write_data_channel_WREADY, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  output [31:0] io_master_write_data_channel_WDATA, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  output [3:0]  io_master_write_data_channel_WSTRB, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  input         io_master_write_response_channel_BVALID, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  output        io_master_write_response_channel_BREADY, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  output        io_master_read_address_channel_ARVALID, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  input         io_master_read_address_channel_ARREADY, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  output [31:0] io_master_read_address_channel_ARADDR, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  input         io_master_read_data_channel_RVALID, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  output        io_master_read_data_channel_RREADY, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  input  [31:0] io_master_read_data_channel_RDATA, // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
+  output        io_signal_interrupt // @[4-soc/src/main/scala/peripheral/DMA.scala 51:14]
 );
 `ifdef RANDOMIZE_REG_INIT
   reg [31:0] _RAND_0;
+  reg [31:0] _RAND_1;
+  reg [31:0] _RAND_2;
+  reg [31:0] _RAND_3;
+  reg [31:0] _RAND_4;
+  reg [31:0] _RAND_5;
+  reg [31:0] _RAND_6;
+  reg [31:0] _RAND_7;
+  reg [31:0] _RAND_8;
+  reg [31:0] _RAND_9;
 `endif // RANDOMIZE_REG_INIT
-  wire  cpu_clock; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire  cpu_reset; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire [31:0] cpu_io_instruction_address; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire [31:0] cpu_io_instruction; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire  cpu_io_instruction_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire [31:0] cpu_io_memory_bundle_address; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire  cpu_io_memory_bundle_read; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire [31:0] cpu_io_memory_bundle_read_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire  cpu_io_memory_bundle_read_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire  cpu_io_memory_bundle_write; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire [31:0] cpu_io_memory_bundle_write_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire  cpu_io_memory_bundle_write_strobe_0; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire  cpu_io_memory_bundle_write_strobe_1; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire  cpu_io_memory_bundle_write_strobe_2; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire  cpu_io_memory_bundle_write_strobe_3; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire  cpu_io_memory_bundle_write_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire  cpu_io_memory_bundle_request; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire  cpu_io_memory_bundle_granted; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire [2:0] cpu_io_device_select; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire [31:0] cpu_io_interrupt_flag; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire [4:0] cpu_io_debug_read_address; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire [31:0] cpu_io_debug_read_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire [11:0] cpu_io_csr_debug_read_address; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire [31:0] cpu_io_csr_debug_read_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-  wire  axi_master_clock; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire  axi_master_reset; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire  axi_master_io_channels_write_address_channel_AWVALID; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire  axi_master_io_channels_write_address_channel_AWREADY; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire [31:0] axi_master_io_channels_write_address_channel_AWADDR; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire  axi_master_io_channels_write_data_channel_WVALID; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire  axi_master_io_channels_write_data_channel_WREADY; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire [31:0] axi_master_io_channels_write_data_channel_WDATA; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire [3:0] axi_master_io_channels_write_data_channel_WSTRB; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire  axi_master_io_channels_write_response_channel_BVALID; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire  axi_master_io_channels_write_response_channel_BREADY; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire  axi_master_io_channels_read_address_channel_ARVALID; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire  axi_master_io_channels_read_address_channel_ARREADY; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire [31:0] axi_master_io_channels_read_address_channel_ARADDR; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire  axi_master_io_channels_read_data_channel_RVALID; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire  axi_master_io_channels_read_data_channel_RREADY; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire [31:0] axi_master_io_channels_read_data_channel_RDATA; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire [31:0] axi_master_io_bundle_address; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire  axi_master_io_bundle_read; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire  axi_master_io_bundle_write; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire [31:0] axi_master_io_bundle_read_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire [31:0] axi_master_io_bundle_write_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire  axi_master_io_bundle_write_strobe_0; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire  axi_master_io_bundle_write_strobe_1; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire  axi_master_io_bundle_write_strobe_2; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire  axi_master_io_bundle_write_strobe_3; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire  axi_master_io_bundle_busy; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire  axi_master_io_bundle_read_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire  axi_master_io_bundle_write_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
-  wire [31:0] full_bus_address = {cpu_io_device_select,cpu_io_memory_bundle_address[28:0]}; // @[4-soc/src/main/scala/riscv/core/CPU.scala 29:51]
-  wire  _cpu_io_memory_bundle_granted_T = ~axi_master_io_bundle_busy; // @[4-soc/src/main/scala/riscv/core/CPU.scala 44:51]
-  reg [31:0] bus_address_reg; // @[4-soc/src/main/scala/riscv/core/CPU.scala 69:37]
-  wire  _start_bus_transaction_T_1 = _cpu_io_memory_bundle_granted_T & cpu_io_memory_bundle_request; // @[4-soc/src/main/scala/riscv/core/CPU.scala 75:36]
-  wire  _start_bus_transaction_T_2 = cpu_io_memory_bundle_read | cpu_io_memory_bundle_write; // @[4-soc/src/main/scala/riscv/core/CPU.scala 77:38]
-  wire  start_bus_transaction = _start_bus_transaction_T_1 & _start_bus_transaction_T_2; // @[4-soc/src/main/scala/riscv/core/CPU.scala 76:40]
-  PipelinedCPU cpu ( // @[4-soc/src/main/scala/riscv/core/CPU.scala 18:23]
-    .clock(cpu_clock),
-    .reset(cpu_reset),
-    .io_instruction_address(cpu_io_instruction_address),
-    .io_instruction(cpu_io_instruction),
-    .io_instruction_valid(cpu_io_instruction_valid),
-    .io_memory_bundle_address(cpu_io_memory_bundle_address),
-    .io_memory_bundle_read(cpu_io_memory_bundle_read),
-    .io_memory_bundle_read_data(cpu_io_memory_bundle_read_data),
-    .io_memory_bundle_read_valid(cpu_io_memory_bundle_read_valid),
-    .io_memory_bundle_write(cpu_io_memory_bundle_write),
-    .io_memory_bundle_write_data(cpu_io_memory_bundle_write_data),
-    .io_memory_bundle_write_strobe_0(cpu_io_memory_bundle_write_strobe_0),
-    .io_memory_bundle_write_strobe_1(cpu_io_memory_bundle_write_strobe_1),
-    .io_memory_bundle_write_strobe_2(cpu_io_memory_bundle_write_strobe_2),
-    .io_memory_bundle_write_strobe_3(cpu_io_memory_bundle_write_strobe_3),
-    .io_memory_bundle_write_valid(cpu_io_memory_bundle_write_valid),
-    .io_memory_bundle_request(cpu_io_memory_bundle_request),
-    .io_memory_bundle_granted(cpu_io_memory_bundle_granted),
-    .io_device_select(cpu_io_device_select),
-    .io_interrupt_flag(cpu_io_interrupt_flag),
-    .io_debug_read_address(cpu_io_debug_read_address),
-    .io_debug_read_data(cpu_io_debug_read_data),
-    .io_csr_debug_read_address(cpu_io_csr_debug_read_address),
-    .io_csr_debug_read_data(cpu_io_csr_debug_read_data)
+  wire  slave_clock; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire  slave_reset; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire  slave_io_channels_write_address_channel_AWVALID; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire  slave_io_channels_write_address_channel_AWREADY; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire [7:0] slave_io_channels_write_address_channel_AWADDR; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire  slave_io_channels_write_data_channel_WVALID; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire  slave_io_channels_write_data_channel_WREADY; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire [31:0] slave_io_channels_write_data_channel_WDATA; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire  slave_io_channels_write_response_channel_BVALID; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire  slave_io_channels_write_response_channel_BREADY; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire  slave_io_channels_read_address_channel_ARVALID; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire  slave_io_channels_read_address_channel_ARREADY; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire [7:0] slave_io_channels_read_address_channel_ARADDR; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire  slave_io_channels_read_data_channel_RVALID; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire  slave_io_channels_read_data_channel_RREADY; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire [31:0] slave_io_channels_read_data_channel_RDATA; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire [7:0] slave_io_bundle_address; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire  slave_io_bundle_read; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire [31:0] slave_io_bundle_read_data; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire  slave_io_bundle_read_valid; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire  slave_io_bundle_write; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire [31:0] slave_io_bundle_write_data; // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+  wire  axi_master_clock; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire  axi_master_reset; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire  axi_master_io_channels_write_address_channel_AWVALID; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire  axi_master_io_channels_write_address_channel_AWREADY; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire [31:0] axi_master_io_channels_write_address_channel_AWADDR; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire  axi_master_io_channels_write_data_channel_WVALID; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire  axi_master_io_channels_write_data_channel_WREADY; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire [31:0] axi_master_io_channels_write_data_channel_WDATA; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire [3:0] axi_master_io_channels_write_data_channel_WSTRB; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire  axi_master_io_channels_write_response_channel_BVALID; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire  axi_master_io_channels_write_response_channel_BREADY; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire  axi_master_io_channels_read_address_channel_ARVALID; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire  axi_master_io_channels_read_address_channel_ARREADY; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire [31:0] axi_master_io_channels_read_address_channel_ARADDR; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire  axi_master_io_channels_read_data_channel_RVALID; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire  axi_master_io_channels_read_data_channel_RREADY; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire [31:0] axi_master_io_channels_read_data_channel_RDATA; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire [31:0] axi_master_io_bundle_address; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire  axi_master_io_bundle_read; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire  axi_master_io_bundle_write; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire [31:0] axi_master_io_bundle_read_data; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire [31:0] axi_master_io_bundle_write_data; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire  axi_master_io_bundle_write_strobe_0; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire  axi_master_io_bundle_write_strobe_1; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire  axi_master_io_bundle_write_strobe_2; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire  axi_master_io_bundle_write_strobe_3; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire  axi_master_io_bundle_granted; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire  axi_master_io_bundle_busy; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire  axi_master_io_bundle_read_valid; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  wire  axi_master_io_bundle_write_valid; // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
+  reg [31:0] src; // @[4-soc/src/main/scala/peripheral/DMA.scala 76:30]
+  reg [31:0] dst; // @[4-soc/src/main/scala/peripheral/DMA.scala 77:30]
+  reg [31:0] len; // @[4-soc/src/main/scala/peripheral/DMA.scala 78:30]
+  reg [31:0] src_stride; // @[4-soc/src/main/scala/peripheral/DMA.scala 79:30]
+  reg [31:0] dst_stride; // @[4-soc/src/main/scala/peripheral/DMA.scala 80:30]
+  reg  ie; // @[4-soc/src/main/scala/peripheral/DMA.scala 81:30]
+  reg  busy; // @[4-soc/src/main/scala/peripheral/DMA.scala 82:30]
+  reg  done; // @[4-soc/src/main/scala/peripheral/DMA.scala 83:30]
+  reg [31:0] reads_left; // @[4-soc/src/main/scala/peripheral/DMA.scala 84:30]
+  reg [2:0] reading; // @[4-soc/src/main/scala/peripheral/DMA.scala 85:30]
+  wire  buffer_clock; // @[4-soc/src/main/scala/peripheral/DMA.scala 87:22]
+  wire  buffer_reset; // @[4-soc/src/main/scala/peripheral/DMA.scala 87:22]
+  wire  buffer_io_enq_valid; // @[4-soc/src/main/scala/peripheral/DMA.scala 87:22]
+  wire [31:0] buffer_io_enq_bits; // @[4-soc/src/main/scala/peripheral/DMA.scala 87:22]
+  wire  buffer_io_deq_ready; // @[4-soc/src/main/scala/peripheral/DMA.scala 87:22]
+  wire  buffer_io_deq_valid; // @[4-soc/src/main/scala/peripheral/DMA.scala 87:22]
+  wire [31:0] buffer_io_deq_bits; // @[4-soc/src/main/scala/peripheral/DMA.scala 87:22]
+  wire [2:0] buffer_io_count; // @[4-soc/src/main/scala/peripheral/DMA.scala 87:22]
+  wire [7:0] addr = slave_io_bundle_address; // @[4-soc/src/main/scala/peripheral/DMA.scala 90:30]
+  wire [31:0] _slave_io_bundle_read_data_T_1 = 8'h0 == addr ? src : 32'h0; // @[src/main/scala/chisel3/util/Mux.scala 81:58]
+  wire [31:0] _slave_io_bundle_read_data_T_3 = 8'h4 == addr ? dst : _slave_io_bundle_read_data_T_1; // @[src/main/scala/chisel3/util/Mux.scala 81:58]
+  wire [31:0] _slave_io_bundle_read_data_T_5 = 8'h8 == addr ? len : _slave_io_bundle_read_data_T_3; // @[src/main/scala/chisel3/util/Mux.scala 81:58]
+  wire [31:0] _slave_io_bundle_read_data_T_7 = 8'hc == addr ? src_stride : _slave_io_bundle_read_data_T_5; // @[src/main/scala/chisel3/util/Mux.scala 81:58]
+  wire [31:0] _slave_io_bundle_read_data_T_9 = 8'h10 == addr ? dst_stride : _slave_io_bundle_read_data_T_7; // @[src/main/scala/chisel3/util/Mux.scala 81:58]
+  wire [1:0] _slave_io_bundle_read_data_T_10 = {ie,1'h0}; // @[4-soc/src/main/scala/peripheral/DMA.scala 99:29]
+  wire [31:0] _slave_io_bundle_read_data_T_11 = 8'h14 == addr ? {{30'd0}, _slave_io_bundle_read_data_T_10} : _slave_io_bundle_read_data_T_9; // @[src/main/scala/chisel3/util/Mux.scala 81:58]
+  wire [1:0] _slave_io_bundle_read_data_T_12 = {done,busy}; // @[4-soc/src/main/scala/peripheral/DMA.scala 100:29]
+  wire [31:0] _slave_io_bundle_read_data_T_13 = 8'h18 == addr ? {{30'd0}, _slave_io_bundle_read_data_T_12} : _slave_io_bundle_read_data_T_11; // @[src/main/scala/chisel3/util/Mux.scala 81:58]
+  wire  _T = addr == 8'h14; // @[4-soc/src/main/scala/peripheral/DMA.scala 107:15]
+  wire  _T_1 = addr == 8'h18; // @[4-soc/src/main/scala/peripheral/DMA.scala 110:21]
+  wire  _T_2 = addr == 8'h0; // @[4-soc/src/main/scala/peripheral/DMA.scala 115:17]
+  wire  _T_3 = addr == 8'h4; // @[4-soc/src/main/scala/peripheral/DMA.scala 117:23]
+  wire  _T_4 = addr == 8'h8; // @[4-soc/src/main/scala/peripheral/DMA.scala 119:23]
+  wire  _T_5 = addr == 8'hc; // @[4-soc/src/main/scala/peripheral/DMA.scala 121:23]
+  wire  _T_6 = addr == 8'h10; // @[4-soc/src/main/scala/peripheral/DMA.scala 123:23]
+  wire  _start_T_1 = slave_io_bundle_write_data[0] & ~busy; // @[4-soc/src/main/scala/peripheral/DMA.scala 109:35]
+  wire  start = slave_io_bundle_write & _T & _start_T_1; // @[4-soc/src/main/scala/peripheral/DMA.scala 105:28 106:36 107:33 109:13]
+  wire [31:0] _src_T_1 = {slave_io_bundle_write_data[31:2],2'h0}; // @[4-soc/src/main/scala/peripheral/DMA.scala 73:36]
+  wire  write_request = busy & buffer_io_deq_valid; // @[4-soc/src/main/scala/peripheral/DMA.scala 131:38]
+  wire [3:0] _read_request_T_2 = buffer_io_count + reading; // @[4-soc/src/main/scala/peripheral/DMA.scala 132:79]
+  wire  read_request = busy & reads_left != 32'h0 & _read_request_T_2 < 4'h4; // @[4-soc/src/main/scala/peripheral/DMA.scala 132:68]
+  wire  _axi_master_io_bundle_read_T_1 = read_request & ~write_request; // @[4-soc/src/main/scala/peripheral/DMA.scala 134:53]
+  wire  read_grant = _axi_master_io_bundle_read_T_1 & axi_master_io_bundle_granted; // @[4-soc/src/main/scala/peripheral/DMA.scala 139:52]
+  wire  write_grant = write_request & axi_master_io_bundle_granted; // @[4-soc/src/main/scala/peripheral/DMA.scala 140:39]
+  wire [2:0] _GEN_30 = {{2'd0}, read_grant}; // @[4-soc/src/main/scala/peripheral/DMA.scala 144:30]
+  wire [2:0] _reading_T_1 = reading + _GEN_30; // @[4-soc/src/main/scala/peripheral/DMA.scala 144:30]
+  wire [2:0] _GEN_31 = {{2'd0}, axi_master_io_bundle_read_valid}; // @[4-soc/src/main/scala/peripheral/DMA.scala 144:64]
+  wire [2:0] _reading_T_3 = _reading_T_1 - _GEN_31; // @[4-soc/src/main/scala/peripheral/DMA.scala 144:64]
+  wire [31:0] _src_T_3 = src + src_stride; // @[4-soc/src/main/scala/peripheral/DMA.scala 147:23]
+  wire [31:0] _reads_left_T_1 = reads_left - 32'h1; // @[4-soc/src/main/scala/peripheral/DMA.scala 148:30]
+  wire [31:0] _dst_T_3 = dst + dst_stride; // @[4-soc/src/main/scala/peripheral/DMA.scala 151:16]
+  wire [31:0] _len_T_1 = len - 32'h1; // @[4-soc/src/main/scala/peripheral/DMA.scala 152:16]
+  wire  _T_10 = busy & len == 32'h0 & ~axi_master_io_bundle_busy; // @[4-soc/src/main/scala/peripheral/DMA.scala 159:39]
+  AXI4LiteSlave_2 slave ( // @[4-soc/src/main/scala/peripheral/DMA.scala 68:21]
+    .clock(slave_clock),
+    .reset(slave_reset),
+    .io_channels_write_address_channel_AWVALID(slave_io_channels_write_address_channel_AWVALID),
+    .io_channels_write_address_channel_AWREADY(slave_io_channels_write_address_channel_AWREADY),
+    .io_channels_write_address_channel_AWADDR(slave_io_channels_write_address_channel_AWADDR),
+    .io_channels_write_data_channel_WVALID(slave_io_channels_write_data_channel_WVALID),
+    .io_channels_write_data_channel_WREADY(slave_io_channels_write_data_channel_WREADY),
+    .io_channels_write_data_channel_WDATA(slave_io_channels_write_data_channel_WDATA),
+    .io_channels_write_response_channel_BVALID(slave_io_channels_write_response_channel_BVALID),
+    .io_channels_write_response_channel_BREADY(slave_io_channels_write_response_channel_BREADY),
+    .io_channels_read_address_channel_ARVALID(slave_io_channels_read_address_channel_ARVALID),
+    .io_channels_read_address_channel_ARREADY(slave_io_channels_read_address_channel_ARREADY),
+    .io_channels_read_address_channel_ARADDR(slave_io_channels_read_address_channel_ARADDR),
+    .io_channels_read_data_channel_RVALID(slave_io_channels_read_data_channel_RVALID),
+    .io_channels_read_data_channel_RREADY(slave_io_channels_read_data_channel_RREADY),
+    .io_channels_read_data_channel_RDATA(slave_io_channels_read_data_channel_RDATA),
+    .io_bundle_address(slave_io_bundle_address),
+    .io_bundle_read(slave_io_bundle_read),
+    .io_bundle_read_data(slave_io_bundle_read_data),
+    .io_bundle_read_valid(slave_io_bundle_read_valid),
+    .io_bundle_write(slave_io_bundle_write),
+    .io_bundle_write_data(slave_io_bundle_write_data)
   );
-  AXI4LiteMaster axi_master ( // @[4-soc/src/main/scala/riscv/core/CPU.scala 26:30]
+  AXI4LiteMaster axi_master ( // @[4-soc/src/main/scala/peripheral/DMA.scala 70:26]
     .clock(axi_master_clock),
     .reset(axi_master_reset),
     .io_channels_write_address_channel_AWVALID(axi_master_io_channels_write_address_channel_AWVALID),
@@ -10352,55 +13095,182 @@ module CPU(
     .io_bundle_write_strobe_1(axi_master_io_bundle_write_strobe_1),
     .io_bundle_write_strobe_2(axi_master_io_bundle_write_strobe_2),
     .io_bundle_write_strobe_3(axi_master_io_bundle_write_strobe_3),
+    .io_bundle_granted(axi_master_io_bundle_granted),
     .io_bundle_busy(axi_master_io_bundle_busy),
     .io_bundle_read_valid(axi_master_io_bundle_read_valid),
     .io_bundle_write_valid(axi_master_io_bundle_write_valid)
   );
-  assign io_instruction_address = cpu_io_instruction_address; // @[4-soc/src/main/scala/riscv/core/CPU.scala 21:32]
-  assign io_axi4_channels_write_address_channel_AWVALID = axi_master_io_channels_write_address_channel_AWVALID; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
-  assign io_axi4_channels_write_address_channel_AWADDR = axi_master_io_channels_write_address_channel_AWADDR; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
-  assign io_axi4_channels_write_data_channel_WVALID = axi_master_io_channels_write_data_channel_WVALID; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
-  assign io_axi4_channels_write_data_channel_WDATA = axi_master_io_channels_write_data_channel_WDATA; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
-  assign io_axi4_channels_write_data_channel_WSTRB = axi_master_io_channels_write_data_channel_WSTRB; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
-  assign io_axi4_channels_write_response_channel_BREADY = axi_master_io_channels_write_response_channel_BREADY; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
-  assign io_axi4_channels_read_address_channel_ARVALID = axi_master_io_channels_read_address_channel_ARVALID; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
-  assign io_axi4_channels_read_address_channel_ARADDR = axi_master_io_channels_read_address_channel_ARADDR; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
-  assign io_axi4_channels_read_data_channel_RREADY = axi_master_io_channels_read_data_channel_RREADY; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
-  assign io_debug_read_data = cpu_io_debug_read_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 102:33]
-  assign io_csr_debug_read_data = cpu_io_csr_debug_read_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 105:37]
-  assign io_bus_address = bus_address_reg; // @[4-soc/src/main/scala/riscv/core/CPU.scala 83:22]
-  assign cpu_clock = clock;
-  assign cpu_reset = reset;
-  assign cpu_io_instruction = io_instruction; // @[4-soc/src/main/scala/riscv/core/CPU.scala 22:32]
-  assign cpu_io_instruction_valid = io_instruction_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 23:32]
-  assign cpu_io_memory_bundle_read_data = axi_master_io_bundle_read_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 39:48]
-  assign cpu_io_memory_bundle_read_valid = axi_master_io_bundle_read_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 40:48]
-  assign cpu_io_memory_bundle_write_valid = axi_master_io_bundle_write_valid; // @[4-soc/src/main/scala/riscv/core/CPU.scala 41:48]
-  assign cpu_io_memory_bundle_granted = ~axi_master_io_bundle_busy; // @[4-soc/src/main/scala/riscv/core/CPU.scala 44:51]
-  assign cpu_io_interrupt_flag = io_interrupt_flag; // @[4-soc/src/main/scala/riscv/core/CPU.scala 98:29]
-  assign cpu_io_debug_read_address = io_debug_read_address; // @[4-soc/src/main/scala/riscv/core/CPU.scala 101:33]
-  assign cpu_io_csr_debug_read_address = io_csr_debug_read_address; // @[4-soc/src/main/scala/riscv/core/CPU.scala 104:37]
+  Queue_1 buffer ( // @[4-soc/src/main/scala/peripheral/DMA.scala 87:22]
+    .clock(buffer_clock),
+    .reset(buffer_reset),
+    .io_enq_valid(buffer_io_enq_valid),
+    .io_enq_bits(buffer_io_enq_bits),
+    .io_deq_ready(buffer_io_deq_ready),
+    .io_deq_valid(buffer_io_deq_valid),
+    .io_deq_bits(buffer_io_deq_bits),
+    .io_count(buffer_io_count)
+  );
+  assign io_channels_write_address_channel_AWREADY = slave_io_channels_write_address_channel_AWREADY; // @[4-soc/src/main/scala/peripheral/DMA.scala 69:21]
+  assign io_channels_write_data_channel_WREADY = slave_io_channels_write_data_channel_WREADY; // @[4-soc/src/main/scala/peripheral/DMA.scala 69:21]
+  assign io_channels_write_response_channel_BVALID = slave_io_channels_write_response_channel_BVALID; // @[4-soc/src/main/scala/peripheral/DMA.scala 69:21]
+  assign io_channels_read_address_channel_ARREADY = slave_io_channels_read_address_channel_ARREADY; // @[4-soc/src/main/scala/peripheral/DMA.scala 69:21]
+  assign io_channels_read_data_channel_RVALID = slave_io_channels_read_data_channel_RVALID; // @[4-soc/src/main/scala/peripheral/DMA.scala 69:21]
+  assign io_channels_read_data_channel_RDATA = slave_io_channels_read_data_channel_RDATA; // @[4-soc/src/main/scala/peripheral/DMA.scala 69:21]
+  assign io_master_write_address_channel_AWVALID = axi_master_io_channels_write_address_channel_AWVALID; // @[4-soc/src/main/scala/peripheral/DMA.scala 71:13]
+  assign io_master_write_address_channel_AWADDR = axi_master_io_channels_write_address_channel_AWADDR; // @[4-soc/src/main/scala/peripheral/DMA.scala 71:13]
+  assign io_master_write_data_channel_WVALID = axi_master_io_channels_write_data_channel_WVALID; // @[4-soc/src/main/scala/peripheral/DMA.scala 71:13]
+  assign io_master_write_data_channel_WDATA = axi_master_io_channels_write_data_channel_WDATA; // @[4-soc/src/main/scala/peripheral/DMA.scala 71:13]
+  assign io_master_write_data_channel_WSTRB = axi_master_io_channels_write_data_channel_WSTRB; // @[4-soc/src/main/scala/peripheral/DMA.scala 71:13]
+  assign io_master_write_response_channel_BREADY = axi_master_io_channels_write_response_channel_BREADY; // @[4-soc/src/main/scala/peripheral/DMA.scala 71:13]
+  assign io_master_read_address_channel_ARVALID = axi_master_io_channels_read_address_channel_ARVALID; // @[4-soc/src/main/scala/peripheral/DMA.scala 71:13]
+  assign io_master_read_address_channel_ARADDR = axi_master_io_channels_read_address_channel_ARADDR; // @[4-soc/src/main/scala/peripheral/DMA.scala 71:13]
+  assign io_master_read_data_channel_RREADY = axi_master_io_channels_read_data_channel_RREADY; // @[4-soc/src/main/scala/peripheral/DMA.scala 71:13]
+  assign io_signal_interrupt = done & ie; // @[4-soc/src/main/scala/peripheral/DMA.scala 164:31]
+  assign slave_clock = clock;
+  assign slave_reset = reset;
+  assign slave_io_channels_write_address_channel_AWVALID = io_channels_write_address_channel_AWVALID; // @[4-soc/src/main/scala/peripheral/DMA.scala 69:21]
+  assign slave_io_channels_write_address_channel_AWADDR = io_channels_write_address_channel_AWADDR; // @[4-soc/src/main/scala/peripheral/DMA.scala 69:21]
+  assign slave_io_channels_write_data_channel_WVALID = io_channels_write_data_channel_WVALID; // @[4-soc/src/main/scala/peripheral/DMA.scala 69:21]
+  assign slave_io_channels_write_data_channel_WDATA = io_channels_write_data_channel_WDATA; // @[4-soc/src/main/scala/peripheral/DMA.scala 69:21]
+  assign slave_io_channels_write_response_channel_BREADY = io_channels_write_response_channel_BREADY; // @[4-soc/src/main/scala/peripheral/DMA.scala 69:21]
+  assign slave_io_channels_read_address_channel_ARVALID = io_channels_read_address_channel_ARVALID; // @[4-soc/src/main/scala/peripheral/DMA.scala 69:21]
+  assign slave_io_channels_read_address_channel_ARADDR = io_channels_read_address_channel_ARADDR; // @[4-soc/src/main/scala/peripheral/DMA.scala 69:21]
+  assign slave_io_channels_read_data_channel_RREADY = io_channels_read_data_channel_RREADY; // @[4-soc/src/main/scala/peripheral/DMA.scala 69:21]
+  assign slave_io_bundle_read_data = _slave_io_bundle_read_data_T_13; // @[4-soc/src/main/scala/peripheral/DMA.scala 92:29]
+  assign slave_io_bundle_read_valid = slave_io_bundle_read; // @[4-soc/src/main/scala/peripheral/DMA.scala 91:30]
   assign axi_master_clock = clock;
   assign axi_master_reset = reset;
-  assign axi_master_io_channels_write_address_channel_AWREADY = io_axi4_channels_write_address_channel_AWREADY; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
-  assign axi_master_io_channels_write_data_channel_WREADY = io_axi4_channels_write_data_channel_WREADY; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
-  assign axi_master_io_channels_write_response_channel_BVALID = io_axi4_channels_write_response_channel_BVALID; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
-  assign axi_master_io_channels_read_address_channel_ARREADY = io_axi4_channels_read_address_channel_ARREADY; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
-  assign axi_master_io_channels_read_data_channel_RVALID = io_axi4_channels_read_data_channel_RVALID; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
-  assign axi_master_io_channels_read_data_channel_RDATA = io_axi4_channels_read_data_channel_RDATA; // @[4-soc/src/main/scala/riscv/core/CPU.scala 47:24]
-  assign axi_master_io_bundle_address = {cpu_io_device_select,cpu_io_memory_bundle_address[28:0]}; // @[4-soc/src/main/scala/riscv/core/CPU.scala 29:51]
-  assign axi_master_io_bundle_read = cpu_io_memory_bundle_request & cpu_io_memory_bundle_read; // @[4-soc/src/main/scala/riscv/core/CPU.scala 34:73]
-  assign axi_master_io_bundle_write = cpu_io_memory_bundle_request & cpu_io_memory_bundle_write; // @[4-soc/src/main/scala/riscv/core/CPU.scala 35:73]
-  assign axi_master_io_bundle_write_data = cpu_io_memory_bundle_write_data; // @[4-soc/src/main/scala/riscv/core/CPU.scala 36:41]
-  assign axi_master_io_bundle_write_strobe_0 = cpu_io_memory_bundle_write_strobe_0; // @[4-soc/src/main/scala/riscv/core/CPU.scala 37:41]
-  assign axi_master_io_bundle_write_strobe_1 = cpu_io_memory_bundle_write_strobe_1; // @[4-soc/src/main/scala/riscv/core/CPU.scala 37:41]
-  assign axi_master_io_bundle_write_strobe_2 = cpu_io_memory_bundle_write_strobe_2; // @[4-soc/src/main/scala/riscv/core/CPU.scala 37:41]
-  assign axi_master_io_bundle_write_strobe_3 = cpu_io_memory_bundle_write_strobe_3; // @[4-soc/src/main/scala/riscv/core/CPU.scala 37:41]
+  assign axi_master_io_channels_write_address_channel_AWREADY = io_master_write_address_channel_AWREADY; // @[4-soc/src/main/scala/peripheral/DMA.scala 71:13]
+  assign axi_master_io_channels_write_data_channel_WREADY = io_master_write_data_channel_WREADY; // @[4-soc/src/main/scala/peripheral/DMA.scala 71:13]
+  assign axi_master_io_channels_write_response_channel_BVALID = io_master_write_response_channel_BVALID; // @[4-soc/src/main/scala/peripheral/DMA.scala 71:13]
+  assign axi_master_io_channels_read_address_channel_ARREADY = io_master_read_address_channel_ARREADY; // @[4-soc/src/main/scala/peripheral/DMA.scala 71:13]
+  assign axi_master_io_channels_read_data_channel_RVALID = io_master_read_data_channel_RVALID; // @[4-soc/src/main/scala/peripheral/DMA.scala 71:13]
+  assign axi_master_io_channels_read_data_channel_RDATA = io_master_read_data_channel_RDATA; // @[4-soc/src/main/scala/peripheral/DMA.scala 71:13]
+  assign axi_master_io_bundle_address = write_request ? dst : src; // @[4-soc/src/main/scala/peripheral/DMA.scala 133:43]
+  assign axi_master_io_bundle_read = read_request & ~write_request; // @[4-soc/src/main/scala/peripheral/DMA.scala 134:53]
+  assign axi_master_io_bundle_write = busy & buffer_io_deq_valid; // @[4-soc/src/main/scala/peripheral/DMA.scala 131:38]
+  assign axi_master_io_bundle_write_data = buffer_io_deq_bits; // @[4-soc/src/main/scala/peripheral/DMA.scala 136:37]
+  assign axi_master_io_bundle_write_strobe_0 = 1'h1; // @[4-soc/src/main/scala/peripheral/DMA.scala 137:37]
+  assign axi_master_io_bundle_write_strobe_1 = 1'h1; // @[4-soc/src/main/scala/peripheral/DMA.scala 137:37]
+  assign axi_master_io_bundle_write_strobe_2 = 1'h1; // @[4-soc/src/main/scala/peripheral/DMA.scala 137:37]
+  assign axi_master_io_bundle_write_strobe_3 = 1'h1; // @[4-soc/src/main/scala/peripheral/DMA.scala 137:37]
+  assign buffer_clock = clock;
+  assign buffer_reset = reset;
+  assign buffer_io_enq_valid = axi_master_io_bundle_read_valid; // @[4-soc/src/main/scala/peripheral/DMA.scala 141:23]
+  assign buffer_io_enq_bits = axi_master_io_bundle_read_data; // @[4-soc/src/main/scala/peripheral/DMA.scala 142:23]
+  assign buffer_io_deq_ready = write_request & axi_master_io_bundle_granted; // @[4-soc/src/main/scala/peripheral/DMA.scala 140:39]
   always @(posedge clock) begin
-    if (reset) begin // @[4-soc/src/main/scala/riscv/core/CPU.scala 69:37]
-      bus_address_reg <= 32'h0; // @[4-soc/src/main/scala/riscv/core/CPU.scala 69:37]
-    end else if (start_bus_transaction) begin // @[4-soc/src/main/scala/riscv/core/CPU.scala 79:35]
-      bus_address_reg <= full_bus_address; // @[4-soc/src/main/scala/riscv/core/CPU.scala 80:25]
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 76:30]
+      src <= 32'h0; // @[4-soc/src/main/scala/peripheral/DMA.scala 76:30]
+    end else if (read_grant) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 146:20]
+      src <= _src_T_3; // @[4-soc/src/main/scala/peripheral/DMA.scala 147:16]
+    end else if (slave_io_bundle_write) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 106:36]
+      if (!(_T)) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 107:35]
+        if (!(_T_1)) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 110:43]
+          if (~busy) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 114:22]
+            if (_T_2) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 115:32]
+              src <= _src_T_1; // @[4-soc/src/main/scala/peripheral/DMA.scala 116:13]
+            end
+          end
+        end
+      end
+    end
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 77:30]
+      dst <= 32'h0; // @[4-soc/src/main/scala/peripheral/DMA.scala 77:30]
+    end else if (write_grant) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 150:21]
+      dst <= _dst_T_3; // @[4-soc/src/main/scala/peripheral/DMA.scala 151:9]
+    end else if (slave_io_bundle_write) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 106:36]
+      if (!(_T)) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 107:35]
+        if (!(_T_1)) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 110:43]
+          if (~busy) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 114:22]
+            if (_T_3) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 117:38]
+              dst <= _src_T_1; // @[4-soc/src/main/scala/peripheral/DMA.scala 118:13]
+            end
+          end
+        end
+      end
+    end
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 78:30]
+      len <= 32'h0; // @[4-soc/src/main/scala/peripheral/DMA.scala 78:30]
+    end else if (write_grant) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 150:21]
+      len <= _len_T_1; // @[4-soc/src/main/scala/peripheral/DMA.scala 152:9]
+    end else if (slave_io_bundle_write) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 106:36]
+      if (!(_T)) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 107:35]
+        if (!(_T_1)) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 110:43]
+          if (~busy) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 114:22]
+            if (_T_4) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 119:38]
+              len <= slave_io_bundle_write_data; // @[4-soc/src/main/scala/peripheral/DMA.scala 120:13]
+            end
+          end
+        end
+      end
+    end
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 79:30]
+      src_stride <= 32'h4; // @[4-soc/src/main/scala/peripheral/DMA.scala 79:30]
+    end else if (slave_io_bundle_write) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 106:36]
+      if (!(_T)) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 107:35]
+        if (!(_T_1)) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 110:43]
+          if (~busy) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 114:22]
+            if (_T_5) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 121:45]
+              src_stride <= _src_T_1; // @[4-soc/src/main/scala/peripheral/DMA.scala 122:20]
+            end
+          end
+        end
+      end
+    end
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 80:30]
+      dst_stride <= 32'h4; // @[4-soc/src/main/scala/peripheral/DMA.scala 80:30]
+    end else if (slave_io_bundle_write) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 106:36]
+      if (!(_T)) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 107:35]
+        if (!(_T_1)) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 110:43]
+          if (~busy) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 114:22]
+            if (_T_6) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 123:45]
+              dst_stride <= _src_T_1; // @[4-soc/src/main/scala/peripheral/DMA.scala 124:20]
+            end
+          end
+        end
+      end
+    end
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 81:30]
+      ie <= 1'h0; // @[4-soc/src/main/scala/peripheral/DMA.scala 81:30]
+    end else if (slave_io_bundle_write) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 106:36]
+      if (_T) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 107:35]
+        ie <= slave_io_bundle_write_data[1]; // @[4-soc/src/main/scala/peripheral/DMA.scala 108:13]
+      end
+    end
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 82:30]
+      busy <= 1'h0; // @[4-soc/src/main/scala/peripheral/DMA.scala 82:30]
+    end else if (start) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 155:15]
+      busy <= 1'h1; // @[4-soc/src/main/scala/peripheral/DMA.scala 156:16]
+    end else if (_T_10) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 159:72]
+      busy <= 1'h0; // @[4-soc/src/main/scala/peripheral/DMA.scala 160:10]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 83:30]
+      done <= 1'h0; // @[4-soc/src/main/scala/peripheral/DMA.scala 83:30]
+    end else if (start) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 155:15]
+      done <= 1'h0; // @[4-soc/src/main/scala/peripheral/DMA.scala 157:16]
+    end else if (_T_10) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 159:72]
+      done <= 1'h1; // @[4-soc/src/main/scala/peripheral/DMA.scala 161:10]
+    end else if (slave_io_bundle_write) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 106:36]
+      if (!(_T)) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 107:35]
+        if (_T_1) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 110:43]
+          if (slave_io_bundle_write_data[1]) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 111:28]
+            done <= 1'h0; // @[4-soc/src/main/scala/peripheral/DMA.scala 112:14]
+          end
+        end
+      end
+    end
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 84:30]
+      reads_left <= 32'h0; // @[4-soc/src/main/scala/peripheral/DMA.scala 84:30]
+    end else if (start) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 155:15]
+      reads_left <= len; // @[4-soc/src/main/scala/peripheral/DMA.scala 158:16]
+    end else if (read_grant) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 146:20]
+      reads_left <= _reads_left_T_1; // @[4-soc/src/main/scala/peripheral/DMA.scala 148:16]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/peripheral/DMA.scala 85:30]
+      reading <= 3'h0; // @[4-soc/src/main/scala/peripheral/DMA.scala 85:30]
+    end else begin
+      reading <= _reading_T_3; // @[4-soc/src/main/scala/peripheral/DMA.scala 144:23]
     end
   end
 // Register and memory initialization
@@ -10440,7 +13310,25 @@ initial begin
     `endif
 `ifdef RANDOMIZE_REG_INIT
   _RAND_0 = {1{`RANDOM}};
-  bus_address_reg = _RAND_0[31:0];
+  src = _RAND_0[31:0];
+  _RAND_1 = {1{`RANDOM}};
+  dst = _RAND_1[31:0];
+  _RAND_2 = {1{`RANDOM}};
+  len = _RAND_2[31:0];
+  _RAND_3 = {1{`RANDOM}};
+  src_stride = _RAND_3[31:0];
+  _RAND_4 = {1{`RANDOM}};
+  dst_stride = _RAND_4[31:0];
+  _RAND_5 = {1{`RANDOM}};
+  ie = _RAND_5[0:0];
+  _RAND_6 = {1{`RANDOM}};
+  busy = _RAND_6[0:0];
+  _RAND_7 = {1{`RANDOM}};
+  done = _RAND_7[0:0];
+  _RAND_8 = {1{`RANDOM}};
+  reads_left = _RAND_8[31:0];
+  _RAND_9 = {1{`RANDOM}};
+  reading = _RAND_9[2:0];
 `endif // RANDOMIZE_REG_INIT
   `endif // RANDOMIZE
 end // initial
@@ -10553,202 +13441,430 @@ end // initial
 `endif
 `endif // SYNTHESIS
 endmodule
+module BusArbiter(
+  input         clock,
+  input         reset,
+  input         io_masters_0_write_address_channel_AWVALID, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  output        io_masters_0_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input  [31:0] io_masters_0_write_address_channel_AWADDR, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input         io_masters_0_write_data_channel_WVALID, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  output        io_masters_0_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input  [31:0] io_masters_0_write_data_channel_WDATA, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input  [3:0]  io_masters_0_write_data_channel_WSTRB, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  output        io_masters_0_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input         io_masters_0_write_response_channel_BREADY, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input         io_masters_0_read_address_channel_ARVALID, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  output        io_masters_0_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input  [31:0] io_masters_0_read_address_channel_ARADDR, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  output        io_masters_0_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input         io_masters_0_read_data_channel_RREADY, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  output [31:0] io_masters_0_read_data_channel_RDATA, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input         io_masters_1_write_address_channel_AWVALID, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  output        io_masters_1_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input  [31:0] io_masters_1_write_address_channel_AWADDR, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input         io_masters_1_write_data_channel_WVALID, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  output        io_masters_1_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input  [31:0] io_masters_1_write_data_channel_WDATA, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input  [3:0]  io_masters_1_write_data_channel_WSTRB, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  output        io_masters_1_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input         io_masters_1_write_response_channel_BREADY, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input         io_masters_1_read_address_channel_ARVALID, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  output        io_masters_1_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input  [31:0] io_masters_1_read_address_channel_ARADDR, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  output        io_masters_1_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input         io_masters_1_read_data_channel_RREADY, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  output [31:0] io_masters_1_read_data_channel_RDATA, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  output        io_slave_write_address_channel_AWVALID, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input         io_slave_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  output [31:0] io_slave_write_address_channel_AWADDR, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  output        io_slave_write_data_channel_WVALID, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input         io_slave_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  output [31:0] io_slave_write_data_channel_WDATA, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  output [3:0]  io_slave_write_data_channel_WSTRB, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input         io_slave_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  output        io_slave_write_response_channel_BREADY, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  output        io_slave_read_address_channel_ARVALID, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input         io_slave_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  output [31:0] io_slave_read_address_channel_ARADDR, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input         io_slave_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  output        io_slave_read_data_channel_RREADY, // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+  input  [31:0] io_slave_read_data_channel_RDATA // @[4-soc/src/main/scala/bus/BusArbiter.scala 43:14]
+);
+`ifdef RANDOMIZE_REG_INIT
+  reg [31:0] _RAND_0;
+  reg [31:0] _RAND_1;
+  reg [31:0] _RAND_2;
+  reg [31:0] _RAND_3;
+`endif // RANDOMIZE_REG_INIT
+  reg  read_owner; // @[4-soc/src/main/scala/bus/BusArbiter.scala 55:28]
+  reg [2:0] read_count; // @[4-soc/src/main/scala/bus/BusArbiter.scala 56:28]
+  reg  write_owner; // @[4-soc/src/main/scala/bus/BusArbiter.scala 57:28]
+  reg [2:0] write_count; // @[4-soc/src/main/scala/bus/BusArbiter.scala 58:28]
+  wire [1:0] ar_valid = {io_masters_1_read_address_channel_ARVALID,io_masters_0_read_address_channel_ARVALID}; // @[4-soc/src/main/scala/bus/BusArbiter.scala 61:77]
+  wire [1:0] _ar_index_after_T = {~read_owner,1'h0}; // @[4-soc/src/main/scala/bus/BusArbiter.scala 50:61]
+  wire [1:0] ar_index_after = ar_valid & _ar_index_after_T; // @[4-soc/src/main/scala/bus/BusArbiter.scala 50:23]
+  wire  _ar_index_T_2 = ar_index_after[0] ? 1'h0 : 1'h1; // @[src/main/scala/chisel3/util/Mux.scala 47:70]
+  wire  _ar_index_T_3 = ar_valid[0] ? 1'h0 : 1'h1; // @[src/main/scala/chisel3/util/Mux.scala 47:70]
+  wire  _ar_index_T_4 = |ar_index_after ? _ar_index_T_2 : _ar_index_T_3; // @[4-soc/src/main/scala/bus/BusArbiter.scala 51:8]
+  wire  ar_index = read_count == 3'h0 ? _ar_index_T_4 : read_owner; // @[4-soc/src/main/scala/bus/BusArbiter.scala 62:23]
+  wire [1:0] r_sel = 2'h1 << read_owner; // @[src/main/scala/chisel3/util/OneHot.scala 65:12]
+  wire [1:0] _ar_waiting_T = ~r_sel; // @[4-soc/src/main/scala/bus/BusArbiter.scala 64:33]
+  wire [1:0] _ar_waiting_T_1 = ar_valid & _ar_waiting_T; // @[4-soc/src/main/scala/bus/BusArbiter.scala 64:30]
+  wire  ar_waiting = |_ar_waiting_T_1; // @[4-soc/src/main/scala/bus/BusArbiter.scala 64:42]
+  wire  ar_open = read_count == 3'h0 | ~ar_waiting & read_count != 3'h4; // @[4-soc/src/main/scala/bus/BusArbiter.scala 65:38]
+  wire [1:0] _ar_sel_T = 2'h1 << ar_index; // @[src/main/scala/chisel3/util/OneHot.scala 65:12]
+  wire [1:0] _ar_sel_T_1 = ar_open ? _ar_sel_T : 2'h0; // @[4-soc/src/main/scala/bus/BusArbiter.scala 66:22]
+  wire [1:0] ar_sel = _ar_sel_T_1 & ar_valid; // @[4-soc/src/main/scala/bus/BusArbiter.scala 66:76]
+  wire [1:0] aw_valid = {io_masters_1_write_address_channel_AWVALID,io_masters_0_write_address_channel_AWVALID}; // @[4-soc/src/main/scala/bus/BusArbiter.scala 69:78]
+  wire [1:0] _aw_index_after_T = {~write_owner,1'h0}; // @[4-soc/src/main/scala/bus/BusArbiter.scala 50:61]
+  wire [1:0] aw_index_after = aw_valid & _aw_index_after_T; // @[4-soc/src/main/scala/bus/BusArbiter.scala 50:23]
+  wire  _aw_index_T_2 = aw_index_after[0] ? 1'h0 : 1'h1; // @[src/main/scala/chisel3/util/Mux.scala 47:70]
+  wire  _aw_index_T_3 = aw_valid[0] ? 1'h0 : 1'h1; // @[src/main/scala/chisel3/util/Mux.scala 47:70]
+  wire  _aw_index_T_4 = |aw_index_after ? _aw_index_T_2 : _aw_index_T_3; // @[4-soc/src/main/scala/bus/BusArbiter.scala 51:8]
+  wire  aw_index = write_count == 3'h0 ? _aw_index_T_4 : write_owner; // @[4-soc/src/main/scala/bus/BusArbiter.scala 70:23]
+  wire [1:0] b_sel = 2'h1 << write_owner; // @[src/main/scala/chisel3/util/OneHot.scala 65:12]
+  wire [1:0] _aw_waiting_T = ~b_sel; // @[4-soc/src/main/scala/bus/BusArbiter.scala 72:33]
+  wire [1:0] _aw_waiting_T_1 = aw_valid & _aw_waiting_T; // @[4-soc/src/main/scala/bus/BusArbiter.scala 72:30]
+  wire  aw_waiting = |_aw_waiting_T_1; // @[4-soc/src/main/scala/bus/BusArbiter.scala 72:42]
+  wire  aw_open = write_count == 3'h0 | ~aw_waiting & write_count != 3'h4; // @[4-soc/src/main/scala/bus/BusArbiter.scala 73:38]
+  wire [1:0] _aw_sel_T = 2'h1 << aw_index; // @[src/main/scala/chisel3/util/OneHot.scala 65:12]
+  wire [1:0] _aw_sel_T_1 = aw_open ? _aw_sel_T : 2'h0; // @[4-soc/src/main/scala/bus/BusArbiter.scala 74:22]
+  wire [1:0] aw_sel = _aw_sel_T_1 & aw_valid; // @[4-soc/src/main/scala/bus/BusArbiter.scala 74:76]
+  wire [1:0] w_sel = |aw_sel ? aw_sel : b_sel; // @[4-soc/src/main/scala/bus/BusArbiter.scala 75:22]
+  wire  ar_fire = io_slave_read_address_channel_ARVALID & io_slave_read_address_channel_ARREADY; // @[4-soc/src/main/scala/bus/BusArbiter.scala 105:55]
+  wire  r_fire = io_slave_read_data_channel_RVALID & io_slave_read_data_channel_RREADY; // @[4-soc/src/main/scala/bus/BusArbiter.scala 106:52]
+  wire  aw_fire = io_slave_write_address_channel_AWVALID & io_slave_write_address_channel_AWREADY; // @[4-soc/src/main/scala/bus/BusArbiter.scala 107:56]
+  wire  b_fire = io_slave_write_response_channel_BVALID & io_slave_write_response_channel_BREADY; // @[4-soc/src/main/scala/bus/BusArbiter.scala 108:56]
+  wire [2:0] _GEN_4 = {{2'd0}, ar_fire}; // @[4-soc/src/main/scala/bus/BusArbiter.scala 115:29]
+  wire [2:0] _read_count_T_1 = read_count + _GEN_4; // @[4-soc/src/main/scala/bus/BusArbiter.scala 115:29]
+  wire [2:0] _GEN_5 = {{2'd0}, r_fire}; // @[4-soc/src/main/scala/bus/BusArbiter.scala 115:47]
+  wire [2:0] _read_count_T_3 = _read_count_T_1 - _GEN_5; // @[4-soc/src/main/scala/bus/BusArbiter.scala 115:47]
+  wire [2:0] _GEN_6 = {{2'd0}, aw_fire}; // @[4-soc/src/main/scala/bus/BusArbiter.scala 116:31]
+  wire [2:0] _write_count_T_1 = write_count + _GEN_6; // @[4-soc/src/main/scala/bus/BusArbiter.scala 116:31]
+  wire [2:0] _GEN_7 = {{2'd0}, b_fire}; // @[4-soc/src/main/scala/bus/BusArbiter.scala 116:49]
+  wire [2:0] _write_count_T_3 = _write_count_T_1 - _GEN_7; // @[4-soc/src/main/scala/bus/BusArbiter.scala 116:49]
+  assign io_masters_0_write_address_channel_AWREADY = io_slave_write_address_channel_AWREADY & aw_sel[0]; // @[4-soc/src/main/scala/bus/BusArbiter.scala 93:94]
+  assign io_masters_0_write_data_channel_WREADY = io_slave_write_data_channel_WREADY & w_sel[0]; // @[4-soc/src/main/scala/bus/BusArbiter.scala 94:86]
+  assign io_masters_0_write_response_channel_BVALID = io_slave_write_response_channel_BVALID & b_sel[0]; // @[4-soc/src/main/scala/bus/BusArbiter.scala 95:94]
+  assign io_masters_0_read_address_channel_ARREADY = io_slave_read_address_channel_ARREADY & ar_sel[0]; // @[4-soc/src/main/scala/bus/BusArbiter.scala 98:91]
+  assign io_masters_0_read_data_channel_RVALID = io_slave_read_data_channel_RVALID & r_sel[0]; // @[4-soc/src/main/scala/bus/BusArbiter.scala 99:83]
+  assign io_masters_0_read_data_channel_RDATA = io_slave_read_data_channel_RDATA; // @[4-soc/src/main/scala/bus/BusArbiter.scala 100:50]
+  assign io_masters_1_write_address_channel_AWREADY = io_slave_write_address_channel_AWREADY & aw_sel[1]; // @[4-soc/src/main/scala/bus/BusArbiter.scala 93:94]
+  assign io_masters_1_write_data_channel_WREADY = io_slave_write_data_channel_WREADY & w_sel[1]; // @[4-soc/src/main/scala/bus/BusArbiter.scala 94:86]
+  assign io_masters_1_write_response_channel_BVALID = io_slave_write_response_channel_BVALID & b_sel[1]; // @[4-soc/src/main/scala/bus/BusArbiter.scala 95:94]
+  assign io_masters_1_read_address_channel_ARREADY = io_slave_read_address_channel_ARREADY & ar_sel[1]; // @[4-soc/src/main/scala/bus/BusArbiter.scala 98:91]
+  assign io_masters_1_read_data_channel_RVALID = io_slave_read_data_channel_RVALID & r_sel[1]; // @[4-soc/src/main/scala/bus/BusArbiter.scala 99:83]
+  assign io_masters_1_read_data_channel_RDATA = io_slave_read_data_channel_RDATA; // @[4-soc/src/main/scala/bus/BusArbiter.scala 100:50]
+  assign io_slave_write_address_channel_AWVALID = |aw_sel; // @[4-soc/src/main/scala/bus/BusArbiter.scala 78:50]
+  assign io_slave_write_address_channel_AWADDR = (aw_sel[0] ? io_masters_0_write_address_channel_AWADDR : 32'h0) |
+    (aw_sel[1] ? io_masters_1_write_address_channel_AWADDR : 32'h0); // @[src/main/scala/chisel3/util/Mux.scala 30:73]
+  assign io_slave_write_data_channel_WVALID = w_sel[0] & io_masters_0_write_data_channel_WVALID |
+    w_sel[1] & io_masters_1_write_data_channel_WVALID; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
+  assign io_slave_write_data_channel_WDATA = (w_sel[0] ? io_masters_0_write_data_channel_WDATA : 32'h0) |
+    (w_sel[1] ? io_masters_1_write_data_channel_WDATA : 32'h0); // @[src/main/scala/chisel3/util/Mux.scala 30:73]
+  assign io_slave_write_data_channel_WSTRB = (w_sel[0] ? io_masters_0_write_data_channel_WSTRB : 4'h0) |
+    (w_sel[1] ? io_masters_1_write_data_channel_WSTRB : 4'h0); // @[src/main/scala/chisel3/util/Mux.scala 30:73]
+  assign io_slave_write_response_channel_BREADY = b_sel[0] & io_masters_0_write_response_channel_BREADY |
+    b_sel[1] & io_masters_1_write_response_channel_BREADY; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
+  assign io_slave_read_address_channel_ARVALID = |ar_sel; // @[4-soc/src/main/scala/bus/BusArbiter.scala 86:49]
+  assign io_slave_read_address_channel_ARADDR = (ar_sel[0] ? io_masters_0_read_address_channel_ARADDR : 32'h0) |
+    (ar_sel[1] ? io_masters_1_read_address_channel_ARADDR : 32'h0); // @[src/main/scala/chisel3/util/Mux.scala 30:73]
+  assign io_slave_read_data_channel_RREADY = r_sel[0] & io_masters_0_read_data_channel_RREADY |
+    r_sel[1] & io_masters_1_read_data_channel_RREADY; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
+  always @(posedge clock) begin
+    if (reset) begin // @[4-soc/src/main/scala/bus/BusArbiter.scala 55:28]
+      read_owner <= 1'h0; // @[4-soc/src/main/scala/bus/BusArbiter.scala 55:28]
+    end else if (ar_fire) begin // @[4-soc/src/main/scala/bus/BusArbiter.scala 109:17]
+      read_owner <= ar_index; // @[4-soc/src/main/scala/bus/BusArbiter.scala 110:16]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/BusArbiter.scala 56:28]
+      read_count <= 3'h0; // @[4-soc/src/main/scala/bus/BusArbiter.scala 56:28]
+    end else begin
+      read_count <= _read_count_T_3; // @[4-soc/src/main/scala/bus/BusArbiter.scala 115:15]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/BusArbiter.scala 57:28]
+      write_owner <= 1'h0; // @[4-soc/src/main/scala/bus/BusArbiter.scala 57:28]
+    end else if (aw_fire) begin // @[4-soc/src/main/scala/bus/BusArbiter.scala 112:17]
+      write_owner <= aw_index; // @[4-soc/src/main/scala/bus/BusArbiter.scala 113:17]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/BusArbiter.scala 58:28]
+      write_count <= 3'h0; // @[4-soc/src/main/scala/bus/BusArbiter.scala 58:28]
+    end else begin
+      write_count <= _write_count_T_3; // @[4-soc/src/main/scala/bus/BusArbiter.scala 116:15]
+    end
+  end
+// Register and memory initialization
+`ifdef RANDOMIZE_GARBAGE_ASSIGN
+`define RANDOMIZE
+`endif
+`ifdef RANDOMIZE_INVALID_ASSIGN
+`define RANDOMIZE
+`endif
+`ifdef RANDOMIZE_REG_INIT
+`define RANDOMIZE
+`endif
+`ifdef RANDOMIZE_MEM_INIT
+`define RANDOMIZE
+`endif
+`ifndef RANDOM
+`define RANDOM $random
+`endif
+`ifdef RANDOMIZE_MEM_INIT
+  integer initvar;
+`endif
+`ifndef SYNTHESIS
+`ifdef FIRRTL_BEFORE_INITIAL
+`FIRRTL_BEFORE_INITIAL
+`endif
+initial begin
+  `ifdef RANDOMIZE
+    `ifdef INIT_RANDOM
+      `INIT_RANDOM
+    `endif
+    `ifndef VERILATOR
+      `ifdef RANDOMIZE_DELAY
+        #`RANDOMIZE_DELAY begin end
+      `else
+        #0.002 begin end
+      `endif
+    `endif
+`ifdef RANDOMIZE_REG_INIT
+  _RAND_0 = {1{`RANDOM}};
+  read_owner = _RAND_0[0:0];
+  _RAND_1 = {1{`RANDOM}};
+  read_count = _RAND_1[2:0];
+  _RAND_2 = {1{`RANDOM}};
+  write_owner = _RAND_2[0:0];
+  _RAND_3 = {1{`RANDOM}};
+  write_count = _RAND_3[2:0];
+`endif // RANDOMIZE_REG_INIT
+  `endif // RANDOMIZE
+end // initial
+`ifdef FIRRTL_AFTER_INITIAL
+`FIRRTL_AFTER_INITIAL
+`endif
+`endif // SYNTHESIS
+endmodule
 module BusSwitch(
   input         clock,
   input         reset,
-  input  [31:0] io_address, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_slaves_0_write_address_channel_AWVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_0_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output [31:0] io_slaves_0_write_address_channel_AWADDR, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_slaves_0_write_data_channel_WVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_0_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output [31:0] io_slaves_0_write_data_channel_WDATA, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output [3:0]  io_slaves_0_write_data_channel_WSTRB, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_0_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_slaves_0_write_response_channel_BREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_slaves_0_read_address_channel_ARVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_0_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output [31:0] io_slaves_0_read_address_channel_ARADDR, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_0_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_slaves_0_read_data_channel_RREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input  [31:0] io_slaves_0_read_data_channel_RDATA, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_slaves_1_write_address_channel_AWVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_1_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output [31:0] io_slaves_1_write_address_channel_AWADDR, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_slaves_1_write_data_channel_WVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_1_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output [31:0] io_slaves_1_write_data_channel_WDATA, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_1_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_slaves_1_write_response_channel_BREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_slaves_1_read_address_channel_ARVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_1_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output [31:0] io_slaves_1_read_address_channel_ARADDR, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_1_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_slaves_1_read_data_channel_RREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input  [31:0] io_slaves_1_read_data_channel_RDATA, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_slaves_2_write_address_channel_AWVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_2_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output [31:0] io_slaves_2_write_address_channel_AWADDR, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_slaves_2_write_data_channel_WVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_2_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output [31:0] io_slaves_2_write_data_channel_WDATA, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_2_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_slaves_2_write_response_channel_BREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_slaves_2_read_address_channel_ARVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_2_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output [31:0] io_slaves_2_read_address_channel_ARADDR, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_2_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_slaves_2_read_data_channel_RREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input  [31:0] io_slaves_2_read_data_channel_RDATA, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_3_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_3_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_3_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_3_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_3_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_4_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_4_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_4_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_4_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_4_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_5_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_5_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_5_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_5_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_5_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_6_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_6_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_6_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_6_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_6_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_slaves_7_write_address_channel_AWVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_7_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_slaves_7_write_data_channel_WVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_7_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_7_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_slaves_7_write_response_channel_BREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_slaves_7_read_address_channel_ARVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_7_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_slaves_7_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_slaves_7_read_data_channel_RREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_master_write_address_channel_AWVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_master_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input  [31:0] io_master_write_address_channel_AWADDR, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_master_write_data_channel_WVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_master_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input  [31:0] io_master_write_data_channel_WDATA, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input  [3:0]  io_master_write_data_channel_WSTRB, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_master_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_master_write_response_channel_BREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_master_read_address_channel_ARVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_master_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input  [31:0] io_master_read_address_channel_ARADDR, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output        io_master_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  input         io_master_read_data_channel_RREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
-  output [31:0] io_master_read_data_channel_RDATA // @[4-soc/src/main/scala/bus/BusSwitch.scala 43:14]
+  output        io_slaves_0_write_address_channel_AWVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_0_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output [31:0] io_slaves_0_write_address_channel_AWADDR, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_0_write_data_channel_WVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_0_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output [31:0] io_slaves_0_write_data_channel_WDATA, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output [3:0]  io_slaves_0_write_data_channel_WSTRB, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_0_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_0_write_response_channel_BREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_0_read_address_channel_ARVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_0_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output [31:0] io_slaves_0_read_address_channel_ARADDR, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_0_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_0_read_data_channel_RREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input  [31:0] io_slaves_0_read_data_channel_RDATA, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_1_write_address_channel_AWVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_1_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output [31:0] io_slaves_1_write_address_channel_AWADDR, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_1_write_data_channel_WVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_1_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output [31:0] io_slaves_1_write_data_channel_WDATA, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_1_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_1_write_response_channel_BREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_1_read_address_channel_ARVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_1_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output [31:0] io_slaves_1_read_address_channel_ARADDR, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_1_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_1_read_data_channel_RREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input  [31:0] io_slaves_1_read_data_channel_RDATA, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_2_write_address_channel_AWVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_2_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output [31:0] io_slaves_2_write_address_channel_AWADDR, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_2_write_data_channel_WVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_2_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output [31:0] io_slaves_2_write_data_channel_WDATA, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_2_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_2_write_response_channel_BREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_2_read_address_channel_ARVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_2_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output [31:0] io_slaves_2_read_address_channel_ARADDR, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_2_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_2_read_data_channel_RREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input  [31:0] io_slaves_2_read_data_channel_RDATA, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_3_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_3_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_3_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_3_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_3_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_4_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_4_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_4_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_4_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_4_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_5_write_address_channel_AWVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_5_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output [31:0] io_slaves_5_write_address_channel_AWADDR, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_5_write_data_channel_WVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_5_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output [31:0] io_slaves_5_write_data_channel_WDATA, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_5_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_5_write_response_channel_BREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_5_read_address_channel_ARVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_5_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output [31:0] io_slaves_5_read_address_channel_ARADDR, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_5_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_5_read_data_channel_RREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input  [31:0] io_slaves_5_read_data_channel_RDATA, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_6_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_6_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_6_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_6_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_6_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_7_write_address_channel_AWVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_7_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_7_write_data_channel_WVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_7_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_7_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_7_write_response_channel_BREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_7_read_address_channel_ARVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_7_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_slaves_7_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_slaves_7_read_data_channel_RREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_master_write_address_channel_AWVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_master_write_address_channel_AWREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input  [31:0] io_master_write_address_channel_AWADDR, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_master_write_data_channel_WVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_master_write_data_channel_WREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input  [31:0] io_master_write_data_channel_WDATA, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input  [3:0]  io_master_write_data_channel_WSTRB, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_master_write_response_channel_BVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_master_write_response_channel_BREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_master_read_address_channel_ARVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_master_read_address_channel_ARREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input  [31:0] io_master_read_address_channel_ARADDR, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output        io_master_read_data_channel_RVALID, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  input         io_master_read_data_channel_RREADY, // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
+  output [31:0] io_master_read_data_channel_RDATA // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:14]
 );
 `ifdef RANDOMIZE_REG_INIT
   reg [31:0] _RAND_0;
   reg [31:0] _RAND_1;
+  reg [31:0] _RAND_2;
+  reg [31:0] _RAND_3;
 `endif // RANDOMIZE_REG_INIT
-  wire [2:0] index = io_address[31:29]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 49:25]
-  wire [7:0] sel = 8'h1 << index; // @[src/main/scala/chisel3/util/OneHot.scala 65:12]
-  reg [7:0] read_sel; // @[4-soc/src/main/scala/bus/BusSwitch.scala 55:26]
-  reg [7:0] write_sel; // @[4-soc/src/main/scala/bus/BusSwitch.scala 56:26]
-  wire  hit = sel[0]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 78:18]
-  wire  hit_1 = sel[1]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 78:18]
-  wire  hit_2 = sel[2]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 78:18]
-  wire  hit_7 = sel[7]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 78:18]
-  wire [31:0] _io_master_read_data_channel_RDATA_T_8 = read_sel[0] ? io_slaves_0_read_data_channel_RDATA : 32'h0; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
-  wire [31:0] _io_master_read_data_channel_RDATA_T_9 = read_sel[1] ? io_slaves_1_read_data_channel_RDATA : 32'h0; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
-  wire [31:0] _io_master_read_data_channel_RDATA_T_10 = read_sel[2] ? io_slaves_2_read_data_channel_RDATA : 32'h0; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
-  wire [31:0] _io_master_read_data_channel_RDATA_T_11 = read_sel[3] ? 32'hdeadbeef : 32'h0; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
-  wire [31:0] _io_master_read_data_channel_RDATA_T_12 = read_sel[4] ? 32'hdeadbeef : 32'h0; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
-  wire [31:0] _io_master_read_data_channel_RDATA_T_13 = read_sel[5] ? 32'hdeadbeef : 32'h0; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
-  wire [31:0] _io_master_read_data_channel_RDATA_T_14 = read_sel[6] ? 32'hdeadbeef : 32'h0; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
-  wire [31:0] _io_master_read_data_channel_RDATA_T_15 = read_sel[7] ? 32'hdeadbeef : 32'h0; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
-  wire [31:0] _io_master_read_data_channel_RDATA_T_16 = _io_master_read_data_channel_RDATA_T_8 |
-    _io_master_read_data_channel_RDATA_T_9; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
-  wire [31:0] _io_master_read_data_channel_RDATA_T_17 = _io_master_read_data_channel_RDATA_T_16 |
-    _io_master_read_data_channel_RDATA_T_10; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
-  wire [31:0] _io_master_read_data_channel_RDATA_T_18 = _io_master_read_data_channel_RDATA_T_17 |
-    _io_master_read_data_channel_RDATA_T_11; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
-  wire [31:0] _io_master_read_data_channel_RDATA_T_19 = _io_master_read_data_channel_RDATA_T_18 |
-    _io_master_read_data_channel_RDATA_T_12; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
-  wire [31:0] _io_master_read_data_channel_RDATA_T_20 = _io_master_read_data_channel_RDATA_T_19 |
-    _io_master_read_data_channel_RDATA_T_13; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
-  wire [31:0] _io_master_read_data_channel_RDATA_T_21 = _io_master_read_data_channel_RDATA_T_20 |
-    _io_master_read_data_channel_RDATA_T_14; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
-  assign io_slaves_0_write_address_channel_AWVALID = io_master_write_address_channel_AWVALID & hit; // @[4-soc/src/main/scala/bus/BusSwitch.scala 81:91]
-  assign io_slaves_0_write_address_channel_AWADDR = io_master_write_address_channel_AWADDR; // @[4-soc/src/main/scala/bus/BusSwitch.scala 82:48]
-  assign io_slaves_0_write_data_channel_WVALID = io_master_write_data_channel_WVALID & hit; // @[4-soc/src/main/scala/bus/BusSwitch.scala 86:83]
-  assign io_slaves_0_write_data_channel_WDATA = io_master_write_data_channel_WDATA; // @[4-soc/src/main/scala/bus/BusSwitch.scala 87:44]
-  assign io_slaves_0_write_data_channel_WSTRB = io_master_write_data_channel_WSTRB; // @[4-soc/src/main/scala/bus/BusSwitch.scala 88:44]
-  assign io_slaves_0_write_response_channel_BREADY = io_master_write_response_channel_BREADY & write_sel[0]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 91:91]
-  assign io_slaves_0_read_address_channel_ARVALID = io_master_read_address_channel_ARVALID & hit; // @[4-soc/src/main/scala/bus/BusSwitch.scala 94:89]
-  assign io_slaves_0_read_address_channel_ARADDR = io_master_read_address_channel_ARADDR; // @[4-soc/src/main/scala/bus/BusSwitch.scala 95:47]
-  assign io_slaves_0_read_data_channel_RREADY = io_master_read_data_channel_RREADY & read_sel[0]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 99:81]
-  assign io_slaves_1_write_address_channel_AWVALID = io_master_write_address_channel_AWVALID & hit_1; // @[4-soc/src/main/scala/bus/BusSwitch.scala 81:91]
-  assign io_slaves_1_write_address_channel_AWADDR = io_master_write_address_channel_AWADDR; // @[4-soc/src/main/scala/bus/BusSwitch.scala 82:48]
-  assign io_slaves_1_write_data_channel_WVALID = io_master_write_data_channel_WVALID & hit_1; // @[4-soc/src/main/scala/bus/BusSwitch.scala 86:83]
-  assign io_slaves_1_write_data_channel_WDATA = io_master_write_data_channel_WDATA; // @[4-soc/src/main/scala/bus/BusSwitch.scala 87:44]
-  assign io_slaves_1_write_response_channel_BREADY = io_master_write_response_channel_BREADY & write_sel[1]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 91:91]
-  assign io_slaves_1_read_address_channel_ARVALID = io_master_read_address_channel_ARVALID & hit_1; // @[4-soc/src/main/scala/bus/BusSwitch.scala 94:89]
-  assign io_slaves_1_read_address_channel_ARADDR = io_master_read_address_channel_ARADDR; // @[4-soc/src/main/scala/bus/BusSwitch.scala 95:47]
-  assign io_slaves_1_read_data_channel_RREADY = io_master_read_data_channel_RREADY & read_sel[1]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 99:81]
-  assign io_slaves_2_write_address_channel_AWVALID = io_master_write_address_channel_AWVALID & hit_2; // @[4-soc/src/main/scala/bus/BusSwitch.scala 81:91]
-  assign io_slaves_2_write_address_channel_AWADDR = io_master_write_address_channel_AWADDR; // @[4-soc/src/main/scala/bus/BusSwitch.scala 82:48]
-  assign io_slaves_2_write_data_channel_WVALID = io_master_write_data_channel_WVALID & hit_2; // @[4-soc/src/main/scala/bus/BusSwitch.scala 86:83]
-  assign io_slaves_2_write_data_channel_WDATA = io_master_write_data_channel_WDATA; // @[4-soc/src/main/scala/bus/BusSwitch.scala 87:44]
-  assign io_slaves_2_write_response_channel_BREADY = io_master_write_response_channel_BREADY & write_sel[2]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 91:91]
-  assign io_slaves_2_read_address_channel_ARVALID = io_master_read_address_channel_ARVALID & hit_2; // @[4-soc/src/main/scala/bus/BusSwitch.scala 94:89]
-  assign io_slaves_2_read_address_channel_ARADDR = io_master_read_address_channel_ARADDR; // @[4-soc/src/main/scala/bus/BusSwitch.scala 95:47]
-  assign io_slaves_2_read_data_channel_RREADY = io_master_read_data_channel_RREADY & read_sel[2]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 99:81]
-  assign io_slaves_7_write_address_channel_AWVALID = io_master_write_address_channel_AWVALID & hit_7; // @[4-soc/src/main/scala/bus/BusSwitch.scala 81:91]
-  assign io_slaves_7_write_data_channel_WVALID = io_master_write_data_channel_WVALID & hit_7; // @[4-soc/src/main/scala/bus/BusSwitch.scala 86:83]
-  assign io_slaves_7_write_response_channel_BREADY = io_master_write_response_channel_BREADY & write_sel[7]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 91:91]
-  assign io_slaves_7_read_address_channel_ARVALID = io_master_read_address_channel_ARVALID & hit_7; // @[4-soc/src/main/scala/bus/BusSwitch.scala 94:89]
-  assign io_slaves_7_read_data_channel_RREADY = io_master_read_data_channel_RREADY & read_sel[7]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 99:81]
-  assign io_master_write_address_channel_AWREADY = hit & io_slaves_0_write_address_channel_AWREADY | hit_1 &
-    io_slaves_1_write_address_channel_AWREADY | hit_2 & io_slaves_2_write_address_channel_AWREADY | sel[3] &
-    io_slaves_3_write_address_channel_AWREADY | sel[4] & io_slaves_4_write_address_channel_AWREADY | sel[5] &
-    io_slaves_5_write_address_channel_AWREADY | sel[6] & io_slaves_6_write_address_channel_AWREADY | hit_7 &
-    io_slaves_7_write_address_channel_AWREADY; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
-  assign io_master_write_data_channel_WREADY = hit & io_slaves_0_write_data_channel_WREADY | hit_1 &
-    io_slaves_1_write_data_channel_WREADY | hit_2 & io_slaves_2_write_data_channel_WREADY | sel[3] &
-    io_slaves_3_write_data_channel_WREADY | sel[4] & io_slaves_4_write_data_channel_WREADY | sel[5] &
-    io_slaves_5_write_data_channel_WREADY | sel[6] & io_slaves_6_write_data_channel_WREADY | hit_7 &
-    io_slaves_7_write_data_channel_WREADY; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
-  assign io_master_write_response_channel_BVALID = write_sel[0] & io_slaves_0_write_response_channel_BVALID | write_sel[
-    1] & io_slaves_1_write_response_channel_BVALID | write_sel[2] & io_slaves_2_write_response_channel_BVALID |
-    write_sel[3] & io_slaves_3_write_response_channel_BVALID | write_sel[4] & io_slaves_4_write_response_channel_BVALID
-     | write_sel[5] & io_slaves_5_write_response_channel_BVALID | write_sel[6] &
-    io_slaves_6_write_response_channel_BVALID | write_sel[7] & io_slaves_7_write_response_channel_BVALID; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
-  assign io_master_read_address_channel_ARREADY = hit & io_slaves_0_read_address_channel_ARREADY | hit_1 &
-    io_slaves_1_read_address_channel_ARREADY | hit_2 & io_slaves_2_read_address_channel_ARREADY | sel[3] &
-    io_slaves_3_read_address_channel_ARREADY | sel[4] & io_slaves_4_read_address_channel_ARREADY | sel[5] &
-    io_slaves_5_read_address_channel_ARREADY | sel[6] & io_slaves_6_read_address_channel_ARREADY | hit_7 &
-    io_slaves_7_read_address_channel_ARREADY; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
-  assign io_master_read_data_channel_RVALID = read_sel[0] & io_slaves_0_read_data_channel_RVALID | read_sel[1] &
-    io_slaves_1_read_data_channel_RVALID | read_sel[2] & io_slaves_2_read_data_channel_RVALID | read_sel[3] &
-    io_slaves_3_read_data_channel_RVALID | read_sel[4] & io_slaves_4_read_data_channel_RVALID | read_sel[5] &
-    io_slaves_5_read_data_channel_RVALID | read_sel[6] & io_slaves_6_read_data_channel_RVALID | read_sel[7] &
-    io_slaves_7_read_data_channel_RVALID; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
-  assign io_master_read_data_channel_RDATA = _io_master_read_data_channel_RDATA_T_21 |
-    _io_master_read_data_channel_RDATA_T_15; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
+  reg [2:0] read_target; // @[4-soc/src/main/scala/bus/BusSwitch.scala 69:29]
+  reg [2:0] read_count; // @[4-soc/src/main/scala/bus/BusSwitch.scala 70:29]
+  reg [2:0] write_target; // @[4-soc/src/main/scala/bus/BusSwitch.scala 71:29]
+  reg [2:0] write_count; // @[4-soc/src/main/scala/bus/BusSwitch.scala 72:29]
+  wire [2:0] ar_index = io_master_read_address_channel_ARADDR[31:29]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 66:47]
+  wire  ar_open = read_count == 3'h0 | read_target == ar_index & read_count != 3'h4; // @[4-soc/src/main/scala/bus/BusSwitch.scala 76:38]
+  wire [7:0] _ar_sel_T = 8'h1 << ar_index; // @[src/main/scala/chisel3/util/OneHot.scala 65:12]
+  wire [7:0] ar_sel = ar_open ? _ar_sel_T : 8'h0; // @[4-soc/src/main/scala/bus/BusSwitch.scala 77:22]
+  wire [7:0] r_sel = 8'h1 << read_target; // @[src/main/scala/chisel3/util/OneHot.scala 65:12]
+  wire [2:0] aw_index = io_master_write_address_channel_AWADDR[31:29]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 66:47]
+  wire  aw_open = write_count == 3'h0 | write_target == aw_index & write_count != 3'h4; // @[4-soc/src/main/scala/bus/BusSwitch.scala 82:39]
+  wire [7:0] _aw_sel_T = 8'h1 << aw_index; // @[src/main/scala/chisel3/util/OneHot.scala 65:12]
+  wire [7:0] aw_sel = aw_open ? _aw_sel_T : 8'h0; // @[4-soc/src/main/scala/bus/BusSwitch.scala 83:22]
+  wire [7:0] b_sel = 8'h1 << write_target; // @[src/main/scala/chisel3/util/OneHot.scala 65:12]
+  wire [7:0] w_sel = io_master_write_address_channel_AWVALID ? aw_sel : b_sel; // @[4-soc/src/main/scala/bus/BusSwitch.scala 85:22]
+  wire  ar_fire = io_master_read_address_channel_ARVALID & io_master_read_address_channel_ARREADY; // @[4-soc/src/main/scala/bus/BusSwitch.scala 123:55]
+  wire  r_fire = io_master_read_data_channel_RVALID & io_master_read_data_channel_RREADY; // @[4-soc/src/main/scala/bus/BusSwitch.scala 124:52]
+  wire  aw_fire = io_master_write_address_channel_AWVALID & io_master_write_address_channel_AWREADY; // @[4-soc/src/main/scala/bus/BusSwitch.scala 125:56]
+  wire  b_fire = io_master_write_response_channel_BVALID & io_master_write_response_channel_BREADY; // @[4-soc/src/main/scala/bus/BusSwitch.scala 126:56]
+  wire [2:0] _GEN_0 = {{2'd0}, ar_fire}; // @[4-soc/src/main/scala/bus/BusSwitch.scala 133:29]
+  wire [2:0] _read_count_T_1 = read_count + _GEN_0; // @[4-soc/src/main/scala/bus/BusSwitch.scala 133:29]
+  wire [2:0] _GEN_1 = {{2'd0}, r_fire}; // @[4-soc/src/main/scala/bus/BusSwitch.scala 133:47]
+  wire [2:0] _read_count_T_3 = _read_count_T_1 - _GEN_1; // @[4-soc/src/main/scala/bus/BusSwitch.scala 133:47]
+  wire [2:0] _GEN_2 = {{2'd0}, aw_fire}; // @[4-soc/src/main/scala/bus/BusSwitch.scala 134:31]
+  wire [2:0] _write_count_T_1 = write_count + _GEN_2; // @[4-soc/src/main/scala/bus/BusSwitch.scala 134:31]
+  wire [2:0] _GEN_3 = {{2'd0}, b_fire}; // @[4-soc/src/main/scala/bus/BusSwitch.scala 134:49]
+  wire [2:0] _write_count_T_3 = _write_count_T_1 - _GEN_3; // @[4-soc/src/main/scala/bus/BusSwitch.scala 134:49]
+  assign io_slaves_0_write_address_channel_AWVALID = io_master_write_address_channel_AWVALID & aw_sel[0]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 90:79]
+  assign io_slaves_0_write_address_channel_AWADDR = io_master_write_address_channel_AWADDR; // @[4-soc/src/main/scala/bus/BusSwitch.scala 91:48]
+  assign io_slaves_0_write_data_channel_WVALID = io_master_write_data_channel_WVALID & w_sel[0]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 95:75]
+  assign io_slaves_0_write_data_channel_WDATA = io_master_write_data_channel_WDATA; // @[4-soc/src/main/scala/bus/BusSwitch.scala 96:44]
+  assign io_slaves_0_write_data_channel_WSTRB = io_master_write_data_channel_WSTRB; // @[4-soc/src/main/scala/bus/BusSwitch.scala 97:44]
+  assign io_slaves_0_write_response_channel_BREADY = io_master_write_response_channel_BREADY & b_sel[0]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 100:84]
+  assign io_slaves_0_read_address_channel_ARVALID = io_master_read_address_channel_ARVALID & ar_sel[0]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 103:77]
+  assign io_slaves_0_read_address_channel_ARADDR = io_master_read_address_channel_ARADDR; // @[4-soc/src/main/scala/bus/BusSwitch.scala 104:47]
+  assign io_slaves_0_read_data_channel_RREADY = io_master_read_data_channel_RREADY & r_sel[0]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 108:72]
+  assign io_slaves_1_write_address_channel_AWVALID = io_master_write_address_channel_AWVALID & aw_sel[1]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 90:79]
+  assign io_slaves_1_write_address_channel_AWADDR = io_master_write_address_channel_AWADDR; // @[4-soc/src/main/scala/bus/BusSwitch.scala 91:48]
+  assign io_slaves_1_write_data_channel_WVALID = io_master_write_data_channel_WVALID & w_sel[1]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 95:75]
+  assign io_slaves_1_write_data_channel_WDATA = io_master_write_data_channel_WDATA; // @[4-soc/src/main/scala/bus/BusSwitch.scala 96:44]
+  assign io_slaves_1_write_response_channel_BREADY = io_master_write_response_channel_BREADY & b_sel[1]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 100:84]
+  assign io_slaves_1_read_address_channel_ARVALID = io_master_read_address_channel_ARVALID & ar_sel[1]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 103:77]
+  assign io_slaves_1_read_address_channel_ARADDR = io_master_read_address_channel_ARADDR; // @[4-soc/src/main/scala/bus/BusSwitch.scala 104:47]
+  assign io_slaves_1_read_data_channel_RREADY = io_master_read_data_channel_RREADY & r_sel[1]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 108:72]
+  assign io_slaves_2_write_address_channel_AWVALID = io_master_write_address_channel_AWVALID & aw_sel[2]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 90:79]
+  assign io_slaves_2_write_address_channel_AWADDR = io_master_write_address_channel_AWADDR; // @[4-soc/src/main/scala/bus/BusSwitch.scala 91:48]
+  assign io_slaves_2_write_data_channel_WVALID = io_master_write_data_channel_WVALID & w_sel[2]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 95:75]
+  assign io_slaves_2_write_data_channel_WDATA = io_master_write_data_channel_WDATA; // @[4-soc/src/main/scala/bus/BusSwitch.scala 96:44]
+  assign io_slaves_2_write_response_channel_BREADY = io_master_write_response_channel_BREADY & b_sel[2]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 100:84]
+  assign io_slaves_2_read_address_channel_ARVALID = io_master_read_address_channel_ARVALID & ar_sel[2]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 103:77]
+  assign io_slaves_2_read_address_channel_ARADDR = io_master_read_address_channel_ARADDR; // @[4-soc/src/main/scala/bus/BusSwitch.scala 104:47]
+  assign io_slaves_2_read_data_channel_RREADY = io_master_read_data_channel_RREADY & r_sel[2]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 108:72]
+  assign io_slaves_5_write_address_channel_AWVALID = io_master_write_address_channel_AWVALID & aw_sel[5]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 90:79]
+  assign io_slaves_5_write_address_channel_AWADDR = io_master_write_address_channel_AWADDR; // @[4-soc/src/main/scala/bus/BusSwitch.scala 91:48]
+  assign io_slaves_5_write_data_channel_WVALID = io_master_write_data_channel_WVALID & w_sel[5]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 95:75]
+  assign io_slaves_5_write_data_channel_WDATA = io_master_write_data_channel_WDATA; // @[4-soc/src/main/scala/bus/BusSwitch.scala 96:44]
+  assign io_slaves_5_write_response_channel_BREADY = io_master_write_response_channel_BREADY & b_sel[5]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 100:84]
+  assign io_slaves_5_read_address_channel_ARVALID = io_master_read_address_channel_ARVALID & ar_sel[5]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 103:77]
+  assign io_slaves_5_read_address_channel_ARADDR = io_master_read_address_channel_ARADDR; // @[4-soc/src/main/scala/bus/BusSwitch.scala 104:47]
+  assign io_slaves_5_read_data_channel_RREADY = io_master_read_data_channel_RREADY & r_sel[5]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 108:72]
+  assign io_slaves_7_write_address_channel_AWVALID = io_master_write_address_channel_AWVALID & aw_sel[7]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 90:79]
+  assign io_slaves_7_write_data_channel_WVALID = io_master_write_data_channel_WVALID & w_sel[7]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 95:75]
+  assign io_slaves_7_write_response_channel_BREADY = io_master_write_response_channel_BREADY & b_sel[7]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 100:84]
+  assign io_slaves_7_read_address_channel_ARVALID = io_master_read_address_channel_ARVALID & ar_sel[7]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 103:77]
+  assign io_slaves_7_read_data_channel_RREADY = io_master_read_data_channel_RREADY & r_sel[7]; // @[4-soc/src/main/scala/bus/BusSwitch.scala 108:72]
+  assign io_master_write_address_channel_AWREADY = aw_sel[0] & io_slaves_0_write_address_channel_AWREADY |
+    aw_sel[1] & io_slaves_1_write_address_channel_AWREADY | aw_sel[2] & io_slaves_2_write_address_channel_AWREADY |
+    aw_sel[3] & io_slaves_3_write_address_channel_AWREADY | aw_sel[4] & io_slaves_4_write_address_channel_AWREADY |
+    aw_sel[5] & io_slaves_5_write_address_channel_AWREADY | aw_sel[6] & io_slaves_6_write_address_channel_AWREADY |
+    aw_sel[7] & io_slaves_7_write_address_channel_AWREADY; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
+  assign io_master_write_data_channel_WREADY = w_sel[0] & io_slaves_0_write_data_channel_WREADY |
+    w_sel[1] & io_slaves_1_write_data_channel_WREADY | w_sel[2] & io_slaves_2_write_data_channel_WREADY |
+    w_sel[3] & io_slaves_3_write_data_channel_WREADY | w_sel[4] & io_slaves_4_write_data_channel_WREADY |
+    w_sel[5] & io_slaves_5_write_data_channel_WREADY | w_sel[6] & io_slaves_6_write_data_channel_WREADY |
+    w_sel[7] & io_slaves_7_write_data_channel_WREADY; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
+  assign io_master_write_response_channel_BVALID = b_sel[0] & io_slaves_0_write_response_channel_BVALID |
+    b_sel[1] & io_slaves_1_write_response_channel_BVALID | b_sel[2] & io_slaves_2_write_response_channel_BVALID |
+    b_sel[3] & io_slaves_3_write_response_channel_BVALID | b_sel[4] & io_slaves_4_write_response_channel_BVALID |
+    b_sel[5] & io_slaves_5_write_response_channel_BVALID | b_sel[6] & io_slaves_6_write_response_channel_BVALID |
+    b_sel[7] & io_slaves_7_write_response_channel_BVALID; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
+  assign io_master_read_address_channel_ARREADY = ar_sel[0] & io_slaves_0_read_address_channel_ARREADY |
+    ar_sel[1] & io_slaves_1_read_address_channel_ARREADY | ar_sel[2] & io_slaves_2_read_address_channel_ARREADY |
+    ar_sel[3] & io_slaves_3_read_address_channel_ARREADY | ar_sel[4] & io_slaves_4_read_address_channel_ARREADY |
+    ar_sel[5] & io_slaves_5_read_address_channel_ARREADY | ar_sel[6] & io_slaves_6_read_address_channel_ARREADY |
+    ar_sel[7] & io_slaves_7_read_address_channel_ARREADY; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
+  assign io_master_read_data_channel_RVALID = r_sel[0] & io_slaves_0_read_data_channel_RVALID |
+    r_sel[1] & io_slaves_1_read_data_channel_RVALID | r_sel[2] & io_slaves_2_read_data_channel_RVALID |
+    r_sel[3] & io_slaves_3_read_data_channel_RVALID | r_sel[4] & io_slaves_4_read_data_channel_RVALID |
+    r_sel[5] & io_slaves_5_read_data_channel_RVALID | r_sel[6] & io_slaves_6_read_data_channel_RVALID |
+    r_sel[7] & io_slaves_7_read_data_channel_RVALID; // @[src/main/scala/chisel3/util/Mux.scala 30:73]
+  assign io_master_read_data_channel_RDATA = (r_sel[0] ? io_slaves_0_read_data_channel_RDATA : 32'h0) |
+    (r_sel[1] ? io_slaves_1_read_data_channel_RDATA : 32'h0) |
+    (r_sel[2] ? io_slaves_2_read_data_channel_RDATA : 32'h0) | (r_sel[5] ? io_slaves_5_read_data_channel_RDATA : 32'h0); // @[src/main/scala/chisel3/util/Mux.scala 30:73]
   always @(posedge clock) begin
-    if (reset) begin // @[4-soc/src/main/scala/bus/BusSwitch.scala 55:26]
-      read_sel <= 8'h0; // @[4-soc/src/main/scala/bus/BusSwitch.scala 55:26]
-    end else if (io_master_read_address_channel_ARVALID) begin // @[4-soc/src/main/scala/bus/BusSwitch.scala 61:48]
-      read_sel <= sel; // @[4-soc/src/main/scala/bus/BusSwitch.scala 62:14]
-    end else if (io_master_read_data_channel_RVALID & io_master_read_data_channel_RREADY) begin // @[4-soc/src/main/scala/bus/BusSwitch.scala 63:88]
-      read_sel <= 8'h0; // @[4-soc/src/main/scala/bus/BusSwitch.scala 64:14]
-    end
-    if (reset) begin // @[4-soc/src/main/scala/bus/BusSwitch.scala 56:26]
-      write_sel <= 8'h0; // @[4-soc/src/main/scala/bus/BusSwitch.scala 56:26]
-    end else if (io_master_write_address_channel_AWVALID | io_master_write_data_channel_WVALID) begin // @[4-soc/src/main/scala/bus/BusSwitch.scala 69:88]
-      write_sel <= sel; // @[4-soc/src/main/scala/bus/BusSwitch.scala 70:15]
-    end else if (io_master_write_response_channel_BVALID & io_master_write_response_channel_BREADY) begin // @[4-soc/src/main/scala/bus/BusSwitch.scala 71:98]
-      write_sel <= 8'h0; // @[4-soc/src/main/scala/bus/BusSwitch.scala 72:15]
+    if (reset) begin // @[4-soc/src/main/scala/bus/BusSwitch.scala 69:29]
+      read_target <= 3'h0; // @[4-soc/src/main/scala/bus/BusSwitch.scala 69:29]
+    end else if (ar_fire) begin // @[4-soc/src/main/scala/bus/BusSwitch.scala 127:17]
+      read_target <= ar_index; // @[4-soc/src/main/scala/bus/BusSwitch.scala 128:17]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/BusSwitch.scala 70:29]
+      read_count <= 3'h0; // @[4-soc/src/main/scala/bus/BusSwitch.scala 70:29]
+    end else begin
+      read_count <= _read_count_T_3; // @[4-soc/src/main/scala/bus/BusSwitch.scala 133:15]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/BusSwitch.scala 71:29]
+      write_target <= 3'h0; // @[4-soc/src/main/scala/bus/BusSwitch.scala 71:29]
+    end else if (aw_fire) begin // @[4-soc/src/main/scala/bus/BusSwitch.scala 130:17]
+      write_target <= aw_index; // @[4-soc/src/main/scala/bus/BusSwitch.scala 131:18]
+    end
+    if (reset) begin // @[4-soc/src/main/scala/bus/BusSwitch.scala 72:29]
+      write_count <= 3'h0; // @[4-soc/src/main/scala/bus/BusSwitch.scala 72:29]
+    end else begin
+      write_count <= _write_count_T_3; // @[4-soc/src/main/scala/bus/BusSwitch.scala 134:15]
     end
   end
 // Register and memory initialization
@@ -10788,9 +13904,13 @@ initial begin
     `endif
 `ifdef RANDOMIZE_REG_INIT
   _RAND_0 = {1{`RANDOM}};
-  read_sel = _RAND_0[7:0];
+  read_target = _RAND_0[2:0];
   _RAND_1 = {1{`RANDOM}};
-  write_sel = _RAND_1[7:0];
+  read_count = _RAND_1[2:0];
+  _RAND_2 = {1{`RANDOM}};
+  write_target = _RAND_2[2:0];
+  _RAND_3 = {1{`RANDOM}};
+  write_count = _RAND_3[2:0];
 `endif // RANDOMIZE_REG_INIT
   `endif // RANDOMIZE
 end // initial
@@ -10806,6 +13926,12 @@ module Top(
   output [31:0] io_instruction_address, // @[4-soc/src/main/scala/board/verilator/Top.scala 20:14]
   input  [31:0] io_instruction, // @[4-soc/src/main/scala/board/verilator/Top.scala 20:14]
   input         io_instruction_valid, // @[4-soc/src/main/scala/board/verilator/Top.scala 20:14]
+  input         io_icache_enable, // @[4-soc/src/main/scala/board/verilator/Top.scala 23:14]
+  output        io_icache_refill_request, // @[4-soc/src/main/scala/board/verilator/Top.scala 23:14]
+  output [31:0] io_icache_refill_address, // @[4-soc/src/main/scala/board/verilator/Top.scala 23:14]
+  input  [31:0] io_icache_refill_data, // @[4-soc/src/main/scala/board/verilator/Top.scala 23:14]
+  input         io_icache_refill_data_valid, // @[4-soc/src/main/scala/board/verilator/Top.scala 23:14]
+  input         io_dcache_enable, // @[4-soc/src/main/scala/board/verilator/Top.scala 36:25]
   output [31:0] io_mem_slave_address, // @[4-soc/src/main/scala/board/verilator/Top.scala 20:14]
   output        io_mem_slave_read, // @[4-soc/src/main/scala/board/verilator/Top.scala 20:14]
   input  [31:0] io_mem_slave_read_data, // @[4-soc/src/main/scala/board/verilator/Top.scala 20:14]
@@ -10829,7 +13955,15 @@ module Top(
   input  [4:0]  io_cpu_debug_read_address, // @[4-soc/src/main/scala/board/verilator/Top.scala 20:14]
   output [31:0] io_cpu_debug_read_data, // @[4-soc/src/main/scala/board/verilator/Top.scala 20:14]
   input  [11:0] io_cpu_csr_debug_read_address, // @[4-soc/src/main/scala/board/verilator/Top.scala 20:14]
-  output [31:0] io_cpu_csr_debug_read_data // @[4-soc/src/main/scala/board/verilator/Top.scala 20:14]
+  output [31:0] io_cpu_csr_debug_read_data, // @[4-soc/src/main/scala/board/verilator/Top.scala 20:14]
+  output        io_retire_reg_valid, // @[4-soc/src/main/scala/board/verilator/Top.scala 20:14]
+  output [31:0] io_retire_reg_pc, // @[4-soc/src/main/scala/board/verilator/Top.scala 20:14]
+  output [4:0]  io_retire_reg_rd, // @[4-soc/src/main/scala/board/verilator/Top.scala 20:14]
+  output [31:0] io_retire_reg_data, // @[4-soc/src/main/scala/board/verilator/Top.scala 20:14]
+  output        io_retire_store_valid, // @[4-soc/src/main/scala/board/verilator/Top.scala 20:14]
+  output [31:0] io_retire_store_address, // @[4-soc/src/main/scala/board/verilator/Top.scala 20:14]
+  output [31:0] io_retire_store_data, // @[4-soc/src/main/scala/board/verilator/Top.scala 20:14]
+  output [3:0]  io_retire_store_strobe // @[4-soc/src/main/scala/board/verilator/Top.scala 20:14]
 );
   wire  mem_slave_clock; // @[4-soc/src/main/scala/board/verilator/Top.scala 51:25]
   wire  mem_slave_reset; // @[4-soc/src/main/scala/board/verilator/Top.scala 51:25]
@@ -10862,7 +13996,7 @@ module Top(
   wire  vga_reset; // @[4-soc/src/main/scala/board/verilator/Top.scala 55:19]
   wire  vga_io_channels_write_address_channel_AWVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 55:19]
   wire  vga_io_channels_write_address_channel_AWREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 55:19]
-  wire [7:0] vga_io_channels_write_address_channel_AWADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 55:19]
+  wire [15:0] vga_io_channels_write_address_channel_AWADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 55:19]
   wire  vga_io_channels_write_data_channel_WVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 55:19]
   wire  vga_io_channels_write_data_channel_WREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 55:19]
   wire [31:0] vga_io_channels_write_data_channel_WDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 55:19]
@@ -10870,7 +14004,7 @@ module Top(
   wire  vga_io_channels_write_response_channel_BREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 55:19]
   wire  vga_io_channels_read_address_channel_ARVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 55:19]
   wire  vga_io_channels_read_address_channel_ARREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 55:19]
-  wire [7:0] vga_io_channels_read_address_channel_ARADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 55:19]
+  wire [15:0] vga_io_channels_read_address_channel_ARADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 55:19]
   wire  vga_io_channels_read_data_channel_RVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 55:19]
   wire  vga_io_channels_read_data_channel_RREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 55:19]
   wire [31:0] vga_io_channels_read_data_channel_RDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 55:19]
@@ -10900,11 +14034,49 @@ module Top(
   wire  uart_io_rxd; // @[4-soc/src/main/scala/board/verilator/Top.scala 58:20]
   wire  uart_io_txd; // @[4-soc/src/main/scala/board/verilator/Top.scala 58:20]
   wire  uart_io_signal_interrupt; // @[4-soc/src/main/scala/board/verilator/Top.scala 58:20]
+  wire  dma_clock; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_reset; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_io_channels_write_address_channel_AWVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_io_channels_write_address_channel_AWREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire [7:0] dma_io_channels_write_address_channel_AWADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_io_channels_write_data_channel_WVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_io_channels_write_data_channel_WREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire [31:0] dma_io_channels_write_data_channel_WDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_io_channels_write_response_channel_BVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_io_channels_write_response_channel_BREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_io_channels_read_address_channel_ARVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_io_channels_read_address_channel_ARREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire [7:0] dma_io_channels_read_address_channel_ARADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_io_channels_read_data_channel_RVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_io_channels_read_data_channel_RREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire [31:0] dma_io_channels_read_data_channel_RDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_io_master_write_address_channel_AWVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_io_master_write_address_channel_AWREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire [31:0] dma_io_master_write_address_channel_AWADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_io_master_write_data_channel_WVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_io_master_write_data_channel_WREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire [31:0] dma_io_master_write_data_channel_WDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire [3:0] dma_io_master_write_data_channel_WSTRB; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_io_master_write_response_channel_BVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_io_master_write_response_channel_BREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_io_master_read_address_channel_ARVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_io_master_read_address_channel_ARREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire [31:0] dma_io_master_read_address_channel_ARADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_io_master_read_data_channel_RVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_io_master_read_data_channel_RREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire [31:0] dma_io_master_read_data_channel_RDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+  wire  dma_io_signal_interrupt; // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
   wire  cpu_clock; // @[4-soc/src/main/scala/board/verilator/Top.scala 60:27]
   wire  cpu_reset; // @[4-soc/src/main/scala/board/verilator/Top.scala 60:27]
   wire [31:0] cpu_io_instruction_address; // @[4-soc/src/main/scala/board/verilator/Top.scala 60:27]
   wire [31:0] cpu_io_instruction; // @[4-soc/src/main/scala/board/verilator/Top.scala 60:27]
   wire  cpu_io_instruction_valid; // @[4-soc/src/main/scala/board/verilator/Top.scala 60:27]
+  wire  cpu_io_icache_enable; // @[4-soc/src/main/scala/board/verilator/Top.scala 66:27]
+  wire  cpu_io_dcache_enable; // @[4-soc/src/main/scala/board/verilator/Top.scala 66:27]
+  wire  cpu_io_icache_refill_request; // @[4-soc/src/main/scala/board/verilator/Top.scala 66:27]
+  wire [31:0] cpu_io_icache_refill_address; // @[4-soc/src/main/scala/board/verilator/Top.scala 66:27]
+  wire [31:0] cpu_io_icache_refill_data; // @[4-soc/src/main/scala/board/verilator/Top.scala 66:27]
+  wire  cpu_io_icache_refill_data_valid; // @[4-soc/src/main/scala/board/verilator/Top.scala 66:27]
   wire  cpu_io_axi4_channels_write_address_channel_AWVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 60:27]
   wire  cpu_io_axi4_channels_write_address_channel_AWREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 60:27]
   wire [31:0] cpu_io_axi4_channels_write_address_channel_AWADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 60:27]
@@ -10925,7 +14097,14 @@ module Top(
   wire [31:0] cpu_io_debug_read_data; // @[4-soc/src/main/scala/board/verilator/Top.scala 60:27]
   wire [11:0] cpu_io_csr_debug_read_address; // @[4-soc/src/main/scala/board/verilator/Top.scala 60:27]
   wire [31:0] cpu_io_csr_debug_read_data; // @[4-soc/src/main/scala/board/verilator/Top.scala 60:27]
-  wire [31:0] cpu_io_bus_address; // @[4-soc/src/main/scala/board/verilator/Top.scala 60:27]
+  wire  cpu_io_retire_reg_valid; // @[4-soc/src/main/scala/board/verilator/Top.scala 61:27]
+  wire [31:0] cpu_io_retire_reg_pc; // @[4-soc/src/main/scala/board/verilator/Top.scala 61:27]
+  wire [4:0] cpu_io_retire_reg_rd; // @[4-soc/src/main/scala/board/verilator/Top.scala 61:27]
+  wire [31:0] cpu_io_retire_reg_data; // @[4-soc/src/main/scala/board/verilator/Top.scala 61:27]
+  wire  cpu_io_retire_store_valid; // @[4-soc/src/main/scala/board/verilator/Top.scala 61:27]
+  wire [31:0] cpu_io_retire_store_address; // @[4-soc/src/main/scala/board/verilator/Top.scala 61:27]
+  wire [31:0] cpu_io_retire_store_data; // @[4-soc/src/main/scala/board/verilator/Top.scala 61:27]
+  wire [3:0] cpu_io_retire_store_strobe; // @[4-soc/src/main/scala/board/verilator/Top.scala 61:27]
   wire  dummy_clock; // @[4-soc/src/main/scala/board/verilator/Top.scala 61:27]
   wire  dummy_reset; // @[4-soc/src/main/scala/board/verilator/Top.scala 61:27]
   wire  dummy_io_channels_write_address_channel_AWVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 61:27]
@@ -10938,9 +14117,55 @@ module Top(
   wire  dummy_io_channels_read_address_channel_ARREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 61:27]
   wire  dummy_io_channels_read_data_channel_RVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 61:27]
   wire  dummy_io_channels_read_data_channel_RREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 61:27]
+  wire  bus_arbiter_clock; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_reset; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_masters_0_write_address_channel_AWVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_masters_0_write_address_channel_AWREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire [31:0] bus_arbiter_io_masters_0_write_address_channel_AWADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_masters_0_write_data_channel_WVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_masters_0_write_data_channel_WREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire [31:0] bus_arbiter_io_masters_0_write_data_channel_WDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire [3:0] bus_arbiter_io_masters_0_write_data_channel_WSTRB; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_masters_0_write_response_channel_BVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_masters_0_write_response_channel_BREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_masters_0_read_address_channel_ARVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_masters_0_read_address_channel_ARREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire [31:0] bus_arbiter_io_masters_0_read_address_channel_ARADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_masters_0_read_data_channel_RVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_masters_0_read_data_channel_RREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire [31:0] bus_arbiter_io_masters_0_read_data_channel_RDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_masters_1_write_address_channel_AWVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_masters_1_write_address_channel_AWREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire [31:0] bus_arbiter_io_masters_1_write_address_channel_AWADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_masters_1_write_data_channel_WVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_masters_1_write_data_channel_WREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire [31:0] bus_arbiter_io_masters_1_write_data_channel_WDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire [3:0] bus_arbiter_io_masters_1_write_data_channel_WSTRB; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_masters_1_write_response_channel_BVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_masters_1_write_response_channel_BREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_masters_1_read_address_channel_ARVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_masters_1_read_address_channel_ARREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire [31:0] bus_arbiter_io_masters_1_read_address_channel_ARADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_masters_1_read_data_channel_RVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_masters_1_read_data_channel_RREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire [31:0] bus_arbiter_io_masters_1_read_data_channel_RDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_slave_write_address_channel_AWVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_slave_write_address_channel_AWREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire [31:0] bus_arbiter_io_slave_write_address_channel_AWADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_slave_write_data_channel_WVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_slave_write_data_channel_WREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire [31:0] bus_arbiter_io_slave_write_data_channel_WDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire [3:0] bus_arbiter_io_slave_write_data_channel_WSTRB; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_slave_write_response_channel_BVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_slave_write_response_channel_BREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_slave_read_address_channel_ARVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_slave_read_address_channel_ARREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire [31:0] bus_arbiter_io_slave_read_address_channel_ARADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_slave_read_data_channel_RVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire  bus_arbiter_io_slave_read_data_channel_RREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+  wire [31:0] bus_arbiter_io_slave_read_data_channel_RDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
   wire  bus_switch_clock; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
   wire  bus_switch_reset; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
-  wire [31:0] bus_switch_io_address; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
   wire  bus_switch_io_slaves_0_write_address_channel_AWVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
   wire  bus_switch_io_slaves_0_write_address_channel_AWREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
   wire [31:0] bus_switch_io_slaves_0_write_address_channel_AWADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
@@ -10994,11 +14219,20 @@ module Top(
   wire  bus_switch_io_slaves_4_write_response_channel_BVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
   wire  bus_switch_io_slaves_4_read_address_channel_ARREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
   wire  bus_switch_io_slaves_4_read_data_channel_RVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
+  wire  bus_switch_io_slaves_5_write_address_channel_AWVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
   wire  bus_switch_io_slaves_5_write_address_channel_AWREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
+  wire [31:0] bus_switch_io_slaves_5_write_address_channel_AWADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
+  wire  bus_switch_io_slaves_5_write_data_channel_WVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
   wire  bus_switch_io_slaves_5_write_data_channel_WREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
+  wire [31:0] bus_switch_io_slaves_5_write_data_channel_WDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
   wire  bus_switch_io_slaves_5_write_response_channel_BVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
+  wire  bus_switch_io_slaves_5_write_response_channel_BREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
+  wire  bus_switch_io_slaves_5_read_address_channel_ARVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
   wire  bus_switch_io_slaves_5_read_address_channel_ARREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
+  wire [31:0] bus_switch_io_slaves_5_read_address_channel_ARADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
   wire  bus_switch_io_slaves_5_read_data_channel_RVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
+  wire  bus_switch_io_slaves_5_read_data_channel_RREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
+  wire [31:0] bus_switch_io_slaves_5_read_data_channel_RDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
   wire  bus_switch_io_slaves_6_write_address_channel_AWREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
   wire  bus_switch_io_slaves_6_write_data_channel_WREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
   wire  bus_switch_io_slaves_6_write_response_channel_BVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
@@ -11029,6 +14263,7 @@ module Top(
   wire  bus_switch_io_master_read_data_channel_RVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
   wire  bus_switch_io_master_read_data_channel_RREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
   wire [31:0] bus_switch_io_master_read_data_channel_RDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
+  wire [1:0] _cpu_io_interrupt_flag_T = {dma_io_signal_interrupt,io_signal_interrupt}; // @[4-soc/src/main/scala/board/verilator/Top.scala 148:35]
   AXI4LiteSlave mem_slave ( // @[4-soc/src/main/scala/board/verilator/Top.scala 51:25]
     .clock(mem_slave_clock),
     .reset(mem_slave_reset),
@@ -11104,12 +14339,52 @@ module Top(
     .io_txd(uart_io_txd),
     .io_signal_interrupt(uart_io_signal_interrupt)
   );
+  DMA dma ( // @[4-soc/src/main/scala/board/verilator/Top.scala 76:19]
+    .clock(dma_clock),
+    .reset(dma_reset),
+    .io_channels_write_address_channel_AWVALID(dma_io_channels_write_address_channel_AWVALID),
+    .io_channels_write_address_channel_AWREADY(dma_io_channels_write_address_channel_AWREADY),
+    .io_channels_write_address_channel_AWADDR(dma_io_channels_write_address_channel_AWADDR),
+    .io_channels_write_data_channel_WVALID(dma_io_channels_write_data_channel_WVALID),
+    .io_channels_write_data_channel_WREADY(dma_io_channels_write_data_channel_WREADY),
+    .io_channels_write_data_channel_WDATA(dma_io_channels_write_data_channel_WDATA),
+    .io_channels_write_response_channel_BVALID(dma_io_channels_write_response_channel_BVALID),
+    .io_channels_write_response_channel_BREADY(dma_io_channels_write_response_channel_BREADY),
+    .io_channels_read_address_channel_ARVALID(dma_io_channels_read_address_channel_ARVALID),
+    .io_channels_read_address_channel_ARREADY(dma_io_channels_read_address_channel_ARREADY),
+    .io_channels_read_address_channel_ARADDR(dma_io_channels_read_address_channel_ARADDR),
+    .io_channels_read_data_channel_RVALID(dma_io_channels_read_data_channel_RVALID),
+    .io_channels_read_data_channel_RREADY(dma_io_channels_read_data_channel_RREADY),
+    .io_channels_read_data_channel_RDATA(dma_io_channels_read_data_channel_RDATA),
+    .io_master_write_address_channel_AWVALID(dma_io_master_write_address_channel_AWVALID),
+    .io_master_write_address_channel_AWREADY(dma_io_master_write_address_channel_AWREADY),
+    .io_master_write_address_channel_AWADDR(dma_io_master_write_address_channel_AWADDR),
+    .io_master_write_data_channel_WVALID(dma_io_master_write_data_channel_WVALID),
+    .io_master_write_data_channel_WREADY(dma_io_master_write_data_channel_WREADY),
+    .io_master_write_data_channel_WDATA(dma_io_master_write_data_channel_WDATA),
+    .io_master_write_data_channel_WSTRB(dma_io_master_write_data_channel_WSTRB),
+    .io_master_write_response_channel_BVALID(dma_io_master_write_response_channel_BVALID),
+    .io_master_write_response_channel_BREADY(dma_io_master_write_response_channel_BREADY),
+    .io_master_read_address_channel_ARVALID(dma_io_master_read_address_channel_ARVALID),
+    .io_master_read_address_channel_ARREADY(dma_io_master_read_address_channel_ARREADY),
+    .io_master_read_address_channel_ARADDR(dma_io_master_read_address_channel_ARADDR),
+    .io_master_read_data_channel_RVALID(dma_io_master_read_data_channel_RVALID),
+    .io_master_read_data_channel_RREADY(dma_io_master_read_data_channel_RREADY),
+    .io_master_read_data_channel_RDATA(dma_io_master_read_data_channel_RDATA),
+    .io_signal_interrupt(dma_io_signal_interrupt)
+  );
   CPU cpu ( // @[4-soc/src/main/scala/board/verilator/Top.scala 60:27]
     .clock(cpu_clock),
     .reset(cpu_reset),
     .io_instruction_address(cpu_io_instruction_address),
     .io_instruction(cpu_io_instruction),
     .io_instruction_valid(cpu_io_instruction_valid),
+    .io_icache_enable(cpu_io_icache_enable),
+    .io_icache_refill_request(cpu_io_icache_refill_request),
+    .io_icache_refill_address(cpu_io_icache_refill_address),
+    .io_icache_refill_data(cpu_io_icache_refill_data),
+    .io_icache_refill_data_valid(cpu_io_icache_refill_data_valid),
+    .io_dcache_enable(cpu_io_dcache_enable),
     .io_axi4_channels_write_address_channel_AWVALID(cpu_io_axi4_channels_write_address_channel_AWVALID),
     .io_axi4_channels_write_address_channel_AWREADY(cpu_io_axi4_channels_write_address_channel_AWREADY),
     .io_axi4_channels_write_address_channel_AWADDR(cpu_io_axi4_channels_write_address_channel_AWADDR),
@@ -11130,7 +14405,14 @@ module Top(
     .io_debug_read_data(cpu_io_debug_read_data),
     .io_csr_debug_read_address(cpu_io_csr_debug_read_address),
     .io_csr_debug_read_data(cpu_io_csr_debug_read_data),
-    .io_bus_address(cpu_io_bus_address)
+    .io_retire_reg_valid(cpu_io_retire_reg_valid),
+    .io_retire_reg_pc(cpu_io_retire_reg_pc),
+    .io_retire_reg_rd(cpu_io_retire_reg_rd),
+    .io_retire_reg_data(cpu_io_retire_reg_data),
+    .io_retire_store_valid(cpu_io_retire_store_valid),
+    .io_retire_store_address(cpu_io_retire_store_address),
+    .io_retire_store_data(cpu_io_retire_store_data),
+    .io_retire_store_strobe(cpu_io_retire_store_strobe)
   );
   DummySlave dummy ( // @[4-soc/src/main/scala/board/verilator/Top.scala 61:27]
     .clock(dummy_clock),
@@ -11146,10 +14428,58 @@ module Top(
     .io_channels_read_data_channel_RVALID(dummy_io_channels_read_data_channel_RVALID),
     .io_channels_read_data_channel_RREADY(dummy_io_channels_read_data_channel_RREADY)
   );
+  BusArbiter bus_arbiter ( // @[4-soc/src/main/scala/board/verilator/Top.scala 80:27]
+    .clock(bus_arbiter_clock),
+    .reset(bus_arbiter_reset),
+    .io_masters_0_write_address_channel_AWVALID(bus_arbiter_io_masters_0_write_address_channel_AWVALID),
+    .io_masters_0_write_address_channel_AWREADY(bus_arbiter_io_masters_0_write_address_channel_AWREADY),
+    .io_masters_0_write_address_channel_AWADDR(bus_arbiter_io_masters_0_write_address_channel_AWADDR),
+    .io_masters_0_write_data_channel_WVALID(bus_arbiter_io_masters_0_write_data_channel_WVALID),
+    .io_masters_0_write_data_channel_WREADY(bus_arbiter_io_masters_0_write_data_channel_WREADY),
+    .io_masters_0_write_data_channel_WDATA(bus_arbiter_io_masters_0_write_data_channel_WDATA),
+    .io_masters_0_write_data_channel_WSTRB(bus_arbiter_io_masters_0_write_data_channel_WSTRB),
+    .io_masters_0_write_response_channel_BVALID(bus_arbiter_io_masters_0_write_response_channel_BVALID),
+    .io_masters_0_write_response_channel_BREADY(bus_arbiter_io_masters_0_write_response_channel_BREADY),
+    .io_masters_0_read_address_channel_ARVALID(bus_arbiter_io_masters_0_read_address_channel_ARVALID),
+    .io_masters_0_read_address_channel_ARREADY(bus_arbiter_io_masters_0_read_address_channel_ARREADY),
+    .io_masters_0_read_address_channel_ARADDR(bus_arbiter_io_masters_0_read_address_channel_ARADDR),
+    .io_masters_0_read_data_channel_RVALID(bus_arbiter_io_masters_0_read_data_channel_RVALID),
+    .io_masters_0_read_data_channel_RREADY(bus_arbiter_io_masters_0_read_data_channel_RREADY),
+    .io_masters_0_read_data_channel_RDATA(bus_arbiter_io_masters_0_read_data_channel_RDATA),
+    .io_masters_1_write_address_channel_AWVALID(bus_arbiter_io_masters_1_write_address_channel_AWVALID),
+    .io_masters_1_write_address_channel_AWREADY(bus_arbiter_io_masters_1_write_address_channel_AWREADY),
+    .io_masters_1_write_address_channel_AWADDR(bus_arbiter_io_masters_1_write_address_channel_AWADDR),
+    .io_masters_1_write_data_channel_WVALID(bus_arbiter_io_masters_1_write_data_channel_WVALID),
+    .io_masters_1_write_data_channel_WREADY(bus_arbiter_io_masters_1_write_data_channel_WREADY),
+    .io_masters_1_write_data_channel_WDATA(bus_arbiter_io_masters_1_write_data_channel_WDATA),
+    .io_masters_1_write_data_channel_WSTRB(bus_arbiter_io_masters_1_write_data_channel_WSTRB),
+    .io_masters_1_write_response_channel_BVALID(bus_arbiter_io_masters_1_write_response_channel_BVALID),
+    .io_masters_1_write_response_channel_BREADY(bus_arbiter_io_masters_1_write_response_channel_BREADY),
+    .io_masters_1_read_address_channel_ARVALID(bus_arbiter_io_masters_1_read_address_channel_ARVALID),
+    .io_masters_1_read_address_channel_ARREADY(bus_arbiter_io_masters_1_read_address_channel_ARREADY),
+    .io_masters_1_read_address_channel_ARADDR(bus_arbiter_io_masters_1_read_address_channel_ARADDR),
+    .io_masters_1_read_data_channel_RVALID(bus_arbiter_io_masters_1_read_data_channel_RVALID),
+    .io_masters_1_read_data_channel_RREADY(bus_arbiter_io_masters_1_read_data_channel_RREADY),
+    .io_masters_1_read_data_channel_RDATA(bus_arbiter_io_masters_1_read_data_channel_RDATA),
+    .io_slave_write_address_channel_AWVALID(bus_arbiter_io_slave_write_address_channel_AWVALID),
+    .io_slave_write_address_channel_AWREADY(bus_arbiter_io_slave_write_address_channel_AWREADY),
+    .io_slave_write_address_channel_AWADDR(bus_arbiter_io_slave_write_address_channel_AWADDR),
+    .io_slave_write_data_channel_WVALID(bus_arbiter_io_slave_write_data_channel_WVALID),
+    .io_slave_write_data_channel_WREADY(bus_arbiter_io_slave_write_data_channel_WREADY),
+    .io_slave_write_data_channel_WDATA(bus_arbiter_io_slave_write_data_channel_WDATA),
+    .io_slave_write_data_channel_WSTRB(bus_arbiter_io_slave_write_data_channel_WSTRB),
+    .io_slave_write_response_channel_BVALID(bus_arbiter_io_slave_write_response_channel_BVALID),
+    .io_slave_write_response_channel_BREADY(bus_arbiter_io_slave_write_response_channel_BREADY),
+    .io_slave_read_address_channel_ARVALID(bus_arbiter_io_slave_read_address_channel_ARVALID),
+    .io_slave_read_address_channel_ARREADY(bus_arbiter_io_slave_read_address_channel_ARREADY),
+    .io_slave_read_address_channel_ARADDR(bus_arbiter_io_slave_read_address_channel_ARADDR),
+    .io_slave_read_data_channel_RVALID(bus_arbiter_io_slave_read_data_channel_RVALID),
+    .io_slave_read_data_channel_RREADY(bus_arbiter_io_slave_read_data_channel_RREADY),
+    .io_slave_read_data_channel_RDATA(bus_arbiter_io_slave_read_data_channel_RDATA)
+  );
   BusSwitch bus_switch ( // @[4-soc/src/main/scala/board/verilator/Top.scala 63:27]
     .clock(bus_switch_clock),
     .reset(bus_switch_reset),
-    .io_address(bus_switch_io_address),
     .io_slaves_0_write_address_channel_AWVALID(bus_switch_io_slaves_0_write_address_channel_AWVALID),
     .io_slaves_0_write_address_channel_AWREADY(bus_switch_io_slaves_0_write_address_channel_AWREADY),
     .io_slaves_0_write_address_channel_AWADDR(bus_switch_io_slaves_0_write_address_channel_AWADDR),
@@ -11203,11 +14533,20 @@ module Top(
     .io_slaves_4_write_response_channel_BVALID(bus_switch_io_slaves_4_write_response_channel_BVALID),
     .io_slaves_4_read_address_channel_ARREADY(bus_switch_io_slaves_4_read_address_channel_ARREADY),
     .io_slaves_4_read_data_channel_RVALID(bus_switch_io_slaves_4_read_data_channel_RVALID),
+    .io_slaves_5_write_address_channel_AWVALID(bus_switch_io_slaves_5_write_address_channel_AWVALID),
     .io_slaves_5_write_address_channel_AWREADY(bus_switch_io_slaves_5_write_address_channel_AWREADY),
+    .io_slaves_5_write_address_channel_AWADDR(bus_switch_io_slaves_5_write_address_channel_AWADDR),
+    .io_slaves_5_write_data_channel_WVALID(bus_switch_io_slaves_5_write_data_channel_WVALID),
     .io_slaves_5_write_data_channel_WREADY(bus_switch_io_slaves_5_write_data_channel_WREADY),
+    .io_slaves_5_write_data_channel_WDATA(bus_switch_io_slaves_5_write_data_channel_WDATA),
     .io_slaves_5_write_response_channel_BVALID(bus_switch_io_slaves_5_write_response_channel_BVALID),
+    .io_slaves_5_write_response_channel_BREADY(bus_switch_io_slaves_5_write_response_channel_BREADY),
+    .io_slaves_5_read_address_channel_ARVALID(bus_switch_io_slaves_5_read_address_channel_ARVALID),
     .io_slaves_5_read_address_channel_ARREADY(bus_switch_io_slaves_5_read_address_channel_ARREADY),
+    .io_slaves_5_read_address_channel_ARADDR(bus_switch_io_slaves_5_read_address_channel_ARADDR),
     .io_slaves_5_read_data_channel_RVALID(bus_switch_io_slaves_5_read_data_channel_RVALID),
+    .io_slaves_5_read_data_channel_RREADY(bus_switch_io_slaves_5_read_data_channel_RREADY),
+    .io_slaves_5_read_data_channel_RDATA(bus_switch_io_slaves_5_read_data_channel_RDATA),
     .io_slaves_6_write_address_channel_AWREADY(bus_switch_io_slaves_6_write_address_channel_AWREADY),
     .io_slaves_6_write_data_channel_WREADY(bus_switch_io_slaves_6_write_data_channel_WREADY),
     .io_slaves_6_write_response_channel_BVALID(bus_switch_io_slaves_6_write_response_channel_BVALID),
@@ -11258,6 +14597,14 @@ module Top(
   assign io_uart_interrupt = uart_io_signal_interrupt; // @[4-soc/src/main/scala/board/verilator/Top.scala 106:21]
   assign io_cpu_debug_read_data = cpu_io_debug_read_data; // @[4-soc/src/main/scala/board/verilator/Top.scala 113:33]
   assign io_cpu_csr_debug_read_data = cpu_io_csr_debug_read_data; // @[4-soc/src/main/scala/board/verilator/Top.scala 115:33]
+  assign io_retire_reg_valid = cpu_io_retire_reg_valid; // @[4-soc/src/main/scala/board/verilator/Top.scala 120:33]
+  assign io_retire_reg_pc = cpu_io_retire_reg_pc; // @[4-soc/src/main/scala/board/verilator/Top.scala 120:33]
+  assign io_retire_reg_rd = cpu_io_retire_reg_rd; // @[4-soc/src/main/scala/board/verilator/Top.scala 120:33]
+  assign io_retire_reg_data = cpu_io_retire_reg_data; // @[4-soc/src/main/scala/board/verilator/Top.scala 120:33]
+  assign io_retire_store_valid = cpu_io_retire_store_valid; // @[4-soc/src/main/scala/board/verilator/Top.scala 120:33]
+  assign io_retire_store_address = cpu_io_retire_store_address; // @[4-soc/src/main/scala/board/verilator/Top.scala 120:33]
+  assign io_retire_store_data = cpu_io_retire_store_data; // @[4-soc/src/main/scala/board/verilator/Top.scala 120:33]
+  assign io_retire_store_strobe = cpu_io_retire_store_strobe; // @[4-soc/src/main/scala/board/verilator/Top.scala 120:33]
   assign mem_slave_clock = clock;
   assign mem_slave_reset = reset;
   assign mem_slave_io_channels_write_address_channel_AWVALID = bus_switch_io_slaves_0_write_address_channel_AWVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 87:27]
@@ -11274,12 +14621,12 @@ module Top(
   assign vga_clock = clock;
   assign vga_reset = reset;
   assign vga_io_channels_write_address_channel_AWVALID = bus_switch_io_slaves_1_write_address_channel_AWVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 88:27]
-  assign vga_io_channels_write_address_channel_AWADDR = bus_switch_io_slaves_1_write_address_channel_AWADDR[7:0]; // @[4-soc/src/main/scala/board/verilator/Top.scala 88:27]
+  assign vga_io_channels_write_address_channel_AWADDR = bus_switch_io_slaves_1_write_address_channel_AWADDR[15:0]; // @[4-soc/src/main/scala/board/verilator/Top.scala 88:27]
   assign vga_io_channels_write_data_channel_WVALID = bus_switch_io_slaves_1_write_data_channel_WVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 88:27]
   assign vga_io_channels_write_data_channel_WDATA = bus_switch_io_slaves_1_write_data_channel_WDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 88:27]
   assign vga_io_channels_write_response_channel_BREADY = bus_switch_io_slaves_1_write_response_channel_BREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 88:27]
   assign vga_io_channels_read_address_channel_ARVALID = bus_switch_io_slaves_1_read_address_channel_ARVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 88:27]
-  assign vga_io_channels_read_address_channel_ARADDR = bus_switch_io_slaves_1_read_address_channel_ARADDR[7:0]; // @[4-soc/src/main/scala/board/verilator/Top.scala 88:27]
+  assign vga_io_channels_read_address_channel_ARADDR = bus_switch_io_slaves_1_read_address_channel_ARADDR[15:0]; // @[4-soc/src/main/scala/board/verilator/Top.scala 88:27]
   assign vga_io_channels_read_data_channel_RREADY = bus_switch_io_slaves_1_read_data_channel_RREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 88:27]
   assign vga_io_pixClock = io_vga_pixclk; // @[4-soc/src/main/scala/board/verilator/Top.scala 95:22]
   assign uart_clock = clock;
@@ -11293,17 +14640,39 @@ module Top(
   assign uart_io_channels_read_address_channel_ARADDR = bus_switch_io_slaves_2_read_address_channel_ARADDR[7:0]; // @[4-soc/src/main/scala/board/verilator/Top.scala 89:27]
   assign uart_io_channels_read_data_channel_RREADY = bus_switch_io_slaves_2_read_data_channel_RREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 89:27]
   assign uart_io_rxd = io_uart_rxd; // @[4-soc/src/main/scala/board/verilator/Top.scala 105:21]
+  assign dma_clock = clock;
+  assign dma_reset = reset;
+  assign dma_io_channels_write_address_channel_AWVALID = bus_switch_io_slaves_5_write_address_channel_AWVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 113:31]
+  assign dma_io_channels_write_address_channel_AWADDR = bus_switch_io_slaves_5_write_address_channel_AWADDR[7:0]; // @[4-soc/src/main/scala/board/verilator/Top.scala 113:31]
+  assign dma_io_channels_write_data_channel_WVALID = bus_switch_io_slaves_5_write_data_channel_WVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 113:31]
+  assign dma_io_channels_write_data_channel_WDATA = bus_switch_io_slaves_5_write_data_channel_WDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 113:31]
+  assign dma_io_channels_write_response_channel_BREADY = bus_switch_io_slaves_5_write_response_channel_BREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 113:31]
+  assign dma_io_channels_read_address_channel_ARVALID = bus_switch_io_slaves_5_read_address_channel_ARVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 113:31]
+  assign dma_io_channels_read_address_channel_ARADDR = bus_switch_io_slaves_5_read_address_channel_ARADDR[7:0]; // @[4-soc/src/main/scala/board/verilator/Top.scala 113:31]
+  assign dma_io_channels_read_data_channel_RREADY = bus_switch_io_slaves_5_read_data_channel_RREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 113:31]
+  assign dma_io_master_write_address_channel_AWREADY = bus_arbiter_io_masters_1_write_address_channel_AWREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 104:29]
+  assign dma_io_master_write_data_channel_WREADY = bus_arbiter_io_masters_1_write_data_channel_WREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 104:29]
+  assign dma_io_master_write_response_channel_BVALID = bus_arbiter_io_masters_1_write_response_channel_BVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 104:29]
+  assign dma_io_master_read_address_channel_ARREADY = bus_arbiter_io_masters_1_read_address_channel_ARREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 104:29]
+  assign dma_io_master_read_data_channel_RVALID = bus_arbiter_io_masters_1_read_data_channel_RVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 104:29]
+  assign dma_io_master_read_data_channel_RDATA = bus_arbiter_io_masters_1_read_data_channel_RDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 104:29]
   assign cpu_clock = clock;
   assign cpu_reset = reset;
   assign cpu_io_instruction = io_instruction; // @[4-soc/src/main/scala/board/verilator/Top.scala 67:28]
+  assign io_icache_refill_request = cpu_io_icache_refill_request; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:20]
+  assign io_icache_refill_address = cpu_io_icache_refill_address; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:20]
   assign cpu_io_instruction_valid = io_instruction_valid; // @[4-soc/src/main/scala/board/verilator/Top.scala 68:28]
-  assign cpu_io_axi4_channels_write_address_channel_AWREADY = bus_switch_io_master_write_address_channel_AWREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 85:24]
-  assign cpu_io_axi4_channels_write_data_channel_WREADY = bus_switch_io_master_write_data_channel_WREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 85:24]
-  assign cpu_io_axi4_channels_write_response_channel_BVALID = bus_switch_io_master_write_response_channel_BVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 85:24]
-  assign cpu_io_axi4_channels_read_address_channel_ARREADY = bus_switch_io_master_read_address_channel_ARREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 85:24]
-  assign cpu_io_axi4_channels_read_data_channel_RVALID = bus_switch_io_master_read_data_channel_RVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 85:24]
-  assign cpu_io_axi4_channels_read_data_channel_RDATA = bus_switch_io_master_read_data_channel_RDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 85:24]
-  assign cpu_io_interrupt_flag = {{31'd0}, io_signal_interrupt}; // @[4-soc/src/main/scala/board/verilator/Top.scala 109:25]
+  assign cpu_io_icache_enable = io_icache_enable; // @[4-soc/src/main/scala/board/verilator/Top.scala 79:28]
+  assign cpu_io_dcache_enable = io_dcache_enable; // @[4-soc/src/main/scala/board/verilator/Top.scala 83:28]
+  assign cpu_io_icache_refill_data = io_icache_refill_data; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:20]
+  assign cpu_io_icache_refill_data_valid = io_icache_refill_data_valid; // @[4-soc/src/main/scala/board/verilator/Top.scala 80:20]
+  assign cpu_io_axi4_channels_write_address_channel_AWREADY = bus_arbiter_io_masters_0_write_address_channel_AWREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 103:29]
+  assign cpu_io_axi4_channels_write_data_channel_WREADY = bus_arbiter_io_masters_0_write_data_channel_WREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 103:29]
+  assign cpu_io_axi4_channels_write_response_channel_BVALID = bus_arbiter_io_masters_0_write_response_channel_BVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 103:29]
+  assign cpu_io_axi4_channels_read_address_channel_ARREADY = bus_arbiter_io_masters_0_read_address_channel_ARREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 103:29]
+  assign cpu_io_axi4_channels_read_data_channel_RVALID = bus_arbiter_io_masters_0_read_data_channel_RVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 103:29]
+  assign cpu_io_axi4_channels_read_data_channel_RDATA = bus_arbiter_io_masters_0_read_data_channel_RDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 103:29]
+  assign cpu_io_interrupt_flag = {{30'd0}, _cpu_io_interrupt_flag_T}; // @[4-soc/src/main/scala/board/verilator/Top.scala 148:25]
   assign cpu_io_debug_read_address = io_cpu_debug_read_address; // @[4-soc/src/main/scala/board/verilator/Top.scala 112:33]
   assign cpu_io_csr_debug_read_address = io_cpu_csr_debug_read_address; // @[4-soc/src/main/scala/board/verilator/Top.scala 114:33]
   assign dummy_clock = clock;
@@ -11313,9 +14682,34 @@ module Top(
   assign dummy_io_channels_write_response_channel_BREADY = bus_switch_io_slaves_7_write_response_channel_BREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 91:29]
   assign dummy_io_channels_read_address_channel_ARVALID = bus_switch_io_slaves_7_read_address_channel_ARVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 91:29]
   assign dummy_io_channels_read_data_channel_RREADY = bus_switch_io_slaves_7_read_data_channel_RREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 91:29]
+  assign bus_arbiter_clock = clock;
+  assign bus_arbiter_reset = reset;
+  assign bus_arbiter_io_masters_0_write_address_channel_AWVALID = cpu_io_axi4_channels_write_address_channel_AWVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 103:29]
+  assign bus_arbiter_io_masters_0_write_address_channel_AWADDR = cpu_io_axi4_channels_write_address_channel_AWADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 103:29]
+  assign bus_arbiter_io_masters_0_write_data_channel_WVALID = cpu_io_axi4_channels_write_data_channel_WVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 103:29]
+  assign bus_arbiter_io_masters_0_write_data_channel_WDATA = cpu_io_axi4_channels_write_data_channel_WDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 103:29]
+  assign bus_arbiter_io_masters_0_write_data_channel_WSTRB = cpu_io_axi4_channels_write_data_channel_WSTRB; // @[4-soc/src/main/scala/board/verilator/Top.scala 103:29]
+  assign bus_arbiter_io_masters_0_write_response_channel_BREADY = cpu_io_axi4_channels_write_response_channel_BREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 103:29]
+  assign bus_arbiter_io_masters_0_read_address_channel_ARVALID = cpu_io_axi4_channels_read_address_channel_ARVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 103:29]
+  assign bus_arbiter_io_masters_0_read_address_channel_ARADDR = cpu_io_axi4_channels_read_address_channel_ARADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 103:29]
+  assign bus_arbiter_io_masters_0_read_data_channel_RREADY = cpu_io_axi4_channels_read_data_channel_RREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 103:29]
+  assign bus_arbiter_io_masters_1_write_address_channel_AWVALID = dma_io_master_write_address_channel_AWVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 104:29]
+  assign bus_arbiter_io_masters_1_write_address_channel_AWADDR = dma_io_master_write_address_channel_AWADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 104:29]
+  assign bus_arbiter_io_masters_1_write_data_channel_WVALID = dma_io_master_write_data_channel_WVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 104:29]
+  assign bus_arbiter_io_masters_1_write_data_channel_WDATA = dma_io_master_write_data_channel_WDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 104:29]
+  assign bus_arbiter_io_masters_1_write_data_channel_WSTRB = dma_io_master_write_data_channel_WSTRB; // @[4-soc/src/main/scala/board/verilator/Top.scala 104:29]
+  assign bus_arbiter_io_masters_1_write_response_channel_BREADY = dma_io_master_write_response_channel_BREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 104:29]
+  assign bus_arbiter_io_masters_1_read_address_channel_ARVALID = dma_io_master_read_address_channel_ARVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 104:29]
+  assign bus_arbiter_io_masters_1_read_address_channel_ARADDR = dma_io_master_read_address_channel_ARADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 104:29]
+  assign bus_arbiter_io_masters_1_read_data_channel_RREADY = dma_io_master_read_data_channel_RREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 104:29]
+  assign bus_arbiter_io_slave_write_address_channel_AWREADY = bus_switch_io_master_write_address_channel_AWREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 107:24]
+  assign bus_arbiter_io_slave_write_data_channel_WREADY = bus_switch_io_master_write_data_channel_WREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 107:24]
+  assign bus_arbiter_io_slave_write_response_channel_BVALID = bus_switch_io_master_write_response_channel_BVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 107:24]
+  assign bus_arbiter_io_slave_read_address_channel_ARREADY = bus_switch_io_master_read_address_channel_ARREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 107:24]
+  assign bus_arbiter_io_slave_read_data_channel_RVALID = bus_switch_io_master_read_data_channel_RVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 107:24]
+  assign bus_arbiter_io_slave_read_data_channel_RDATA = bus_switch_io_master_read_data_channel_RDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 107:24]
   assign bus_switch_clock = clock;
   assign bus_switch_reset = reset;
-  assign bus_switch_io_address = cpu_io_bus_address; // @[4-soc/src/main/scala/board/verilator/Top.scala 86:25]
   assign bus_switch_io_slaves_0_write_address_channel_AWREADY = mem_slave_io_channels_write_address_channel_AWREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 87:27]
   assign bus_switch_io_slaves_0_write_data_channel_WREADY = mem_slave_io_channels_write_data_channel_WREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 87:27]
   assign bus_switch_io_slaves_0_write_response_channel_BVALID = mem_slave_io_channels_write_response_channel_BVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 87:27]
@@ -11344,11 +14738,12 @@ module Top(
   assign bus_switch_io_slaves_4_write_response_channel_BVALID = dummy_io_channels_write_response_channel_BVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 91:29]
   assign bus_switch_io_slaves_4_read_address_channel_ARREADY = dummy_io_channels_read_address_channel_ARREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 91:29]
   assign bus_switch_io_slaves_4_read_data_channel_RVALID = dummy_io_channels_read_data_channel_RVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 91:29]
-  assign bus_switch_io_slaves_5_write_address_channel_AWREADY = dummy_io_channels_write_address_channel_AWREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 91:29]
-  assign bus_switch_io_slaves_5_write_data_channel_WREADY = dummy_io_channels_write_data_channel_WREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 91:29]
-  assign bus_switch_io_slaves_5_write_response_channel_BVALID = dummy_io_channels_write_response_channel_BVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 91:29]
-  assign bus_switch_io_slaves_5_read_address_channel_ARREADY = dummy_io_channels_read_address_channel_ARREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 91:29]
-  assign bus_switch_io_slaves_5_read_data_channel_RVALID = dummy_io_channels_read_data_channel_RVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 91:29]
+  assign bus_switch_io_slaves_5_write_address_channel_AWREADY = dma_io_channels_write_address_channel_AWREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 113:31]
+  assign bus_switch_io_slaves_5_write_data_channel_WREADY = dma_io_channels_write_data_channel_WREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 113:31]
+  assign bus_switch_io_slaves_5_write_response_channel_BVALID = dma_io_channels_write_response_channel_BVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 113:31]
+  assign bus_switch_io_slaves_5_read_address_channel_ARREADY = dma_io_channels_read_address_channel_ARREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 113:31]
+  assign bus_switch_io_slaves_5_read_data_channel_RVALID = dma_io_channels_read_data_channel_RVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 113:31]
+  assign bus_switch_io_slaves_5_read_data_channel_RDATA = dma_io_channels_read_data_channel_RDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 113:31]
   assign bus_switch_io_slaves_6_write_address_channel_AWREADY = dummy_io_channels_write_address_channel_AWREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 91:29]
   assign bus_switch_io_slaves_6_write_data_channel_WREADY = dummy_io_channels_write_data_channel_WREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 91:29]
   assign bus_switch_io_slaves_6_write_response_channel_BVALID = dummy_io_channels_write_response_channel_BVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 91:29]
@@ -11359,13 +14754,13 @@ module Top(
   assign bus_switch_io_slaves_7_write_response_channel_BVALID = dummy_io_channels_write_response_channel_BVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 91:29]
   assign bus_switch_io_slaves_7_read_address_channel_ARREADY = dummy_io_channels_read_address_channel_ARREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 91:29]
   assign bus_switch_io_slaves_7_read_data_channel_RVALID = dummy_io_channels_read_data_channel_RVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 91:29]
-  assign bus_switch_io_master_write_address_channel_AWVALID = cpu_io_axi4_channels_write_address_channel_AWVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 85:24]
-  assign bus_switch_io_master_write_address_channel_AWADDR = cpu_io_axi4_channels_write_address_channel_AWADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 85:24]
-  assign bus_switch_io_master_write_data_channel_WVALID = cpu_io_axi4_channels_write_data_channel_WVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 85:24]
-  assign bus_switch_io_master_write_data_channel_WDATA = cpu_io_axi4_channels_write_data_channel_WDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 85:24]
-  assign bus_switch_io_master_write_data_channel_WSTRB = cpu_io_axi4_channels_write_data_channel_WSTRB; // @[4-soc/src/main/scala/board/verilator/Top.scala 85:24]
-  assign bus_switch_io_master_write_response_channel_BREADY = cpu_io_axi4_channels_write_response_channel_BREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 85:24]
-  assign bus_switch_io_master_read_address_channel_ARVALID = cpu_io_axi4_channels_read_address_channel_ARVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 85:24]
-  assign bus_switch_io_master_read_address_channel_ARADDR = cpu_io_axi4_channels_read_address_channel_ARADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 85:24]
-  assign bus_switch_io_master_read_data_channel_RREADY = cpu_io_axi4_channels_read_data_channel_RREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 85:24]
+  assign bus_switch_io_master_write_address_channel_AWVALID = bus_arbiter_io_slave_write_address_channel_AWVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 107:24]
+  assign bus_switch_io_master_write_address_channel_AWADDR = bus_arbiter_io_slave_write_address_channel_AWADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 107:24]
+  assign bus_switch_io_master_write_data_channel_WVALID = bus_arbiter_io_slave_write_data_channel_WVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 107:24]
+  assign bus_switch_io_master_write_data_channel_WDATA = bus_arbiter_io_slave_write_data_channel_WDATA; // @[4-soc/src/main/scala/board/verilator/Top.scala 107:24]
+  assign bus_switch_io_master_write_data_channel_WSTRB = bus_arbiter_io_slave_write_data_channel_WSTRB; // @[4-soc/src/main/scala/board/verilator/Top.scala 107:24]
+  assign bus_switch_io_master_write_response_channel_BREADY = bus_arbiter_io_slave_write_response_channel_BREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 107:24]
+  assign bus_switch_io_master_read_address_channel_ARVALID = bus_arbiter_io_slave_read_address_channel_ARVALID; // @[4-soc/src/main/scala/board/verilator/Top.scala 107:24]
+  assign bus_switch_io_master_read_address_channel_ARADDR = bus_arbiter_io_slave_read_address_channel_ARADDR; // @[4-soc/src/main/scala/board/verilator/Top.scala 107:24]
+  assign bus_switch_io_master_read_data_channel_RREADY = bus_arbiter_io_slave_read_data_channel_RREADY; // @[4-soc/src/main/scala/board/verilator/Top.scala 107:24]
 endmodule
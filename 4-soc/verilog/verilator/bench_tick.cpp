@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: MIT
+// MyCPU is freely redistributable under the MIT License. See the file
+// "LICENSE" for information on usage and redistribution of this file.
+
+// Tick loop microbenchmark: the specialized headless batch loop against
+// the fully checked one (Simulator::set_specialized(false)), same binary
+// and tick count. Usage: bench_tick <binary.asmbin> [ticks] [rounds]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+
+#include "simulator.h"
+
+// Best-of-`rounds` ticks per second; the run's end state goes to `pc_out`
+static double measure(const char *binary,
+                      uint64_t ticks,
+                      int rounds,
+                      bool specialized,
+                      uint32_t &pc_out)
+{
+    double best = 0;
+    for (int r = 0; r < rounds; r++) {
+        VerilatedContext ctx;
+        Simulator sim(4 * 1024 * 1024, &ctx);
+        sim.load(binary);
+        sim.set_uart_capture(true);
+        sim.set_specialized(specialized);
+        sim.reset();
+        auto t0 = std::chrono::steady_clock::now();
+        sim.run(ticks);
+        double s = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - t0)
+                       .count();
+        if (sim.ticks() / s > best)
+            best = sim.ticks() / s;
+        pc_out = sim.pc();
+    }
+    return best;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <binary.asmbin> [ticks] [rounds]\n",
+                argv[0]);
+        return 1;
+    }
+    const uint64_t ticks = argc > 2 ? strtoull(argv[2], nullptr, 0) : 20000000;
+    const int rounds = argc > 3 ? atoi(argv[3]) : 3;
+
+    uint32_t pc_generic = 0, pc_special = 0;
+    double generic, special;
+    try {
+        generic = measure(argv[1], ticks, rounds, false, pc_generic);
+        special = measure(argv[1], ticks, rounds, true, pc_special);
+    } catch (const std::exception &e) {
+        fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+
+    printf("Tick loop, %llu ticks, best of %d\n", (unsigned long long) ticks,
+           rounds);
+    printf("  Fully checked: %8.3f Mticks/s\n", generic / 1e6);
+    printf("  Specialized:   %8.3f Mticks/s (%+.1f%%)\n", special / 1e6,
+           100.0 * (special / generic - 1));
+    if (pc_generic != pc_special) {
+        printf("  Final PC differs: 0x%08x vs 0x%08x\n", pc_generic,
+               pc_special);
+        return 1;
+    }
+    return 0;
+}
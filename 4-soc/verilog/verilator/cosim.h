@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: MIT
+// Cosim - lockstep co-simulation of the RTL against the functional Iss
+//
+// Top exports a retirement trace (io_retire_*): every register write-back
+// as it leaves WB, and every store as it starts on the bus. For each RTL
+// write-back the Iss steps to its next instruction that writes a register,
+// and pc, rd and the value must match. Stores are queued on both sides and
+// compared in order (word address, strobe, data bytes under the strobe).
+// The first difference stops the run with the last HISTORY matched events.
+//
+// The Iss has its own memory loaded with the same binary: it runs a few
+// instructions behind the RTL, so sharing the RTL's memory would let it see
+// younger stores. Values the Iss cannot predict are taken from the RTL:
+// MMIO loads, counter CSR reads (mcycle, minstret, mhpmcounter*) and the
+// host call result words, which the Iss copies from RTL memory after its
+// own (silent) service of the same request.
+//
+// Instructions without a write-back (branches, fences, ecall/mret) raise no
+// event; a wrong branch shows up as the next write-back's pc.
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+
+#include "elf_file.h"
+#include "iss.h"
+#include "memory.h"
+#include "simulator.h"
+
+class Cosim : public RetireSink
+{
+public:
+    static constexpr size_t HISTORY = 32;
+    // Iss instructions tolerated between two write-backs (branch-only loops)
+    static constexpr uint32_t MAX_SILENT = 100000;
+
+private:
+    struct Store {
+        uint32_t pc;  // Iss side only
+        uint32_t addr, data;
+        uint8_t strobe;
+    };
+    struct Entry {
+        uint64_t cycle;
+        bool store;
+        uint32_t pc, rd, data, addr;
+        uint8_t strobe;
+    };
+
+    Simulator &sim;
+    Memory mem;
+    Iss iss;
+    std::deque<Store> rtl_stores, iss_stores;
+    Entry history[HISTORY];
+    uint64_t events = 0;
+    uint64_t writebacks = 0, stores = 0, patched = 0;
+    bool diverged_ = false;
+
+    static uint32_t lane_mask(uint8_t strobe)
+    {
+        uint32_t m = 0;
+        for (int i = 0; i < 4; i++)
+            if (strobe & (1 << i))
+                m |= 0xFFu << (8 * i);
+        return m;
+    }
+
+    void record(const Entry &e) { history[events++ % HISTORY] = e; }
+
+    bool diverge()
+    {
+        diverged_ = true;
+        const uint64_t n = events < HISTORY ? events : HISTORY;
+        printf("  Last %llu matched events (oldest first):\n",
+               (unsigned long long) n);
+        for (uint64_t i = events - n; i < events; i++) {
+            const Entry &e = history[i % HISTORY];
+            if (e.store)
+                printf("    %10llu  pc=0x%08x  store [0x%08x] = 0x%08x/%x\n",
+                       (unsigned long long) e.cycle, e.pc, e.addr, e.data,
+                       e.strobe);
+            else
+                printf("    %10llu  pc=0x%08x  x%-2u = 0x%08x\n",
+                       (unsigned long long) e.cycle, e.pc, e.rd, e.data);
+        }
+        fflush(stdout);
+        return false;
+    }
+
+    // Pair up queued stores in program order
+    bool match_stores()
+    {
+        while (!rtl_stores.empty() && !iss_stores.empty()) {
+            const Store r = rtl_stores.front(), s = iss_stores.front();
+            rtl_stores.pop_front();
+            iss_stores.pop_front();
+            if (r.addr != s.addr || r.strobe != s.strobe ||
+                ((r.data ^ s.data) & lane_mask(r.strobe))) {
+                printf("\nCOSIM: store mismatch at cycle %llu\n",
+                       (unsigned long long) sim.cycles());
+                printf("  RTL:             [0x%08x] = 0x%08x/%x\n", r.addr,
+                       r.data, r.strobe);
+                printf("  ISS: pc=0x%08x [0x%08x] = 0x%08x/%x\n", s.pc,
+                       s.addr, s.data, s.strobe);
+                return diverge();
+            }
+            stores++;
+            record({sim.cycles(), true, s.pc, 0, s.data, s.addr, s.strobe});
+        }
+        return true;
+    }
+
+    // Step the Iss to its next register write; false on an Iss stop
+    bool step_to_writeback()
+    {
+        for (uint32_t n = 0; n < MAX_SILENT; n++) {
+            if (!iss.step(1))
+                return false;
+            const Iss::Retired &e = iss.last_retired();
+            if (e.store) {
+                iss_stores.push_back(
+                    {e.pc, e.store_addr, e.store_data, e.store_strobe});
+                if (e.store_addr == HOSTCALL_DOORBELL) {
+                    // ret/ret_hi as the RTL's service wrote them
+                    for (uint32_t off = 0x14; off <= 0x18; off += 4)
+                        mem.write(e.store_data + off,
+                                  sim.memory().read(e.store_data + off), 0xF);
+                }
+            }
+            if (iss.stop() != Iss::RUNNING)
+                return false;
+            if (e.rd)
+                return true;
+        }
+        return false;
+    }
+
+public:
+    // `binary` is loaded into the Iss's memory as Simulator::load() does
+    Cosim(Simulator &s,
+          const char *binary,
+          const char *hostfs = nullptr,
+          size_t mem_words = 4 * 1024 * 1024)
+        : sim(s), mem(mem_words), iss(mem)
+    {
+        load_program(mem, binary);
+        iss.set_hostfs(hostfs);
+        iss.set_quiet(true);
+    }
+
+    bool retire(const RetireInfo &r) override
+    {
+        if (diverged_)
+            return false;
+        // The write-back is older than a store starting in MEM this cycle
+        if (r.reg_valid && r.reg_rd && iss.stop() == Iss::RUNNING) {
+            bool ok = step_to_writeback();
+            const Iss::Retired &e = iss.last_retired();
+            if (iss.stop() == Iss::TEST_DONE || iss.stop() == Iss::HOST_EXIT)
+                return match_stores();  // The RTL is about to finish too
+            bool same = ok && e.pc == r.reg_pc && e.rd == r.reg_rd;
+            if (same && e.rd_data != r.reg_data) {
+                if (!e.unpredictable)
+                    same = false;
+                else {
+                    iss.x[e.rd] = r.reg_data;
+                    patched++;
+                }
+            }
+            if (!same) {
+                printf("\nCOSIM: write-back mismatch at cycle %llu\n",
+                       (unsigned long long) sim.cycles());
+                printf("  RTL: pc=0x%08x x%-2u = 0x%08x\n", r.reg_pc,
+                       r.reg_rd, r.reg_data);
+                if (iss.stop() == Iss::ILLEGAL)
+                    printf("  ISS: illegal instruction at pc=0x%08x\n",
+                           iss.pc());
+                else if (!ok)
+                    printf("  ISS: no write-back in %u instructions\n",
+                           MAX_SILENT);
+                else
+                    printf("  ISS: pc=0x%08x x%-2u = 0x%08x (inst 0x%08x)\n",
+                           e.pc, e.rd, e.rd_data, e.inst);
+                return diverge();
+            }
+            writebacks++;
+            record({sim.cycles(), false, e.pc, e.rd, r.reg_data, 0, 0});
+        }
+        if (r.store_valid)
+            rtl_stores.push_back(
+                {0, r.store_address, r.store_data, r.store_strobe});
+        return match_stores();
+    }
+
+    bool diverged() const { return diverged_; }
+
+    void print_report() const
+    {
+        printf("\nCOSIM: %s after %llu write-backs and %llu stores "
+               "(%llu values taken from the RTL)\n",
+               diverged_ ? "diverged" : "matched",
+               (unsigned long long) writebacks, (unsigned long long) stores,
+               (unsigned long long) patched);
+    }
+};
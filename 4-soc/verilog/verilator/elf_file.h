@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: MIT
+// ELF File - 32-bit little-endian RISC-V executables for the harness
+//
+// Loads PT_LOAD segments into Memory at their physical addresses and looks
+// up symbols, which is what the compliance flow needs: RISCOF test ELFs are
+// run directly, and begin_signature/end_signature/tohost come from .symtab.
+// The core always starts at 0x1000, so images must be linked there.
+//
+// load_program() accepts either an ELF or a raw image (.asmbin) loaded at
+// `base`, and is what every front end uses to fill main memory.
+
+#pragma once
+
+#include <elf.h>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "memory.h"
+
+class ElfFile
+{
+    std::vector<uint8_t> data;
+    std::map<std::string, uint32_t> symbols;
+
+    const Elf32_Ehdr *header() const
+    {
+        return reinterpret_cast<const Elf32_Ehdr *>(data.data());
+    }
+
+    bool in_bounds(size_t off, size_t len) const
+    {
+        return off <= data.size() && len <= data.size() - off;
+    }
+
+    void read_symbols()
+    {
+        const Elf32_Ehdr *eh = header();
+        const size_t sh_size = size_t(eh->e_shnum) * sizeof(Elf32_Shdr);
+        if (!eh->e_shoff || !in_bounds(eh->e_shoff, sh_size))
+            return;
+        const auto *sh =
+            reinterpret_cast<const Elf32_Shdr *>(data.data() + eh->e_shoff);
+        for (unsigned i = 0; i < eh->e_shnum; i++) {
+            if (sh[i].sh_type != SHT_SYMTAB || sh[i].sh_link >= eh->e_shnum)
+                continue;
+            const Elf32_Shdr &strtab = sh[sh[i].sh_link];
+            if (!in_bounds(sh[i].sh_offset, sh[i].sh_size) ||
+                !in_bounds(strtab.sh_offset, strtab.sh_size) ||
+                !strtab.sh_size || data[strtab.sh_offset + strtab.sh_size - 1])
+                continue;  // Malformed, or names not NUL-terminated
+            const auto *sym = reinterpret_cast<const Elf32_Sym *>(
+                data.data() + sh[i].sh_offset);
+            const char *names =
+                reinterpret_cast<const char *>(data.data() + strtab.sh_offset);
+            for (size_t n = 0; n < sh[i].sh_size / sizeof(Elf32_Sym); n++) {
+                if (sym[n].st_name >= strtab.sh_size)
+                    continue;
+                if (names[sym[n].st_name])
+                    symbols[names + sym[n].st_name] = sym[n].st_value;
+            }
+        }
+    }
+
+public:
+    static bool is_elf(const char *path)
+    {
+        std::ifstream f(path, std::ios::binary);
+        char magic[SELFMAG];
+        return f.read(magic, SELFMAG) && !memcmp(magic, ELFMAG, SELFMAG);
+    }
+
+    // Read and validate `path`; throws std::runtime_error
+    explicit ElfFile(const char *path)
+    {
+        std::ifstream f(path, std::ios::binary);
+        if (!f)
+            throw std::runtime_error(std::string("Cannot open ") + path);
+        data.assign(std::istreambuf_iterator<char>(f),
+                    std::istreambuf_iterator<char>());
+        if (data.size() < sizeof(Elf32_Ehdr) ||
+            memcmp(data.data(), ELFMAG, SELFMAG))
+            throw std::runtime_error(std::string("Not an ELF file: ") + path);
+        const Elf32_Ehdr *eh = header();
+        if (eh->e_ident[EI_CLASS] != ELFCLASS32 ||
+            eh->e_ident[EI_DATA] != ELFDATA2LSB || eh->e_machine != EM_RISCV)
+            throw std::runtime_error(
+                std::string("Not a 32-bit little-endian RISC-V ELF: ") + path);
+        if (!in_bounds(eh->e_phoff, size_t(eh->e_phnum) * sizeof(Elf32_Phdr)))
+            throw std::runtime_error(std::string("Truncated ELF: ") + path);
+        read_symbols();
+    }
+
+    uint32_t entry() const { return header()->e_entry; }
+
+    // Copy every PT_LOAD segment; the part past p_filesz is zeroed
+    void load(Memory &mem) const
+    {
+        const Elf32_Ehdr *eh = header();
+        const auto *ph =
+            reinterpret_cast<const Elf32_Phdr *>(data.data() + eh->e_phoff);
+        for (unsigned i = 0; i < eh->e_phnum; i++) {
+            if (ph[i].p_type != PT_LOAD)
+                continue;
+            if (!in_bounds(ph[i].p_offset, ph[i].p_filesz) ||
+                ph[i].p_filesz > ph[i].p_memsz)
+                throw std::runtime_error("Bad ELF program header");
+            const uint8_t *src = data.data() + ph[i].p_offset;
+            for (uint32_t b = 0; b < ph[i].p_memsz; b++)
+                mem.write_byte(ph[i].p_paddr + b,
+                               b < ph[i].p_filesz ? src[b] : 0);
+        }
+    }
+
+    // Symbol value, or false when the symbol is absent
+    bool symbol(const std::string &name, uint32_t &value) const
+    {
+        auto it = symbols.find(name);
+        if (it == symbols.end())
+            return false;
+        value = it->second;
+        return true;
+    }
+};
+
+// Fill `mem` from an ELF (by its segment addresses) or a raw image at `base`
+inline void load_program(Memory &mem, const char *path, size_t base = 0x1000)
+{
+    if (ElfFile::is_elf(path))
+        ElfFile(path).load(mem);
+    else
+        mem.load(path, base);
+}
@@ -0,0 +1,544 @@
+// SPDX-License-Identifier: MIT
+// MyCPU is freely redistributable under the MIT License. See the file
+// "LICENSE" for information on usage and redistribution of this file.
+
+// Regression farm: run many VTop workloads in parallel from a manifest.
+//
+// Each manifest line describes one job:
+//
+//   <name> <binary.asmbin> [key=value ...]
+//
+//   args="..."      extra simulator flags (default: --headless)
+//   input="..."     bytes fed to the simulator's stdin (\r \n \t \xNN)
+//   max_cycles=N    simulator cycle budget (--max-cycles)
+//   timeout=S       host wall-clock limit in seconds (default 300)
+//   expect=X        pass  - guest wrote 0xCAFEF00D to 0x100 with a passing
+//                           result at 0x104 ("TEST PASSED")
+//                   fail  - guest reported a failing result
+//                   done  - simulator exited cleanly (cycle limit or exit)
+//   output="..."    stdout must contain this text
+//
+// Blank lines and lines starting with '#' are ignored. Jobs are pulled from
+// a shared work queue by one worker per host core (override with -j).
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+struct Job {
+    std::string name;
+    std::string binary;
+    std::vector<std::string> args{"--headless"};
+    std::string input;
+    uint64_t max_cycles = 0;  // 0 = simulator default
+    double timeout = 300.0;
+    std::string expect = "pass";
+    std::string output;
+    int line = 0;
+};
+
+struct Result {
+    enum class Status { PASS, FAIL, TIMEOUT, ERROR } status = Status::ERROR;
+    std::string message;
+    std::string output;
+    uint64_t cycles = 0;
+    double host_seconds = 0;
+    int exit_code = -1;
+};
+
+static const char *status_name(Result::Status s)
+{
+    switch (s) {
+    case Result::Status::PASS:
+        return "pass";
+    case Result::Status::FAIL:
+        return "fail";
+    case Result::Status::TIMEOUT:
+        return "timeout";
+    case Result::Status::ERROR:
+        return "error";
+    }
+    return "error";
+}
+
+// Split a manifest line into whitespace-separated tokens, honouring quotes
+static bool tokenize(const std::string &line, std::vector<std::string> &out)
+{
+    std::string cur;
+    bool in_quote = false, have = false;
+    for (size_t i = 0; i < line.size(); i++) {
+        char c = line[i];
+        if (in_quote) {
+            if (c == '"')
+                in_quote = false;
+            else if (c == '\\' && i + 1 < line.size()) {
+                // Keep escapes for unescape(); only protect \" here
+                if (line[i + 1] == '"')
+                    cur += line[++i];
+                else
+                    cur += c;
+            } else
+                cur += c;
+        } else if (c == '"') {
+            in_quote = have = true;
+        } else if (c == ' ' || c == '\t') {
+            if (have)
+                out.push_back(cur);
+            cur.clear();
+            have = false;
+        } else {
+            cur += c;
+            have = true;
+        }
+    }
+    if (in_quote)
+        return false;
+    if (have)
+        out.push_back(cur);
+    return true;
+}
+
+static std::string unescape(const std::string &s)
+{
+    std::string r;
+    for (size_t i = 0; i < s.size(); i++) {
+        if (s[i] != '\\' || i + 1 >= s.size()) {
+            r += s[i];
+            continue;
+        }
+        char n = s[++i];
+        if (n == 'r')
+            r += '\r';
+        else if (n == 'n')
+            r += '\n';
+        else if (n == 't')
+            r += '\t';
+        else if (n == 'x' && i + 2 < s.size()) {
+            r += static_cast<char>(strtoul(s.substr(i + 1, 2).c_str(), 0, 16));
+            i += 2;
+        } else
+            r += n;
+    }
+    return r;
+}
+
+static bool load_manifest(const char *path, std::vector<Job> &jobs)
+{
+    std::ifstream f(path);
+    if (!f) {
+        std::cerr << "Cannot open manifest " << path << "\n";
+        return false;
+    }
+    std::string line;
+    int lineno = 0;
+    while (std::getline(f, line)) {
+        lineno++;
+        size_t start = line.find_first_not_of(" \t");
+        if (start == std::string::npos || line[start] == '#')
+            continue;
+        std::vector<std::string> tok;
+        if (!tokenize(line, tok) || tok.size() < 2) {
+            std::cerr << path << ":" << lineno << ": malformed job\n";
+            return false;
+        }
+        Job j;
+        j.name = tok[0];
+        j.binary = tok[1];
+        j.line = lineno;
+        for (size_t i = 2; i < tok.size(); i++) {
+            size_t eq = tok[i].find('=');
+            if (eq == std::string::npos) {
+                std::cerr << path << ":" << lineno << ": expected key=value, got '"
+                          << tok[i] << "'\n";
+                return false;
+            }
+            std::string key = tok[i].substr(0, eq);
+            std::string val = tok[i].substr(eq + 1);
+            if (key == "args") {
+                std::vector<std::string> a;
+                tokenize(val, a);
+                j.args = a;
+            } else if (key == "input")
+                j.input = unescape(val);
+            else if (key == "max_cycles")
+                j.max_cycles = strtoull(val.c_str(), nullptr, 0);
+            else if (key == "timeout")
+                j.timeout = atof(val.c_str());
+            else if (key == "expect")
+                j.expect = val;
+            else if (key == "output")
+                j.output = unescape(val);
+            else {
+                std::cerr << path << ":" << lineno << ": unknown key '" << key
+                          << "'\n";
+                return false;
+            }
+        }
+        if (j.expect != "pass" && j.expect != "fail" && j.expect != "done") {
+            std::cerr << path << ":" << lineno << ": expect must be "
+                      << "pass, fail or done\n";
+            return false;
+        }
+        jobs.push_back(j);
+    }
+    return true;
+}
+
+// Fork/exec the simulator, feed stdin, collect stdout+stderr and enforce the
+// host timeout. Returns false if the process could not be started.
+static bool spawn(const std::string &sim,
+                  const Job &job,
+                  Result &res,
+                  bool &timed_out)
+{
+    // Close-on-exec: workers fork concurrently, and a child inheriting
+    // another job's write end would hold off that job's EOF until it exits
+    int in_pipe[2], out_pipe[2];
+    if (pipe2(in_pipe, O_CLOEXEC)) {
+        res.message = std::string("pipe: ") + strerror(errno);
+        return false;
+    }
+    if (pipe2(out_pipe, O_CLOEXEC)) {
+        res.message = std::string("pipe: ") + strerror(errno);
+        close(in_pipe[0]);
+        close(in_pipe[1]);
+        return false;
+    }
+
+    std::vector<std::string> argv_s{sim, "-i", job.binary};
+    argv_s.insert(argv_s.end(), job.args.begin(), job.args.end());
+    if (job.max_cycles) {
+        argv_s.push_back("--max-cycles");
+        argv_s.push_back(std::to_string(job.max_cycles));
+    }
+    std::vector<char *> argv;
+    for (auto &a : argv_s)
+        argv.push_back(const_cast<char *>(a.c_str()));
+    argv.push_back(nullptr);
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        res.message = std::string("fork: ") + strerror(errno);
+        for (int fd : {in_pipe[0], in_pipe[1], out_pipe[0], out_pipe[1]})
+            close(fd);
+        return false;
+    }
+    if (pid == 0) {
+        // dup2 clears close-on-exec on the standard descriptors only
+        dup2(in_pipe[0], STDIN_FILENO);
+        dup2(out_pipe[1], STDOUT_FILENO);
+        dup2(out_pipe[1], STDERR_FILENO);
+        close(in_pipe[0]);
+        close(in_pipe[1]);
+        close(out_pipe[0]);
+        close(out_pipe[1]);
+        setpgid(0, 0);
+        execv(argv[0], argv.data());
+        fprintf(stderr, "exec %s: %s\n", argv[0], strerror(errno));
+        _exit(127);
+    }
+
+    close(in_pipe[0]);
+    close(out_pipe[1]);
+    // Input is small (keystrokes); write it all up front then signal EOF
+    signal(SIGPIPE, SIG_IGN);
+    size_t off = 0;
+    while (off < job.input.size()) {
+        ssize_t n = write(in_pipe[1], job.input.data() + off,
+                          job.input.size() - off);
+        if (n <= 0)
+            break;
+        off += n;
+    }
+    close(in_pipe[1]);
+
+    auto start = std::chrono::steady_clock::now();
+    auto deadline = start + std::chrono::duration_cast<
+                                std::chrono::steady_clock::duration>(
+                                std::chrono::duration<double>(job.timeout));
+    timed_out = false;
+    char buf[4096];
+    for (;;) {
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+            timed_out = true;
+            kill(-pid, SIGKILL);
+            break;
+        }
+        int ms = static_cast<int>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(deadline -
+                                                                  now)
+                .count());
+        struct pollfd pfd = {out_pipe[0], POLLIN, 0};
+        int r = poll(&pfd, 1, std::min(ms, 1000) + 1);
+        if (r < 0 && errno != EINTR)
+            break;
+        if (r > 0) {
+            ssize_t n = read(out_pipe[0], buf, sizeof(buf));
+            if (n <= 0)
+                break;  // EOF: child closed stdout (exited)
+            res.output.append(buf, n);
+        }
+    }
+    close(out_pipe[0]);
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    res.host_seconds = std::chrono::duration<double>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+    res.exit_code = WIFEXITED(status) ? WEXITSTATUS(status)
+                                      : 128 + WTERMSIG(status);
+    return true;
+}
+
+static Result run_job(const std::string &sim, const Job &job)
+{
+    Result res;
+    bool timed_out = false;
+    if (!spawn(sim, job, res, timed_out)) {
+        res.status = Result::Status::ERROR;
+        return res;
+    }
+
+    // "Done: <N> cycles" is the harness summary line
+    size_t done = res.output.rfind("\nDone: ");
+    if (done != std::string::npos)
+        res.cycles = strtoull(res.output.c_str() + done + 7, nullptr, 10);
+
+    bool passed = res.output.find("TEST PASSED") != std::string::npos;
+    bool failed = res.output.find("TEST FAILED") != std::string::npos;
+
+    if (timed_out) {
+        res.status = Result::Status::TIMEOUT;
+        char msg[64];
+        snprintf(msg, sizeof(msg), "host timeout after %gs", job.timeout);
+        res.message = msg;
+        return res;
+    }
+    if (res.exit_code == 127 || done == std::string::npos) {
+        res.status = Result::Status::ERROR;
+        res.message = "simulator did not finish (exit " +
+                      std::to_string(res.exit_code) + ")";
+        return res;
+    }
+
+    res.status = Result::Status::FAIL;
+    if (job.expect == "pass" && !passed)
+        res.message = failed ? "guest reported TEST FAILED"
+                             : "no 0xCAFEF00D completion before cycle limit";
+    else if (job.expect == "fail" && !failed)
+        res.message = "expected TEST FAILED";
+    else if (job.expect == "done" && res.exit_code != 0)
+        res.message = "simulator exit " + std::to_string(res.exit_code);
+    else if (!job.output.empty() &&
+             res.output.find(job.output) == std::string::npos)
+        res.message = "output does not contain expected text";
+    else
+        res.status = Result::Status::PASS;
+    return res;
+}
+
+static std::string json_escape(const std::string &s)
+{
+    std::string r;
+    for (unsigned char c : s) {
+        if (c == '"' || c == '\\') {
+            r += '\\';
+            r += c;
+        } else if (c < 0x20 || c >= 0x7f) {
+            char b[8];
+            snprintf(b, sizeof(b), "\\u%04x", c);
+            r += b;
+        } else
+            r += c;
+    }
+    return r;
+}
+
+static std::string xml_escape(const std::string &s)
+{
+    std::string r;
+    for (unsigned char c : s) {
+        if (c == '&')
+            r += "&amp;";
+        else if (c == '<')
+            r += "&lt;";
+        else if (c == '>')
+            r += "&gt;";
+        else if (c == '"')
+            r += "&quot;";
+        else if (c < 0x20 && c != '\n' && c != '\t')
+            r += '?';  // Not representable in XML 1.0
+        else if (c >= 0x7f)
+            r += '?';
+        else
+            r += c;
+    }
+    return r;
+}
+
+// Keep the tail of the log in reports; full logs can be megabytes
+static std::string tail(const std::string &s, size_t n = 4096)
+{
+    return s.size() <= n ? s : s.substr(s.size() - n);
+}
+
+static void write_json(const char *path,
+                       const std::vector<Job> &jobs,
+                       const std::vector<Result> &res,
+                       double wall)
+{
+    std::ofstream f(path);
+    f << "{\n  \"wall_seconds\": " << wall << ",\n  \"jobs\": [\n";
+    for (size_t i = 0; i < jobs.size(); i++) {
+        const Result &r = res[i];
+        f << "    {\"name\": \"" << json_escape(jobs[i].name)
+          << "\", \"binary\": \"" << json_escape(jobs[i].binary)
+          << "\", \"status\": \"" << status_name(r.status)
+          << "\", \"cycles\": " << r.cycles
+          << ", \"host_seconds\": " << r.host_seconds
+          << ", \"exit_code\": " << r.exit_code << ", \"message\": \""
+          << json_escape(r.message) << "\"}"
+          << (i + 1 < jobs.size() ? "," : "") << "\n";
+    }
+    f << "  ]\n}\n";
+}
+
+static void write_junit(const char *path,
+                        const std::vector<Job> &jobs,
+                        const std::vector<Result> &res,
+                        double wall)
+{
+    int failures = 0, errors = 0;
+    for (auto &r : res) {
+        if (r.status == Result::Status::FAIL)
+            failures++;
+        else if (r.status != Result::Status::PASS)
+            errors++;
+    }
+    std::ofstream f(path);
+    f << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+      << "<testsuites>\n"
+      << "  <testsuite name=\"mycpu-regress\" tests=\"" << jobs.size()
+      << "\" failures=\"" << failures << "\" errors=\"" << errors
+      << "\" time=\"" << wall << "\">\n";
+    for (size_t i = 0; i < jobs.size(); i++) {
+        const Result &r = res[i];
+        f << "    <testcase classname=\"4-soc\" name=\""
+          << xml_escape(jobs[i].name) << "\" time=\"" << r.host_seconds
+          << "\">\n"
+          << "      <properties><property name=\"cycles\" value=\""
+          << r.cycles << "\"/></properties>\n";
+        if (r.status == Result::Status::FAIL)
+            f << "      <failure message=\"" << xml_escape(r.message)
+              << "\"/>\n";
+        else if (r.status != Result::Status::PASS)
+            f << "      <error type=\"" << status_name(r.status)
+              << "\" message=\"" << xml_escape(r.message) << "\"/>\n";
+        if (r.status != Result::Status::PASS)
+            f << "      <system-out>" << xml_escape(tail(r.output))
+              << "</system-out>\n";
+        f << "    </testcase>\n";
+    }
+    f << "  </testsuite>\n</testsuites>\n";
+}
+
+int main(int argc, char **argv)
+{
+    const char *sim = "verilog/verilator/obj_dir/VTop";
+    const char *manifest = nullptr;
+    const char *json_path = nullptr;
+    const char *junit_path = nullptr;
+    unsigned workers = std::thread::hardware_concurrency();
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-m") && i + 1 < argc)
+            manifest = argv[++i];
+        else if (!strcmp(argv[i], "-s") && i + 1 < argc)
+            sim = argv[++i];
+        else if (!strcmp(argv[i], "-j") && i + 1 < argc)
+            workers = static_cast<unsigned>(atoi(argv[++i]));
+        else if (!strcmp(argv[i], "--json") && i + 1 < argc)
+            json_path = argv[++i];
+        else if (!strcmp(argv[i], "--junit") && i + 1 < argc)
+            junit_path = argv[++i];
+    }
+    if (!manifest) {
+        std::cerr << "Usage: " << argv[0]
+                  << " -m <manifest> [-s <VTop>] [-j <workers>]"
+                     " [--json <file>] [--junit <file>]\n";
+        return 1;
+    }
+    if (access(sim, X_OK)) {
+        std::cerr << "Simulator not found: " << sim << " (run make verilator)\n";
+        return 1;
+    }
+
+    std::vector<Job> jobs;
+    if (!load_manifest(manifest, jobs))
+        return 1;
+    if (workers == 0)
+        workers = 1;
+    workers = std::min<unsigned>(workers, jobs.size() ? jobs.size() : 1);
+
+    std::cout << "Running " << jobs.size() << " jobs on " << workers
+              << " workers\n";
+
+    std::vector<Result> results(jobs.size());
+    std::atomic<size_t> next{0};
+    std::mutex print_lock;
+    auto t0 = std::chrono::steady_clock::now();
+
+    auto worker = [&]() {
+        for (size_t i; (i = next.fetch_add(1)) < jobs.size();) {
+            results[i] = run_job(sim, jobs[i]);
+            std::lock_guard<std::mutex> g(print_lock);
+            const Result &r = results[i];
+            printf("  [%-7s] %-24s %12llu cycles %8.2fs%s%s\n",
+                   status_name(r.status), jobs[i].name.c_str(),
+                   (unsigned long long) r.cycles, r.host_seconds,
+                   r.message.empty() ? "" : "  ", r.message.c_str());
+            fflush(stdout);
+        }
+    };
+    std::vector<std::thread> pool;
+    for (unsigned w = 0; w < workers; w++)
+        pool.emplace_back(worker);
+    for (auto &t : pool)
+        t.join();
+
+    double wall =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - t0)
+            .count();
+    size_t passed = 0;
+    double serial = 0;
+    for (auto &r : results) {
+        passed += r.status == Result::Status::PASS;
+        serial += r.host_seconds;
+    }
+    printf("\n%zu/%zu passed in %.2fs wall (%.2fs serial)\n", passed,
+           jobs.size(), wall, serial);
+
+    if (json_path)
+        write_json(json_path, jobs, results, wall);
+    if (junit_path)
+        write_junit(junit_path, jobs, results, wall);
+
+    return passed == jobs.size() ? 0 : 1;
+}
@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: MIT
+// Host Call - harness-serviced semihosting channel on the main memory slave
+//
+// The guest fills a request block in ordinary RAM and stores the block's
+// address to HOSTCALL_DOORBELL. The harness sees that store on
+// io_mem_slave_write and services the whole request before the next bus
+// transaction. A printf therefore costs one store, where the UART costs
+// ~4340 cycles per character at 115200 baud.
+//
+// Request block (32-bit little-endian words, see csrc/mmio.h):
+//   +0x00 op       HOSTCALL_OP_*
+//   +0x04 arg[0]
+//   +0x08 arg[1]
+//   +0x0C arg[2]
+//   +0x10 arg[3]
+//   +0x14 ret      result, negative on error
+//   +0x18 ret_hi   upper 32 bits of 64-bit results
+//
+// Operations:
+//   WRITE      arg0=fd (1/2), arg1=buf, arg2=len       -> ret=len
+//   EXIT       arg0=exit code                          -> ends simulation
+//   CYCLES     -                                       -> ret:ret_hi=cycles
+//   READ_FILE  arg0=path, arg1=buf, arg2=len, arg3=off -> ret=bytes read
+//
+// READ_FILE resolves paths below the --hostfs directory and is disabled
+// (ret=-1) unless that option is given.
+//
+// Memory contract: service() reads the block, buffers and paths straight
+// from the harness's Memory, and writes ret back there. That is only
+// correct if every guest store before the doorbell store has reached main
+// memory, and nothing the CPU reads afterwards is stale. Anything that
+// holds guest data outside main memory must settle it when the doorbell
+// (any store to the mailbox page below 0x1000) goes by:
+//   - DCache writes back and invalidates every line before a mailbox store
+//   - StoreBuffer drains in program order, so the doorbell store lands
+//     last, and holds loads until a buffered mailbox store has gone out
+//   - The data TCM is invisible here; csrc/mmio.h copies TCM buffers
+//     through .bss, and hand-built blocks must not live in the TCM
+// New caching or buffering on the data path has to honour the same rule.
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "memory.h"
+
+static constexpr uint32_t HOSTCALL_DOORBELL = 0x200;
+
+class HostCall
+{
+public:
+    enum Op : uint32_t {
+        OP_WRITE = 1,
+        OP_EXIT = 2,
+        OP_CYCLES = 3,
+        OP_READ_FILE = 4,
+    };
+
+private:
+    static constexpr uint32_t OFF_OP = 0x00;
+    static constexpr uint32_t OFF_ARG = 0x04;
+    static constexpr uint32_t OFF_RET = 0x14;
+    static constexpr uint32_t OFF_RET_HI = 0x18;
+    static constexpr uint32_t MAX_PATH = 256;
+
+    std::string root;  // --hostfs directory; empty = file access disabled
+    bool quiet = false;  // WRITE succeeds without printing
+    bool exited = false;
+    int code = 0;
+    uint64_t calls = 0;
+
+    static std::string read_string(const Memory &mem, uint32_t addr)
+    {
+        std::string s;
+        for (uint32_t i = 0; i < MAX_PATH; i++) {
+            char c = static_cast<char>(mem.read_byte(addr + i));
+            if (!c)
+                break;
+            s += c;
+        }
+        return s;
+    }
+
+    // Reject absolute paths and any ".." component
+    static bool safe_path(const std::string &p)
+    {
+        if (p.empty() || p[0] == '/')
+            return false;
+        size_t pos = 0;
+        while (pos <= p.size()) {
+            size_t slash = p.find('/', pos);
+            if (slash == std::string::npos)
+                slash = p.size();
+            if (p.compare(pos, slash - pos, "..") == 0 && slash - pos == 2)
+                return false;
+            pos = slash + 1;
+        }
+        return true;
+    }
+
+    int32_t do_write(const Memory &mem, uint32_t fd, uint32_t buf, uint32_t len)
+    {
+        FILE *out = fd == 2 ? stderr : (fd == 1 ? stdout : nullptr);
+        if (!out)
+            return -1;
+        if (quiet)
+            return static_cast<int32_t>(len);
+        for (uint32_t i = 0; i < len; i++)
+            fputc(mem.read_byte(buf + i), out);
+        fflush(out);
+        return static_cast<int32_t>(len);
+    }
+
+    int32_t do_read_file(Memory &mem,
+                         uint32_t path_addr,
+                         uint32_t buf,
+                         uint32_t len,
+                         uint32_t offset)
+    {
+        if (root.empty())
+            return -1;
+        std::string path = read_string(mem, path_addr);
+        if (!safe_path(path))
+            return -1;
+        FILE *f = fopen((root + "/" + path).c_str(), "rb");
+        if (!f)
+            return -1;
+        int32_t n = -1;
+        if (fseek(f, offset, SEEK_SET) == 0) {
+            n = 0;
+            int c;
+            while (static_cast<uint32_t>(n) < len && (c = fgetc(f)) != EOF)
+                mem.write_byte(buf + n++, static_cast<uint8_t>(c));
+        }
+        fclose(f);
+        return n;
+    }
+
+public:
+    void set_root(const char *dir) { root = dir ? dir : ""; }
+    void set_quiet(bool q) { quiet = q; }
+
+    // Forget a previous run's exit request and call count
+    void restart()
+    {
+        exited = false;
+        code = 0;
+        calls = 0;
+    }
+
+    bool exit_requested() const { return exited; }
+    int exit_code() const { return code; }
+    uint64_t call_count() const { return calls; }
+
+    // Service the request block at `block` (the value stored to the doorbell)
+    void service(Memory &mem, uint32_t block, uint64_t cycles)
+    {
+        calls++;
+        uint32_t op = mem.read(block + OFF_OP);
+        uint32_t arg[4];
+        for (int i = 0; i < 4; i++)
+            arg[i] = mem.read(block + OFF_ARG + 4 * i);
+
+        int32_t ret = -1;
+        uint32_t ret_hi = 0;
+        switch (op) {
+        case OP_WRITE:
+            ret = do_write(mem, arg[0], arg[1], arg[2]);
+            break;
+        case OP_EXIT:
+            exited = true;
+            code = static_cast<int32_t>(arg[0]);
+            ret = 0;
+            break;
+        case OP_CYCLES:
+            ret = static_cast<int32_t>(cycles & 0xFFFFFFFF);
+            ret_hi = static_cast<uint32_t>(cycles >> 32);
+            break;
+        case OP_READ_FILE:
+            ret = do_read_file(mem, arg[0], arg[1], arg[2], arg[3]);
+            break;
+        default:
+            fprintf(stderr, "hostcall: unknown op %u at block 0x%08x\n", op,
+                    block);
+            break;
+        }
+        mem.write(block + OFF_RET, static_cast<uint32_t>(ret), 0xF);
+        mem.write(block + OFF_RET_HI, ret_hi, 0xF);
+    }
+};
@@ -0,0 +1,292 @@
+// SPDX-License-Identifier: MIT
+// Input Script - cycle-stamped UART input injection and recording
+//
+// Replaces a human at the terminal so interactive programs (shell, tetris,
+// trex) can be replayed bit-exactly. Events fire in file order; each waits
+// for its trigger after the previous one fired, then queues its bytes into
+// UartTerminal's RX FIFO at the same point the stdin poll would.
+//
+// Script syntax, one event per line ('#' starts a comment):
+//   cycle <N>       <payload>   at absolute CPU cycle N
+//   after <N>       <payload>   N CPU cycles after the previous event
+//   frame <N>       <payload>   at the Nth VGA vsync
+//   marker "<text>" <payload>   once the CPU has printed <text> on UART TX
+//
+// Payload is a quoted string ("a", "\r", "\x1b[A"), hex bytes (0x20 0x0d)
+// or the word `end`, which stops the simulation. --record-input writes
+// live keystrokes in this format as `cycle` events.
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+class InputScript
+{
+    enum class Trigger { CYCLE, AFTER, FRAME, MARKER };
+
+    struct Event {
+        Trigger trigger;
+        uint64_t value = 0;
+        std::string marker;
+        std::string bytes;
+        bool end = false;
+        int line = 0;
+    };
+
+    std::vector<Event> events;
+    size_t next = 0;
+    uint64_t last_fire = 0;  // CPU cycle the previous event fired
+    std::string tx_window;   // UART output since the previous event
+
+    static bool parse_quoted(const std::string &s, size_t &pos,
+                             std::string &out)
+    {
+        if (pos >= s.size() || s[pos] != '"')
+            return false;
+        for (pos++; pos < s.size() && s[pos] != '"'; pos++) {
+            char c = s[pos];
+            if (c != '\\' || pos + 1 >= s.size()) {
+                out += c;
+                continue;
+            }
+            char n = s[++pos];
+            if (n == 'r')
+                out += '\r';
+            else if (n == 'n')
+                out += '\n';
+            else if (n == 't')
+                out += '\t';
+            else if (n == 'e')
+                out += '\x1b';
+            else if (n == 'x' && pos + 2 < s.size()) {
+                out += static_cast<char>(
+                    strtoul(s.substr(pos + 1, 2).c_str(), nullptr, 16));
+                pos += 2;
+            } else
+                out += n;
+        }
+        if (pos >= s.size())
+            return false;
+        pos++;  // Closing quote
+        return true;
+    }
+
+    static void skip_ws(const std::string &s, size_t &pos)
+    {
+        while (pos < s.size() && (s[pos] == ' ' || s[pos] == '\t'))
+            pos++;
+    }
+
+    static std::string word(const std::string &s, size_t &pos)
+    {
+        size_t start = pos;
+        while (pos < s.size() && s[pos] != ' ' && s[pos] != '\t')
+            pos++;
+        return s.substr(start, pos - start);
+    }
+
+    bool parse_line(const std::string &line, int lineno, Event &ev)
+    {
+        size_t pos = 0;
+        skip_ws(line, pos);
+        std::string kind = word(line, pos);
+        skip_ws(line, pos);
+        if (kind == "cycle")
+            ev.trigger = Trigger::CYCLE;
+        else if (kind == "after")
+            ev.trigger = Trigger::AFTER;
+        else if (kind == "frame")
+            ev.trigger = Trigger::FRAME;
+        else if (kind == "marker")
+            ev.trigger = Trigger::MARKER;
+        else {
+            fprintf(stderr, "input-script:%d: unknown trigger '%s'\n", lineno,
+                    kind.c_str());
+            return false;
+        }
+        if (ev.trigger == Trigger::MARKER) {
+            if (!parse_quoted(line, pos, ev.marker) || ev.marker.empty()) {
+                fprintf(stderr, "input-script:%d: marker needs \"text\"\n",
+                        lineno);
+                return false;
+            }
+        } else {
+            std::string n = word(line, pos);
+            char *end = nullptr;
+            ev.value = strtoull(n.c_str(), &end, 0);
+            if (n.empty() || *end) {
+                fprintf(stderr, "input-script:%d: bad count '%s'\n", lineno,
+                        n.c_str());
+                return false;
+            }
+        }
+
+        // Payload: quoted strings, hex bytes, or `end`
+        for (skip_ws(line, pos); pos < line.size() && line[pos] != '#';
+             skip_ws(line, pos)) {
+            if (line[pos] == '"') {
+                if (!parse_quoted(line, pos, ev.bytes)) {
+                    fprintf(stderr, "input-script:%d: unterminated string\n",
+                            lineno);
+                    return false;
+                }
+                continue;
+            }
+            std::string w = word(line, pos);
+            char *end = nullptr;
+            unsigned long b = strtoul(w.c_str(), &end, 0);
+            if (w == "end")
+                ev.end = true;
+            else if (!w.empty() && !*end && b <= 0xFF)
+                ev.bytes += static_cast<char>(b);
+            else {
+                fprintf(stderr, "input-script:%d: bad payload '%s'\n", lineno,
+                        w.c_str());
+                return false;
+            }
+        }
+        if (ev.bytes.empty() && !ev.end) {
+            fprintf(stderr, "input-script:%d: empty payload\n", lineno);
+            return false;
+        }
+        ev.line = lineno;
+        return true;
+    }
+
+public:
+    bool load(const char *path)
+    {
+        std::ifstream f(path);
+        if (!f) {
+            fprintf(stderr, "input-script: cannot open %s\n", path);
+            return false;
+        }
+        std::string line;
+        int lineno = 0;
+        while (std::getline(f, line)) {
+            lineno++;
+            size_t start = line.find_first_not_of(" \t\r");
+            if (start == std::string::npos || line[start] == '#')
+                continue;
+            if (line.back() == '\r')
+                line.pop_back();
+            Event ev;
+            if (!parse_line(line, lineno, ev))
+                return false;
+            events.push_back(ev);
+        }
+        return true;
+    }
+
+    // Replay from the first event (a new run of the same instance)
+    void rewind()
+    {
+        next = 0;
+        last_fire = 0;
+        tx_window.clear();
+    }
+
+    bool active() const { return next < events.size(); }
+    size_t size() const { return events.size(); }
+
+    // Feed each character the CPU transmits (for marker triggers)
+    void on_tx(char c)
+    {
+        if (!active() || events[next].trigger != Trigger::MARKER)
+            return;
+        tx_window += c;
+        // Only the marker-sized tail can still complete a match
+        size_t keep = events[next].marker.size() * 2;
+        if (tx_window.size() > keep + 256)
+            tx_window.erase(0, tx_window.size() - keep);
+    }
+
+    // Called once per CPU cycle. Appends due bytes to `out`; returns false
+    // when an `end` event fired.
+    bool poll(uint64_t cpu_cycle, uint64_t frame, std::string &out)
+    {
+        while (active()) {
+            const Event &ev = events[next];
+            bool due = false;
+            switch (ev.trigger) {
+            case Trigger::CYCLE:
+                due = cpu_cycle >= ev.value;
+                break;
+            case Trigger::AFTER:
+                due = cpu_cycle >= last_fire + ev.value;
+                break;
+            case Trigger::FRAME:
+                due = frame >= ev.value;
+                break;
+            case Trigger::MARKER:
+                due = tx_window.find(ev.marker) != std::string::npos;
+                break;
+            }
+            if (!due)
+                return true;
+            out += ev.bytes;
+            last_fire = cpu_cycle;
+            tx_window.clear();
+            next++;
+            if (ev.end)
+                return false;
+        }
+        return true;
+    }
+};
+
+// Writes live keystrokes as `cycle` events replayable by InputScript
+class InputRecorder
+{
+    FILE *out = nullptr;
+
+public:
+    ~InputRecorder()
+    {
+        if (out)
+            fclose(out);
+    }
+
+    bool open(const char *path)
+    {
+        out = fopen(path, "w");
+        if (!out) {
+            fprintf(stderr, "record-input: cannot create %s\n", path);
+            return false;
+        }
+        fprintf(out, "# Recorded UART input (replay with --input-script)\n");
+        return true;
+    }
+
+    void record(uint64_t cpu_cycle, uint64_t frame, const std::string &bytes)
+    {
+        if (!out || bytes.empty())
+            return;
+        fprintf(out, "cycle %llu \"", (unsigned long long) cpu_cycle);
+        for (unsigned char c : bytes) {
+            if (c == '"' || c == '\\')
+                fprintf(out, "\\%c", c);
+            else if (c >= 0x20 && c < 0x7F)
+                fputc(c, out);
+            else
+                fprintf(out, "\\x%02x", c);
+        }
+        fprintf(out, "\"  # frame %llu\n", (unsigned long long) frame);
+        fflush(out);
+    }
+
+    // Terminate the replay where the live session stopped
+    void finish(uint64_t cpu_cycle)
+    {
+        if (!out)
+            return;
+        fprintf(out, "cycle %llu end\n", (unsigned long long) cpu_cycle);
+        fclose(out);
+        out = nullptr;
+    }
+};
@@ -0,0 +1,675 @@
+// SPDX-License-Identifier: MIT
+// ISS - functional RV32IM + Zicsr interpreter over the harness Memory
+//
+// Executes one instruction per step with no pipeline or bus timing, for
+// fast-forwarding between detailed RTL windows (see sampler.h). It shares
+// the Simulator's Memory, services the 0x100 test handshake and the host
+// call doorbell exactly like the harness, and models the MMIO peripherals
+// as plain registers:
+//   VGA   0x20000000  registers stored; STATUS.vblank follows instret as if
+//                     one instruction took one CPU cycle; sprite pattern
+//                     and framebuffer RAM writes (+0x100 and up) dropped
+//   UART  0x40000000  TX printed immediately (always ready), RX never valid
+//   TIMER 0x80000000  LIMIT/ENABLED stored
+//   DMA   0xA0000000  the whole copy runs when START is written, so STATUS
+//                     never reads busy
+// The data TCM window at 0x60000000 (DataTCM.scala) is plain RAM of the
+// largest elaborable size; it starts zeroed and, like the RTL TCM, is not
+// part of the shared Memory, so state transfer does not carry it.
+//
+// Traps follow CLINT.scala rather than the privileged spec where the two
+// differ: ecall/ebreak set mepc to the address IF had fetched next (the
+// following instruction), so handlers return with a plain mret. No
+// interrupts are modelled; the harness never raises one either, and the
+// DMA completion interrupt is left to the RTL.
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "hostcall.h"
+#include "memory.h"
+
+class Iss
+{
+public:
+    enum Stop : uint32_t {
+        RUNNING = 0,
+        TEST_DONE,  // 0xCAFEF00D written to 0x100
+        HOST_EXIT,  // HOSTCALL_OP_EXIT
+        ILLEGAL,    // Undecodable instruction at pc()
+    };
+
+    // Peripheral registers (word index = offset >> 2)
+    static constexpr uint32_t VGA_BASE = 0x20000000;
+    static constexpr uint32_t UART_BASE = 0x40000000;
+    static constexpr uint32_t TIMER_BASE = 0x80000000;
+    static constexpr uint32_t DMA_BASE = 0xA0000000;
+    static constexpr uint32_t TCM_BASE = 0x60000000;
+    static constexpr uint32_t TCM_MAX_SIZE = 1u << 20;  // SoCConfig limit
+    static constexpr uint32_t VGA_REGS = 64;
+    static constexpr uint32_t DMA_REGS = 8;
+
+    // Architectural state, public for state transfer to and from the RTL
+    uint32_t x[32] = {0};
+    uint32_t pc_reg = 0x1000;
+    uint32_t mstatus = 0, mie = 0, mtvec = 0, mscratch = 0, mepc = 0,
+             mcause = 0, mcountinhibit = 0;
+    uint64_t mcycle = 0, minstret = 0;
+    uint64_t mhpm[16] = {0};  // mhpmcounter3-15 hold their written values
+    uint32_t vga[VGA_REGS] = {0};
+    uint32_t timer_limit = 100000000, timer_enabled = 1;
+    uint32_t uart_interrupt = 0;
+    // SRC, DST, LEN, SRC_STRIDE, DST_STRIDE, CTRL, STATUS (see DMA.scala)
+    uint32_t dma[DMA_REGS] = {0, 0, 0, 4, 4, 0, 0, 0};
+
+    // What the last executed instruction did (co-simulation, see cosim.h)
+    struct Retired {
+        uint32_t pc = 0, inst = 0;
+        uint32_t rd = 0;  // 0 when no register was written
+        uint32_t rd_data = 0;
+        bool unpredictable = false;  // rd_data from MMIO or a counter CSR
+        bool store = false;
+        uint32_t store_addr = 0;  // Word aligned
+        uint32_t store_data = 0;  // Shifted into its byte lanes
+        uint8_t store_strobe = 0;
+    };
+
+private:
+    Memory &mem;
+    HostCall host;
+    Stop stopped = RUNNING;
+    uint32_t result = 0;
+    uint64_t executed = 0;  // Instructions stepped, independent of CSRs
+    bool capture_uart = false;
+    bool quiet = false;
+    std::string uart_out;
+    std::vector<uint32_t> tcm;  // Allocated on first access
+    Retired last;
+
+    // 832x520 pixel clocks at a quarter of the CPU clock (see VGA.scala)
+    static constexpr uint64_t FRAME_CYCLES = 832ull * 520 * 4;
+    static constexpr uint64_t VISIBLE_CYCLES = 832ull * 480 * 4;
+
+    static int32_t sext(uint32_t v, int bits)
+    {
+        return static_cast<int32_t>(v << (32 - bits)) >> (32 - bits);
+    }
+
+    static bool in_tcm(uint32_t addr)
+    {
+        return addr - TCM_BASE < TCM_MAX_SIZE;
+    }
+
+    uint32_t &tcm_word(uint32_t addr)
+    {
+        if (tcm.empty())
+            tcm.assign(TCM_MAX_SIZE / 4, 0);
+        return tcm[(addr - TCM_BASE) >> 2];
+    }
+
+    uint32_t mmio_read(uint32_t addr)
+    {
+        uint32_t off = addr & 0xFF;
+        switch (addr >> 29) {
+        case 1:  // VGA
+            if ((addr & 0xFFFF) >= 4 * VGA_REGS)
+                return 0;
+            if (off == 0x00)
+                return 0x56474131;  // 'VGA1'
+            if (off == 0x04)
+                return (executed % FRAME_CYCLES >= VISIBLE_CYCLES) ? 0x3 : 0x2;
+            return vga[off >> 2];
+        case 2:  // UART
+            if (off == 0x00)
+                return 0x1;  // TX ready, RX empty
+            if (off == 0x04)
+                return 115200;
+            return 0;
+        case 4:  // Timer
+            if (off == 0x04)
+                return timer_limit;
+            if (off == 0x08)
+                return timer_enabled;
+            return 0;
+        case 5:  // DMA
+            return off < 4 * DMA_REGS ? dma[off >> 2] : 0;
+        default:
+            return 0;
+        }
+    }
+
+    // Copy word by word like the RTL engine: reads go through the same
+    // paths as CPU loads, writes through CPU stores minus the side effects
+    // of the test handshake and doorbell, which a DMA never triggers
+    void dma_run()
+    {
+        for (; dma[2] != 0; dma[2]--) {
+            uint32_t src = dma[0], dst = dma[1];
+            uint32_t word = (src >> 29) ? mmio_read(src) : mem.read(src);
+            if (dst >> 29)
+                mmio_write(dst, word);
+            else
+                mem.write(dst, word, 0xF);
+            dma[0] += dma[3];
+            dma[1] += dma[4];
+        }
+        dma[6] = 0x2;  // Done
+    }
+
+    void mmio_write(uint32_t addr, uint32_t val)
+    {
+        uint32_t off = addr & 0xFF;
+        switch (addr >> 29) {
+        case 1:
+            if ((addr & 0xFFFF) < 4 * VGA_REGS)
+                vga[off >> 2] = val;
+            break;
+        case 2:
+            if (off == 0x08)
+                uart_interrupt = val;
+            else if (off == 0x10) {
+                if (quiet)
+                    break;
+                if (capture_uart)
+                    uart_out += static_cast<char>(val);
+                else {
+                    putchar(static_cast<char>(val));
+                    if (val == '\n')
+                        fflush(stdout);
+                }
+            }
+            break;
+        case 4:
+            if (off == 0x04)
+                timer_limit = val;
+            else if (off == 0x08)
+                timer_enabled = val;
+            break;
+        case 5:
+            if (off == 0x14) {
+                dma[5] = val & 0x2;
+                if (val & 0x1)
+                    dma_run();
+            } else if (off == 0x18)
+                dma[6] &= ~(val & 0x2);
+            else if (off < 0x14)
+                dma[off >> 2] = (off == 0x08) ? val : (val & ~3u);
+            break;
+        default:
+            break;
+        }
+    }
+
+    uint32_t load(uint32_t addr, uint32_t funct3)
+    {
+        uint32_t word = in_tcm(addr)   ? tcm_word(addr)
+                        : (addr >> 29) ? mmio_read(addr & ~3u)
+                                       : mem.read(addr & ~3u);
+        uint32_t shifted = word >> ((addr & 3) * 8);
+        switch (funct3) {
+        case 0:  // lb
+            return sext(shifted & 0xFF, 8);
+        case 1:  // lh
+            return sext(shifted & 0xFFFF, 16);
+        case 4:  // lbu
+            return shifted & 0xFF;
+        case 5:  // lhu
+            return shifted & 0xFFFF;
+        default:  // lw
+            return word;
+        }
+    }
+
+    // Returns false when the store ended the run
+    bool store(uint32_t addr, uint32_t val, uint32_t funct3)
+    {
+        uint32_t shift = (addr & 3) * 8;
+        uint8_t strobe = funct3 == 0 ? 1 : (funct3 == 1 ? 3 : 0xF);
+        strobe = static_cast<uint8_t>(strobe << (addr & 3));
+        val <<= shift;
+        addr &= ~3u;
+        last.store = true;
+        last.store_addr = addr;
+        last.store_data = val;
+        last.store_strobe = strobe;
+
+        if (in_tcm(addr)) {
+            uint32_t mask = 0;
+            for (int i = 0; i < 4; i++)
+                if (strobe & (1u << i))
+                    mask |= 0xFFu << (i * 8);
+            uint32_t &word = tcm_word(addr);
+            word = (word & ~mask) | (val & mask);
+            return true;
+        }
+        if (addr >> 29) {
+            mmio_write(addr, val >> shift);
+            return true;
+        }
+        mem.write(addr, val, strobe);
+        if (addr == 0x100 && val == 0xCAFEF00D) {
+            result = mem.read(0x104);
+            stopped = TEST_DONE;
+            return false;
+        }
+        if (addr == HOSTCALL_DOORBELL) {
+            host.service(mem, val, mcycle);
+            if (host.exit_requested()) {
+                stopped = HOST_EXIT;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    uint32_t csr_read(uint32_t csr) const
+    {
+        switch (csr) {
+        case 0x300:
+            return mstatus;
+        case 0x301:
+            return 0x40001100;  // RV32IM
+        case 0x304:
+            return mie;
+        case 0x305:
+            return mtvec;
+        case 0x320:
+            return mcountinhibit;
+        case 0x340:
+            return mscratch;
+        case 0x341:
+            return mepc;
+        case 0x342:
+            return mcause;
+        case 0xB00:
+        case 0xC00:
+            return static_cast<uint32_t>(mcycle);
+        case 0xB80:
+        case 0xC80:
+            return static_cast<uint32_t>(mcycle >> 32);
+        case 0xB02:
+        case 0xC02:
+            return static_cast<uint32_t>(minstret);
+        case 0xB82:
+        case 0xC82:
+            return static_cast<uint32_t>(minstret >> 32);
+        default:
+            if (csr >= 0xB03 && csr <= 0xB0F)
+                return static_cast<uint32_t>(mhpm[csr - 0xB00]);
+            if (csr >= 0xB83 && csr <= 0xB8F)
+                return static_cast<uint32_t>(mhpm[csr - 0xB80] >> 32);
+            return 0;  // Unimplemented CSRs read as zero, like regLUT
+        }
+    }
+
+    static void set_lo(uint64_t &r, uint32_t v)
+    {
+        r = (r & ~0xFFFFFFFFull) | v;
+    }
+    static void set_hi(uint64_t &r, uint32_t v)
+    {
+        r = (r & 0xFFFFFFFFull) | (static_cast<uint64_t>(v) << 32);
+    }
+
+    void csr_write(uint32_t csr, uint32_t v)
+    {
+        switch (csr) {
+        case 0x300:
+            mstatus = v;
+            break;
+        case 0x304:
+            mie = v;
+            break;
+        case 0x305:
+            mtvec = v;
+            break;
+        case 0x320:
+            mcountinhibit = v & 0x3FD;
+            break;
+        case 0x340:
+            mscratch = v;
+            break;
+        case 0x341:
+            mepc = v;
+            break;
+        case 0x342:
+            mcause = v;
+            break;
+        case 0xB00:
+            set_lo(mcycle, v);
+            break;
+        case 0xB80:
+            set_hi(mcycle, v);
+            break;
+        case 0xB02:
+            set_lo(minstret, v);
+            break;
+        case 0xB82:
+            set_hi(minstret, v);
+            break;
+        default:
+            if (csr >= 0xB03 && csr <= 0xB0F)
+                set_lo(mhpm[csr - 0xB00], v);
+            else if (csr >= 0xB83 && csr <= 0xB8F)
+                set_hi(mhpm[csr - 0xB80], v);
+            break;  // Other writes are dropped
+        }
+    }
+
+    void trap(uint32_t cause, uint32_t next_pc)
+    {
+        mepc = next_pc;
+        mcause = cause;
+        // MIE -> MPIE, then clear MIE
+        mstatus = (mstatus & ~0x88u) | ((mstatus & 0x8) << 4);
+        pc_reg = mtvec;
+    }
+
+    static uint32_t mul_div(uint32_t funct3, uint32_t a, uint32_t b)
+    {
+        int32_t sa = static_cast<int32_t>(a), sb = static_cast<int32_t>(b);
+        switch (funct3) {
+        case 0:  // mul
+            return a * b;
+        case 1:  // mulh
+            return static_cast<uint32_t>(
+                (static_cast<int64_t>(sa) * static_cast<int64_t>(sb)) >> 32);
+        case 2:  // mulhsu
+            return static_cast<uint32_t>(
+                (static_cast<int64_t>(sa) * static_cast<int64_t>(b)) >> 32);
+        case 3:  // mulhu
+            return static_cast<uint32_t>(
+                (static_cast<uint64_t>(a) * static_cast<uint64_t>(b)) >> 32);
+        case 4:  // div
+            if (b == 0)
+                return 0xFFFFFFFF;
+            if (sa == INT32_MIN && sb == -1)
+                return a;
+            return static_cast<uint32_t>(sa / sb);
+        case 5:  // divu
+            return b ? a / b : 0xFFFFFFFF;
+        case 6:  // rem
+            if (b == 0)
+                return a;
+            if (sa == INT32_MIN && sb == -1)
+                return 0;
+            return static_cast<uint32_t>(sa % sb);
+        default:  // remu
+            return b ? a % b : a;
+        }
+    }
+
+    // Execute the instruction at pc_reg; false when the run stopped
+    bool execute()
+    {
+        const uint32_t pc = pc_reg;
+        const uint32_t inst = mem.read(pc);
+        const uint32_t rd = (inst >> 7) & 0x1F;
+        const uint32_t rs1 = (inst >> 15) & 0x1F;
+        const uint32_t rs2 = (inst >> 20) & 0x1F;
+        const uint32_t funct3 = (inst >> 12) & 0x7;
+        const uint32_t funct7 = inst >> 25;
+        const uint32_t a = x[rs1], b = x[rs2];
+        const uint32_t imm_i = sext(inst >> 20, 12);
+        uint32_t next = pc + 4;
+        uint32_t val = 0;
+        bool write_rd = true;
+        last = Retired();
+        last.pc = pc;
+        last.inst = inst;
+
+        switch (inst & 0x7F) {
+        case 0x37:  // lui
+            val = inst & 0xFFFFF000;
+            break;
+        case 0x17:  // auipc
+            val = pc + (inst & 0xFFFFF000);
+            break;
+        case 0x6F: {  // jal
+            uint32_t imm = ((inst >> 31) << 20) |
+                           (((inst >> 12) & 0xFF) << 12) |
+                           (((inst >> 20) & 1) << 11) |
+                           (((inst >> 21) & 0x3FF) << 1);
+            val = next;
+            next = pc + sext(imm, 21);
+            break;
+        }
+        case 0x67:  // jalr
+            val = next;
+            next = (a + imm_i) & ~1u;
+            break;
+        case 0x63: {  // branches
+            uint32_t imm = ((inst >> 31) << 12) | (((inst >> 7) & 1) << 11) |
+                           (((inst >> 25) & 0x3F) << 5) |
+                           (((inst >> 8) & 0xF) << 1);
+            bool taken;
+            switch (funct3) {
+            case 0:
+                taken = a == b;
+                break;
+            case 1:
+                taken = a != b;
+                break;
+            case 4:
+                taken = static_cast<int32_t>(a) < static_cast<int32_t>(b);
+                break;
+            case 5:
+                taken = static_cast<int32_t>(a) >= static_cast<int32_t>(b);
+                break;
+            case 6:
+                taken = a < b;
+                break;
+            case 7:
+                taken = a >= b;
+                break;
+            default:
+                stopped = ILLEGAL;
+                return false;
+            }
+            if (taken)
+                next = pc + sext(imm, 13);
+            write_rd = false;
+            break;
+        }
+        case 0x03:  // loads
+            val = load(a + imm_i, funct3);
+            last.unpredictable =
+                ((a + imm_i) >> 29) != 0 && !in_tcm(a + imm_i);
+            break;
+        case 0x23: {  // stores
+            uint32_t imm = ((inst >> 25) << 5) | ((inst >> 7) & 0x1F);
+            write_rd = false;
+            pc_reg = next;
+            executed++;
+            if (!(mcountinhibit & 4))
+                minstret++;
+            if (!(mcountinhibit & 1))
+                mcycle++;
+            return store(a + sext(imm, 12), b, funct3);
+        }
+        case 0x13:  // op-imm
+            switch (funct3) {
+            case 0:
+                val = a + imm_i;
+                break;
+            case 1:
+                val = a << (rs2);
+                break;
+            case 2:
+                val = static_cast<int32_t>(a) < static_cast<int32_t>(imm_i);
+                break;
+            case 3:
+                val = a < imm_i;
+                break;
+            case 4:
+                val = a ^ imm_i;
+                break;
+            case 5:
+                val = (funct7 & 0x20) ? static_cast<uint32_t>(
+                                            static_cast<int32_t>(a) >> rs2)
+                                      : a >> rs2;
+                break;
+            case 6:
+                val = a | imm_i;
+                break;
+            default:
+                val = a & imm_i;
+                break;
+            }
+            break;
+        case 0x33:  // op
+            if (funct7 == 0x01) {
+                val = mul_div(funct3, a, b);
+                break;
+            }
+            switch (funct3) {
+            case 0:
+                val = (funct7 & 0x20) ? a - b : a + b;
+                break;
+            case 1:
+                val = a << (b & 0x1F);
+                break;
+            case 2:
+                val = static_cast<int32_t>(a) < static_cast<int32_t>(b);
+                break;
+            case 3:
+                val = a < b;
+                break;
+            case 4:
+                val = a ^ b;
+                break;
+            case 5: {
+                uint32_t sh = b & 0x1F;
+                val = (funct7 & 0x20) ? static_cast<uint32_t>(
+                                            static_cast<int32_t>(a) >> sh)
+                                      : a >> sh;
+                break;
+            }
+            case 6:
+                val = a | b;
+                break;
+            default:
+                val = a & b;
+                break;
+            }
+            break;
+        case 0x0F:  // fence, fence.i
+            write_rd = false;
+            break;
+        case 0x73:  // system
+            if (funct3 == 0) {
+                write_rd = false;
+                if (inst == 0x00000073) {  // ecall
+                    trap(11, next);
+                    next = pc_reg;
+                } else if (inst == 0x00100073) {  // ebreak
+                    trap(3, next);
+                    next = pc_reg;
+                } else if (inst == 0x30200073) {  // mret
+                    // MPIE -> MIE, then set MPIE
+                    mstatus = (mstatus & ~0x8u) | ((mstatus >> 4) & 0x8) | 0x80;
+                    next = mepc;
+                }
+                // wfi and other privileged encodings: no-op
+                break;
+            } else {
+                uint32_t csr = inst >> 20;
+                uint32_t src = (funct3 & 4) ? rs1 : a;  // zimm or rs1
+                val = csr_read(csr);
+                // mcycle, minstret and the mhpmcounters (and user shadows)
+                last.unpredictable = (csr >= 0xB00 && csr < 0xBA0) ||
+                                     (csr >= 0xC00 && csr < 0xCA0);
+                switch (funct3 & 3) {
+                case 1:
+                    csr_write(csr, src);
+                    break;
+                case 2:
+                    if (rs1)
+                        csr_write(csr, val | src);
+                    break;
+                case 3:
+                    if (rs1)
+                        csr_write(csr, val & ~src);
+                    break;
+                default:
+                    stopped = ILLEGAL;
+                    return false;
+                }
+            }
+            break;
+        default:
+            stopped = ILLEGAL;
+            return false;
+        }
+
+        if (write_rd && rd) {
+            x[rd] = val;
+            last.rd = rd;
+            last.rd_data = val;
+        }
+        pc_reg = next;
+        executed++;
+        if (!(mcountinhibit & 4))
+            minstret++;
+        if (!(mcountinhibit & 1))
+            mcycle++;
+        return true;
+    }
+
+public:
+    explicit Iss(Memory &m) : mem(m) {}
+
+    void set_hostfs(const char *dir) { host.set_root(dir); }
+
+    // Collect UART output in a buffer (take_uart_output()) instead of stdout
+    void set_uart_capture(bool en) { capture_uart = en; }
+
+    // Drop UART and host call WRITE output; for a shadow of another model
+    void set_quiet(bool en)
+    {
+        quiet = en;
+        host.set_quiet(en);
+    }
+
+    // Execute up to `n` instructions; returns the number executed. Stops
+    // early when the run ends (stop() != RUNNING).
+    uint64_t step(uint64_t n)
+    {
+        const uint64_t start = executed;
+        while (!stopped && executed - start < n && execute()) {
+        }
+        return executed - start;
+    }
+
+    Stop stop() const { return stopped; }
+    uint32_t pc() const { return pc_reg; }
+    uint64_t instructions() const { return executed; }
+    const Retired &last_retired() const { return last; }
+    // The program has loaded or stored in the data TCM window
+    bool tcm_used() const { return !tcm.empty(); }
+
+    // Outcome of the 0x100 handshake or HOSTCALL_OP_EXIT
+    uint32_t test_result() const { return result; }
+    int host_exit_code() const { return host.exit_code(); }
+
+    // Account for instructions and cycles spent in another model
+    void advance(uint64_t instructions, uint64_t cycles)
+    {
+        executed += instructions;
+        if (!(mcountinhibit & 4))
+            minstret += instructions;
+        if (!(mcountinhibit & 1))
+            mcycle += cycles;
+    }
+
+    std::string take_uart_output()
+    {
+        std::string s;
+        s.swap(uart_out);
+        return s;
+    }
+};
@@ -0,0 +1,238 @@
+// SPDX-License-Identifier: MIT
+// MyCPU is freely redistributable under the MIT License. See the file
+// "LICENSE" for information on usage and redistribution of this file.
+
+// C API over Simulator; see libmycpusim.h
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "libmycpusim.h"
+#include "simulator.h"
+
+static_assert(MYCPUSIM_EVENT_TEST_DONE == SIM_EVENT_TEST_DONE, "event ABI");
+static_assert(MYCPUSIM_EVENT_HOST_EXIT == SIM_EVENT_HOST_EXIT, "event ABI");
+static_assert(MYCPUSIM_EVENT_INPUT_END == SIM_EVENT_INPUT_END, "event ABI");
+static_assert(MYCPUSIM_EVENT_FINISH == SIM_EVENT_FINISH, "event ABI");
+static_assert(MYCPUSIM_EVENT_FRAME == SIM_EVENT_FRAME, "event ABI");
+static_assert(MYCPUSIM_EVENT_UART_TX == SIM_EVENT_UART_TX, "event ABI");
+static_assert(MYCPUSIM_FRAME_WIDTH == Simulator::FRAME_WIDTH, "frame ABI");
+static_assert(MYCPUSIM_FRAME_HEIGHT == Simulator::FRAME_HEIGHT, "frame ABI");
+
+struct mycpusim {
+    // Each handle gets its own context so instances are independent
+    VerilatedContext ctx;
+    Simulator sim{4 * 1024 * 1024, &ctx};
+    std::string error;
+    std::string uart_rx;  // Captured TX output not yet returned
+
+    mycpusim()
+    {
+        sim.set_uart_capture(true);
+        sim.set_frame_capture(true);
+        sim.set_uart_rx_live(true);
+    }
+};
+
+// [addr, addr + len) lies in main memory; otherwise sets the error
+static bool in_memory(mycpusim_t *s,
+                      const char *what,
+                      uint32_t addr,
+                      size_t len)
+{
+    size_t size = s->sim.memory().size();
+    if (addr <= size && len <= size - addr)
+        return true;
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%s past end of memory: %zu bytes at 0x%08x",
+             what, len, addr);
+    s->error = msg;
+    return false;
+}
+
+extern "C" {
+
+mycpusim_t *mycpusim_create(void)
+{
+    try {
+        return new mycpusim;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void mycpusim_destroy(mycpusim_t *s)
+{
+    delete s;
+}
+
+const char *mycpusim_last_error(const mycpusim_t *s)
+{
+    return s->error.c_str();
+}
+
+int mycpusim_load(mycpusim_t *s, const char *path)
+{
+    try {
+        s->sim.load(path);
+    } catch (const std::exception &e) {
+        s->error = e.what();
+        return -1;
+    }
+    return 0;
+}
+
+int mycpusim_load_buffer(mycpusim_t *s,
+                         const void *data,
+                         size_t len,
+                         uint32_t base)
+{
+    return mycpusim_write_bytes(s, base, data, len);
+}
+
+int mycpusim_set_mem_timing(mycpusim_t *s, const char *spec)
+{
+    if (s->sim.set_mem_timing(spec))
+        return 0;
+    s->error = std::string("bad memory timing spec: ") + spec;
+    return -1;
+}
+
+void mycpusim_set_hostfs(mycpusim_t *s, const char *dir)
+{
+    s->sim.set_hostfs(dir);
+}
+
+int mycpusim_set_input_script(mycpusim_t *s, const char *path)
+{
+    if (s->sim.set_input_script(path))
+        return 0;
+    s->error = std::string("cannot load input script: ") + path;
+    return -1;
+}
+
+void mycpusim_set_uart_loopback(mycpusim_t *s, int enable)
+{
+    s->sim.set_uart_rx_live(!enable);
+}
+
+void mycpusim_reset(mycpusim_t *s)
+{
+    s->sim.reset();
+}
+
+uint32_t mycpusim_step(mycpusim_t *s, uint64_t cycles)
+{
+    return s->sim.run(cycles * 2);
+}
+
+uint32_t mycpusim_run(mycpusim_t *s, uint64_t max_cycles, uint32_t event_mask)
+{
+    return s->sim.run(max_cycles * 2, event_mask);
+}
+
+uint64_t mycpusim_cycles(const mycpusim_t *s)
+{
+    return s->sim.cycles();
+}
+
+int mycpusim_status(const mycpusim_t *s, uint32_t *result)
+{
+    uint32_t ev = s->sim.finished_event();
+    if (result)
+        *result = ev == SIM_EVENT_HOST_EXIT
+                      ? static_cast<uint32_t>(s->sim.host_exit_code())
+                      : s->sim.test_result();
+    if (!(ev & (SIM_EVENT_TEST_DONE | SIM_EVENT_HOST_EXIT)))
+        return MYCPUSIM_RUNNING;
+    return s->sim.test_failed() ? MYCPUSIM_FAILED : MYCPUSIM_PASSED;
+}
+
+uint32_t mycpusim_pc(const mycpusim_t *s)
+{
+    return s->sim.pc();
+}
+
+uint32_t mycpusim_read_reg(mycpusim_t *s, unsigned idx)
+{
+    return s->sim.read_reg(idx);
+}
+
+uint32_t mycpusim_read_csr(mycpusim_t *s, unsigned csr)
+{
+    return s->sim.read_csr(csr);
+}
+
+int mycpusim_read_mem(mycpusim_t *s, uint32_t addr, uint32_t *value)
+{
+    if (!in_memory(s, "read", addr & ~3u, 4))
+        return -1;
+    *value = s->sim.memory().read(addr);
+    return 0;
+}
+
+int mycpusim_write_mem(mycpusim_t *s, uint32_t addr, uint32_t value)
+{
+    if (!in_memory(s, "write", addr & ~3u, 4))
+        return -1;
+    s->sim.memory().write(addr, value, 0xF);
+    return 0;
+}
+
+int mycpusim_read_bytes(mycpusim_t *s, uint32_t addr, void *buf, size_t len)
+{
+    if (!in_memory(s, "read", addr, len))
+        return -1;
+    const Memory &mem = s->sim.memory();
+    auto *out = static_cast<uint8_t *>(buf);
+    for (size_t i = 0; i < len; i++)
+        out[i] = mem.read_byte(addr + i);
+    return 0;
+}
+
+int mycpusim_write_bytes(mycpusim_t *s,
+                         uint32_t addr,
+                         const void *buf,
+                         size_t len)
+{
+    if (!in_memory(s, "write", addr, len))
+        return -1;
+    Memory &mem = s->sim.memory();
+    auto *in = static_cast<const uint8_t *>(buf);
+    for (size_t i = 0; i < len; i++)
+        mem.write_byte(addr + i, in[i]);
+    return 0;
+}
+
+void mycpusim_uart_send(mycpusim_t *s, const void *data, size_t len)
+{
+    s->sim.push_uart(std::string(static_cast<const char *>(data), len));
+}
+
+size_t mycpusim_uart_recv(mycpusim_t *s, void *buf, size_t len)
+{
+    s->uart_rx += s->sim.take_uart_output();
+    size_t n = std::min(len, s->uart_rx.size());
+    memcpy(buf, s->uart_rx.data(), n);
+    s->uart_rx.erase(0, n);
+    return n;
+}
+
+uint64_t mycpusim_frame_count(const mycpusim_t *s)
+{
+    return s->sim.frames();
+}
+
+int mycpusim_get_frame(const mycpusim_t *s, uint8_t *buf, size_t len)
+{
+    const std::vector<uint8_t> &f = s->sim.frame();
+    if (len < f.size())
+        return -1;
+    memcpy(buf, f.data(), f.size());
+    return 0;
+}
+
+}  // extern "C"
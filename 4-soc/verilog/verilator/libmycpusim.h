@@ -0,0 +1,92 @@
+/* SPDX-License-Identifier: MIT */
+/* libmycpusim - C API for embedding the MyCPU SoC simulator
+ *
+ * Wraps one Simulator instance (VTop + Memory + UART + host calls) per
+ * handle so test scripts can drive the SoC in-process instead of spawning
+ * VTop and parsing its output. Cycle counts are CPU cycles. UART output and
+ * VGA frames are captured into buffers; nothing is printed and no window is
+ * opened.
+ *
+ * Functions returning int use 0 for success and -1 for failure.
+ */
+
+#ifndef LIBMYCPUSIM_H
+#define LIBMYCPUSIM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct mycpusim mycpusim_t;
+
+/* Events returned by mycpusim_step()/mycpusim_run() (bit mask) */
+#define MYCPUSIM_EVENT_NONE 0u
+#define MYCPUSIM_EVENT_TEST_DONE (1u << 0) /* 0xCAFEF00D written to 0x100 */
+#define MYCPUSIM_EVENT_HOST_EXIT (1u << 1) /* host_exit() */
+#define MYCPUSIM_EVENT_INPUT_END (1u << 2) /* Input script `end` */
+#define MYCPUSIM_EVENT_FINISH (1u << 3)    /* $finish */
+#define MYCPUSIM_EVENT_FRAME (1u << 5)     /* VGA vsync */
+#define MYCPUSIM_EVENT_UART_TX (1u << 6)   /* UART character sent */
+
+#define MYCPUSIM_FRAME_WIDTH 640
+#define MYCPUSIM_FRAME_HEIGHT 480
+
+/* Test outcome reported by mycpusim_status() */
+#define MYCPUSIM_RUNNING 0
+#define MYCPUSIM_PASSED 1
+#define MYCPUSIM_FAILED 2
+
+/* Lifecycle */
+mycpusim_t *mycpusim_create(void);
+void mycpusim_destroy(mycpusim_t *sim);
+const char *mycpusim_last_error(const mycpusim_t *sim);
+
+/* Configuration (call before the first step) */
+int mycpusim_load(mycpusim_t *sim, const char *path);
+int mycpusim_load_buffer(mycpusim_t *sim,
+                         const void *data,
+                         size_t len,
+                         uint32_t base);
+int mycpusim_set_mem_timing(mycpusim_t *sim, const char *spec);
+void mycpusim_set_hostfs(mycpusim_t *sim, const char *dir);
+int mycpusim_set_input_script(mycpusim_t *sim, const char *path);
+/* RX defaults to mycpusim_uart_send(); loopback wires TX back to RX */
+void mycpusim_set_uart_loopback(mycpusim_t *sim, int enable);
+void mycpusim_reset(mycpusim_t *sim);
+
+/* Execution: step exactly `cycles` unless a terminal event occurs; run stops
+ * additionally on any event in `event_mask`. Both return the stop events. */
+uint32_t mycpusim_step(mycpusim_t *sim, uint64_t cycles);
+uint32_t mycpusim_run(mycpusim_t *sim, uint64_t max_cycles, uint32_t event_mask);
+uint64_t mycpusim_cycles(const mycpusim_t *sim);
+int mycpusim_status(const mycpusim_t *sim, uint32_t *result);
+
+/* State */
+uint32_t mycpusim_pc(const mycpusim_t *sim);
+uint32_t mycpusim_read_reg(mycpusim_t *sim, unsigned idx);
+uint32_t mycpusim_read_csr(mycpusim_t *sim, unsigned csr);
+/* Main memory accesses fail (-1) outside [0, memory size) */
+int mycpusim_read_mem(mycpusim_t *sim, uint32_t addr, uint32_t *value);
+int mycpusim_write_mem(mycpusim_t *sim, uint32_t addr, uint32_t value);
+int mycpusim_read_bytes(mycpusim_t *sim, uint32_t addr, void *buf, size_t len);
+int mycpusim_write_bytes(mycpusim_t *sim,
+                         uint32_t addr,
+                         const void *buf,
+                         size_t len);
+
+/* UART: queue bytes for the RX line; drain captured TX output */
+void mycpusim_uart_send(mycpusim_t *sim, const void *data, size_t len);
+size_t mycpusim_uart_recv(mycpusim_t *sim, void *buf, size_t len);
+
+/* VGA: completed frames so far, and the last one as RRGGBB bytes */
+uint64_t mycpusim_frame_count(const mycpusim_t *sim);
+int mycpusim_get_frame(const mycpusim_t *sim, uint8_t *buf, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBMYCPUSIM_H */
@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: MIT
+// Memory - word-addressed main memory behind the io_mem_slave_* port
+//
+// Backs slave 0 (0x00000000-0x1FFFFFFF) and the instruction ROM port.
+// Out-of-range reads return 0 and out-of-range writes are dropped.
+//
+// Storage is an anonymous private mapping, so untouched pages cost nothing,
+// and page-aligned program images are mapped copy-on-write from the file:
+// every instance loading the same binary shares the page-cache copy until
+// it writes to a page.
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+class Memory
+{
+    static constexpr size_t PAGE = 4096;
+
+    uint32_t *mem = nullptr;
+    size_t words = 0;
+
+public:
+    explicit Memory(size_t size) : words(size)
+    {
+        void *p = mmap(nullptr, words * 4, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (p == MAP_FAILED)
+            throw std::runtime_error("Cannot allocate simulated memory");
+        mem = static_cast<uint32_t *>(p);
+    }
+
+    ~Memory() { munmap(mem, words * 4); }
+
+    Memory(const Memory &) = delete;
+    Memory &operator=(const Memory &) = delete;
+
+    size_t size() const { return words * 4; }
+
+    // Zero everything, dropping any image mapped by map_image()
+    void clear()
+    {
+        void *p = mmap(mem, words * 4, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED,
+                       -1, 0);
+        if (p == MAP_FAILED)
+            throw std::runtime_error("Cannot clear simulated memory");
+    }
+
+    inline uint32_t read(uint32_t addr) const
+    {
+        addr >>= 2;
+        return (addr < words) ? mem[addr] : 0;
+    }
+
+    void load(const char *filename, size_t base = 0x1000)
+    {
+        std::ifstream f(filename, std::ios::binary | std::ios::ate);
+        if (!f)
+            throw std::runtime_error(std::string("Cannot open ") + filename);
+        auto pos = f.tellg();
+        if (pos < 0)
+            throw std::runtime_error(std::string("Cannot determine size: ") +
+                                     filename);
+        size_t size = static_cast<size_t>(pos);
+        if (base + size > words * 4)
+            throw std::runtime_error(std::string("File too large: ") +
+                                     filename);
+        if (size && base % PAGE == 0 && map_image(filename, base, size))
+            return;
+        f.seekg(0);
+        f.read(reinterpret_cast<char *>(&mem[base >> 2]), size);
+        if (!f)
+            throw std::runtime_error(std::string("Read error: ") + filename);
+    }
+
+    // Map the file copy-on-write over [base, base + size). The tail of the
+    // last page past EOF reads as zero, like the anonymous memory around it.
+    bool map_image(const char *filename, size_t base, size_t size)
+    {
+        size_t len = (size + PAGE - 1) & ~(PAGE - 1);
+        if (base + len > words * 4)
+            return false;
+        int fd = open(filename, O_RDONLY);
+        if (fd < 0)
+            return false;
+        void *p = mmap(reinterpret_cast<char *>(mem) + base, len,
+                       PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0);
+        close(fd);
+        return p != MAP_FAILED;
+    }
+
+    inline uint8_t read_byte(uint32_t addr) const
+    {
+        return static_cast<uint8_t>(read(addr & ~3u) >> ((addr & 3) * 8));
+    }
+
+    inline void write(uint32_t addr, uint32_t val, uint8_t strobe)
+    {
+        addr >>= 2;
+        if (addr >= words)
+            return;
+        uint32_t mask =
+            ((strobe & 1) ? 0x000000FF : 0) | ((strobe & 2) ? 0x0000FF00 : 0) |
+            ((strobe & 4) ? 0x00FF0000 : 0) | ((strobe & 8) ? 0xFF000000 : 0);
+        mem[addr] = (mem[addr] & ~mask) | (val & mask);
+    }
+
+    inline void write_byte(uint32_t addr, uint8_t val)
+    {
+        write(addr & ~3u, static_cast<uint32_t>(val) << ((addr & 3) * 8),
+              1 << (addr & 3));
+    }
+};
@@ -0,0 +1,274 @@
+// SPDX-License-Identifier: MIT
+// Memory Timing - latency/bandwidth model for the io_mem_slave_* port
+//
+// The harness-side Memory answers every read on the next clock edge. This
+// model decides *when* a request is answered so CPI numbers reflect realistic
+// main memory. Data is still served functionally by Memory; only the
+// read_valid timing changes. Writes are posted by AXI4LiteSlave (BVALID does
+// not wait for the harness), so they never stall directly, but they occupy
+// the channel/bank and delay the reads queued behind them.
+//
+// Spec syntax (--mem-timing):
+//   ideal                          next-edge response (default)
+//   fixed:<N>                      N wait states on every read
+//   bw:interval=<N>[,latency=<L>]  one beat per N cycles, L wait states
+//   dram[:tcas=..,trcd=..,trp=..,row=..,banks=..]
+//                                  open-row DRAM, per-bank row buffers
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+class MemoryTiming
+{
+public:
+    enum class Mode { IDEAL, FIXED, BANDWIDTH, DRAM };
+
+private:
+    Mode mode = Mode::IDEAL;
+
+    // FIXED / BANDWIDTH parameters
+    uint32_t latency = 0;   // Wait states before read_valid
+    uint32_t interval = 1;  // Cycles the channel is occupied per beat
+
+    // DRAM parameters (cycles); defaults resemble DDR3 at a 50 MHz core
+    uint32_t t_cas = 2;
+    uint32_t t_rcd = 2;
+    uint32_t t_rp = 2;
+    uint32_t row_bytes = 2048;
+    uint32_t banks = 4;
+
+    struct Bank {
+        bool open = false;
+        uint32_t row = 0;
+        uint64_t busy_until = 0;
+    };
+    std::vector<Bank> bank_state;
+    uint64_t channel_busy_until = 0;
+
+    // Statistics
+    uint64_t reads = 0, writes = 0;
+    uint64_t read_latency_sum = 0, read_latency_max = 0;
+    uint64_t queue_delay_sum = 0, queue_delay_max = 0, queued_requests = 0;
+    uint64_t row_hits = 0, row_misses = 0, row_empty = 0;
+    uint64_t busy_cycles = 0;
+
+    static bool parse_u32(const char *s, uint32_t &out)
+    {
+        char *end = nullptr;
+        unsigned long v = strtoul(s, &end, 0);
+        if (end == s || *end != '\0')
+            return false;
+        out = static_cast<uint32_t>(v);
+        return true;
+    }
+
+    // Parse "key=value,key=value" into the DRAM/bandwidth parameters
+    bool parse_params(const std::string &params)
+    {
+        size_t pos = 0;
+        while (pos < params.size()) {
+            size_t comma = params.find(',', pos);
+            if (comma == std::string::npos)
+                comma = params.size();
+            std::string kv = params.substr(pos, comma - pos);
+            pos = comma + 1;
+            size_t eq = kv.find('=');
+            if (eq == std::string::npos) {
+                fprintf(stderr, "mem-timing: expected key=value, got '%s'\n",
+                        kv.c_str());
+                return false;
+            }
+            std::string key = kv.substr(0, eq);
+            uint32_t val;
+            if (!parse_u32(kv.c_str() + eq + 1, val)) {
+                fprintf(stderr, "mem-timing: bad value for '%s'\n",
+                        key.c_str());
+                return false;
+            }
+            if (key == "latency")
+                latency = val;
+            else if (key == "interval")
+                interval = std::max<uint32_t>(val, 1);
+            else if (key == "tcas")
+                t_cas = val;
+            else if (key == "trcd")
+                t_rcd = val;
+            else if (key == "trp")
+                t_rp = val;
+            else if (key == "row")
+                row_bytes = std::max<uint32_t>(val, 4);
+            else if (key == "banks")
+                banks = std::max<uint32_t>(val, 1);
+            else {
+                fprintf(stderr, "mem-timing: unknown parameter '%s'\n",
+                        key.c_str());
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Reserve the channel (and bank for DRAM) for one beat arriving at `now`.
+    // Returns the cycle at which the beat's data is available.
+    uint64_t schedule(uint32_t addr, uint64_t now)
+    {
+        uint64_t start = std::max(now, channel_busy_until);
+        uint64_t ready = start;
+        uint32_t occupancy = 1;
+
+        switch (mode) {
+        case Mode::IDEAL:
+            break;
+        case Mode::FIXED:
+            ready = start + latency;
+            break;
+        case Mode::BANDWIDTH:
+            ready = start + latency;
+            channel_busy_until = start + interval;
+            occupancy = interval;
+            break;
+        case Mode::DRAM: {
+            uint32_t row = addr / row_bytes;
+            Bank &b = bank_state[row % banks];
+            start = std::max(start, b.busy_until);
+            uint32_t access;
+            if (b.open && b.row == row) {
+                access = t_cas;
+                row_hits++;
+            } else if (b.open) {
+                access = t_rp + t_rcd + t_cas;
+                row_misses++;
+            } else {
+                access = t_rcd + t_cas;
+                row_empty++;
+            }
+            b.open = true;
+            b.row = row;
+            ready = start + access;
+            b.busy_until = ready;
+            channel_busy_until = start + 1;  // One beat on the data bus
+            occupancy = access;
+            break;
+        }
+        }
+
+        uint64_t queued = start - now;
+        if (queued) {
+            queued_requests++;
+            queue_delay_sum += queued;
+            queue_delay_max = std::max(queue_delay_max, queued);
+        }
+        busy_cycles += occupancy;
+        return ready;
+    }
+
+public:
+    MemoryTiming() : bank_state(4) {}
+
+    // Parse a --mem-timing spec; returns false (with a message) on error
+    bool configure(const char *spec)
+    {
+        std::string s(spec);
+        size_t colon = s.find(':');
+        std::string kind = s.substr(0, colon);
+        std::string params =
+            colon == std::string::npos ? "" : s.substr(colon + 1);
+
+        if (kind == "ideal") {
+            mode = Mode::IDEAL;
+        } else if (kind == "fixed") {
+            mode = Mode::FIXED;
+            if (!parse_u32(params.c_str(), latency)) {
+                fprintf(stderr, "mem-timing: fixed:<N> needs a cycle count\n");
+                return false;
+            }
+        } else if (kind == "bw") {
+            mode = Mode::BANDWIDTH;
+            if (!parse_params(params))
+                return false;
+        } else if (kind == "dram") {
+            mode = Mode::DRAM;
+            if (!parse_params(params))
+                return false;
+        } else {
+            fprintf(stderr, "mem-timing: unknown model '%s'\n", kind.c_str());
+            return false;
+        }
+        bank_state.assign(banks, Bank{});
+        return true;
+    }
+
+    // Close all rows, free the channel and clear the statistics; the
+    // configured model is kept
+    void restart()
+    {
+        bank_state.assign(banks, Bank{});
+        channel_busy_until = 0;
+        reads = writes = 0;
+        read_latency_sum = read_latency_max = 0;
+        queue_delay_sum = queue_delay_max = queued_requests = 0;
+        row_hits = row_misses = row_empty = 0;
+        busy_cycles = 0;
+    }
+
+    Mode get_mode() const { return mode; }
+    bool is_ideal() const { return mode == Mode::IDEAL; }
+
+    // A read was observed on io_mem_slave_read at CPU cycle `now`.
+    // Returns the cycle at which read_valid may be driven.
+    uint64_t issue_read(uint32_t addr, uint64_t now)
+    {
+        reads++;
+        uint64_t ready = schedule(addr, now);
+        uint64_t lat = ready - now;
+        read_latency_sum += lat;
+        read_latency_max = std::max(read_latency_max, lat);
+        return ready;
+    }
+
+    // A (posted) write pulse was observed on io_mem_slave_write
+    void issue_write(uint32_t addr, uint64_t now)
+    {
+        writes++;
+        schedule(addr, now);
+    }
+
+    void print_stats(uint64_t total_cycles) const
+    {
+        static const char *names[] = {"ideal", "fixed", "bandwidth", "dram"};
+        printf("\nMemory Timing (%s):\n", names[static_cast<int>(mode)]);
+        printf("  Reads: %llu, Writes: %llu\n", (unsigned long long) reads,
+               (unsigned long long) writes);
+        if (reads)
+            printf("  Read wait states: avg %.2f, max %llu\n",
+                   (double) read_latency_sum / reads,
+                   (unsigned long long) read_latency_max);
+        uint64_t total = reads + writes;
+        printf("  Queued requests: %llu (%.1f%%), queue delay avg %.2f, "
+               "max %llu\n",
+               (unsigned long long) queued_requests,
+               total ? 100.0 * queued_requests / total : 0.0,
+               queued_requests ? (double) queue_delay_sum / queued_requests
+                               : 0.0,
+               (unsigned long long) queue_delay_max);
+        if (mode == Mode::DRAM) {
+            uint64_t acc = row_hits + row_misses + row_empty;
+            printf("  Row buffer: %llu hits, %llu conflicts, %llu empty "
+                   "(hit rate %.1f%%)\n",
+                   (unsigned long long) row_hits,
+                   (unsigned long long) row_misses,
+                   (unsigned long long) row_empty,
+                   acc ? 100.0 * row_hits / acc : 0.0);
+        }
+        if (total_cycles)
+            printf("  Utilization: %.1f%%\n",
+                   100.0 * std::min(busy_cycles, total_cycles) / total_cycles);
+    }
+};
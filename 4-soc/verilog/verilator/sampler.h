@@ -0,0 +1,308 @@
+// SPDX-License-Identifier: MIT
+// Sampler - SMARTS-style sampled simulation: ISS fast-forward, RTL windows
+//
+// The program runs on the functional Iss, and every `interval` instructions
+// one sampling unit runs on the RTL instead:
+//   1. The ISS state is loaded into a freshly reset core through a boot
+//      stub (Simulator::set_boot_stub): the reset vector jumps to STUB_BASE,
+//      where generated code stores the peripheral registers, writes the
+//      CSRs and loads x1-x31, then jumps to the ISS pc.
+//   2. `warmup` instructions run in detail to refill the BTB/RAS and the
+//      memory timing model's open rows (the reset left them cold).
+//   3. `window` instructions are measured: CPI = delta mcycle / delta
+//      minstret, read through the CSR debug port.
+//   4. The pipeline is drained, and pc, x1-x31 and the trap CSRs are read
+//      back into the ISS, which continues from there.
+// Main memory is shared, so no copying is needed in either direction.
+//
+// The report gives the mean CPI over all windows with a 95% confidence
+// interval (normal approximation, 1.96 * sd / sqrt(n)) and scales it by the
+// total instruction count into an estimated cycle count.
+//
+// Not transferred: VGA framebuffer, sprite pattern and tile contents, and
+// peripheral register writes made during an RTL window; the ISS keeps its
+// own copies. Units whose target pc is out of jal range of the stub
+// (+-1 MiB) are skipped.
+//
+// The data TCM is private to each model and too large for the stub to
+// restore, so the run stops with tcm_used() set as soon as the ISS touches
+// the TCM window; startup code (init.S, TCM_STACK) does so before the first
+// unit.
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "iss.h"
+#include "simulator.h"
+
+struct SampleConfig {
+    uint64_t interval = 1000000;  // Instructions between unit starts
+    uint64_t warmup = 2000;       // Detailed but not measured
+    uint64_t window = 10000;      // Measured
+
+    // "interval:warmup:window", e.g. "1000000:2000:10000"
+    bool parse(const char *spec)
+    {
+        char *end;
+        uint64_t v[3];
+        for (int i = 0; i < 3; i++) {
+            v[i] = strtoull(spec, &end, 0);
+            if (end == spec || (i < 2 && *end != ':') || (i == 2 && *end))
+                return false;
+            spec = end + 1;
+        }
+        if (!v[2] || v[1] + v[2] > v[0])
+            return false;
+        interval = v[0];
+        warmup = v[1];
+        window = v[2];
+        return true;
+    }
+};
+
+class Sampler
+{
+public:
+    static constexpr uint32_t STUB_BASE = 0x400;  // Below the 0x1000 image
+
+private:
+    Simulator &sim;
+    Iss iss;
+    SampleConfig cfg;
+
+    std::vector<double> cpi;
+    uint64_t detailed_cycles = 0;
+    uint64_t skipped = 0;
+    uint32_t final_event = SIM_EVENT_NONE;
+    bool tcm = false;
+
+    static constexpr uint32_t CSR_MCYCLE = 0xB00;
+    static constexpr uint32_t CSR_MINSTRET = 0xB02;
+    // Restored in this order; mstatus last so MIE stays clear meanwhile
+    static constexpr uint32_t RESTORED_CSRS[] = {0x304, 0x305, 0x340,
+                                                 0x341, 0x342, 0x300};
+
+    static uint32_t lui(uint32_t rd, uint32_t imm)
+    {
+        return (imm & 0xFFFFF000) | (rd << 7) | 0x37;
+    }
+    static uint32_t addi(uint32_t rd, uint32_t rs1, uint32_t imm)
+    {
+        return ((imm & 0xFFF) << 20) | (rs1 << 15) | (rd << 7) | 0x13;
+    }
+    static uint32_t sw(uint32_t rs2, uint32_t rs1, uint32_t off)
+    {
+        return (((off >> 5) & 0x7F) << 25) | (rs2 << 20) | (rs1 << 15) |
+               (2 << 12) | ((off & 0x1F) << 7) | 0x23;
+    }
+    static uint32_t csrw(uint32_t csr, uint32_t rs1)
+    {
+        return (csr << 20) | (rs1 << 15) | (1 << 12) | 0x73;
+    }
+    static void li(std::vector<uint32_t> &code, uint32_t rd, uint32_t v)
+    {
+        code.push_back(lui(rd, v + 0x800));  // addi sign-extends its imm
+        code.push_back(addi(rd, rd, v));
+    }
+
+    std::vector<uint32_t> restore_stub() const
+    {
+        std::vector<uint32_t> code;
+        auto store = [&](uint32_t base, uint32_t off, uint32_t v) {
+            code.push_back(lui(1, base));
+            li(code, 2, v);
+            code.push_back(sw(2, 1, off));
+        };
+        store(Iss::TIMER_BASE, 0x04, iss.timer_limit);
+        store(Iss::TIMER_BASE, 0x08, iss.timer_enabled);
+        store(Iss::UART_BASE, 0x08, iss.uart_interrupt);
+        for (uint32_t off = 0x24; off < 0x64; off += 4)  // Palette
+            store(Iss::VGA_BASE, off, iss.vga[off >> 2]);
+        store(Iss::VGA_BASE, 0x68, iss.vga[0x68 >> 2]);  // Sprite key
+        store(Iss::VGA_BASE, 0x6C, iss.vga[0x6C >> 2]);  // Tile layer
+        store(Iss::VGA_BASE, 0x70, iss.vga[0x70 >> 2]);  // Scroll
+        store(Iss::VGA_BASE, 0x74, iss.vga[0x74 >> 2]);  // Scroll split
+        for (uint32_t off = 0x80; off < 0xA0; off += 4)  // Sprite positions
+            store(Iss::VGA_BASE, off, iss.vga[off >> 2]);
+        store(Iss::VGA_BASE, 0x10, iss.vga[0x10 >> 2]);  // Upload address
+        store(Iss::VGA_BASE, 0x20, iss.vga[0x20 >> 2] & ~4u);  // No swap
+        for (uint32_t off = 0x00; off < 0x14; off += 4)  // DMA, idle
+            store(Iss::DMA_BASE, off, iss.dma[off >> 2]);
+        store(Iss::DMA_BASE, 0x14, iss.dma[0x14 >> 2]);  // Interrupt enable only
+
+        const uint32_t csr_val[] = {iss.mie,      iss.mtvec, iss.mscratch,
+                                    iss.mepc,     iss.mcause, iss.mstatus};
+        for (size_t i = 0; i < 6; i++) {
+            li(code, 1, csr_val[i]);
+            code.push_back(csrw(RESTORED_CSRS[i], 1));
+        }
+        for (uint32_t r = 1; r < 32; r++)
+            li(code, r, iss.x[r]);
+        uint32_t jal_pc = STUB_BASE + 4 * static_cast<uint32_t>(code.size());
+        code.push_back(Simulator::jal_x0(iss.pc() - jal_pc));
+        return code;
+    }
+
+    static bool in_jal_range(int64_t off)
+    {
+        return off >= -(1 << 20) && off < (1 << 20);
+    }
+
+    // Run the RTL until minstret reaches `target` (checked every 16 cycles)
+    uint32_t run_until_retired(uint32_t target, uint32_t &cycles_out)
+    {
+        for (;;) {
+            uint32_t ev = sim.run(32);
+            if (ev)
+                return ev;
+            if (static_cast<int32_t>(sim.read_csr(CSR_MINSTRET) - target) >= 0)
+                break;
+        }
+        cycles_out = sim.read_csr(CSR_MCYCLE);
+        return SIM_EVENT_NONE;
+    }
+
+    // One sampling unit on the RTL; false when the program ended in it
+    bool detailed_unit()
+    {
+        std::vector<uint32_t> code = restore_stub();
+        int64_t reach = static_cast<int64_t>(iss.pc()) -
+                        (STUB_BASE + 4 * (code.size() - 1));
+        if (!in_jal_range(reach) ||
+            iss.pc() - STUB_BASE < 4 * code.size()) {
+            skipped++;
+            return true;
+        }
+        const uint32_t stub_len = static_cast<uint32_t>(code.size()) + 1;
+        sim.set_boot_stub(STUB_BASE, std::move(code), iss.pc());
+        sim.reset();  // Also restarts sim.ticks()
+
+        uint32_t c0 = 0, c1 = 0;
+        uint32_t ev = run_until_retired(stub_len + cfg.warmup, c0);
+        uint32_t i0 = sim.read_csr(CSR_MINSTRET);
+        if (!ev)
+            ev = run_until_retired(i0 + cfg.window, c1);
+        if (!ev) {
+            uint32_t i1 = sim.read_csr(CSR_MINSTRET);
+            cpi.push_back(static_cast<double>(c1 - c0) / (i1 - i0));
+            if (!sim.drain())
+                ev = sim.finished_event();
+        }
+        detailed_cycles += sim.ticks() >> 1;
+        iss.advance(sim.read_csr(CSR_MINSTRET) - stub_len,
+                    sim.read_csr(CSR_MCYCLE));
+        if (ev & SIM_EVENT_TERMINAL) {
+            final_event = ev;
+            return false;
+        }
+
+        iss.pc_reg = sim.pc();
+        for (uint32_t r = 1; r < 32; r++)
+            iss.x[r] = sim.read_reg(r);
+        iss.mstatus = sim.read_csr(0x300);
+        iss.mie = sim.read_csr(0x304);
+        iss.mtvec = sim.read_csr(0x305);
+        iss.mscratch = sim.read_csr(0x340);
+        iss.mepc = sim.read_csr(0x341);
+        iss.mcause = sim.read_csr(0x342);
+        return true;
+    }
+
+public:
+    Sampler(Simulator &s, const SampleConfig &c)
+        : sim(s), iss(s.memory()), cfg(c)
+    {
+    }
+
+    void set_hostfs(const char *dir) { iss.set_hostfs(dir); }
+
+    // Run to completion or `max_instructions`; returns the events that
+    // ended the run (SIM_EVENT_TEST_DONE/HOST_EXIT), or SIM_EVENT_NONE
+    uint32_t run(uint64_t max_instructions)
+    {
+        const uint64_t fast = cfg.interval - cfg.warmup - cfg.window;
+        while (iss.instructions() < max_instructions) {
+            iss.step(fast);
+            if (iss.stop() != Iss::RUNNING)
+                break;
+            if (iss.tcm_used()) {
+                tcm = true;
+                break;
+            }
+            if (!detailed_unit())
+                break;
+        }
+        fflush(stdout);
+        if (final_event)
+            return final_event;
+        if (iss.stop() == Iss::TEST_DONE)
+            return SIM_EVENT_TEST_DONE;
+        if (iss.stop() == Iss::HOST_EXIT)
+            return SIM_EVENT_HOST_EXIT;
+        return SIM_EVENT_NONE;
+    }
+
+    bool illegal() const { return iss.stop() == Iss::ILLEGAL; }
+    bool tcm_used() const { return tcm; }
+    uint32_t pc() const { return final_event ? sim.pc() : iss.pc(); }
+
+    // Outcome, from whichever model ended the run
+    bool test_failed() const
+    {
+        if (final_event)
+            return sim.test_failed();
+        if (iss.stop() == Iss::TEST_DONE)
+            return iss.test_result() != VGA_TEST_PASS &&
+                   iss.test_result() != UART_TEST_PASS;
+        if (iss.stop() == Iss::HOST_EXIT)
+            return iss.host_exit_code() != 0;
+        return iss.stop() == Iss::ILLEGAL || tcm;
+    }
+    uint32_t test_result() const
+    {
+        return final_event ? sim.test_result() : iss.test_result();
+    }
+    int host_exit_code() const
+    {
+        return final_event ? sim.host_exit_code() : iss.host_exit_code();
+    }
+
+    void print_report() const
+    {
+        const size_t n = cpi.size();
+        printf("\nSampled simulation (interval=%llu warmup=%llu window=%llu)\n",
+               (unsigned long long) cfg.interval,
+               (unsigned long long) cfg.warmup,
+               (unsigned long long) cfg.window);
+        printf("  Instructions:     %llu\n",
+               (unsigned long long) iss.instructions());
+        printf("  Detailed windows: %zu (%llu skipped), %llu RTL cycles\n", n,
+               (unsigned long long) skipped,
+               (unsigned long long) detailed_cycles);
+        if (n == 0) {
+            printf("  No windows measured (shorter than one interval)\n");
+            return;
+        }
+        double mean = 0;
+        for (double c : cpi)
+            mean += c;
+        mean /= n;
+        double var = 0;
+        for (double c : cpi)
+            var += (c - mean) * (c - mean);
+        double sd = n > 1 ? std::sqrt(var / (n - 1)) : 0;
+        double ci = 1.96 * sd / std::sqrt(static_cast<double>(n));
+        printf("  CPI:              %.4f +- %.4f (95%% CI, sd %.4f)\n", mean,
+               ci, sd);
+        printf("  Estimated cycles: %.0f (%.0f - %.0f)\n",
+               mean * iss.instructions(), (mean - ci) * iss.instructions(),
+               (mean + ci) * iss.instructions());
+        if (n < 30)
+            printf("  Note: under 30 windows; the interval is approximate\n");
+    }
+};
@@ -0,0 +1,794 @@
+// SPDX-License-Identifier: MIT
+// Simulator - one MyCPU SoC instance: VTop plus the harness-side devices
+//
+// Owns the Verilated model, main memory, the memory timing model, the UART
+// terminal and the host-call channel. Each tick() advances one half clock
+// with the capture/react/drive ordering the harness has always used, so
+// every front end (sim.cpp, libmycpusim) sees bit-identical behaviour.
+//
+// Time units: a tick is one half clock (one loop iteration of the original
+// harness, which reports it as a "cycle"); CPU cycles are ticks / 2.
+//
+// The tick body is a template over the optional harness features (VGA
+// output, terminal/scripted RX, UART link, tracing). run() and tick() pick
+// the instantiation for the current configuration on entry, so the plain
+// headless loopback run executes none of the optional code and tests none
+// of its flags. Tick results do not depend on the instantiation.
+
+#pragma once
+
+#include <verilated.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "VTop.h"
+#include "elf_file.h"
+#include "hostcall.h"
+#include "input_script.h"
+#include "memory.h"
+#include "memory_timing.h"
+#include "uart_terminal.h"
+
+static constexpr uint32_t UART_TEST_PASS = 0x0F;  // 4 subtests
+static constexpr uint32_t VGA_TEST_PASS = 0x3F;   // 6 subtests
+
+// Reasons run()/tick() return, as a bit mask
+enum SimEvent : uint32_t {
+    SIM_EVENT_NONE = 0,
+    SIM_EVENT_TEST_DONE = 1u << 0,  // 0xCAFEF00D written to 0x100
+    SIM_EVENT_HOST_EXIT = 1u << 1,  // HOSTCALL_OP_EXIT
+    SIM_EVENT_INPUT_END = 1u << 2,  // Script `end`, or Ctrl-C fully echoed
+    SIM_EVENT_FINISH = 1u << 3,     // $finish from the RTL
+    SIM_EVENT_STOPPED = 1u << 4,    // VGA or retire sink asked to stop
+    SIM_EVENT_FRAME = 1u << 5,      // VGA vsync rising edge
+    SIM_EVENT_UART_TX = 1u << 6,    // CPU finished transmitting a character
+};
+
+// Events after which the instance cannot continue
+static constexpr uint32_t SIM_EVENT_TERMINAL =
+    SIM_EVENT_TEST_DONE | SIM_EVENT_HOST_EXIT | SIM_EVENT_INPUT_END |
+    SIM_EVENT_FINISH | SIM_EVENT_STOPPED;
+
+// Receives VGA output on every pixel clock rising edge (e.g. an SDL window)
+class VGASink
+{
+public:
+    virtual ~VGASink() = default;
+    // Return false to stop the simulation (SIM_EVENT_STOPPED)
+    virtual bool pixel(uint16_t x,
+                       uint16_t y,
+                       uint8_t color,
+                       bool active,
+                       bool vsync) = 0;
+};
+
+// One cycle of Top's retirement trace (io_retire_*, see RetireBundle.scala)
+struct RetireInfo {
+    bool reg_valid;  // A register write-back leaves WB
+    uint32_t reg_pc;
+    uint8_t reg_rd;
+    uint32_t reg_data;
+    bool store_valid;  // A store starts on the bus (MEM stage)
+    uint32_t store_address;
+    uint32_t store_data;
+    uint8_t store_strobe;
+};
+
+// Receives the retirement trace on cycles where it is valid (co-simulation)
+class RetireSink
+{
+public:
+    virtual ~RetireSink() = default;
+    // Return false to stop the simulation (SIM_EVENT_STOPPED)
+    virtual bool retire(const RetireInfo &r) = 0;
+};
+
+class Simulator
+{
+public:
+    static constexpr int FRAME_WIDTH = 640;
+    static constexpr int FRAME_HEIGHT = 480;
+
+private:
+    std::unique_ptr<VTop> top;
+    Memory mem;
+    MemoryTiming timing;
+    HostCall host;
+    UartTerminal uart_term;
+    InputScript script;
+    InputRecorder recorder;
+    VGASink *vga_sink = nullptr;
+    RetireSink *retire_sink = nullptr;
+
+    // Configuration
+    bool interactive = false;  // Poll stdin for UART RX
+    bool rx_live = false;      // RX from UartTerminal instead of loopback
+    bool rx_link = false;      // RX driven by drive_uart_rx() (UartLink)
+    bool capture_uart = false;
+    bool capture_frames = false;
+    bool uart_debug = false;
+    bool specialized = true;  // false: always run the fully checked tick
+    bool icache = false;      // Fetch through the I-cache (io_icache_enable)
+    bool dcache = false;      // Loads/stores through the D-cache
+
+    // Harness state
+    bool started = false;
+    uint32_t finished = SIM_EVENT_NONE;
+    uint64_t tick_count = 0;
+    uint32_t vga_div = 0;
+    uint32_t inst = 0;
+    // Outstanding read on io_mem_slave_*: AXI4LiteSlave holds `read` high
+    // until it sees read_valid, so a new request is the first high cycle
+    // after the previous response.
+    bool mem_read_pending = false;
+    uint64_t mem_read_ready_at = 0;
+    // I-cache line refill on io_icache_refill_*: one timed read per word,
+    // in address order, while `request` stays high
+    bool icache_read_pending = false;
+    uint64_t icache_ready_at = 0;
+    uint32_t icache_beat = 0;
+    // Activity counters (watchdog.h): main memory reads, stores of any kind
+    uint64_t mem_read_count = 0;
+    uint64_t store_count = 0;
+    // Early exit tracking for terminal mode (Ctrl-C detection)
+    uint64_t tx_idle_cycles = 0;  // Count cycles of TX idle after Ctrl-C
+    // Vsync count independent of any window (frame-stamped input)
+    uint64_t vsync_count = 0;
+    bool prev_vsync = false;
+    // Serial wire to another instance
+    bool link_rx = true;
+    bool last_txd = true;
+    // Boot stub served in place of memory after reset (set_boot_stub())
+    std::vector<uint32_t> stub;
+    uint32_t stub_base = 0, stub_target = 0;
+    bool stub_active = false, stub_jumped = false;
+
+    // Results
+    uint32_t result = 0;
+    int exit_code = 0;
+    bool failed = false;
+
+    std::string uart_out;
+    std::vector<uint8_t> frame_buf, last_frame;
+
+public:
+    // After Ctrl-C is sent, wait for TX to be idle for this many cycles
+    // This ensures "Goodbye!" message completes before exit
+    // ~50K cycles = ~10 char times of idle = clearly done transmitting
+    static constexpr uint64_t TX_IDLE_EXIT_THRESHOLD = 50000;
+
+    // `mem_words` 32-bit words of main memory; `ctx` gives the instance its
+    // own VerilatedContext when several share a process
+    explicit Simulator(size_t mem_words = 4 * 1024 * 1024,
+                       VerilatedContext *ctx = nullptr)
+        : top(ctx ? std::make_unique<VTop>(ctx) : std::make_unique<VTop>()),
+          mem(mem_words),
+          uart_debug(getenv("UART_DEBUG") != nullptr)
+    {
+    }
+
+    ~Simulator() { top->final(); }
+
+    Simulator(const Simulator &) = delete;
+    Simulator &operator=(const Simulator &) = delete;
+
+    // ---- Configuration -------------------------------------------------
+
+    // Load an ELF, or a raw program image at `base`, into cleared memory
+    // and start a new run (see reset()); throws std::runtime_error
+    void load(const char *path, size_t base = 0x1000)
+    {
+        mem.clear();
+        load_program(mem, path, base);
+        restart();
+        started = false;
+    }
+
+    bool set_mem_timing(const char *spec) { return timing.configure(spec); }
+
+    // Fetch through the I-cache, refilled from main memory under the
+    // timing model, instead of the ideal io_instruction port. Applies from
+    // the next reset(). Incompatible with set_boot_stub(): the stub is only
+    // served on the ideal port.
+    void set_icache(bool en) { icache = en; }
+
+    // Route loads and stores through the write-back D-cache. Applies from
+    // the next reset(). Dirty lines reach memory() only on eviction or when
+    // the guest stores to the mailbox page, so host-side readers of guest
+    // memory (cosim, sampler, signature dump) must not be combined with it.
+    void set_dcache(bool en) { dcache = en; }
+    void set_hostfs(const char *dir) { host.set_root(dir); }
+
+    bool set_input_script(const char *path)
+    {
+        if (!script.load(path))
+            return false;
+        rx_live = true;
+        return true;
+    }
+
+    bool set_record_input(const char *path) { return recorder.open(path); }
+
+    // Interactive terminal: stdin feeds the UART RX line
+    void set_terminal(bool en)
+    {
+        interactive = en;
+        rx_live = rx_live || en;
+    }
+
+    // Drive RX from UartTerminal (push_uart()) instead of TX loopback
+    void set_uart_rx_live(bool en) { rx_live = en; }
+
+    // Drive RX from another instance's TX line (see uart_link.h)
+    void set_uart_link(bool en) { rx_link = en; }
+    void drive_uart_rx(bool level) { link_rx = level; }
+
+    // Collect UART output in a buffer (take_uart_output()) instead of stdout
+    void set_uart_capture(bool en)
+    {
+        capture_uart = en;
+        uart_term.set_echo(!en);
+    }
+
+    // Keep a copy of the last completed VGA frame (frame())
+    void set_frame_capture(bool en)
+    {
+        capture_frames = en;
+        frame_buf.assign(en ? FRAME_WIDTH * FRAME_HEIGHT : 0, 0);
+        last_frame.assign(frame_buf.size(), 0);
+    }
+
+    void set_vga_sink(VGASink *sink) { vga_sink = sink; }
+    void set_retire_sink(RetireSink *sink) { retire_sink = sink; }
+
+    // Serve `code` at `base` instead of memory until the next reset() has
+    // run it: the reset vector fetches `jal x0, base`, and the stub's last
+    // word must jump to `target`. Fetching `target` after that word ends
+    // the override. Used to load architectural state (see sampler.h).
+    void set_boot_stub(uint32_t base,
+                       std::vector<uint32_t> code,
+                       uint32_t target)
+    {
+        stub = std::move(code);
+        stub_base = base;
+        stub_target = target;
+        stub_active = !stub.empty();
+        stub_jumped = false;
+    }
+
+    bool boot_stub_active() const { return stub_active; }
+
+    // ---- Execution -----------------------------------------------------
+
+    // Reset the core and start a new run: cycle and frame counts, results,
+    // host-call exit, UART lines and queues, captured output, input script
+    // and memory timing state all start over. Memory and configuration are
+    // kept (the sampler relies on that); load() clears memory.
+    void reset()
+    {
+        restart();
+        reset_core();
+    }
+
+private:
+    // Per-run harness state back to its initial values
+    void restart()
+    {
+        finished = SIM_EVENT_NONE;
+        tick_count = 0;
+        vga_div = 0;
+        mem_read_count = 0;
+        store_count = 0;
+        tx_idle_cycles = 0;
+        vsync_count = 0;
+        prev_vsync = false;
+        link_rx = true;
+        last_txd = true;
+        result = 0;
+        exit_code = 0;
+        failed = false;
+        uart_out.clear();
+        std::fill(frame_buf.begin(), frame_buf.end(), 0);
+        std::fill(last_frame.begin(), last_frame.end(), 0);
+        host.restart();
+        timing.restart();
+        uart_term.restart();
+        script.rewind();
+    }
+
+    void reset_core()
+    {
+        top->reset = 1;
+        top->clock = 0;
+        for (int i = 0; i < 5; i++) {
+            top->clock = !top->clock;
+            top->eval();
+        }
+        top->reset = 0;
+
+        // Initialize inputs
+        top->io_signal_interrupt = 0;
+        top->io_instruction_valid = 1;
+        top->io_mem_slave_read_valid = 0;
+        top->io_mem_slave_read_data = 0;
+        top->io_uart_rxd = 1;
+        top->io_cpu_debug_read_address = 0;
+        top->io_cpu_csr_debug_read_address = 0;
+        top->io_vga_pixclk = 0;
+        top->io_icache_enable = icache;
+        top->io_icache_refill_data = 0;
+        top->io_icache_refill_data_valid = 0;
+        top->io_dcache_enable = dcache;
+
+        inst = fetch(RESET_VECTOR);
+        mem_read_pending = false;
+        icache_read_pending = false;
+        icache_beat = 0;
+        finished = SIM_EVENT_NONE;
+        started = true;
+    }
+
+    // Optional parts of the tick, one template parameter bit each
+    enum Feature : uint32_t {
+        FEAT_VGA = 1u << 0,       // VGA sink or frame capture
+        FEAT_TERMINAL = 1u << 1,  // RX from UartTerminal (stdin, scripts)
+        FEAT_LINK = 1u << 2,      // RX from another instance
+        FEAT_TRACE = 1u << 3,     // UART_DEBUG, retirement trace
+        FEAT_ALL = (1u << 4) - 1,
+    };
+
+    uint32_t features() const
+    {
+        if (!specialized)
+            return FEAT_ALL;
+        uint32_t f = 0;
+        if (vga_sink || capture_frames)
+            f |= FEAT_VGA;
+        if (rx_live)
+            f |= FEAT_TERMINAL;
+        if (rx_link)
+            f |= FEAT_LINK;
+        if (uart_debug || retire_sink)
+            f |= FEAT_TRACE;
+        return f;
+    }
+
+    // Each feature's code is compiled in only when its bit is set in F, and
+    // then still checks the runtime flag (FEAT_ALL behaves like the
+    // unspecialized loop)
+    template <uint32_t F>
+    uint32_t tick_impl()
+    {
+        if (!started)
+            reset_core();
+        if (finished)
+            return finished;
+        if (top->contextp()->gotFinish())
+            return finished = SIM_EVENT_FINISH;
+
+        uint32_t events = SIM_EVENT_NONE;
+
+        top->io_instruction = inst;
+        top->clock = !top->clock;
+
+        // Single authoritative eval() after clock toggle.
+        // This creates a stable snapshot of all DUT outputs for this clock
+        // edge.
+        top->eval();
+
+        // =================================================================
+        // CAPTURE PHASE: Snapshot all DUT outputs immediately after eval().
+        // This implements the "Capture and Defer" pattern recommended for
+        // Verilator testbenches to avoid race conditions between multiple
+        // eval() calls within a single clock phase.
+        // =================================================================
+
+        // Capture memory interface signals (immune to later state changes)
+        bool mem_read_req = top->io_mem_slave_read;
+        bool mem_write_req = top->io_mem_slave_write;
+        uint32_t mem_address = top->io_mem_slave_address;
+        uint32_t mem_write_data = top->io_mem_slave_write_data;
+        uint8_t mem_write_strobe = (top->io_mem_slave_write_strobe_0) |
+                                   (top->io_mem_slave_write_strobe_1 << 1) |
+                                   (top->io_mem_slave_write_strobe_2 << 2) |
+                                   (top->io_mem_slave_write_strobe_3 << 3);
+        bool icache_req = top->io_icache_refill_request;
+        uint32_t icache_address = top->io_icache_refill_address;
+
+        // Capture VGA outputs for display update
+        uint8_t vga_color = top->io_vga_rrggbb & 0x3F;
+        bool vga_active = top->io_vga_activevideo;
+        bool vga_vsync = top->io_vga_vsync;
+        uint16_t vga_x = top->io_vga_x_pos;
+        uint16_t vga_y = top->io_vga_y_pos;
+
+        // Capture UART TX line for serial output
+        bool uart_txd = top->io_uart_txd;
+        last_txd = uart_txd;
+
+        // =================================================================
+        // REACTION PHASE: Act on captured state. Order no longer matters.
+        // =================================================================
+
+        // VGA pixel clock at 1/4 CPU clock
+        // Drive pixclk input - effect will be seen on next main clock eval()
+        // NO eval() here: avoids race condition with memory signals
+        if (++vga_div >= 4) {
+            vga_div = 0;
+            top->io_vga_pixclk = !top->io_vga_pixclk;
+
+            if ((F & FEAT_VGA) && top->io_vga_pixclk) {
+                if (capture_frames && vga_active && vga_x < FRAME_WIDTH &&
+                    vga_y < FRAME_HEIGHT)
+                    frame_buf[vga_y * FRAME_WIDTH + vga_x] = vga_color;
+                if (vga_sink && !vga_sink->pixel(vga_x, vga_y, vga_color,
+                                                 vga_active, vga_vsync))
+                    return finished = SIM_EVENT_STOPPED;
+            }
+        }
+
+        // Memory handling using captured signals (immune to VGA eval effects)
+        if (top->clock) {
+            uint64_t mem_now = tick_count >> 1;  // CPU cycles (rising edges)
+
+            // Memory read - use captured signals, delayed by timing model
+            if (mem_read_req) {
+                if (!mem_read_pending) {
+                    mem_read_pending = true;
+                    mem_read_count++;
+                    mem_read_ready_at = timing.issue_read(mem_address, mem_now);
+                }
+                if (mem_now >= mem_read_ready_at) {
+                    top->io_mem_slave_read_data = mem.read(mem_address);
+                    top->io_mem_slave_read_valid = 1;
+                    mem_read_pending = false;
+                } else {
+                    top->io_mem_slave_read_valid = 0;
+                }
+            } else {
+                top->io_mem_slave_read_valid = 0;
+            }
+
+            // I-cache refill - next word of the line, same timing model
+            if (icache_req) {
+                uint32_t addr = icache_address + 4 * icache_beat;
+                if (!icache_read_pending) {
+                    icache_read_pending = true;
+                    mem_read_count++;
+                    icache_ready_at = timing.issue_read(addr, mem_now);
+                }
+                if (mem_now >= icache_ready_at) {
+                    top->io_icache_refill_data = mem.read(addr);
+                    top->io_icache_refill_data_valid = 1;
+                    icache_read_pending = false;
+                    icache_beat++;
+                } else {
+                    top->io_icache_refill_data_valid = 0;
+                }
+            } else {
+                top->io_icache_refill_data_valid = 0;
+                icache_beat = 0;
+            }
+
+            // Memory write - use captured signals
+            if (mem_write_req) {
+                mem.write(mem_address, mem_write_data, mem_write_strobe);
+                timing.issue_write(mem_address, mem_now);
+
+                // Test harness check: magic 0xCAFEF00D at 0x100 signals
+                // completion. Test result at 0x104: each set bit = one
+                // subtest passed. UART: 0xF (4 tests), VGA: 0x3F (6 tests)
+                if (mem_address == 0x100 && mem_write_data == 0xCAFEF00D) {
+                    result = mem.read(0x104);
+                    // Accept 0xF (UART) or 0x3F (VGA) as passing
+                    failed = result != VGA_TEST_PASS && result != UART_TEST_PASS;
+                    return finished = SIM_EVENT_TEST_DONE;
+                }
+
+                // Host call: the stored word is the request block address
+                if (mem_address == HOSTCALL_DOORBELL) {
+                    host.service(mem, mem_write_data, mem_now);
+                    if (host.exit_requested()) {
+                        exit_code = host.exit_code();
+                        failed = exit_code != 0;
+                        return finished = SIM_EVENT_HOST_EXIT;
+                    }
+                }
+            }
+        }
+
+        // UART handling: TX always processed, RX depends on mode
+        // Uses captured uart_txd signal for consistent state
+        if (top->clock) {
+            // TX: deserialize CPU output to stdout (both interactive and
+            // loopback) - use captured uart_txd
+            if (F & FEAT_TRACE)
+                uart_term.set_debug(uart_debug, tick_count);
+            int tx_char = uart_term.process_tx(uart_txd);
+            if (tx_char >= 0) {
+                events |= SIM_EVENT_UART_TX;
+                if (capture_uart)
+                    uart_out += static_cast<char>(tx_char);
+            }
+
+            if (vga_vsync && !prev_vsync) {
+                vsync_count++;
+                events |= SIM_EVENT_FRAME;
+                if ((F & FEAT_VGA) && capture_frames)
+                    last_frame = frame_buf;
+            }
+            prev_vsync = vga_vsync;
+
+            if ((F & FEAT_TERMINAL) && rx_live) {
+                // Poll stdin every 64 CPU cycles for responsive input
+                // Note: tick_count increments every half clock, so 128 ticks
+                // = 64 CPU cycles. (tick_count >> 1) is the CPU cycle count,
+                // masked with 0x3F
+                if (interactive && !((tick_count >> 1) & 0x3F)) {
+                    std::string typed = uart_term.poll_input();
+                    recorder.record(tick_count >> 1, vsync_count, typed);
+                }
+                // Scripted events are checked every CPU cycle so recorded
+                // stamps replay at the exact cycle they were captured
+                if (script.active()) {
+                    if (tx_char >= 0)
+                        script.on_tx(static_cast<char>(tx_char));
+                    std::string due;
+                    bool keep_running =
+                        script.poll(tick_count >> 1, vsync_count, due);
+                    uart_term.push_input(due);
+                    if (!keep_running)
+                        return finished = SIM_EVENT_INPUT_END;
+                }
+                // Advance RX state machine and get line value (only on rising
+                // edge)
+                uart_term.get_rx_line();
+
+                // Track TX idle time after Ctrl-C was sent to CPU
+                // This ensures we wait for "Goodbye!" to finish transmitting
+                if (uart_term.sent_ctrl_c()) {
+                    if (uart_term.tx_is_idle()) {
+                        tx_idle_cycles++;
+                    } else {
+                        tx_idle_cycles = 0;  // Reset if TX becomes active
+                    }
+                }
+            }
+        }
+
+        // =================================================================
+        // DRIVE PHASE: Set DUT inputs for next cycle
+        // =================================================================
+
+        // RX input handling
+        if ((F & FEAT_LINK) && rx_link) {
+            // Linked instance: level delivered by UartLink
+            top->io_uart_rxd = link_rx;
+        } else if ((F & FEAT_TERMINAL) && rx_live) {
+            // Use UART terminal RX line
+            top->io_uart_rxd = uart_term.current_rx_line();
+
+            // Early exit when TX has been idle for a while after Ctrl-C
+            // This means "Goodbye!" message has finished transmitting
+            if (uart_term.sent_ctrl_c() &&
+                tx_idle_cycles > TX_IDLE_EXIT_THRESHOLD)
+                return finished = SIM_EVENT_INPUT_END;
+        } else {
+            // Loopback mode: connect TX output to RX input for self-test
+            // Use captured uart_txd for consistent loopback
+            top->io_uart_rxd = uart_txd;
+        }
+
+        // Final eval() to propagate input changes (RXD, memory responses)
+        // before the next clock edge. This settles combinational logic.
+        top->eval();
+        if (!top->clock)
+            store_count += top->io_retire_store_valid;
+
+        // Retirement trace: sampled settled before the rising edge that
+        // commits it, so each event is seen exactly once
+        if ((F & FEAT_TRACE) && retire_sink && !top->clock &&
+            (top->io_retire_reg_valid || top->io_retire_store_valid)) {
+            RetireInfo r;
+            r.reg_valid = top->io_retire_reg_valid;
+            r.reg_pc = top->io_retire_reg_pc;
+            r.reg_rd = top->io_retire_reg_rd;
+            r.reg_data = top->io_retire_reg_data;
+            r.store_valid = top->io_retire_store_valid;
+            r.store_address = top->io_retire_store_address;
+            r.store_data = top->io_retire_store_data;
+            r.store_strobe = top->io_retire_store_strobe;
+            if (!retire_sink->retire(r))
+                return finished = SIM_EVENT_STOPPED;
+        }
+
+        inst = fetch(top->io_instruction_address);
+        tick_count++;
+        return events;
+    }
+
+    template <uint32_t F>
+    uint32_t run_impl(uint64_t max_ticks, uint32_t stop_mask)
+    {
+        for (uint64_t i = 0; i < max_ticks; i++) {
+            uint32_t ev = tick_impl<F>();
+            if (ev & stop_mask)
+                return ev & stop_mask;
+        }
+        return SIM_EVENT_NONE;
+    }
+
+    // Dispatch tables indexed by features()
+    using TickFn = uint32_t (Simulator::*)();
+    using RunFn = uint32_t (Simulator::*)(uint64_t, uint32_t);
+    template <size_t... I>
+    static constexpr std::array<TickFn, sizeof...(I)> tick_table(
+        std::index_sequence<I...>)
+    {
+        return {&Simulator::tick_impl<I>...};
+    }
+    template <size_t... I>
+    static constexpr std::array<RunFn, sizeof...(I)> run_table(
+        std::index_sequence<I...>)
+    {
+        return {&Simulator::run_impl<I>...};
+    }
+
+public:
+    // Advance one half clock. Returns the events raised; a terminal event
+    // ends the tick early (like a `break` out of the original loop) and
+    // does not count it.
+    uint32_t tick()
+    {
+        static constexpr auto table =
+            tick_table(std::make_index_sequence<FEAT_ALL + 1>());
+        return (this->*table[features()])();
+    }
+
+    // Run at most `max_ticks` ticks. Stops early on a terminal event or on
+    // any event in `stop_mask`; returns the events that caused the stop
+    // (SIM_EVENT_NONE when the budget ran out).
+    uint32_t run(uint64_t max_ticks, uint32_t stop_mask = SIM_EVENT_NONE)
+    {
+        static constexpr auto table =
+            run_table(std::make_index_sequence<FEAT_ALL + 1>());
+        return (this->*table[features()])(max_ticks,
+                                          stop_mask | SIM_EVENT_TERMINAL);
+    }
+
+    // Always use the fully checked tick (FEAT_ALL); for benchmarking the
+    // specialization (bench_tick.cpp)
+    void set_specialized(bool en) { specialized = en; }
+
+    // Stop fetching and let in-flight work finish: io_instruction_valid low
+    // holds the PC (jumps still redirect it) and feeds NOPs. Done once the
+    // PC and main memory bus (including stores still draining from the
+    // store buffer) have been quiet for a while and the UART has sent its
+    // last stop bit. Returns false if that took over `max_cycles` or a
+    // terminal event occurred.
+    bool drain(uint64_t max_cycles = 20000)
+    {
+        static constexpr uint64_t QUIET_CYCLES = 16;
+        static constexpr uint64_t TX_IDLE_CYCLES = 2 * 434;  // Stop bits
+        uint64_t quiet = 0, tx_idle = 0;
+        uint32_t last_pc = pc();
+        bool ok = false;
+        top->io_instruction_valid = 0;
+        for (uint64_t i = 0; i < max_cycles; i++) {
+            if (run(2))
+                break;
+            bool busy = mem_read_pending || top->io_mem_slave_read ||
+                        top->io_mem_slave_write ||
+                        top->io_icache_refill_request || pc() != last_pc;
+            last_pc = pc();
+            quiet = busy ? 0 : quiet + 1;
+            tx_idle = (last_txd && uart_term.tx_is_idle()) ? tx_idle + 1 : 0;
+            if (quiet >= QUIET_CYCLES && tx_idle >= TX_IDLE_CYCLES) {
+                ok = true;
+                break;
+            }
+        }
+        top->io_instruction_valid = 1;
+        return ok;
+    }
+
+    // Restore the terminal and close the input recording
+    void finish()
+    {
+        uart_term.disable_raw_mode();
+        recorder.finish(tick_count >> 1);
+    }
+
+    // ---- Inspection ----------------------------------------------------
+
+    uint64_t ticks() const { return tick_count; }
+    uint64_t cycles() const { return tick_count >> 1; }
+    uint32_t finished_event() const { return finished; }
+    uint64_t frames() const { return vsync_count; }
+
+    // Outcome of the 0x100 handshake or HOSTCALL_OP_EXIT
+    bool test_failed() const { return failed; }
+    uint32_t test_result() const { return result; }
+    int host_exit_code() const { return exit_code; }
+
+    uint32_t pc() const { return top->io_instruction_address; }
+    bool uart_txd() const { return last_txd; }
+
+    // Data reads served from main memory, and stores started to any slave
+    uint64_t mem_reads() const { return mem_read_count; }
+    uint64_t stores() const { return store_count; }
+
+    // Whether UART input can still arrive (terminal, pending script events
+    // or a linked instance); otherwise a guest waiting for it waits forever
+    bool input_possible() const
+    {
+        return interactive || rx_link || script.active();
+    }
+
+    // Register file / CSR through the combinational debug read ports
+    uint32_t read_reg(uint32_t idx)
+    {
+        top->io_cpu_debug_read_address = idx & 0x1F;
+        top->eval();
+        return top->io_cpu_debug_read_data;
+    }
+
+    uint32_t read_csr(uint32_t csr)
+    {
+        top->io_cpu_csr_debug_read_address = csr & 0xFFF;
+        top->eval();
+        return top->io_cpu_csr_debug_read_data;
+    }
+
+    Memory &memory() { return mem; }
+    const Memory &memory() const { return mem; }
+    const MemoryTiming &mem_timing() const { return timing; }
+    UartTerminal &uart() { return uart_term; }
+    VTop &model() { return *top; }
+
+    void push_uart(const std::string &bytes) { uart_term.push_input(bytes); }
+
+    // Drain UART output collected with set_uart_capture(true)
+    std::string take_uart_output()
+    {
+        std::string s;
+        s.swap(uart_out);
+        return s;
+    }
+
+    // Last completed frame: FRAME_WIDTH x FRAME_HEIGHT RRGGBB bytes
+    const std::vector<uint8_t> &frame() const { return last_frame; }
+
+private:
+    static constexpr uint32_t RESET_VECTOR = 0x1000;
+
+    uint32_t fetch(uint32_t addr)
+    {
+        if (stub_active) {
+            uint32_t off = addr - stub_base;
+            if (stub_jumped && addr == stub_target)
+                stub_active = false;
+            else if (addr == RESET_VECTOR)
+                return jal_x0(stub_base - RESET_VECTOR);
+            else if (off < stub.size() * 4) {
+                stub_jumped |= off == (stub.size() - 1) * 4;
+                return stub[off >> 2];
+            }
+        }
+        return mem.read(addr);
+    }
+
+public:
+    // jal x0, offset (offset within +-1 MiB)
+    static uint32_t jal_x0(uint32_t offset)
+    {
+        return ((offset & 0x100000) << 11) | ((offset & 0x7FE) << 20) |
+               ((offset & 0x800) << 9) | (offset & 0xFF000) | 0x6F;
+    }
+};
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: MIT
+// UART Link - serial wires between Simulator instances on separate threads
+//
+// Node i's io_uart_txd drives node (i + 1) % N's io_uart_rxd, so two nodes
+// form a crossover cable and more form a ring. Each node runs on its own
+// thread in quanta of one UART bit time (434 CPU cycles), recording its TX
+// level every cycle. After a barrier, the receiver replays those samples
+// one quantum later. Every wire therefore has a fixed one-bit-time delay:
+// the 8N2 receivers tolerate it, threads never wait on each other inside a
+// quantum, and the result is identical regardless of host scheduling.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "simulator.h"
+
+class UartLink
+{
+public:
+    // Lookahead: one bit at 115200 baud / 50 MHz (see UartTerminal)
+    static constexpr uint32_t QUANTUM = 434;
+
+private:
+    size_t nodes;
+    // Double-buffered TX samples: [quantum parity][node][cycle in quantum]
+    std::vector<std::vector<uint8_t>> samples[2];
+
+    // Barrier; the last node to arrive decides whether everyone stops
+    std::mutex lock;
+    std::condition_variable cv;
+    size_t arrived = 0;
+    size_t arrived_done = 0;
+    uint64_t generation = 0;
+    bool stop = false;
+
+    bool sync(bool done)
+    {
+        std::unique_lock<std::mutex> g(lock);
+        arrived_done += done;
+        if (++arrived == nodes) {
+            stop = arrived_done == nodes;
+            arrived = arrived_done = 0;
+            generation++;
+            cv.notify_all();
+            return stop;
+        }
+        uint64_t gen = generation;
+        cv.wait(g, [&] { return generation != gen; });
+        // No node can start the next barrier until this one has left
+        return stop;
+    }
+
+public:
+    explicit UartLink(size_t n) : nodes(n)
+    {
+        for (auto &s : samples)
+            s.assign(n, std::vector<uint8_t>(QUANTUM, 1));  // Idle high
+    }
+
+    // Run `sim` as node `idx` until every node has finished or reached
+    // `max_ticks`. Must be called once per node, each on its own thread.
+    uint32_t run(size_t idx, Simulator &sim, uint64_t max_ticks)
+    {
+        sim.set_uart_link(true);
+        const size_t src = (idx + nodes - 1) % nodes;
+        uint32_t event = SIM_EVENT_NONE;
+
+        for (uint64_t q = 0;; q++) {
+            // Written by the source node during the previous quantum
+            const std::vector<uint8_t> &in = samples[(q + 1) & 1][src];
+            std::vector<uint8_t> &out = samples[q & 1][idx];
+            for (uint32_t t = 0; t < QUANTUM; t++) {
+                if (event || sim.ticks() >= max_ticks) {
+                    out[t] = 1;  // Finished nodes leave the line idle
+                    continue;
+                }
+                sim.drive_uart_rx(in[t]);
+                event = sim.run(2);
+                out[t] = sim.uart_txd();
+            }
+            if (sync(event || sim.ticks() >= max_ticks))
+                return event;
+        }
+    }
+};
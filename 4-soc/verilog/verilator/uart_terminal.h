@@ -0,0 +1,310 @@
+// SPDX-License-Identifier: MIT
+// UART Terminal - bit-level 8N2 serializer/deserializer for io_uart_*
+//
+// Decodes the CPU's TX line into characters and serializes queued bytes
+// (stdin, scripts, the embedding API) onto the RX line at 115200 baud.
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <queue>
+#include <string>
+
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+// UART terminal interface for interactive mode
+// Simulates 115200 baud, 8N2 (8 data bits, no parity, 2 stop bits)
+class UartTerminal
+{
+    // TX state machine (CPU -> Terminal)
+    enum class TxState { IDLE, START, DATA, STOP };
+    TxState tx_state = TxState::IDLE;
+    uint32_t tx_counter = 0;
+    uint8_t tx_bit_idx = 0;
+    uint8_t tx_data = 0;
+    bool tx_prev = true;
+
+    // RX state machine (Terminal -> CPU)
+    enum class RxState { IDLE, START, DATA, STOP };
+    RxState rx_state = RxState::IDLE;
+    uint32_t rx_counter = 0;
+    uint8_t rx_bit_idx = 0;
+    uint8_t rx_shift = 0;
+    std::queue<uint8_t> rx_fifo;
+
+    // Timing: cycles per bit at 50MHz / 115200 baud
+    // UART.scala: BIT_CNT = ((freq + baud/2) / baud - 1) = 433
+    // Hardware counts 433 to 0 (inclusive), so actual cycles per bit = 434
+    static constexpr uint32_t CYCLES_PER_BIT = 434;
+    static constexpr uint32_t HALF_BIT = CYCLES_PER_BIT / 2;
+
+    // Terminal settings
+    struct termios orig_termios{};
+    bool raw_mode = false;
+    bool is_tty = false;
+
+public:
+    ~UartTerminal()
+    {
+        if (raw_mode)
+            disable_raw_mode();
+    }
+
+    void enable_raw_mode()
+    {
+        if (raw_mode)
+            return;
+        is_tty = isatty(STDIN_FILENO);
+        // Set stdin to non-blocking
+        int flags = fcntl(STDIN_FILENO, F_GETFL, 0);
+        if (flags == -1) {
+            perror("fcntl F_GETFL");
+            return;
+        }
+        if (fcntl(STDIN_FILENO, F_SETFL, flags | O_NONBLOCK) == -1) {
+            perror("fcntl F_SETFL");
+            return;
+        }
+        // Configure raw mode only for TTY (skip for piped input)
+        if (is_tty) {
+            tcgetattr(STDIN_FILENO, &orig_termios);
+            struct termios raw = orig_termios;
+            // Input flags: disable CR-to-NL, NL-to-CR, ignore CR, flow control
+            raw.c_iflag &= ~(ICRNL | INLCR | IGNCR | IXON | IXOFF);
+            // Output flags: disable output processing (no NL-to-CRNL)
+            raw.c_oflag &= ~(OPOST);
+            // Local flags: disable echo, canonical mode, signals, extensions
+            raw.c_lflag &= ~(ECHO | ICANON | ISIG | IEXTEN);
+            raw.c_cc[VMIN] = 0;  // Non-blocking read
+            raw.c_cc[VTIME] = 0;
+            tcsetattr(STDIN_FILENO, TCSAFLUSH, &raw);
+        }
+        raw_mode = true;
+    }
+
+    void disable_raw_mode()
+    {
+        if (!raw_mode)
+            return;
+        if (is_tty)
+            tcsetattr(STDIN_FILENO, TCSAFLUSH, &orig_termios);
+        raw_mode = false;
+    }
+
+    // Poll stdin for input, queue bytes for transmission to CPU
+    // Returns the bytes read so the caller can record them
+    std::string poll_input()
+    {
+        std::string got;
+        char c;
+        while (read(STDIN_FILENO, &c, 1) == 1)
+            got += c;
+        push_input(got);
+        return got;
+    }
+
+    // Queue bytes for transmission to CPU (stdin or --input-script)
+    void push_input(const std::string &bytes)
+    {
+        for (char c : bytes) {
+            rx_fifo.push(static_cast<uint8_t>(c));
+            // Track Ctrl-C for early exit in terminal mode
+            if (c == 0x03)
+                ctrl_c_received = true;
+        }
+    }
+
+    // Idle both lines and drop queued input; settings are kept
+    void restart()
+    {
+        tx_state = TxState::IDLE;
+        tx_counter = 0;
+        tx_bit_idx = 0;
+        tx_data = 0;
+        tx_prev = true;
+        rx_state = RxState::IDLE;
+        rx_counter = 0;
+        rx_bit_idx = 0;
+        rx_shift = 0;
+        rx_fifo = {};
+        rx_line_value = true;
+        ctrl_c_received = false;
+        ctrl_c_in_flight = false;
+        ctrl_c_sent = false;
+    }
+
+    size_t rx_pending() const { return rx_fifo.size(); }
+    bool got_ctrl_c() const { return ctrl_c_received; }
+    bool sent_ctrl_c() const { return ctrl_c_sent; }
+    bool tx_is_idle() const { return tx_state == TxState::IDLE; }
+
+    // Get current RX line state without advancing state machine
+    bool current_rx_line() const { return rx_line_value; }
+
+    bool ctrl_c_received = false;   // Track Ctrl-C was queued
+    bool ctrl_c_in_flight = false;  // Track Ctrl-C is being serialized
+    bool ctrl_c_sent = false;       // Track Ctrl-C transmission complete
+
+    uint64_t debug_cycle = 0;  // Track cycle for debug
+    bool debug_enabled = false;
+    bool echo = true;  // Print received characters on stdout
+
+    void set_echo(bool en) { echo = en; }
+
+    void set_debug(bool en, uint64_t cyc)
+    {
+        debug_enabled = en;
+        debug_cycle = cyc;
+    }
+
+    // Process TX line from CPU (detect and print characters)
+    // Returns the completed character, or -1 if none finished this cycle
+    int process_tx(bool tx_line)
+    {
+        int done = -1;
+        // Detailed line tracing: log every transition and periodically during
+        // frame
+        if (debug_enabled && tx_state != TxState::IDLE) {
+            // Log transitions
+            if (tx_line != tx_prev) {
+                fprintf(
+                    stderr,
+                    "[%llu] TX_LINE: %d -> %d (state=%d, counter=%u, bit=%d)\n",
+                    (unsigned long long) debug_cycle, tx_prev ? 1 : 0,
+                    tx_line ? 1 : 0, (int) tx_state, tx_counter, tx_bit_idx);
+            }
+            // Log every 100 cycles during active transmission
+            if (tx_counter % 100 == 0 && tx_state == TxState::DATA) {
+                fprintf(
+                    stderr,
+                    "[%llu] TX_SAMPLE: line=%d counter=%u bit=%d data=0x%02x\n",
+                    (unsigned long long) debug_cycle, tx_line ? 1 : 0,
+                    tx_counter, tx_bit_idx, tx_data);
+            }
+        }
+
+        switch (tx_state) {
+        case TxState::IDLE:
+            // Detect falling edge (start bit)
+            if (tx_prev && !tx_line) {
+                tx_state = TxState::START;
+                tx_counter = HALF_BIT;  // Sample at middle of start bit
+                tx_data = 0;
+                tx_bit_idx = 0;
+                if (debug_enabled)
+                    fprintf(stderr, "[%llu] TX: Start bit detected\n",
+                            (unsigned long long) debug_cycle);
+            }
+            break;
+
+        case TxState::START:
+            if (++tx_counter >= CYCLES_PER_BIT) {
+                // Verify start bit is still low
+                if (!tx_line) {
+                    tx_state = TxState::DATA;
+                    tx_counter = 0;
+                } else {
+                    tx_state = TxState::IDLE;  // False start
+                }
+            }
+            break;
+
+        case TxState::DATA:
+            if (++tx_counter >= CYCLES_PER_BIT) {
+                tx_counter = 0;
+                // Sample data bit (LSB first)
+                tx_data |= (tx_line ? 1 : 0) << tx_bit_idx;
+                if (debug_enabled)
+                    fprintf(stderr,
+                            "[%llu] TX: bit %d = %d, data so far = 0x%02x\n",
+                            (unsigned long long) debug_cycle, tx_bit_idx,
+                            tx_line ? 1 : 0, tx_data);
+                if (++tx_bit_idx >= 8)
+                    tx_state = TxState::STOP;
+            }
+            break;
+
+        case TxState::STOP:
+            if (++tx_counter >=
+                CYCLES_PER_BIT * 2) {  // 2 stop bits (8N2 format)
+                if (debug_enabled)
+                    fprintf(stderr, "[%llu] TX: Received char 0x%02x '%c'\n",
+                            (unsigned long long) debug_cycle, tx_data,
+                            (tx_data >= 32 && tx_data < 127) ? tx_data : '.');
+                if (echo) {
+                    putchar(tx_data);
+                    fflush(stdout);
+                }
+                done = tx_data;
+                tx_state = TxState::IDLE;
+            }
+            break;
+        }
+        tx_prev = tx_line;
+        return done;
+    }
+
+    bool rx_line_value = true;  // Current RX line value (cached)
+
+    // Generate RX line to CPU (serialize queued bytes)
+    // Returns the line value and updates rx_line_value cache
+    bool get_rx_line()
+    {
+        switch (rx_state) {
+        case RxState::IDLE:
+            if (!rx_fifo.empty()) {
+                rx_shift = rx_fifo.front();
+                rx_fifo.pop();
+                rx_state = RxState::START;
+                rx_counter = 0;
+                rx_bit_idx = 0;
+                rx_line_value = false;  // Start bit (low)
+                // Track when Ctrl-C starts transmitting to CPU
+                if (rx_shift == 0x03 && ctrl_c_received)
+                    ctrl_c_in_flight = true;
+                return rx_line_value;
+            }
+            rx_line_value = true;  // Idle (high)
+            return rx_line_value;
+
+        case RxState::START:
+            rx_line_value = false;  // Start bit is always low
+            if (++rx_counter >= CYCLES_PER_BIT) {
+                rx_counter = 0;
+                rx_state = RxState::DATA;
+            }
+            return false;  // Start bit
+
+        case RxState::DATA: {
+            // Capture current bit BEFORE any state changes (LSB first)
+            bool bit = (rx_shift >> rx_bit_idx) & 1;
+            rx_line_value = bit;  // Cache for between-edge reads
+            if (++rx_counter >= CYCLES_PER_BIT) {
+                rx_counter = 0;
+                if (++rx_bit_idx >= 8) {
+                    rx_state = RxState::STOP;
+                    // Don't change rx_line_value here - keep returning current
+                    // bit until next get_rx_line() call
+                }
+            }
+            return bit;
+        }
+
+        case RxState::STOP:
+            rx_line_value = true;                      // Stop bits (high)
+            if (++rx_counter >= CYCLES_PER_BIT * 2) {  // 2 stop bits
+                rx_state = RxState::IDLE;
+                // Mark Ctrl-C as fully sent when its transmission completes
+                if (ctrl_c_in_flight) {
+                    ctrl_c_sent = true;
+                    ctrl_c_in_flight = false;
+                }
+            }
+            return rx_line_value;
+        }
+        return true;
+    }
+};
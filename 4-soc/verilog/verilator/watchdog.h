@@ -0,0 +1,174 @@
+// SPDX-License-Identifier: MIT
+// Watchdog - ends runs whose guest has stopped making progress
+//
+// check() is called between run() chunks. Each call hashes the PC, x1-x31
+// (read through the debug port) and the store count into one sample. The
+// samples are grouped into windows of `window` CPU cycles. A window with at
+// most MAX_STATES distinct hashes that the next window repeats exactly
+// means the guest cycles through the same few states. Because the store
+// count is part of the hash, nothing was written in the meantime, not even
+// a UART character.
+//
+// The window's activity then tells the cases apart:
+//   HALTED    a sampled PC holds wfi (the harness never raises interrupts)
+//   LIVELOCK  main memory reads (spinning on RAM that nothing else writes),
+//             or no loads at all (a register-only loop)
+//   IDLE      memory stall cycles (mhpmcounter5) without main memory reads:
+//             the loop polls a peripheral, e.g. waiting for UART input
+// LIVELOCK is a guest bug and always ends the run as a failure. IDLE and
+// HALTED are legitimate; the caller ends the run only when no input can
+// arrive anymore (Simulator::input_possible()). A loop that polls a device
+// and reads RAM in the same iteration is classed as LIVELOCK.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "simulator.h"
+
+class Watchdog
+{
+public:
+    enum Verdict : uint32_t {
+        OK = 0,
+        LIVELOCK,
+        IDLE,
+        HALTED,
+    };
+
+    static constexpr size_t MAX_STATES = 16;
+    static constexpr uint64_t DEFAULT_WINDOW = 2000000;  // > 1 VGA frame
+
+private:
+    static constexpr uint32_t CSR_MEM_STALL = 0xB05;  // mhpmcounter5
+    static constexpr uint32_t WFI = 0x10500073;
+
+    uint64_t window;
+    uint64_t window_start = 0;  // CPU cycle
+    std::vector<uint64_t> cur, prev;
+    std::vector<uint32_t> pcs;  // Sampled PCs in the current window
+    uint64_t reads_start = 0;
+    uint32_t stall_start = 0;
+    bool primed = false;
+
+    // Last window's figures, for the report
+    Verdict verdict = OK;
+    uint64_t at_cycle = 0, reads = 0;
+    uint32_t stalls = 0;
+    std::vector<uint32_t> last_pcs;
+    uint32_t regs[32] = {0};
+
+    static uint64_t mix(uint64_t h, uint64_t v)
+    {
+        // FNV-1a over 64-bit words, finished with a multiply-xorshift
+        h = (h ^ v) * 0x100000001B3ull;
+        return h ^ (h >> 29);
+    }
+
+    static void unique(std::vector<uint64_t> &v)
+    {
+        std::sort(v.begin(), v.end());
+        v.erase(std::unique(v.begin(), v.end()), v.end());
+    }
+
+    void start_window(Simulator &sim, uint64_t now)
+    {
+        window_start = now;
+        reads_start = sim.mem_reads();
+        stall_start = sim.read_csr(CSR_MEM_STALL);
+        cur.clear();
+        pcs.clear();
+    }
+
+    Verdict classify(const Simulator &sim) const
+    {
+        for (uint32_t pc : last_pcs)
+            if (sim.memory().read(pc) == WFI)
+                return HALTED;
+        if (reads || !stalls)
+            return LIVELOCK;
+        return IDLE;
+    }
+
+public:
+    explicit Watchdog(uint64_t window_cycles = DEFAULT_WINDOW)
+        : window(window_cycles)
+    {
+    }
+
+    // Sample `sim`; returns the verdict once a window has repeated, and OK
+    // while the guest is making progress
+    Verdict check(Simulator &sim)
+    {
+        const uint64_t now = sim.cycles();
+        if (!primed) {
+            start_window(sim, now);
+            primed = true;
+        }
+
+        uint64_t h = mix(0xCBF29CE484222325ull, sim.pc());
+        for (uint32_t r = 1; r < 32; r++) {
+            regs[r] = sim.read_reg(r);
+            h = mix(h, regs[r]);
+        }
+        h = mix(h, sim.stores());
+        cur.push_back(h);
+        pcs.push_back(sim.pc());
+
+        if (now - window_start < window)
+            return OK;
+
+        unique(cur);
+        const bool repeats = cur.size() <= MAX_STATES && cur == prev;
+        reads = sim.mem_reads() - reads_start;
+        stalls = sim.read_csr(CSR_MEM_STALL) - stall_start;
+        last_pcs = pcs;
+        prev.swap(cur);
+        start_window(sim, now);
+        if (!repeats)
+            return OK;
+
+        std::sort(last_pcs.begin(), last_pcs.end());
+        last_pcs.erase(std::unique(last_pcs.begin(), last_pcs.end()),
+                       last_pcs.end());
+        at_cycle = now;
+        return verdict = classify(sim);
+    }
+
+    static const char *name(Verdict v)
+    {
+        switch (v) {
+        case LIVELOCK:
+            return "livelock";
+        case IDLE:
+            return "idle (polling a device, no input can arrive)";
+        case HALTED:
+            return "halted in wfi";
+        default:
+            return "ok";
+        }
+    }
+
+    void print_report() const
+    {
+        printf("\nWATCHDOG: %s at cycle %llu\n", name(verdict),
+               (unsigned long long) at_cycle);
+        printf("  %zu states repeated for %llu cycles without a store\n",
+               prev.size(), (unsigned long long) (2 * window));
+        printf("  Last window: %llu main memory reads, %u memory stall "
+               "cycles\n",
+               (unsigned long long) reads, stalls);
+        printf("  PCs:");
+        for (size_t i = 0; i < last_pcs.size(); i++)
+            printf("%s 0x%08x", (i && !(i % 6)) ? "\n      " : "",
+                   last_pcs[i]);
+        printf("\n");
+        for (uint32_t r = 1; r < 32; r++)
+            printf("  x%-2u=0x%08x%s", r, regs[r], (r % 4 == 3) ? "\n" : "");
+        printf("\n");
+        fflush(stdout);
+    }
+};